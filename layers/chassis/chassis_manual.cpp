@@ -22,6 +22,7 @@
 
 #include <cstring>
 
+#include "chassis/device_hook.h"
 #include "chassis/dispatch_object.h"
 #include "generated/dispatch_vector.h"
 #include "chassis/validation_object.h"
@@ -498,6 +499,8 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     }
 
     auto instance_dispatch = vvl::dispatch::GetData(device_dispatch->physical_device);
+    // Everything logged for this device is delivered before the call returns, even with async_message_delivery
+    instance_dispatch->debug_report->FlushMessages();
     instance_dispatch->debug_report->device_created--;
 
     vvl::dispatch::FreeData(key, device);
@@ -825,8 +828,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
             if (!vo) {
                 continue;
             }
-            auto lock = vo->ReadLock();
-            skip |= vo->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, error_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, ReadLock)();
+            skip |= VVL_DEVICE_HOOK(vo, PreCallValidateCreatePipelineLayout)(device, pCreateInfo, pAllocator, pPipelineLayout,
+                                                                             error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
     }
@@ -859,8 +863,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
-            vo->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, WriteLock)();
+            VVL_DEVICE_HOOK(vo, PostCallRecordCreatePipelineLayout)(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj);
         }
     }
     return result;
@@ -878,8 +882,8 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
             if (!vo) {
                 continue;
             }
-            auto lock = vo->ReadLock();
-            skip |= vo->PreCallValidateGetShaderBinaryDataEXT(device, shader, pDataSize, pData, error_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, ReadLock)();
+            skip |= VVL_DEVICE_HOOK(vo, PreCallValidateGetShaderBinaryDataEXT)(device, shader, pDataSize, pData, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
     }
@@ -909,8 +913,8 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
-            vo->PostCallRecordGetShaderBinaryDataEXT(device, shader, pDataSize, pData, record_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, WriteLock)();
+            VVL_DEVICE_HOOK(vo, PostCallRecordGetShaderBinaryDataEXT)(device, shader, pDataSize, pData, record_obj);
         }
     }
     return result;
@@ -1070,8 +1074,8 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkD
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
-            vo->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, WriteLock)();
+            VVL_DEVICE_HOOK(vo, PreCallRecordAllocateDescriptorSets)(device, pAllocateInfo, pDescriptorSets, record_obj);
         }
     }
 
@@ -1110,8 +1114,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
             if (!vo) {
                 continue;
             }
-            auto lock = vo->ReadLock();
-            skip |= vo->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, error_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, ReadLock)();
+            skip |= VVL_DEVICE_HOOK(vo, PreCallValidateCreateBuffer)(device, pCreateInfo, pAllocator, pBuffer, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
     }
@@ -1144,9 +1148,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
+            auto lock = VVL_DEVICE_HOOK(vo, WriteLock)();
             // If we don't pass into PostCallRecord, CoreCheck may give false positives when using GPU-AV
-            vo->PostCallRecordCreateBuffer(device, chassis_state.create_info_copy, pAllocator, pBuffer, record_obj);
+            VVL_DEVICE_HOOK(vo, PostCallRecordCreateBuffer)(device, chassis_state.create_info_copy, pAllocator, pBuffer,
+                                                            record_obj);
         }
     }
     return result;
@@ -1165,8 +1170,8 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
             if (!vo) {
                 continue;
             }
-            auto lock = vo->ReadLock();
-            skip |= vo->PreCallValidateQueuePresentKHR(queue, pPresentInfo, error_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, ReadLock)();
+            skip |= VVL_DEVICE_HOOK(vo, PreCallValidateQueuePresentKHR)(queue, pPresentInfo, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
     }
@@ -1177,8 +1182,8 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
-            vo->PreCallRecordQueuePresentKHR(queue, pPresentInfo, record_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, WriteLock)();
+            VVL_DEVICE_HOOK(vo, PreCallRecordQueuePresentKHR)(queue, pPresentInfo, record_obj);
         }
     }
 
@@ -1208,12 +1213,12 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
+            auto lock = VVL_DEVICE_HOOK(vo, WriteLock)();
 
             if (result == VK_ERROR_DEVICE_LOST) {
                 vo->is_device_lost = true;
             }
-            vo->PostCallRecordQueuePresentKHR(queue, pPresentInfo, record_obj);
+            VVL_DEVICE_HOOK(vo, PostCallRecordQueuePresentKHR)(queue, pPresentInfo, record_obj);
         }
     }
     return result;
@@ -1235,8 +1240,8 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
             if (!vo) {
                 continue;
             }
-            auto lock = vo->ReadLock();
-            skip |= vo->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo, error_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, ReadLock)();
+            skip |= VVL_DEVICE_HOOK(vo, PreCallValidateBeginCommandBuffer)(commandBuffer, pBeginInfo, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
     }
@@ -1248,8 +1253,8 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
-            vo->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, WriteLock)();
+            VVL_DEVICE_HOOK(vo, PreCallRecordBeginCommandBuffer)(commandBuffer, pBeginInfo, record_obj);
         }
     }
 
@@ -1266,8 +1271,8 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
-            vo->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, WriteLock)();
+            VVL_DEVICE_HOOK(vo, PostCallRecordBeginCommandBuffer)(commandBuffer, pBeginInfo, record_obj);
         }
     }
     return result;
@@ -1396,8 +1401,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
             if (!vo) {
                 continue;
             }
-            auto lock = vo->ReadLock();
-            skip |= vo->PreCallValidateCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, error_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, CommandBufferReadLock)();
+            skip |= VVL_DEVICE_HOOK(vo, PreCallValidateCmdBindDescriptorBuffersEXT)(commandBuffer, bufferCount, pBindingInfos,
+                                                                                    error_obj);
             if (skip) return;
         }
     }
@@ -1411,7 +1417,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
+            auto lock = vo->CommandBufferWriteLock();
             vo->PreCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, record_obj, chassis_state);
         }
     }
@@ -1428,8 +1434,9 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
             if (!vo) {
                 continue;
             }
-            auto lock = vo->WriteLock();
-            vo->PostCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, modified_count, chassis_state.pBindInfos, record_obj);
+            auto lock = VVL_DEVICE_HOOK(vo, CommandBufferWriteLock)();
+            VVL_DEVICE_HOOK(vo, PostCallRecordCmdBindDescriptorBuffersEXT)(commandBuffer, modified_count, chassis_state.pBindInfos,
+                                                                           record_obj);
         }
     }
 }
@@ -44,6 +44,8 @@ struct CreateShaderModule {
     // creation time where the rest of the information is needed to do the remaining SPIR-V validation.
     std::shared_ptr<spirv::Module> module_state = nullptr;  // contains SPIR-V to validate
     spirv::StatelessData stateless_data;
+    // Non-zero if spirv::ModuleCache is in use, so the result of the checks can be remembered
+    uint64_t module_cache_hash = 0;
 };
 
 struct ShaderObjectInstrumentationData {
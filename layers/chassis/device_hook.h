@@ -0,0 +1,89 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include "chassis/validation_object.h"
+#include "thread_tracker/thread_safety_validation.h"
+#include "stateless/stateless_validation.h"
+#include "generated/legacy.h"
+#include "object_tracker/object_lifetime_validation.h"
+#include "state_tracker/state_tracker.h"
+#include "core_checks/core_validation.h"
+#include "best_practices/best_practices_validation.h"
+#include "gpuav/core/gpuav.h"
+#include "sync/sync_validation.h"
+
+namespace vvl::dispatch {
+
+// The intercept vectors already only hold the validation objects overriding a hook, but every call still goes through the
+// vtable, which the compiler can neither inline nor predict well when 5+ objects take turns for each API call.
+//
+// Each container_type is always created with the same concrete class (see Device::InitValidationObjects), so switching on it
+// and calling the hook qualified with that class is a direct call. Anything else falls back to the virtual call.
+template <typename Hook>
+struct DeviceHookCall {
+    base::Device* vo;
+    Hook hook;
+
+    template <typename... Args>
+    decltype(auto) operator()(Args&&... args) const {
+        switch (vo->container_type) {
+            case LayerObjectTypeThreading:
+                return hook(static_cast<threadsafety::Device*>(vo), std::forward<Args>(args)...);
+            case LayerObjectTypeParameterValidation:
+                return hook(static_cast<stateless::Device*>(vo), std::forward<Args>(args)...);
+            case LayerObjectTypeLegacy:
+                return hook(static_cast<legacy::Device*>(vo), std::forward<Args>(args)...);
+            case LayerObjectTypeObjectTracker:
+                return hook(static_cast<object_lifetimes::Device*>(vo), std::forward<Args>(args)...);
+            case LayerObjectTypeStateTracker:
+                return hook(static_cast<vvl::DeviceState*>(vo), std::forward<Args>(args)...);
+            case LayerObjectTypeCoreValidation:
+                return hook(static_cast<CoreChecks*>(vo), std::forward<Args>(args)...);
+            case LayerObjectTypeBestPractices:
+                return hook(static_cast<BestPractices*>(vo), std::forward<Args>(args)...);
+            case LayerObjectTypeGpuAssisted:
+                return hook(static_cast<gpuav::Validator*>(vo), std::forward<Args>(args)...);
+            case LayerObjectTypeSyncValidation:
+                return hook(static_cast<syncval::SyncValidator*>(vo), std::forward<Args>(args)...);
+            default:
+                return hook(vo, std::forward<Args>(args)...);
+        }
+    }
+};
+
+template <typename Hook>
+DeviceHookCall(base::Device*, Hook) -> DeviceHookCall<Hook>;
+
+}  // namespace vvl::dispatch
+
+// VVL_DEVICE_HOOK(vo, PreCallValidateFoo)(args...) is vo->PreCallValidateFoo(args...) without the virtual call.
+// The arguments are forwarded by the call operator rather than captured, older GCC fails on packs captured by nested lambdas.
+#define VVL_DEVICE_HOOK(vo, name)                                                              \
+    vvl::dispatch::DeviceHookCall {                                                            \
+        (vo), [](auto* object, auto&&... args) -> decltype(auto) {                             \
+            using ObjectType = std::remove_pointer_t<decltype(object)>;                        \
+            if constexpr (std::is_same_v<ObjectType, vvl::base::Device>) {                     \
+                return object->name(std::forward<decltype(args)>(args)...);                    \
+            } else {                                                                           \
+                return object->ObjectType::name(std::forward<decltype(args)>(args)...);        \
+            }                                                                                  \
+        }                                                                                      \
+    }
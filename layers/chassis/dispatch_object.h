@@ -21,6 +21,8 @@
 
 #pragma once
 #include <atomic>
+#include <mutex>
+#include <vector>
 
 #include <vulkan/vulkan.h>
 #include <vulkan/vk_enum_string_helper.h>
@@ -28,6 +30,7 @@
 
 #include "error_message/logging.h"
 #include "containers/custom_containers.h"
+#include "containers/slot_table.h"
 #include "layer_options.h"
 #include "gpuav/core/gpuav_settings.h"
 #include "sync/sync_settings.h"
@@ -178,6 +181,48 @@ struct Settings {
     ValidationEnabled enabled = {};
 };
 
+// Hands out the ids of wrapped handles.
+// A slotted id is [0:1][generation:39][slot:24]. Slots of erased handles are reused with the next generation. This keeps the slots
+// dense so they can index an array (see vvl::slot_table), while the generation keeps a stale handle from matching the object that
+// reused its slot, until the slot was reused 2^39 times. Generation 0 is never given to a slot.
+// Once every slot is in use, ids are [1:1][hash:23][counter:40], the hash bits are added by HashedUint64 for unique_id_mapping.
+//
+// Freed ids are kept in a small per thread cache, so creating and destroying handles only takes the lock once per batch.
+class HandleSlotAllocator {
+  public:
+    static constexpr uint32_t kSlotBits = 24;
+    static constexpr uint32_t kGenerationBits = 39;
+    static constexpr uint32_t kMaxSlots = 1u << kSlotBits;
+    static constexpr uint64_t kUnslottedBit = 1ULL << 63;
+
+    static uint32_t Slot(uint64_t id) { return static_cast<uint32_t>(id) & (kMaxSlots - 1); }
+    static uint64_t Generation(uint64_t id) { return (id >> kSlotBits) & ((1ULL << kGenerationBits) - 1); }
+    // False for ids that were not given a slot of their own
+    static bool HasSlot(uint64_t id) { return (id & kUnslottedBit) == 0; }
+
+    uint64_t Allocate();
+    void Free(uint64_t id);
+
+  private:
+    static constexpr size_t kThreadCacheSize = 256;
+    struct ThreadCache {
+        HandleSlotAllocator* owner = nullptr;
+        std::vector<uint64_t> ids;  // last id handed out for each free slot
+        ~ThreadCache();
+    };
+    static thread_local ThreadCache thread_cache_;
+
+    static uint64_t NextGeneration(uint64_t id) {
+        const uint64_t generation = Generation(id) + 1;
+        return ((generation == (1ULL << kGenerationBits) ? 1 : generation) << kSlotBits) | Slot(id);
+    }
+
+    std::atomic<uint32_t> next_slot_{0};
+    std::atomic<uint64_t> next_unslotted_id_{1};
+    std::mutex lock_;        // guards free_ids_
+    std::vector<uint64_t> free_ids_;
+};
+
 class HandleWrapper : public Logger {
   public:
     HandleWrapper(DebugReport* dr);
@@ -187,25 +232,36 @@ class HandleWrapper : public Logger {
     template <typename HandleType>
     HandleType Unwrap(HandleType wrapped_handle) {
         if (wrapped_handle == (HandleType)VK_NULL_HANDLE) return wrapped_handle;
-        auto iter = unique_id_mapping.find(CastToUint64(wrapped_handle));
-        if (iter == unique_id_mapping.end()) return (HandleType)0;
-        return (HandleType)iter->second;
+        return Find(wrapped_handle);
     }
 
     // Wrap a newly created handle with a new unique ID, and return the new ID.
     template <typename HandleType>
     HandleType WrapNew(HandleType new_created_handle) {
         if (new_created_handle == (HandleType)VK_NULL_HANDLE) return new_created_handle;
-        auto unique_id = global_unique_id++;
-        unique_id = HashedUint64::hash(unique_id);
+        const uint64_t unique_id = handle_slots.Allocate();
         assert(unique_id != 0);  // can't be 0, otherwise unwrap will apply special rule for VK_NULL_HANDLE
-        unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
+        if (HandleSlotAllocator::HasSlot(unique_id)) {
+            const bool inserted =
+                handle_table.insert(HandleSlotAllocator::Slot(unique_id), unique_id, CastToUint64(new_created_handle));
+            assert(inserted);  // the slot was free in the allocator
+            (void)inserted;
+        } else {
+            unique_id_mapping.insert_or_assign(unique_id, CastToUint64(new_created_handle));
+        }
         return (HandleType)unique_id;
     }
 
     template <typename HandleType>
     HandleType Find(HandleType wrapped_handle) const {
         uint64_t id = CastToUint64(wrapped_handle);
+        if (HandleSlotAllocator::HasSlot(id)) {
+            uint64_t handle = 0;
+            if (handle_table.find(HandleSlotAllocator::Slot(id), id, handle)) {
+                return CastFromUint64<HandleType>(handle);
+            }
+            return CastFromUint<HandleType>(0ULL);
+        }
         auto iter = unique_id_mapping.find(id);
         if (iter != unique_id_mapping.end()) {
             return CastFromUint64<HandleType>(iter->second);
@@ -217,6 +273,14 @@ class HandleWrapper : public Logger {
     template <typename HandleType>
     HandleType Erase(HandleType wrapped_handle) {
         uint64_t id = CastToUint64(wrapped_handle);
+        if (HandleSlotAllocator::HasSlot(id)) {
+            uint64_t handle = 0;
+            if (handle_table.erase(HandleSlotAllocator::Slot(id), id, handle)) {
+                handle_slots.Free(id);
+                return CastFromUint64<HandleType>(handle);
+            }
+            return CastFromUint<HandleType>(0ULL);
+        }
         auto iter = unique_id_mapping.pop(id);
         if (iter != unique_id_mapping.end()) {
             return CastFromUint64<HandleType>(iter->second);
@@ -227,7 +291,10 @@ class HandleWrapper : public Logger {
 
     void UnwrapPnextChainHandles(const void* pNext);
 
-    static std::atomic<uint64_t> global_unique_id;
+    static HandleSlotAllocator handle_slots;
+    // Wrapped handles with a slot, unwrapping them is wait-free
+    static vvl::slot_table<uint64_t, HandleSlotAllocator::kSlotBits> handle_table;
+    // Wrapped handles handed out once every slot was in use
     static vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
     static bool wrap_handles;
 };
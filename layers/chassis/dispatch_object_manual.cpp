@@ -24,6 +24,7 @@
 #include "generated/dispatch_functions.h"
 #include "utils/dispatch_utils.h"
 
+#include <algorithm>
 #include <atomic>
 
 #define OBJECT_LAYER_DESCRIPTION "khronos_validation"
@@ -569,10 +570,62 @@ namespace dispatch {
 
 static std::shared_mutex dispatch_lock;
 
-std::atomic<uint64_t> HandleWrapper::global_unique_id{1};
+HandleSlotAllocator HandleWrapper::handle_slots;
+vvl::slot_table<uint64_t, HandleSlotAllocator::kSlotBits> HandleWrapper::handle_table;
 vvl::concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> HandleWrapper::unique_id_mapping;
 bool HandleWrapper::wrap_handles{true};
 
+thread_local HandleSlotAllocator::ThreadCache HandleSlotAllocator::thread_cache_;
+
+HandleSlotAllocator::ThreadCache::~ThreadCache() {
+    if (owner && !ids.empty()) {
+        std::lock_guard<std::mutex> guard(owner->lock_);
+        owner->free_ids_.insert(owner->free_ids_.end(), ids.begin(), ids.end());
+    }
+}
+
+uint64_t HandleSlotAllocator::Allocate() {
+    ThreadCache &cache = thread_cache_;
+    assert(!cache.owner || cache.owner == this);  // there is a single allocator, HandleWrapper::handle_slots
+    cache.owner = this;
+    if (cache.ids.empty()) {
+        std::lock_guard<std::mutex> guard(lock_);
+        const size_t count = std::min(free_ids_.size(), kThreadCacheSize / 2);
+        cache.ids.insert(cache.ids.end(), free_ids_.end() - count, free_ids_.end());
+        free_ids_.resize(free_ids_.size() - count);
+    }
+    if (!cache.ids.empty()) {
+        const uint64_t id = cache.ids.back();
+        cache.ids.pop_back();
+        return NextGeneration(id);
+    }
+
+    const uint32_t slot = next_slot_.fetch_add(1, std::memory_order_relaxed);
+    if (slot < kMaxSlots) {
+        return NextGeneration(slot);
+    }
+    next_slot_.store(kMaxSlots, std::memory_order_relaxed);  // keep it from wrapping around
+    // Millions of live wrapped handles, the rest can only be looked up by hashing
+    const uint64_t counter = next_unslotted_id_.fetch_add(1, std::memory_order_relaxed) & ((1ULL << 40) - 1);
+    return HashedUint64::hash(counter) | kUnslottedBit;
+}
+
+void HandleSlotAllocator::Free(uint64_t id) {
+    if (!HasSlot(id)) {
+        return;
+    }
+    ThreadCache &cache = thread_cache_;
+    assert(!cache.owner || cache.owner == this);
+    cache.owner = this;
+    cache.ids.push_back(id);
+    if (cache.ids.size() >= kThreadCacheSize) {
+        // Give half back, so a thread that only destroys handles does not keep all the free slots
+        std::lock_guard<std::mutex> guard(lock_);
+        free_ids_.insert(free_ids_.end(), cache.ids.begin() + kThreadCacheSize / 2, cache.ids.end());
+        cache.ids.resize(kThreadCacheSize / 2);
+    }
+}
+
 // Must be defined before device_data
 static ASHostGeomCacheInitializer as_host_geom_cache_initializer;
 
@@ -202,6 +202,12 @@ class Device : public Logger {
     virtual ReadLockGuard ReadLock() const { return ReadLockGuard(validation_object_mutex); }
     virtual WriteLockGuard WriteLock() { return WriteLockGuard(validation_object_mutex); }
 
+    // Used instead of ReadLock()/WriteLock() around vkCmd* calls. Those only modify the command buffer being recorded,
+    // which the application must externally synchronize, so objects that keep their command buffer state under the
+    // command buffer's own lock can skip the device-wide lock and let threads record in parallel.
+    virtual ReadLockGuard CommandBufferReadLock() const { return ReadLock(); }
+    virtual WriteLockGuard CommandBufferWriteLock() { return WriteLock(); }
+
     // Should be used instead of WriteLock() if the Record phase wants to release
     // its lock during the blocking operation.
     struct BlockingOperationGuard {
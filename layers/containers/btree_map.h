@@ -0,0 +1,670 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace vvl {
+
+// btree_map
+//
+// Ordered unique-key map stored in a B+tree. Provides the subset of the std::map interface used by
+// sparse_container::range_map, so it can be used as its ImplMap.
+//
+// The keys live in leaves of a few cache lines that are linked in key order, so a lookup touches O(log n)
+// compact nodes (searched linearly) and in-order traversal walks contiguous memory instead of chasing
+// red-black tree nodes. The leaves hold pointers to the elements, so splitting and merging leaves never
+// moves an element. The elements are allocated from chunks owned by the map (see ElementPool), which keeps
+// elements inserted together close in memory and avoids a call to the global allocator per insert.
+//
+// Differences from std::map:
+// - References and pointers to elements stay valid until the element is erased, as with std::map.
+// - Iterators stay valid until the element they point to is erased, as with std::map. An iterator keeps a
+//   pointer to its element and looks up its leaf position again if the map was modified since the iterator
+//   was last moved.
+// - On erase, a leaf is merged into its left neighbor when both fit into one leaf; inner nodes are only
+//   removed when empty.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class btree_map {
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<const Key, T>;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+
+  private:
+    static constexpr size_t kNodeBytes = 256;
+    static constexpr uint32_t kLeafSlots =
+        static_cast<uint32_t>(std::max<size_t>(4, kNodeBytes / (sizeof(Key) + sizeof(value_type *))));
+    static constexpr uint32_t kInnerKeys =
+        static_cast<uint32_t>(std::max<size_t>(3, kNodeBytes / (sizeof(Key) + sizeof(void *))));
+
+    struct InnerNode;
+
+    // Allocates elements from chunks of growing size and reuses the slots of erased elements. Elements never
+    // move, the chunks are only released when the map is cleared or destroyed.
+    class ElementPool {
+      public:
+        ElementPool() = default;
+        ElementPool(const ElementPool &) = delete;
+        ElementPool &operator=(const ElementPool &) = delete;
+        ~ElementPool() { Release(); }
+
+        template <typename Value>
+        value_type *Create(Value &&value) {
+            return new (Allocate()->storage) value_type(std::forward<Value>(value));
+        }
+
+        void Destroy(value_type *element) {
+            element->~value_type();
+            Free(reinterpret_cast<Slot *>(element));
+        }
+
+        // All elements must have been destroyed
+        void Release() {
+            while (chunks_) {
+                Slot *chunk = chunks_;
+                chunks_ = chunk->next;
+                delete[] chunk;
+            }
+            free_ = unused_ = unused_end_ = nullptr;
+            last_chunk_slots_ = 0;
+        }
+
+        void swap(ElementPool &other) noexcept {
+            std::swap(chunks_, other.chunks_);
+            std::swap(free_, other.free_);
+            std::swap(unused_, other.unused_);
+            std::swap(unused_end_, other.unused_end_);
+            std::swap(last_chunk_slots_, other.last_chunk_slots_);
+        }
+
+      private:
+        // Small maps are common, so the first chunks are small
+        static constexpr uint32_t kFirstChunkSlots = 4;
+        static constexpr uint32_t kMaxChunkSlots = 256;
+
+        // A free slot links to the next free slot. Slot 0 of each chunk links to the previously allocated chunk.
+        union Slot {
+            Slot *next;
+            alignas(value_type) unsigned char storage[sizeof(value_type)];
+        };
+
+        Slot *Allocate() {
+            if (free_) {
+                Slot *slot = free_;
+                free_ = slot->next;
+                return slot;
+            }
+            if (unused_ == unused_end_) {
+                last_chunk_slots_ = last_chunk_slots_ ? std::min(last_chunk_slots_ * 2, kMaxChunkSlots) : kFirstChunkSlots;
+                Slot *chunk = new Slot[last_chunk_slots_ + 1];
+                chunk->next = chunks_;
+                chunks_ = chunk;
+                unused_ = chunk + 1;
+                unused_end_ = unused_ + last_chunk_slots_;
+            }
+            return unused_++;
+        }
+
+        void Free(Slot *slot) {
+            slot->next = free_;
+            free_ = slot;
+        }
+
+        Slot *chunks_ = nullptr;
+        Slot *free_ = nullptr;
+        // Slots of the last chunk that were never used
+        Slot *unused_ = nullptr;
+        Slot *unused_end_ = nullptr;
+        uint32_t last_chunk_slots_ = 0;
+    };
+
+    struct NodeBase {
+        explicit NodeBase(bool leaf) : is_leaf(leaf) {}
+        InnerNode *parent = nullptr;
+        uint32_t position = 0;  // index in parent->children
+        uint32_t count = 0;     // number of elements (leaf) or separator keys (inner node)
+        const bool is_leaf;
+    };
+
+    // keys[i] is a copy of values[i]->first, searches do not have to leave the leaf
+    struct LeafNode : NodeBase {
+        LeafNode() : NodeBase(true) {}
+
+        LeafNode *prev = nullptr;
+        LeafNode *next = nullptr;
+        Key keys[kLeafSlots];
+        value_type *values[kLeafSlots];
+    };
+
+    // Separator keys[i] is not greater than any key in children[i + 1] and greater than all keys in children[i]
+    struct InnerNode : NodeBase {
+        InnerNode() : NodeBase(false) {}
+        Key keys[kInnerKeys];
+        NodeBase *children[kInnerKeys + 1];
+    };
+
+    template <bool IsConst>
+    class iterator_impl {
+        friend class btree_map;
+        template <bool>
+        friend class iterator_impl;
+        using MapPtr = std::conditional_t<IsConst, const btree_map *, btree_map *>;
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::conditional_t<IsConst, const typename btree_map::value_type, typename btree_map::value_type>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type *;
+        using reference = value_type &;
+
+        iterator_impl() = default;
+        // iterator -> const_iterator
+        template <bool C = IsConst, typename = std::enable_if_t<C>>
+        iterator_impl(const iterator_impl<false> &other)
+            : map_(other.map_), leaf_(other.leaf_), slot_(other.slot_), generation_(other.generation_), value_(other.value_) {}
+
+        reference operator*() const {
+            assert(value_);
+            return *value_;
+        }
+        pointer operator->() const {
+            assert(value_);
+            return value_;
+        }
+
+        iterator_impl &operator++() {
+            Locate();
+            assert(leaf_);
+            if (++slot_ == leaf_->count) {
+                leaf_ = leaf_->next;
+                slot_ = 0;
+            }
+            Cache();
+            return *this;
+        }
+
+        iterator_impl &operator--() {
+            if (!leaf_) {
+                leaf_ = map_->last_leaf_;
+                assert(leaf_);
+                slot_ = leaf_->count - 1;
+            } else {
+                Locate();
+                if (slot_ > 0) {
+                    --slot_;
+                } else {
+                    leaf_ = leaf_->prev;
+                    assert(leaf_);
+                    slot_ = leaf_->count - 1;
+                }
+            }
+            Cache();
+            return *this;
+        }
+
+        bool operator==(const iterator_impl &rhs) const { return value_ == rhs.value_; }
+        bool operator!=(const iterator_impl &rhs) const { return !(*this == rhs); }
+
+      private:
+        iterator_impl(MapPtr map, LeafNode *leaf, uint32_t slot) : map_(map), leaf_(leaf), slot_(slot) {
+            if (leaf_ && slot_ == leaf_->count) {
+                leaf_ = leaf_->next;
+                slot_ = 0;
+            }
+            Cache();
+        }
+
+        void Cache() {
+            generation_ = map_->generation_;
+            value_ = leaf_ ? leaf_->values[slot_] : nullptr;
+        }
+
+        // Re-find the leaf position if the map was modified since the position was cached
+        void Locate() const {
+            assert(leaf_);
+            if (generation_ != map_->generation_) {
+                auto [leaf, slot] = map_->LowerBoundPosition(value_->first);
+                assert(slot < leaf->count && leaf->values[slot] == value_);
+                leaf_ = leaf;
+                slot_ = slot;
+                generation_ = map_->generation_;
+            }
+        }
+
+        MapPtr map_ = nullptr;
+        mutable LeafNode *leaf_ = nullptr;  // nullptr is end()
+        mutable uint32_t slot_ = 0;
+        mutable uint64_t generation_ = 0;
+        value_type *value_ = nullptr;  // stable until erased, nullptr is end()
+    };
+
+  public:
+    using iterator = iterator_impl<false>;
+    using const_iterator = iterator_impl<true>;
+
+    btree_map() = default;
+    btree_map(const btree_map &other) : comp_(other.comp_) {
+        for (const auto &value : other) {
+            emplace_hint(end(), value);
+        }
+    }
+    btree_map(btree_map &&other) noexcept { swap(other); }
+    btree_map &operator=(const btree_map &other) {
+        if (this != &other) {
+            btree_map copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+    btree_map &operator=(btree_map &&other) noexcept {
+        if (this != &other) {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+    ~btree_map() { clear(); }
+
+    void swap(btree_map &other) noexcept {
+        std::swap(root_, other.root_);
+        std::swap(first_leaf_, other.first_leaf_);
+        std::swap(last_leaf_, other.last_leaf_);
+        std::swap(size_, other.size_);
+        std::swap(comp_, other.comp_);
+        pool_.swap(other.pool_);
+        // Iterators refer to the map object, not the tree, so both sets of iterators must be invalidated
+        generation_ = other.generation_ = std::max(generation_, other.generation_) + 1;
+    }
+
+    iterator begin() { return iterator(this, first_leaf_, 0); }
+    const_iterator begin() const { return const_iterator(this, first_leaf_, 0); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return iterator(this, nullptr, 0); }
+    const_iterator end() const { return const_iterator(this, nullptr, 0); }
+    const_iterator cend() const { return end(); }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+
+    void clear() {
+        if (root_) {
+            DestroyNode(root_);
+        }
+        pool_.Release();
+        root_ = nullptr;
+        first_leaf_ = last_leaf_ = nullptr;
+        size_ = 0;
+        generation_++;
+    }
+
+    iterator lower_bound(const Key &key) { return MakeIterator<iterator>(this, LowerBoundPosition(key)); }
+    const_iterator lower_bound(const Key &key) const { return MakeIterator<const_iterator>(this, LowerBoundPosition(key)); }
+
+    iterator upper_bound(const Key &key) { return MakeIterator<iterator>(this, UpperBoundPosition(key)); }
+    const_iterator upper_bound(const Key &key) const { return MakeIterator<const_iterator>(this, UpperBoundPosition(key)); }
+
+    iterator find(const Key &key) { return MakeIterator<iterator>(this, FindPosition(key)); }
+    const_iterator find(const Key &key) const { return MakeIterator<const_iterator>(this, FindPosition(key)); }
+
+    template <typename Value>
+    std::pair<iterator, bool> insert(Value &&value) {
+        auto [leaf, slot] = LowerBoundPosition(value.first);
+        if (leaf && slot < leaf->count && !comp_(value.first, leaf->keys[slot])) {
+            return {iterator(this, leaf, slot), false};
+        }
+        auto [new_leaf, new_slot] = InsertAt(leaf, slot, std::forward<Value>(value));
+        return {iterator(this, new_leaf, new_slot), true};
+    }
+
+    // Constant time when hint is end() or an element that is not first in its leaf, and the new element
+    // goes right before hint. Sorted runs inserted with end() or the previous result as a hint are appended
+    // to the last leaf, which is split unevenly so that the resulting leaves stay full.
+    template <typename Value>
+    iterator emplace_hint(const_iterator hint, Value &&value) {
+        const Key &key = value.first;
+        LeafNode *leaf = nullptr;
+        uint32_t slot = 0;
+        if (!hint.leaf_) {
+            if (last_leaf_ && comp_(last_leaf_->keys[last_leaf_->count - 1], key)) {
+                leaf = last_leaf_;
+                slot = leaf->count;
+            }
+        } else {
+            hint.Locate();
+            if (hint.slot_ > 0 && comp_(key, hint.leaf_->keys[hint.slot_]) &&
+                comp_(hint.leaf_->keys[hint.slot_ - 1], key)) {
+                leaf = hint.leaf_;
+                slot = hint.slot_;
+            }
+        }
+        if (!leaf) {
+            return insert(std::forward<Value>(value)).first;
+        }
+        auto [new_leaf, new_slot] = InsertAt(leaf, slot, std::forward<Value>(value));
+        return iterator(this, new_leaf, new_slot);
+    }
+
+    template <typename Value>
+    iterator insert(const_iterator hint, Value &&value) {
+        return emplace_hint(hint, std::forward<Value>(value));
+    }
+
+    iterator erase(const_iterator pos) {
+        pos.Locate();
+        auto [leaf, slot] = EraseAt(pos.leaf_, pos.slot_);
+        return iterator(this, leaf, slot);
+    }
+    iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        // last compares by key, so it stays valid while the elements before it are erased
+        while (first != last) {
+            first = erase(first);
+        }
+        if (first.leaf_) {
+            first.Locate();
+        }
+        return iterator(this, first.leaf_, first.slot_);
+    }
+
+  private:
+    using Position = std::pair<LeafNode *, uint32_t>;
+
+    template <typename Iterator, typename MapPtr>
+    static Iterator MakeIterator(MapPtr map, Position position) {
+        return Iterator(map, position.first, position.second);
+    }
+
+    // Leaf and slot of the first element not less than key. Slot is leaf->count when the lower bound is
+    // the first element of the next leaf (or end).
+    Position LowerBoundPosition(const Key &key) const {
+        if (!root_) return {nullptr, 0};
+        NodeBase *node = root_;
+        while (!node->is_leaf) {
+            const auto *inner = static_cast<const InnerNode *>(node);
+            uint32_t i = 0;
+            while (i < inner->count && !comp_(key, inner->keys[i])) {
+                ++i;
+            }
+            node = inner->children[i];
+        }
+        auto *leaf = static_cast<LeafNode *>(node);
+        uint32_t i = 0;
+        while (i < leaf->count && comp_(leaf->keys[i], key)) {
+            ++i;
+        }
+        return {leaf, i};
+    }
+
+    Position UpperBoundPosition(const Key &key) const {
+        auto [leaf, slot] = LowerBoundPosition(key);
+        if (leaf && slot < leaf->count && !comp_(key, leaf->keys[slot])) {
+            ++slot;
+        }
+        return {leaf, slot};
+    }
+
+    Position FindPosition(const Key &key) const {
+        auto [leaf, slot] = LowerBoundPosition(key);
+        if (leaf && slot < leaf->count && !comp_(key, leaf->keys[slot])) {
+            return {leaf, slot};
+        }
+        return {nullptr, 0};
+    }
+
+    // Only keys and element pointers move, the elements stay where they are
+    static void MoveSlots(LeafNode *dst, uint32_t dst_slot, LeafNode *src, uint32_t src_slot, uint32_t count) {
+        // Handles overlapping ranges within the same leaf
+        if (dst == src && dst_slot > src_slot) {
+            std::move_backward(src->keys + src_slot, src->keys + src_slot + count, dst->keys + dst_slot + count);
+            std::copy_backward(src->values + src_slot, src->values + src_slot + count, dst->values + dst_slot + count);
+        } else {
+            std::move(src->keys + src_slot, src->keys + src_slot + count, dst->keys + dst_slot);
+            std::copy(src->values + src_slot, src->values + src_slot + count, dst->values + dst_slot);
+        }
+    }
+
+    template <typename Value>
+    void ConstructSlot(LeafNode *leaf, uint32_t slot, Value &&value) {
+        value_type *element = pool_.Create(std::forward<Value>(value));
+        leaf->keys[slot] = element->first;
+        leaf->values[slot] = element;
+    }
+
+    // Inserts value before the given slot. Returns the final position of the new element.
+    template <typename Value>
+    Position InsertAt(LeafNode *leaf, uint32_t slot, Value &&value) {
+        generation_++;
+        size_++;
+        if (!leaf) {
+            leaf = new LeafNode();
+            root_ = first_leaf_ = last_leaf_ = leaf;
+            ConstructSlot(leaf, 0, std::forward<Value>(value));
+            leaf->count = 1;
+            return {leaf, 0};
+        }
+
+        if (leaf->count < kLeafSlots) {
+            MoveSlots(leaf, slot + 1, leaf, slot, leaf->count - slot);
+            ConstructSlot(leaf, slot, std::forward<Value>(value));
+            leaf->count++;
+            return {leaf, slot};
+        }
+
+        // Appending to the last leaf starts a new empty leaf, otherwise split in half
+        const bool append = !leaf->next && slot == leaf->count;
+        const uint32_t split = append ? leaf->count : leaf->count / 2;
+
+        auto *right = new LeafNode();
+        MoveSlots(right, 0, leaf, split, leaf->count - split);
+        right->count = leaf->count - split;
+        leaf->count = split;
+
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (right->next) {
+            right->next->prev = right;
+        } else {
+            last_leaf_ = right;
+        }
+        leaf->next = right;
+
+        // An element that goes between the halves stays in the left leaf, it is less than the separator
+        Position result = (append || slot > split) ? Position{right, slot - split} : Position{leaf, slot};
+        LeafNode *target = result.first;
+        MoveSlots(target, result.second + 1, target, result.second, target->count - result.second);
+        ConstructSlot(target, result.second, std::forward<Value>(value));
+        target->count++;
+
+        InsertChild(leaf, right->keys[0], right);
+        return result;
+    }
+
+    // Inserts right (with separator) after left into left's parent, splitting inner nodes as needed
+    void InsertChild(NodeBase *left, const Key &separator, NodeBase *right) {
+        InnerNode *parent = left->parent;
+        if (!parent) {
+            auto *new_root = new InnerNode();
+            new_root->count = 1;
+            new_root->keys[0] = separator;
+            SetChild(new_root, 0, left);
+            SetChild(new_root, 1, right);
+            root_ = new_root;
+            return;
+        }
+
+        const uint32_t pos = left->position;
+        if (parent->count < kInnerKeys) {
+            for (uint32_t i = parent->count; i > pos; --i) {
+                parent->keys[i] = parent->keys[i - 1];
+                SetChild(parent, i + 1, parent->children[i]);
+            }
+            parent->keys[pos] = separator;
+            SetChild(parent, pos + 1, right);
+            parent->count++;
+            return;
+        }
+
+        // Full inner node, split around the middle key, which moves up to the grandparent
+        Key keys[kInnerKeys + 1];
+        NodeBase *children[kInnerKeys + 2];
+        for (uint32_t i = 0, src = 0; i < kInnerKeys + 1; ++i) {
+            keys[i] = (i == pos) ? separator : parent->keys[src++];
+        }
+        for (uint32_t i = 0, src = 0; i < kInnerKeys + 2; ++i) {
+            children[i] = (i == pos + 1) ? right : parent->children[src++];
+        }
+
+        constexpr uint32_t total_keys = kInnerKeys + 1;
+        constexpr uint32_t mid = total_keys / 2;
+        auto *sibling = new InnerNode();
+        parent->count = mid;
+        for (uint32_t i = 0; i < mid; ++i) {
+            parent->keys[i] = keys[i];
+        }
+        for (uint32_t i = 0; i <= mid; ++i) {
+            SetChild(parent, i, children[i]);
+        }
+        sibling->count = total_keys - mid - 1;
+        for (uint32_t i = 0; i < sibling->count; ++i) {
+            sibling->keys[i] = keys[mid + 1 + i];
+        }
+        for (uint32_t i = 0; i <= sibling->count; ++i) {
+            SetChild(sibling, i, children[mid + 1 + i]);
+        }
+        InsertChild(parent, keys[mid], sibling);
+    }
+
+    static void SetChild(InnerNode *parent, uint32_t index, NodeBase *child) {
+        parent->children[index] = child;
+        child->parent = parent;
+        child->position = index;
+    }
+
+    // Returns the position of the element following the erased one
+    Position EraseAt(LeafNode *leaf, uint32_t slot) {
+        generation_++;
+        size_--;
+        pool_.Destroy(leaf->values[slot]);
+        MoveSlots(leaf, slot, leaf, slot + 1, leaf->count - slot - 1);
+        leaf->count--;
+
+        if (leaf->count == 0) {
+            LeafNode *next = leaf->next;
+            RemoveLeaf(leaf);
+            return {next, 0};
+        }
+
+        Position result{leaf, slot};
+        LeafNode *next = leaf->next;
+        if (next && next->parent == leaf->parent && leaf->count < kLeafSlots / 4 && leaf->count + next->count <= kLeafSlots) {
+            // The elements of next are greater than the left separator of leaf, so they can join it
+            MoveSlots(leaf, leaf->count, next, 0, next->count);
+            leaf->count += next->count;
+            next->count = 0;
+            RemoveLeaf(next);
+        }
+        // When slot is past the last element, the iterator moves to the next leaf
+        return result;
+    }
+
+    void RemoveLeaf(LeafNode *leaf) {
+        assert(leaf->count == 0);
+        if (leaf->prev) {
+            leaf->prev->next = leaf->next;
+        } else {
+            first_leaf_ = leaf->next;
+        }
+        if (leaf->next) {
+            leaf->next->prev = leaf->prev;
+        } else {
+            last_leaf_ = leaf->prev;
+        }
+        RemoveChild(leaf);
+        delete leaf;
+    }
+
+    // Unlinks node from its parent, collapsing inner nodes that are left with a single child
+    void RemoveChild(NodeBase *node) {
+        InnerNode *parent = node->parent;
+        if (!parent) {
+            root_ = nullptr;
+            return;
+        }
+
+        const uint32_t pos = node->position;
+        const uint32_t key_index = pos > 0 ? pos - 1 : 0;
+        for (uint32_t i = key_index; i + 1 < parent->count; ++i) {
+            parent->keys[i] = parent->keys[i + 1];
+        }
+        for (uint32_t i = pos; i < parent->count; ++i) {
+            SetChild(parent, i, parent->children[i + 1]);
+        }
+        parent->count--;
+
+        if (parent->count == 0) {
+            NodeBase *only_child = parent->children[0];
+            if (InnerNode *grandparent = parent->parent) {
+                SetChild(grandparent, parent->position, only_child);
+            } else {
+                only_child->parent = nullptr;
+                only_child->position = 0;
+                root_ = only_child;
+            }
+            delete parent;
+        }
+    }
+
+    void DestroyNode(NodeBase *node) {
+        if (node->is_leaf) {
+            auto *leaf = static_cast<LeafNode *>(node);
+            for (uint32_t i = 0; i < leaf->count; ++i) {
+                pool_.Destroy(leaf->values[i]);
+            }
+            delete leaf;
+        } else {
+            auto *inner = static_cast<InnerNode *>(node);
+            for (uint32_t i = 0; i <= inner->count; ++i) {
+                DestroyNode(inner->children[i]);
+            }
+            delete inner;
+        }
+    }
+
+    NodeBase *root_ = nullptr;
+    LeafNode *first_leaf_ = nullptr;
+    LeafNode *last_leaf_ = nullptr;
+    size_type size_ = 0;
+    // Incremented by every modification, iterators with an older generation re-find their element
+    uint64_t generation_ = 0;
+    Compare comp_;
+    ElementPool pool_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,59 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vvl {
+
+// paged_array
+//
+// Values indexed by dense integer ids, split in pages like paged_bitset. A page is allocated the first time one of its values
+// is written, values which were never written read as T{}. Not thread safe.
+template <typename T, uint32_t kPageBits = 10>
+class paged_array {
+  public:
+    T get(uint32_t index) const {
+        const uint32_t page_index = index >> kPageBits;
+        if (page_index >= pages_.size() || !pages_[page_index]) {
+            return T{};
+        }
+        return (*pages_[page_index])[index & kIndexMask];
+    }
+
+    void set(uint32_t index, const T &value) {
+        const uint32_t page_index = index >> kPageBits;
+        if (page_index >= pages_.size()) {
+            pages_.resize(page_index + 1);
+        }
+        if (!pages_[page_index]) {
+            pages_[page_index] = std::make_unique<Page>();
+        }
+        (*pages_[page_index])[index & kIndexMask] = value;
+    }
+
+  private:
+    static constexpr uint32_t kIndexMask = (1u << kPageBits) - 1;
+    using Page = std::array<T, 1u << kPageBits>;
+
+    std::vector<std::unique_ptr<Page>> pages_;
+};
+
+}  // namespace vvl
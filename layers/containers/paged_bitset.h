@@ -0,0 +1,83 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vvl {
+
+// paged_bitset
+//
+// Set of dense integer ids stored as bits. The bits are split in pages which are allocated the first time one of their bits is
+// set, so a set holding a few large ids does not pay for all the smaller ones.
+//
+// Pages are kept when their bits are reset, a set that is filled and emptied over and over (once per command buffer
+// recording) stops allocating. Not thread safe.
+template <uint32_t kPageBits = 12>
+class paged_bitset {
+    static_assert(kPageBits >= 6, "a page holds at least one word");
+
+  public:
+    bool test(uint32_t index) const {
+        const uint32_t page_index = index >> kPageBits;
+        if (page_index >= pages_.size() || !pages_[page_index]) {
+            return false;
+        }
+        return ((*pages_[page_index])[WordIndex(index)] & BitMask(index)) != 0;
+    }
+
+    // Returns true if the bit was not set yet
+    bool set(uint32_t index) {
+        const uint32_t page_index = index >> kPageBits;
+        if (page_index >= pages_.size()) {
+            pages_.resize(page_index + 1);
+        }
+        if (!pages_[page_index]) {
+            pages_[page_index] = std::make_unique<Page>();
+        }
+        uint64_t &word = (*pages_[page_index])[WordIndex(index)];
+        const bool was_set = (word & BitMask(index)) != 0;
+        word |= BitMask(index);
+        return !was_set;
+    }
+
+    // Returns true if the bit was set
+    bool reset(uint32_t index) {
+        const uint32_t page_index = index >> kPageBits;
+        if (page_index >= pages_.size() || !pages_[page_index]) {
+            return false;
+        }
+        uint64_t &word = (*pages_[page_index])[WordIndex(index)];
+        const bool was_set = (word & BitMask(index)) != 0;
+        word &= ~BitMask(index);
+        return was_set;
+    }
+
+  private:
+    static constexpr uint32_t kWordsPerPage = (1u << kPageBits) / 64;
+    using Page = std::array<uint64_t, kWordsPerPage>;
+
+    static uint32_t WordIndex(uint32_t index) { return (index >> 6) & (kWordsPerPage - 1); }
+    static uint64_t BitMask(uint32_t index) { return uint64_t(1) << (index & 63); }
+
+    std::vector<std::unique_ptr<Page>> pages_;
+};
+
+}  // namespace vvl
@@ -27,6 +27,9 @@
 #include <utility>
 #include "containers/range.h"
 #include "containers/container_utils.h"
+#ifdef USE_BTREE_RANGE_MAP
+#include "containers/btree_map.h"
+#endif
 
 #define RANGE_ASSERT(b) assert(b)
 
@@ -37,11 +40,21 @@ enum class value_precedence { prefer_source, prefer_dest };
 template <typename Iterator, typename Map, typename Range>
 Iterator split(Iterator in, Map &map, const Range &range);
 
+// The default ImplMap of range_map. With USE_BTREE_RANGE_MAP the ranges are stored in a B+tree, which keeps
+// neighboring keys in the same cache lines. References to mapped values stay valid as with std::map (see vvl::btree_map).
+#ifdef USE_BTREE_RANGE_MAP
+template <typename Key, typename T>
+using default_range_impl_map = vvl::btree_map<vvl::range<Key>, T>;
+#else
+template <typename Key, typename T>
+using default_range_impl_map = std::map<vvl::range<Key>, T>;
+#endif
+
 // range_map
 //
 // The range based sparse map implemented on the ImplMap.
 // Implements an ordered map of non-overlapping, non-empty ranges
-template <typename Key, typename T, typename ImplMap = std::map<vvl::range<Key>, T>>
+template <typename Key, typename T, typename ImplMap = default_range_impl_map<Key, T>>
 class range_map {
   private:
     ImplMap impl_map_;
@@ -482,6 +495,38 @@ class range_map {
         return overwrite_range(lower, value);
     }
 
+    // Overwrites each range of a sorted run of non-overlapping values, [first, last), in one forward pass.
+    // The position after each overwrite is the search start for the next range, so a run of adjacent or
+    // nearby ranges costs a single lower bound lookup instead of one per range.
+    template <typename InputIt>
+    void overwrite_sorted_run(InputIt first, InputIt last) {
+        if (first == last) return;
+        auto pos = lower_bound_impl(first->first);
+        for (; first != last; ++first) {
+            const key_type &key = first->first;
+            if (key.empty()) continue;
+
+            // The run is sorted, so the lower bound of key is at or after pos. Walk a few entries before
+            // falling back to a search.
+            constexpr int kMaxWalk = 4;
+            int walked = 0;
+            while (!at_impl_end(pos) && pos->first.end <= key.begin && walked < kMaxWalk) {
+                ++pos;
+                ++walked;
+            }
+            if (!at_impl_end(pos) && pos->first.end <= key.begin) {
+                pos = lower_bound_impl(key);
+            }
+            RANGE_ASSERT(pos == lower_bound_impl(key));
+
+            if (!at_impl_end(pos) && key.intersects(pos->first)) {
+                pos = impl_erase_range(key, pos, [](const auto &) { return true; });
+            }
+            pos = impl_insert(pos, *first);
+            ++pos;
+        }
+    }
+
     bool empty() const { return impl_map_.empty(); }
     size_type size() const { return impl_map_.size(); }
 
@@ -0,0 +1,61 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "containers/read_mostly_map.h"
+
+namespace vvl {
+
+ReaderCounters &ReaderCounters::Get() {
+    static ReaderCounters counters;
+    return counters;
+}
+
+ReaderCounters::Counter &ReaderCounters::Local() {
+    // Threads are assigned counters round robin. Threads that share a counter only share a cache line,
+    // the correctness of the epochs does not depend on the assignment.
+    static thread_local uint32_t thread_index = next_thread_index_.fetch_add(1, std::memory_order_relaxed) % kCount;
+    return counters_[thread_index];
+}
+
+uint32_t ReaderCounters::Enter() {
+    // The epoch may advance between the load and the increment. The reader then counts under an older parity,
+    // which only delays the next advance; it loads the table after the increment, so it cannot see a table
+    // that was retired before the counters were checked.
+    const uint32_t parity = static_cast<uint32_t>(epoch_.load(std::memory_order_seq_cst) & 1);
+    Local().value[parity].fetch_add(1, std::memory_order_seq_cst);
+    return parity;
+}
+
+void ReaderCounters::Exit(uint32_t parity) { Local().value[parity].fetch_sub(1, std::memory_order_release); }
+
+uint64_t ReaderCounters::TryAdvanceEpoch() {
+    uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    // Readers of the previous epoch use the parity of the next one
+    const uint32_t previous_parity = static_cast<uint32_t>((epoch + 1) & 1);
+    for (const Counter &counter : counters_) {
+        if (counter.value[previous_parity].load(std::memory_order_seq_cst) != 0) {
+            return epoch;
+        }
+    }
+    // Writers of different maps may race here, only one of them advances the epoch
+    if (epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst)) {
+        epoch++;
+    }
+    return epoch;
+}
+
+}  // namespace vvl
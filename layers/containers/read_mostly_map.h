@@ -0,0 +1,247 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace vvl {
+
+// Tracks the readers of all read_mostly_maps, so a replaced hash table is freed only when no reader can still
+// be probing it. Each thread increments one of kCount counters on separate cache lines, so readers on different
+// threads do not write to shared memory.
+//
+// Readers count themselves under the parity of the global epoch they started in. The epoch only advances once
+// no reader is left from the epoch before the current one, so new readers never hold back the reclamation of
+// tables retired earlier: a table retired in epoch e can be freed once the epoch reached e + kReclaimEpochs.
+class ReaderCounters {
+  public:
+    static constexpr uint32_t kCount = 64;
+    // The advance to e + 1 may have checked the counters before the table was retired, the advances to e + 2 and
+    // e + 3 check both parities after it
+    static constexpr uint64_t kReclaimEpochs = 3;
+
+    static ReaderCounters &Get();
+
+    // Returns the parity to pass to Exit()
+    uint32_t Enter();
+    void Exit(uint32_t parity);
+
+    uint64_t Epoch() const { return epoch_.load(std::memory_order_seq_cst); }
+
+    // Advances the epoch if no reader that started in the previous epoch is still running. Returns the current epoch.
+    uint64_t TryAdvanceEpoch();
+
+  private:
+    struct alignas(64) Counter {
+        std::atomic<uint32_t> value[2] = {0, 0};
+    };
+    Counter &Local();
+
+    Counter counters_[kCount];
+    std::atomic<uint32_t> next_thread_index_{0};
+    std::atomic<uint64_t> epoch_{0};
+};
+
+// read_mostly_map
+//
+// Hash map from handle-like keys to raw pointers with a lock-free find(). Writers are serialized by a mutex.
+//
+// The table is open addressed with linear probing. Slots are only ever added or have their value replaced,
+// so a reader that sees a key also sees its value. Erase stores nullptr as value and keeps the key; when live
+// entries plus erased entries reach half of the table, the writer builds a new table and publishes it
+// atomically. The old table is freed by a later write once the ReaderCounters epoch shows its readers are done.
+//
+// The map does not own the pointed-to objects. Key{} (VK_NULL_HANDLE) is reserved for empty slots.
+template <typename Key, typename T>
+class read_mostly_map {
+    static_assert(std::is_trivially_copyable_v<Key>, "read_mostly_map keys are stored in atomics");
+
+  public:
+    read_mostly_map() = default;
+    read_mostly_map(const read_mostly_map &) = delete;
+    read_mostly_map &operator=(const read_mostly_map &) = delete;
+    ~read_mostly_map() { delete table_.load(std::memory_order_relaxed); }
+
+    T *find(const Key &key) const {
+        ReaderCounters &readers = ReaderCounters::Get();
+        const uint32_t parity = readers.Enter();
+        T *result = nullptr;
+        // seq_cst so the load is ordered with the writer's check of the reader counters
+        if (const Table *table = table_.load(std::memory_order_seq_cst)) {
+            for (uint32_t i = Index(key, table->mask);; i = (i + 1) & table->mask) {
+                const Key slot_key = table->slots[i].key.load(std::memory_order_acquire);
+                if (slot_key == key) {
+                    result = table->slots[i].value.load(std::memory_order_acquire);
+                    break;
+                }
+                if (slot_key == Key{}) {
+                    break;
+                }
+            }
+        }
+        readers.Exit(parity);
+        return result;
+    }
+
+    void insert_or_assign(const Key &key, T *value) {
+        assert(key != Key{});
+        assert(value);
+        std::lock_guard<std::mutex> lock(mutex_);
+        FreeRetiredTables();
+
+        Table *table = table_.load(std::memory_order_relaxed);
+        if (Slot *slot = FindSlot(table, key)) {
+            if (!slot->value.exchange(value, std::memory_order_release)) {
+                live_count_++;
+            }
+            return;
+        }
+        if (!table || (used_count_ + 1) * 2 > table->mask + 1) {
+            table = Rebuild(live_count_ + 1);
+        }
+        uint32_t i = Index(key, table->mask);
+        while (table->slots[i].key.load(std::memory_order_relaxed) != Key{}) {
+            i = (i + 1) & table->mask;
+        }
+        // Publish the value before the key, readers look at the value only after finding the key
+        table->slots[i].value.store(value, std::memory_order_relaxed);
+        table->slots[i].key.store(key, std::memory_order_release);
+        used_count_++;
+        live_count_++;
+    }
+
+    void erase(const Key &key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        FreeRetiredTables();
+        if (Slot *slot = FindSlot(table_.load(std::memory_order_relaxed), key)) {
+            if (slot->value.exchange(nullptr, std::memory_order_release)) {
+                live_count_--;
+            }
+        }
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Retire(table_.exchange(nullptr, std::memory_order_seq_cst));
+        used_count_ = 0;
+        live_count_ = 0;
+        FreeRetiredTables();
+    }
+
+    // Replaced tables that some reader might still be probing
+    size_t retired_table_count() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return retired_tables_.size();
+    }
+
+  private:
+    struct Slot {
+        std::atomic<Key> key{Key{}};
+        std::atomic<T *> value{nullptr};
+    };
+
+    struct Table {
+        explicit Table(uint32_t capacity) : mask(capacity - 1), slots(new Slot[capacity]) {}
+        const uint32_t mask;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    static uint32_t Index(const Key &key, uint32_t mask) {
+        uint64_t bits;
+        if constexpr (std::is_pointer_v<Key>) {
+            bits = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key));
+        } else {
+            bits = static_cast<uint64_t>(key);
+        }
+        // Handles are often allocation addresses, with the entropy in the middle bits
+        return static_cast<uint32_t>((bits * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    }
+
+    // Writer side lookup, includes erased entries
+    static Slot *FindSlot(Table *table, const Key &key) {
+        if (!table) return nullptr;
+        for (uint32_t i = Index(key, table->mask);; i = (i + 1) & table->mask) {
+            const Key slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+            if (slot_key == key) return &table->slots[i];
+            if (slot_key == Key{}) return nullptr;
+        }
+    }
+
+    // Copies the live entries into a table with room for at least min_count entries at 25% load
+    Table *Rebuild(uint32_t min_count) {
+        uint32_t capacity = 16;
+        while (capacity < min_count * 4) {
+            capacity *= 2;
+        }
+        auto *new_table = new Table(capacity);
+        Table *old_table = table_.load(std::memory_order_relaxed);
+        if (old_table) {
+            for (uint32_t i = 0; i <= old_table->mask; ++i) {
+                T *value = old_table->slots[i].value.load(std::memory_order_relaxed);
+                if (!value) continue;
+                const Key key = old_table->slots[i].key.load(std::memory_order_relaxed);
+                uint32_t j = Index(key, new_table->mask);
+                while (new_table->slots[j].key.load(std::memory_order_relaxed) != Key{}) {
+                    j = (j + 1) & new_table->mask;
+                }
+                new_table->slots[j].value.store(value, std::memory_order_relaxed);
+                new_table->slots[j].key.store(key, std::memory_order_relaxed);
+            }
+        }
+        // seq_cst so the publish is ordered with the later epoch read and reader counter checks
+        table_.store(new_table, std::memory_order_seq_cst);
+        Retire(old_table);
+        used_count_ = live_count_;
+        return new_table;
+    }
+
+    void Retire(Table *table) {
+        if (table) {
+            retired_tables_.emplace_back(RetiredTable{std::unique_ptr<Table>(table), ReaderCounters::Get().Epoch()});
+        }
+    }
+
+    // Retired tables are in epoch order
+    void FreeRetiredTables() {
+        if (retired_tables_.empty()) return;
+        const uint64_t epoch = ReaderCounters::Get().TryAdvanceEpoch();
+        auto it = retired_tables_.begin();
+        while (it != retired_tables_.end() && it->epoch + ReaderCounters::kReclaimEpochs <= epoch) {
+            ++it;
+        }
+        retired_tables_.erase(retired_tables_.begin(), it);
+    }
+
+    std::atomic<Table *> table_{nullptr};
+    std::mutex mutex_;
+    uint32_t used_count_ = 0;  // keys in the table, including erased entries
+    uint32_t live_count_ = 0;
+    struct RetiredTable {
+        std::unique_ptr<Table> table;
+        uint64_t epoch;
+    };
+    std::vector<RetiredTable> retired_tables_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,135 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+namespace vvl {
+
+// slot_table
+//
+// Array of (key, value) entries indexed by a small integer the caller allocates (usually packed in the key itself, see
+// vvl::dispatch::HandleSlotAllocator). find() is wait-free: a page load, a key compare and a value load.
+//
+// Storage is paged, pages are allocated when the first entry in their range is inserted and are never freed before the table,
+// so readers never see memory go away. Each entry holds the full key, so a reader with a stale key does not match the entry
+// that reused its index.
+//
+// Key 0 marks an empty entry and key 1 an entry being written, keys must be greater than 1.
+// Concurrent insert() and erase() of the same index are the caller's problem, the index allocator must not hand out an index
+// again before it was erased.
+template <typename T, uint32_t kIndexBits, uint32_t kPageBits = 12>
+class slot_table {
+    static_assert(std::is_trivially_copyable_v<T>, "slot_table values are stored in atomics");
+    static_assert(kPageBits <= kIndexBits);
+
+  public:
+    static constexpr uint32_t kMaxIndex = (1u << kIndexBits) - 1;
+
+    slot_table() = default;
+    slot_table(const slot_table &) = delete;
+    slot_table &operator=(const slot_table &) = delete;
+    ~slot_table() {
+        for (auto &page : pages_) {
+            delete page.load(std::memory_order_relaxed);
+        }
+    }
+
+    bool find(uint32_t index, uint64_t key, T &out_value) const {
+        assert(index <= kMaxIndex);
+        const Page *page = pages_[index >> kPageBits].load(std::memory_order_acquire);
+        if (!page) {
+            return false;
+        }
+        const Entry &entry = page->entries[index & kPageMask];
+        if (entry.key.load(std::memory_order_acquire) != key) {
+            return false;
+        }
+        out_value = entry.value.load(std::memory_order_acquire);
+        // The entry could have been erased and reused while reading the value
+        return entry.key.load(std::memory_order_relaxed) == key;
+    }
+
+    // Returns false if the entry is used by another key
+    bool insert(uint32_t index, uint64_t key, const T &value) {
+        assert(index <= kMaxIndex);
+        assert(key > kBusyKey);
+        Entry &entry = GetOrCreatePage(index >> kPageBits).entries[index & kPageMask];
+        uint64_t expected = kEmptyKey;
+        if (!entry.key.compare_exchange_strong(expected, kBusyKey, std::memory_order_acquire)) {
+            return false;
+        }
+        // Publish the value before the key, readers look at the value only after finding the key
+        entry.value.store(value, std::memory_order_relaxed);
+        entry.key.store(key, std::memory_order_release);
+        return true;
+    }
+
+    // Returns false if the entry does not hold key
+    bool erase(uint32_t index, uint64_t key, T &out_value) {
+        assert(index <= kMaxIndex);
+        Page *page = pages_[index >> kPageBits].load(std::memory_order_acquire);
+        if (!page) {
+            return false;
+        }
+        Entry &entry = page->entries[index & kPageMask];
+        uint64_t expected = key;
+        if (!entry.key.compare_exchange_strong(expected, kBusyKey, std::memory_order_acquire)) {
+            return false;
+        }
+        out_value = entry.value.load(std::memory_order_relaxed);
+        entry.key.store(kEmptyKey, std::memory_order_release);
+        return true;
+    }
+
+  private:
+    static constexpr uint64_t kEmptyKey = 0;
+    static constexpr uint64_t kBusyKey = 1;
+    static constexpr uint32_t kPageSize = 1u << kPageBits;
+    static constexpr uint32_t kPageMask = kPageSize - 1;
+    static constexpr uint32_t kPageCount = 1u << (kIndexBits - kPageBits);
+
+    struct Entry {
+        std::atomic<uint64_t> key{kEmptyKey};
+        std::atomic<T> value{};
+    };
+    struct Page {
+        std::array<Entry, kPageSize> entries;
+    };
+
+    Page &GetOrCreatePage(uint32_t page_index) {
+        std::atomic<Page *> &page_ptr = pages_[page_index];
+        Page *page = page_ptr.load(std::memory_order_acquire);
+        if (!page) {
+            Page *new_page = new Page();
+            if (page_ptr.compare_exchange_strong(page, new_page, std::memory_order_acq_rel)) {
+                page = new_page;
+            } else {
+                delete new_page;  // another thread added the page first
+            }
+        }
+        return *page;
+    }
+
+    std::array<std::atomic<Page *>, kPageCount> pages_{};
+};
+
+}  // namespace vvl
@@ -371,7 +371,7 @@ bool CoreChecks::PreCallValidateCmdFillBuffer(VkCommandBuffer commandBuffer, VkB
                                               VkDeviceSize size, uint32_t data, const ErrorObject &error_obj) const {
     bool skip = false;
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto buffer_state = Get<vvl::Buffer>(dstBuffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(dstBuffer);
     ASSERT_AND_RETURN_SKIP(cb_state_ptr && buffer_state);
 
     const LogObjectList objlist(commandBuffer, dstBuffer);
@@ -475,7 +475,7 @@ bool CoreChecks::ValidateCmdBindIndexBuffer(const vvl::CommandBuffer &cb_state,
     const bool is_2 = loc.function == Func::vkCmdBindIndexBuffer2KHR || loc.function == Func::vkCmdBindIndexBuffer2;
     const char *vuid;
 
-    auto buffer_state = Get<vvl::Buffer>(buffer);
+    auto buffer_state = GetBorrowed<vvl::Buffer>(buffer);
     if (!buffer_state) return skip;  // if using nullDescriptors
     const LogObjectList objlist(cb_state.Handle(), buffer);
 
@@ -518,7 +518,7 @@ bool CoreChecks::PreCallValidateCmdBindIndexBuffer2(VkCommandBuffer commandBuffe
     skip |= ValidateCmdBindIndexBuffer(*cb_state, buffer, offset, indexType, error_obj.location);
 
     if (size != VK_WHOLE_SIZE && buffer != VK_NULL_HANDLE) {
-        auto buffer_state = Get<vvl::Buffer>(buffer);
+        const vvl::Buffer *buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         if (!buffer_state) return skip;  // if using nullDescriptors
 
         const VkDeviceSize offset_align = static_cast<VkDeviceSize>(GetIndexAlignment(indexType));
@@ -551,7 +551,7 @@ bool CoreChecks::PreCallValidateCmdBindVertexBuffers(VkCommandBuffer commandBuff
     bool skip = false;
     skip |= ValidateCmd(*cb_state, error_obj.location);
     for (uint32_t i = 0; i < bindingCount; ++i) {
-        auto buffer_state = Get<vvl::Buffer>(pBuffers[i]);
+        const vvl::Buffer *buffer_state = GetBorrowed<vvl::Buffer>(pBuffers[i]);
         if (!buffer_state) continue;  // if using nullDescriptors
 
         const LogObjectList objlist(commandBuffer, buffer_state->Handle());
@@ -572,7 +572,7 @@ bool CoreChecks::PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer, V
                                                 VkDeviceSize dataSize, const void *pData, const ErrorObject &error_obj) const {
     bool skip = false;
     auto cb_state = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto dst_buffer_state = Get<vvl::Buffer>(dstBuffer);
+    const vvl::Buffer *dst_buffer_state = GetBorrowed<vvl::Buffer>(dstBuffer);
     ASSERT_AND_RETURN_SKIP(dst_buffer_state);
 
     const LogObjectList objlist(commandBuffer, dstBuffer);
@@ -1703,7 +1703,7 @@ bool CoreChecks::PreCallValidateCmdBindTransformFeedbackBuffersEXT(VkCommandBuff
 
     for (uint32_t i = 0; i < bindingCount; ++i) {
         const Location buffer_loc = error_obj.location.dot(Field::pBuffers, i);
-        auto buffer_state = Get<vvl::Buffer>(pBuffers[i]);
+        auto buffer_state = GetBorrowed<vvl::Buffer>(pBuffers[i]);
         ASSERT_AND_CONTINUE(buffer_state);
 
         if (pOffsets[i] >= buffer_state->create_info.size) {
@@ -1800,7 +1800,7 @@ bool CoreChecks::PreCallValidateCmdBeginTransformFeedbackEXT(VkCommandBuffer com
             if (pCounterBuffers[i] == VK_NULL_HANDLE) {
                 continue;
             }
-            auto buffer_state = Get<vvl::Buffer>(pCounterBuffers[i]);
+            auto buffer_state = GetBorrowed<vvl::Buffer>(pCounterBuffers[i]);
             ASSERT_AND_CONTINUE(buffer_state);
 
             if (pCounterBufferOffsets != nullptr && pCounterBufferOffsets[i] + 4 > buffer_state->create_info.size) {
@@ -1840,7 +1840,7 @@ bool CoreChecks::PreCallValidateCmdEndTransformFeedbackEXT(VkCommandBuffer comma
             if (pCounterBuffers[i] == VK_NULL_HANDLE) {
                 continue;
             }
-            auto buffer_state = Get<vvl::Buffer>(pCounterBuffers[i]);
+            auto buffer_state = GetBorrowed<vvl::Buffer>(pCounterBuffers[i]);
             ASSERT_AND_CONTINUE(buffer_state);
 
             if (pCounterBufferOffsets != nullptr && pCounterBufferOffsets[i] + 4 > buffer_state->create_info.size) {
@@ -1872,7 +1872,7 @@ bool CoreChecks::PreCallValidateCmdBindVertexBuffers2(VkCommandBuffer commandBuf
     bool skip = false;
     skip |= ValidateCmd(*cb_state, error_obj.location);
     for (uint32_t i = 0; i < bindingCount; ++i) {
-        auto buffer_state = Get<vvl::Buffer>(pBuffers[i]);
+        auto buffer_state = GetBorrowed<vvl::Buffer>(pBuffers[i]);
         if (!buffer_state) continue;  // if using nullDescriptors
 
         const LogObjectList objlist(commandBuffer, pBuffers[i]);
@@ -1936,7 +1936,7 @@ bool CoreChecks::PreCallValidateCmdBeginConditionalRenderingEXT(
     }
 
     if (pConditionalRenderingBegin) {
-        if (auto buffer_state = Get<vvl::Buffer>(pConditionalRenderingBegin->buffer)) {
+        if (auto buffer_state = GetBorrowed<vvl::Buffer>(pConditionalRenderingBegin->buffer)) {
             const Location conditional_loc = error_obj.location.dot(Field::pConditionalRenderingBegin);
             skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *buffer_state, conditional_loc.dot(Field::buffer),
                                                   "VUID-VkConditionalRenderingBeginInfoEXT-buffer-01981");
@@ -2002,7 +2002,7 @@ bool CoreChecks::PreCallValidateCmdBindShadingRateImageNV(VkCommandBuffer comman
     if (imageView == VK_NULL_HANDLE) {
         return skip;
     }
-    auto view_state = Get<vvl::ImageView>(imageView);
+    auto view_state = GetBorrowed<vvl::ImageView>(imageView);
     if (!view_state) {
         const LogObjectList objlist(commandBuffer, imageView);
         skip |= LogError("VUID-vkCmdBindShadingRateImageNV-imageView-02059", objlist, error_obj.location,
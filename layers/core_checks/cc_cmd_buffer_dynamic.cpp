@@ -687,9 +687,9 @@ bool CoreChecks::ValidateDrawDynamicStatePipelineValue(const LastBound& last_bou
             const bool mode_early_fragment_test =
                 fragment_entry_point->execution_mode.Has(spirv::ExecutionModeSet::early_fragment_test_bit);
             const bool depth_read =
-                pipeline.fragment_shader_state->fragment_shader->spirv->static_data_.has_shader_tile_image_depth_read;
+                pipeline.fragment_shader_state->fragment_shader->spirv->GetStaticData().has_shader_tile_image_depth_read;
             const bool stencil_read =
-                pipeline.fragment_shader_state->fragment_shader->spirv->static_data_.has_shader_tile_image_stencil_read;
+                pipeline.fragment_shader_state->fragment_shader->spirv->GetStaticData().has_shader_tile_image_stencil_read;
 
             if (depth_read && dyn_depth_write_enable && mode_early_fragment_test &&
                 cb_state.dynamic_state_value.depth_write_enable) {
@@ -1041,7 +1041,7 @@ bool CoreChecks::ValidateDrawDynamicStateFragment(const LastBound& last_bound_st
                                      string_VkSampleCountFlagBits(rasterization_samples), gridSize.height);
                 }
             }
-            if (frag_spirv_state && frag_spirv_state->static_data_.uses_interpolate_at_sample) {
+            if (frag_spirv_state && frag_spirv_state->GetStaticData().uses_interpolate_at_sample) {
                 const LogObjectList objlist(cb_state.Handle(), frag_spirv_state->handle());
                 skip |= LogError(vuid.sample_locations_enable_07487, objlist, vuid.loc(),
                                  "sampleLocationsEnable set with vkCmdSetSampleLocationsEnableEXT() was VK_TRUE, but fragment "
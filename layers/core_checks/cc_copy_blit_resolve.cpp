@@ -894,8 +894,8 @@ bool CoreChecks::ValidateCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer s
                                        const RegionType *pRegions, const Location &loc) const {
     bool skip = false;
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto src_buffer_state = Get<vvl::Buffer>(srcBuffer);
-    auto dst_buffer_state = Get<vvl::Buffer>(dstBuffer);
+    auto src_buffer_state = GetBorrowed<vvl::Buffer>(srcBuffer);
+    auto dst_buffer_state = GetBorrowed<vvl::Buffer>(dstBuffer);
     if (!cb_state_ptr || !src_buffer_state || !dst_buffer_state) {
         return skip;
     }
@@ -1489,7 +1489,7 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
                                       const RegionType *pRegions, const Location &loc) const {
     bool skip = false;
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto src_image_state = Get<vvl::Image>(srcImage);
+    auto src_image_state = GetBorrowed<vvl::Image>(srcImage);
     auto dst_image_state = Get<vvl::Image>(dstImage);
     ASSERT_AND_RETURN_SKIP(src_image_state && dst_image_state);
 
@@ -2181,8 +2181,8 @@ bool CoreChecks::ValidateCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkI
                                               const Location &loc) const {
     bool skip = false;
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto src_image_state = Get<vvl::Image>(srcImage);
-    auto dst_buffer_state = Get<vvl::Buffer>(dstBuffer);
+    auto src_image_state = GetBorrowed<vvl::Image>(srcImage);
+    auto dst_buffer_state = GetBorrowed<vvl::Buffer>(dstBuffer);
     ASSERT_AND_RETURN_SKIP(src_image_state && dst_buffer_state);
 
     const vvl::CommandBuffer &cb_state = *cb_state_ptr;
@@ -2359,8 +2359,8 @@ bool CoreChecks::ValidateCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkB
                                               const Location &loc) const {
     bool skip = false;
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto src_buffer_state = Get<vvl::Buffer>(srcBuffer);
-    auto dst_image_state = Get<vvl::Image>(dstImage);
+    auto src_buffer_state = GetBorrowed<vvl::Buffer>(srcBuffer);
+    auto dst_image_state = GetBorrowed<vvl::Image>(dstImage);
     ASSERT_AND_RETURN_SKIP(src_buffer_state);
     ASSERT_AND_RETURN_SKIP(dst_image_state);
 
@@ -2932,7 +2932,7 @@ bool CoreChecks::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage src
                                       const RegionType *pRegions, VkFilter filter, const Location &loc) const {
     bool skip = false;
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto src_image_state = Get<vvl::Image>(srcImage);
+    auto src_image_state = GetBorrowed<vvl::Image>(srcImage);
     auto dst_image_state = Get<vvl::Image>(dstImage);
     ASSERT_AND_RETURN_SKIP(src_image_state && dst_image_state);
 
@@ -3417,8 +3417,8 @@ bool CoreChecks::ValidateCmdResolveImage(VkCommandBuffer commandBuffer, VkImage
                                          const RegionType *pRegions, const Location &loc) const {
     bool skip = false;
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto src_image_state = Get<vvl::Image>(srcImage);
-    auto dst_image_state = Get<vvl::Image>(dstImage);
+    auto src_image_state = GetBorrowed<vvl::Image>(srcImage);
+    auto dst_image_state = GetBorrowed<vvl::Image>(dstImage);
     ASSERT_AND_RETURN_SKIP(src_image_state);
     ASSERT_AND_RETURN_SKIP(dst_image_state);
 
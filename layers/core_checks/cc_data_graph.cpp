@@ -346,7 +346,7 @@ bool CoreChecks::PreCallValidateCmdDispatchDataGraphARM(VkCommandBuffer commandB
     const vvl::DrawDispatchVuid &dispatch_vuid = GetDrawDispatchVuid(error_obj.location.function);
     skip |= ValidateActionState(last_bound_state, dispatch_vuid);
 
-    const auto session_state_ptr = Get<vvl::DataGraphPipelineSession>(session);
+    const auto session_state_ptr = GetBorrowed<vvl::DataGraphPipelineSession>(session);
     ASSERT_AND_RETURN_SKIP(session_state_ptr);
     const auto& session_state = *session_state_ptr;
     const auto& bound_memory_map = session_state.BoundMemoryMap();
@@ -210,7 +210,7 @@ bool CoreChecks::ValidateCmdBindDescriptorSets(const vvl::CommandBuffer &cb_stat
     bool skip = false;
     const bool is_2 = loc.function != Func::vkCmdBindDescriptorSets;
 
-    auto pipeline_layout = Get<vvl::PipelineLayout>(layout);
+    auto pipeline_layout = GetBorrowed<vvl::PipelineLayout>(layout);
     if (!pipeline_layout) {
         return skip;  // dynamicPipelineLayout feature
     }
@@ -350,7 +350,7 @@ bool CoreChecks::ValidateCmdBindDescriptorSets(const vvl::CommandBuffer &cb_stat
                                 const VkDeviceSize bound_range = buffer_descriptor->GetRange();
                                 const VkDeviceSize bound_offset = buffer_descriptor->GetOffset();
                                 // NOTE: null / invalid buffers may show up here, errors are raised elsewhere for this.
-                                auto buffer_state = buffer_descriptor->GetBufferState();
+                                auto buffer_state = buffer_descriptor->GetBufferState(*device_state);
 
                                 // Validate offset didn't go over buffer
                                 if ((bound_range == VK_WHOLE_SIZE) && (offset > 0)) {
@@ -1448,45 +1448,55 @@ vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const vvl::DeviceState &device
                                                   const vvl::DescriptorUpdateTemplate &template_state, const void *pData,
                                                   VkDescriptorSetLayout push_layout) {
     auto const &create_info = template_state.create_info;
-    inline_infos.resize(create_info.descriptorUpdateEntryCount);  // Make sure we have one if we need it
-    inline_infos_khr.resize(create_info.descriptorUpdateEntryCount);
-    inline_infos_nv.resize(create_info.descriptorUpdateEntryCount);
-    desc_writes.reserve(create_info.descriptorUpdateEntryCount);  // emplaced, so reserved without initialization
-    VkDescriptorSetLayout effective_dsl = create_info.templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET
-                                              ? create_info.descriptorSetLayout
-                                              : push_layout;
-    auto ds_layout_state = device_data.Get<vvl::DescriptorSetLayout>(effective_dsl);
-    if (!ds_layout_state) return;
-
-    // Create a WriteDescriptorSet struct for each template update entry
-    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
-        const auto &descriptor_update_entry = create_info.pDescriptorUpdateEntries[i];
-        uint32_t binding_count = ds_layout_state->GetDescriptorCountFromBinding(descriptor_update_entry.dstBinding);
-        uint32_t binding_being_updated = descriptor_update_entry.dstBinding;
-        uint32_t dst_array_element = descriptor_update_entry.dstArrayElement;
-
-        desc_writes.reserve(desc_writes.size() + descriptor_update_entry.descriptorCount);
-        for (uint32_t j = 0; j < descriptor_update_entry.descriptorCount; j++) {
+    const vvl::DescriptorUpdateTemplate::DecodePlan *plan = &template_state.decode_plan;
+    // Push descriptor templates only get their layout when recorded
+    std::shared_ptr<const vvl::DescriptorUpdateTemplate::DecodePlan> push_plan;
+    if (create_info.templateType != VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        auto ds_layout_state = device_data.Get<vvl::DescriptorSetLayout>(push_layout);
+        if (!ds_layout_state) return;
+        push_plan = template_state.GetPushDecodePlan(*ds_layout_state);
+        plan = push_plan.get();
+    }
+
+    // An inline uniform block run is a single VkWriteDescriptorSet, its count is in bytes
+    size_t write_count = 0;
+    size_t inline_count = 0;
+    size_t acceleration_structure_count = 0;
+    for (const auto &run : *plan) {
+        if (run.type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK) {
+            ++write_count;
+            ++inline_count;
+        } else {
+            write_count += run.count;
+            if (run.type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR ||
+                run.type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV) {
+                acceleration_structure_count += run.count;
+            }
+        }
+    }
+    // The writes point into these, so they must not grow after being reserved
+    desc_writes.reserve(write_count);
+    inline_infos.reserve(inline_count);
+    inline_infos_khr.reserve(acceleration_structure_count);
+    inline_infos_nv.reserve(acceleration_structure_count);
+
+    // Create a WriteDescriptorSet struct for each descriptor of the plan
+    for (const auto &run : *plan) {
+        char *run_data = (char *)(pData) + run.offset;
+        for (uint32_t j = 0; j < run.count; j++) {
             desc_writes.emplace_back();
             auto &write_entry = desc_writes.back();
-
-            size_t offset = descriptor_update_entry.offset + j * descriptor_update_entry.stride;
-            char *update_entry = (char *)(pData) + offset;
-
-            if (dst_array_element >= binding_count) {
-                dst_array_element = 0;
-                binding_being_updated = ds_layout_state->GetNextValidBinding(binding_being_updated);
-            }
+            char *update_entry = run_data + j * run.stride;
 
             write_entry.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
             write_entry.pNext = NULL;
             write_entry.dstSet = descriptorSet;
-            write_entry.dstBinding = binding_being_updated;
-            write_entry.dstArrayElement = dst_array_element;
+            write_entry.dstBinding = run.binding;
+            write_entry.dstArrayElement = run.array_element + j;
             write_entry.descriptorCount = 1;
-            write_entry.descriptorType = descriptor_update_entry.descriptorType;
+            write_entry.descriptorType = run.type;
 
-            switch (descriptor_update_entry.descriptorType) {
+            switch (run.type) {
                 case VK_DESCRIPTOR_TYPE_SAMPLER:
                 case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
                 case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
@@ -1507,23 +1517,21 @@ vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const vvl::DeviceState &device
                     write_entry.pTexelBufferView = reinterpret_cast<VkBufferView *>(update_entry);
                     break;
                 case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK: {
-                    VkWriteDescriptorSetInlineUniformBlock *inline_info = &inline_infos[i];
+                    VkWriteDescriptorSetInlineUniformBlock *inline_info = &inline_infos.emplace_back();
                     inline_info->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT;
                     inline_info->pNext = nullptr;
-                    inline_info->dataSize = descriptor_update_entry.descriptorCount;
+                    inline_info->dataSize = run.count;
                     inline_info->pData = update_entry;
                     write_entry.pNext = inline_info;
                     // descriptorCount must match the dataSize member of the VkWriteDescriptorSetInlineUniformBlock structure
                     write_entry.descriptorCount = inline_info->dataSize;
-                    // skip the rest of the array, they just represent bytes in the update
-                    j = descriptor_update_entry.descriptorCount;
                     break;
                 }
                 case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: {
-                    VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr[i];
+                    VkWriteDescriptorSetAccelerationStructureKHR *inline_info_khr = &inline_infos_khr.emplace_back();
                     inline_info_khr->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR;
                     inline_info_khr->pNext = nullptr;
-                    inline_info_khr->accelerationStructureCount = descriptor_update_entry.descriptorCount;
+                    inline_info_khr->accelerationStructureCount = 1;
                     inline_info_khr->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureKHR *>(update_entry);
                     write_entry.pNext = inline_info_khr;
                     // descriptorCount must match the accelerationStructureCount
@@ -1531,10 +1539,10 @@ vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const vvl::DeviceState &device
                     break;
                 }
                 case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV: {
-                    VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv[i];
+                    VkWriteDescriptorSetAccelerationStructureNV *inline_info_nv = &inline_infos_nv.emplace_back();
                     inline_info_nv->sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV;
                     inline_info_nv->pNext = nullptr;
-                    inline_info_nv->accelerationStructureCount = descriptor_update_entry.descriptorCount;
+                    inline_info_nv->accelerationStructureCount = 1;
                     inline_info_nv->pAccelerationStructures = reinterpret_cast<VkAccelerationStructureNV *>(update_entry);
                     write_entry.pNext = inline_info_nv;
                     // descriptorCount must match the accelerationStructureCount
@@ -1545,12 +1553,7 @@ vvl::DecodedTemplateUpdate::DecodedTemplateUpdate(const vvl::DeviceState &device
                     assert(false);
                     break;
             }
-            dst_array_element++;
-
-            // If acceleration structure, we only create a single VkWriteDescriptorSet and map the actually AS into
-            // VkWriteDescriptorSetAccelerationStructureKHR
-            if (descriptor_update_entry.descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR ||
-                descriptor_update_entry.descriptorType == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV) {
+            if (run.type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK) {
                 break;
             }
         }
@@ -2348,7 +2351,7 @@ bool CoreChecks::ValidateCmdSetDescriptorBufferOffsets(const vvl::CommandBuffer
     bool skip = false;
     skip |= ValidateCmd(cb_state, loc);
 
-    auto pipeline_layout = Get<vvl::PipelineLayout>(layout);
+    auto pipeline_layout = GetBorrowed<vvl::PipelineLayout>(layout);
     if (!pipeline_layout) {
         return skip;  // dynamicPipelineLayout
     }
@@ -2578,7 +2581,7 @@ bool CoreChecks::ValidateCmdBindDescriptorBufferEmbeddedSamplers(const vvl::Comm
         skip |= LogError(vuid, cb_state.Handle(), loc, "descriptorBuffer feature was not enabled.");
     }
 
-    auto pipeline_layout = Get<vvl::PipelineLayout>(layout);
+    auto pipeline_layout = GetBorrowed<vvl::PipelineLayout>(layout);
     if (!pipeline_layout) return skip;  // dynamicPipelineLayout
 
     if (set >= pipeline_layout->set_layouts.list.size()) {
@@ -3722,7 +3725,7 @@ bool CoreChecks::ValidateCmdPushDescriptorSet(const vvl::CommandBuffer &cb_state
     bool skip = false;
     const bool is_2 = loc.function != Func::vkCmdPushDescriptorSetKHR && loc.function != Func::vkCmdPushDescriptorSet;
 
-    auto pipeline_layout = Get<vvl::PipelineLayout>(layout);
+    auto pipeline_layout = GetBorrowed<vvl::PipelineLayout>(layout);
     if (!pipeline_layout) return skip;  // dynamicPipelineLayout
 
     // Validate the set index points to a push descriptor set and is in range
@@ -3955,7 +3958,7 @@ bool CoreChecks::ValidateCmdPushDescriptorSetWithTemplate(VkCommandBuffer comman
                          set, FormatHandle(dsl->Handle()).c_str(), FormatHandle(layout).c_str());
     }
 
-    auto template_state = Get<vvl::DescriptorUpdateTemplate>(descriptorUpdateTemplate);
+    auto template_state = GetBorrowed<vvl::DescriptorUpdateTemplate>(descriptorUpdateTemplate);
     if (!template_state) {
         return skip;
     }
@@ -4837,7 +4840,7 @@ bool CoreChecks::ValidateCmdPushConstants(VkCommandBuffer commandBuffer, VkPipel
 
     // Check if pipeline_layout VkPushConstantRange(s) overlapping offset, size have stageFlags set for each stage in the command
     // stageFlags argument, *and* that the command stageFlags argument has bits set for the stageFlags in each overlapping range.
-    auto layout_state = Get<vvl::PipelineLayout>(layout);
+    auto layout_state = GetBorrowed<vvl::PipelineLayout>(layout);
     if (!layout_state) return skip;  // dynamicPipelineLayout feature
 
     const bool is_2 = loc.function != Func::vkCmdPushConstants;
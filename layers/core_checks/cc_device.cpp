@@ -19,7 +19,6 @@
  * This file deals with anything related to Phyiscal Devices, Logical Devices, or Device Queues Families, Device Masks, etc
  */
 
-#include <fstream>
 #include <vector>
 
 #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
@@ -33,10 +32,12 @@
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/cmd_buffer_state.h"
 #include "state_tracker/pipeline_state.h"
+#include "state_tracker/shader_module.h"
 #include <spirv-tools/libspirv.h>
 #include "generated/dispatch_functions.h"
 #include "error_message/error_strings.h"
 #include "utils/file_system_utils.h"
+#include "utils/shader_utils.h"
 
 bool CoreChecks::ValidateDeviceQueueFamily(uint32_t queue_family, const Location &loc, const char *vuid,
                                            bool optional = false) const {
@@ -358,22 +359,33 @@ void CoreChecks::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const
 #endif
         validation_cache_path += ".bin";
 
-        std::vector<char> validation_cache_data;
-        std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
-
-        if (read_file) {
-            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(validation_cache_data));
-            read_file.close();
-        } else {
-            LogInfo("WARNING-cache-file-error", device, loc,
-                    "Cannot open shader validation cache at %s for reading (it may not exist yet)", validation_cache_path.c_str());
-        }
-
         VkValidationCacheCreateInfoEXT cacheCreateInfo = vku::InitStructHelper();
-        cacheCreateInfo.initialDataSize = validation_cache_data.size();
-        cacheCreateInfo.pInitialData = validation_cache_data.data();
         cacheCreateInfo.flags = 0;
         CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
+
+        // New hashes are appended to the file as they are found, so there is nothing to write back at vkDestroyDevice
+        if (!CastFromHandle<ValidationCache *>(core_validation_cache)->AttachFile(validation_cache_path)) {
+            LogInfo("WARNING-cache-file-error", device, loc, "Cannot open shader validation cache at %s",
+                    validation_cache_path.c_str());
+        }
+    }
+
+    // The module cache vouches for the checks done in PreCallRecordCreateShaderModule, so it lives and dies with them
+    if (!disabled[shader_validation_caching] && !disabled[shader_validation] && !device_state->shader_module_cache) {
+        std::string module_cache_path = GetTempFilePath() + "/shader_module_cache";
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
+        module_cache_path += "-" + std::to_string(getuid());
+#endif
+        module_cache_path += ".bin";
+
+        uint8_t uuid[VK_UUID_SIZE];
+        GetShaderModuleCacheUUID(api_version, *pCreateInfo, enabled_features, phys_dev_props, spirv_val_option_hash, uuid);
+        device_state->shader_module_cache = std::make_unique<spirv::ModuleCache>();
+        if (!device_state->shader_module_cache->Load(module_cache_path, uuid)) {
+            LogInfo("WARNING-cache-file-error", device, loc,
+                    "Cannot use shader module cache at %s (it may not exist yet or is from a different layer/device configuration)",
+                    module_cache_path.c_str());
+        }
     }
 }
 
@@ -383,39 +395,15 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
 
     BaseClass::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
-    if (core_validation_cache) {
-        Location loc(Func::vkDestroyDevice);
-        size_t validation_cache_size = 0;
-        void *validation_cache_data = nullptr;
-
-        CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
-
-        validation_cache_data = (char *)malloc(sizeof(char) * validation_cache_size);
-        if (!validation_cache_data) {
-            LogInfo("WARNING-cache-memory-error", device, loc, "Validation Cache Memory Error");
-            return;
-        }
-
-        VkResult result =
-            CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, validation_cache_data);
-
-        if (result != VK_SUCCESS) {
-            LogInfo("WARNING-cache-retrieval-error", device, loc, "Validation Cache Retrieval Error");
-            free(validation_cache_data);
-            return;
+    if (device_state->shader_module_cache) {
+        if (!device_state->shader_module_cache->Save()) {
+            LogInfo("WARNING-cache-write-error", device, Location(Func::vkDestroyDevice),
+                    "Cannot write out the shader module cache");
         }
+        device_state->shader_module_cache.reset();
+    }
 
-        if (validation_cache_path.size() > 0) {
-            std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
-            if (write_file) {
-                write_file.write(static_cast<char *>(validation_cache_data), validation_cache_size);
-                write_file.close();
-            } else {
-                LogInfo("WARNING-cache-write-error", device, loc, "Cannot open shader validation cache at %s for writing",
-                        validation_cache_path.c_str());
-            }
-        }
-        free(validation_cache_data);
+    if (core_validation_cache) {
         CoreLayerDestroyValidationCacheEXT(device, core_validation_cache, NULL);
     }
 }
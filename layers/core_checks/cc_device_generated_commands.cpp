@@ -543,7 +543,7 @@ bool CoreChecks::PreCallValidateCmdExecuteGeneratedCommandsEXT(VkCommandBuffer c
     }
 
     const Location info_loc = error_obj.location.dot(Field::pGeneratedCommandsInfo);
-    const auto indirect_commands_layout = Get<vvl::IndirectCommandsLayout>(pGeneratedCommandsInfo->indirectCommandsLayout);
+    const auto indirect_commands_layout = GetBorrowed<vvl::IndirectCommandsLayout>(pGeneratedCommandsInfo->indirectCommandsLayout);
     ASSERT_AND_RETURN_SKIP(indirect_commands_layout);
 
     const bool preprocess_usage_flag =
@@ -576,7 +576,7 @@ bool CoreChecks::PreCallValidateCmdExecuteGeneratedCommandsEXT(VkCommandBuffer c
         }
     }
 
-    if (auto indirect_execution_set = Get<vvl::IndirectExecutionSet>(pGeneratedCommandsInfo->indirectExecutionSet)) {
+    if (auto indirect_execution_set = GetBorrowed<vvl::IndirectExecutionSet>(pGeneratedCommandsInfo->indirectExecutionSet)) {
         const LogObjectList objlist(commandBuffer, indirect_commands_layout->Handle(), indirect_execution_set->Handle());
         skip |= ValidateGeneratedCommandsInitialShaderState(cb_state, *indirect_commands_layout, *indirect_execution_set,
                                                             pGeneratedCommandsInfo->shaderStages, objlist,
@@ -687,7 +687,7 @@ bool CoreChecks::PreCallValidateCmdPreprocessGeneratedCommandsEXT(VkCommandBuffe
     }
 
     const Location info_loc = error_obj.location.dot(Field::pGeneratedCommandsInfo);
-    const auto indirect_commands_layout = Get<vvl::IndirectCommandsLayout>(pGeneratedCommandsInfo->indirectCommandsLayout);
+    const auto indirect_commands_layout = GetBorrowed<vvl::IndirectCommandsLayout>(pGeneratedCommandsInfo->indirectCommandsLayout);
     ASSERT_AND_RETURN_SKIP(indirect_commands_layout);
 
     if ((indirect_commands_layout->create_info.flags & VK_INDIRECT_COMMANDS_LAYOUT_USAGE_EXPLICIT_PREPROCESS_BIT_EXT) == 0) {
@@ -26,6 +26,7 @@
 #include "error_message/logging.h"
 #include "generated/spirv_grammar_helper.h"
 #include "generated/vk_extension_helper.h"
+#include "profiling/profiling.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/image_state.h"
 #include "state_tracker/last_bound_state.h"
@@ -341,7 +342,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndirect(VkCommandBuffer commandBuffer, V
     skip |= ValidateVTGShaderStages(last_bound_state, vuid);
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
 
@@ -399,7 +400,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirect(VkCommandBuffer commandBu
     }
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
 
@@ -570,7 +571,7 @@ bool CoreChecks::PreCallValidateCmdDispatchIndirect(VkCommandBuffer commandBuffe
     skip |= ValidateActionState(last_bound_state, vuid);
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
         if (offset & 3) {
@@ -620,13 +621,13 @@ bool CoreChecks::PreCallValidateCmdDrawIndirectCount(VkCommandBuffer commandBuff
     }
 
     {
-        auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+        auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
         ASSERT_AND_RETURN_SKIP(count_buffer_state);
         skip |= ValidateIndirectCountCmd(cb_state, *count_buffer_state, countBufferOffset, vuid);
     }
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
         skip |= ValidateCmdDrawStrideWithStruct(cb_state, "VUID-vkCmdDrawIndirectCount-stride-03110", stride,
@@ -678,7 +679,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer comm
     }
 
     {
-        auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+        auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
         ASSERT_AND_RETURN_SKIP(count_buffer_state);
         skip |= ValidateIndirectCountCmd(cb_state, *count_buffer_state, countBufferOffset, vuid);
     }
@@ -689,7 +690,7 @@ bool CoreChecks::PreCallValidateCmdDrawIndexedIndirectCount(VkCommandBuffer comm
     }
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         if (maxDrawCount > 1) {
             skip |= ValidateCmdDrawStrideWithBuffer(cb_state, "VUID-vkCmdDrawIndexedIndirectCount-maxDrawCount-03143", stride,
@@ -870,7 +871,7 @@ bool CoreChecks::PreCallValidateCmdTraceRaysNV(VkCommandBuffer commandBuffer, Vk
                          "must be less than or equal to VkPhysicalDeviceLimits::maxComputeWorkGroupCount[2].");
     }
 
-    auto callable_shader_buffer_state = Get<vvl::Buffer>(callableShaderBindingTableBuffer);
+    auto callable_shader_buffer_state = GetBorrowed<vvl::Buffer>(callableShaderBindingTableBuffer);
     if (callable_shader_buffer_state && callableShaderBindingOffset >= callable_shader_buffer_state->create_info.size) {
         LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR);
         objlist.add(callableShaderBindingTableBuffer);
@@ -879,7 +880,7 @@ bool CoreChecks::PreCallValidateCmdTraceRaysNV(VkCommandBuffer commandBuffer, Vk
                          "%" PRIu64 " must be less than the size of callableShaderBindingTableBuffer %" PRIu64 " .",
                          callableShaderBindingOffset, callable_shader_buffer_state->create_info.size);
     }
-    auto hit_shader_buffer_state = Get<vvl::Buffer>(hitShaderBindingTableBuffer);
+    auto hit_shader_buffer_state = GetBorrowed<vvl::Buffer>(hitShaderBindingTableBuffer);
     if (hit_shader_buffer_state && hitShaderBindingOffset >= hit_shader_buffer_state->create_info.size) {
         LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR);
         objlist.add(hitShaderBindingTableBuffer);
@@ -888,7 +889,7 @@ bool CoreChecks::PreCallValidateCmdTraceRaysNV(VkCommandBuffer commandBuffer, Vk
                          "%" PRIu64 " must be less than the size of hitShaderBindingTableBuffer %" PRIu64 " .",
                          hitShaderBindingOffset, hit_shader_buffer_state->create_info.size);
     }
-    auto miss_shader_buffer_state = Get<vvl::Buffer>(missShaderBindingTableBuffer);
+    auto miss_shader_buffer_state = GetBorrowed<vvl::Buffer>(missShaderBindingTableBuffer);
     if (miss_shader_buffer_state && missShaderBindingOffset >= miss_shader_buffer_state->create_info.size) {
         LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR);
         objlist.add(missShaderBindingTableBuffer);
@@ -897,7 +898,7 @@ bool CoreChecks::PreCallValidateCmdTraceRaysNV(VkCommandBuffer commandBuffer, Vk
                          "%" PRIu64 " must be less than the size of missShaderBindingTableBuffer %" PRIu64 " .",
                          missShaderBindingOffset, miss_shader_buffer_state->create_info.size);
     }
-    auto raygen_shader_buffer_state = Get<vvl::Buffer>(raygenShaderBindingTableBuffer);
+    auto raygen_shader_buffer_state = GetBorrowed<vvl::Buffer>(raygenShaderBindingTableBuffer);
     if (raygenShaderBindingOffset >= raygen_shader_buffer_state->create_info.size) {
         LogObjectList objlist = cb_state.GetObjectList(VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR);
         objlist.add(raygenShaderBindingTableBuffer);
@@ -1175,13 +1176,13 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountNV(VkCommandBuffer
     }
 
     {
-        auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+        auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
         ASSERT_AND_RETURN_SKIP(count_buffer_state);
         skip |= ValidateIndirectCountCmd(cb_state, *count_buffer_state, countBufferOffset, vuid);
     }
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
         skip |= ValidateCmdDrawStrideWithStruct(cb_state, "VUID-vkCmdDrawMeshTasksIndirectCountNV-stride-02182", stride,
@@ -1274,7 +1275,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectEXT(VkCommandBuffer comm
     skip |= ValidateMeshShaderStage(last_bound_state, vuid, false);
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
 
@@ -1326,7 +1327,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
     skip |= ValidateActionState(last_bound_state, vuid);
     skip |= ValidateMeshShaderStage(last_bound_state, vuid, false);
 
-    auto count_buffer_state = Get<vvl::Buffer>(countBuffer);
+    auto count_buffer_state = GetBorrowed<vvl::Buffer>(countBuffer);
     ASSERT_AND_RETURN_SKIP(count_buffer_state);
     skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *count_buffer_state, error_obj.location.dot(Field::countBuffer),
                                           vuid.indirect_count_contiguous_memory_02714);
@@ -1335,7 +1336,7 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
                                      error_obj.location.dot(Field::countBuffer));
 
     {
-        auto indirect_buffer_state = Get<vvl::Buffer>(buffer);
+        auto indirect_buffer_state = GetBorrowed<vvl::Buffer>(buffer);
         ASSERT_AND_RETURN_SKIP(indirect_buffer_state);
 
         skip |= ValidateIndirectCmd(cb_state, *indirect_buffer_state, vuid);
@@ -1434,17 +1435,18 @@ bool CoreChecks::ValidateActionState(const LastBound &last_bound_state, const Dr
 
 // Validate the draw-time state for this descriptor set
 // We can skip validating the descriptor set if "nothing" has changed since the last validation.
-// Same set, no image layout changes, and same "pipeline state" (binding_req_map). If there are
-// any dynamic descriptors, always revalidate rather than caching the values. We currently only
-// apply this optimization if IsManyDescriptors is true, to avoid the overhead of copying the
-// binding_req_map which could potentially be expensive.
-static bool NeedDrawStateValidated(const vvl::CommandBuffer &cb_state, const vvl::DescriptorSet *descriptor_set,
-                                   const LastBound::DescriptorSetSlot &ds_slot, bool disabled_image_layout_validation) {
-    return ds_slot.dynamic_offsets.size() > 0 ||
-           // Revalidate if descriptor set (or contents) has changed
-           ds_slot.validated_set != descriptor_set || ds_slot.validated_set_change_count != descriptor_set->GetChangeCount() ||
-           (!disabled_image_layout_validation &&
-            ds_slot.validated_set_image_layout_change_count != cb_state.image_layout_change_count);
+// Same set and contents, same dynamic offsets, no image layout changes, same render pass attachments and same "pipeline state"
+// (the bound pipeline or shader objects, see LastBound::DescriptorValidationKey). The last validated state is stored at record
+// time in CommandBufferSubState::RecordActionCommand, so only draws that passed validation are remembered.
+bool CoreChecks::NeedDrawStateValidated(const LastBound &last_bound_state, uint32_t set_index) const {
+    const auto &ds_slot = last_bound_state.ds_slots[set_index];
+    const bool need_validate = ds_slot.NeedValidation(last_bound_state.cb_state, last_bound_state.DescriptorValidationKey(),
+                                                      !disabled[image_layout_validation]);
+    const uint64_t lookups = draw_state_cache_stats.Add(need_validate);
+    if ((lookups % kDrawStateCacheStatsPlotInterval) == 0) {
+        VVL_TracyPlot("Draw descriptor validation cache hit %", draw_state_cache_stats.HitRate() * 100.0);
+    }
+    return need_validate;
 }
 
 bool CoreChecks::ValidateActionStateDescriptorsPipeline(const LastBound &last_bound_state, const VkPipelineBindPoint bind_point,
@@ -1549,9 +1551,7 @@ bool CoreChecks::ValidateActionStateDescriptorsPipeline(const LastBound &last_bo
                 const auto *descriptor_set = ds_slot.ds_state.get();
                 ASSERT_AND_CONTINUE(descriptor_set);
 
-                const bool need_validate =
-                    NeedDrawStateValidated(cb_state, descriptor_set, ds_slot, disabled[image_layout_validation]);
-                if (need_validate) {
+                if (NeedDrawStateValidated(last_bound_state, set_index)) {
                     skip |= ValidateDrawState(*descriptor_set, set_index, binding_req_map, cb_state, vuid,
                                               LogObjectList(pipeline.Handle()));
                 }
@@ -1624,9 +1624,7 @@ bool CoreChecks::ValidateActionStateDescriptorsShaderObject(const LastBound &las
                     const auto *descriptor_set = ds_slot.ds_state.get();
                     ASSERT_AND_CONTINUE(descriptor_set);
 
-                    const bool need_validate =
-                        NeedDrawStateValidated(cb_state, descriptor_set, ds_slot, disabled[image_layout_validation]);
-                    if (need_validate) {
+                    if (NeedDrawStateValidated(last_bound_state, set_index)) {
                         skip |= ValidateDrawState(*descriptor_set, set_index, binding_req_map, cb_state, vuid,
                                                   LogObjectList(shader_state->Handle()));
                     }
@@ -914,7 +914,7 @@ bool CoreChecks::PreCallValidateCmdClearColorImage(VkCommandBuffer commandBuffer
     bool skip = false;
     // TODO : Verify memory is in VK_IMAGE_STATE_CLEAR state
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto image_state_ptr = Get<vvl::Image>(image);
+    auto image_state_ptr = GetBorrowed<vvl::Image>(image);
     ASSERT_AND_RETURN_SKIP(image_state_ptr);
 
     const auto &cb_state = *cb_state_ptr;
@@ -990,7 +990,7 @@ bool CoreChecks::PreCallValidateCmdClearDepthStencilImage(VkCommandBuffer comman
 
     // TODO : Verify memory is in VK_IMAGE_STATE_CLEAR state
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto image_state_ptr = Get<vvl::Image>(image);
+    auto image_state_ptr = GetBorrowed<vvl::Image>(image);
     ASSERT_AND_RETURN_SKIP(image_state_ptr);
 
     const auto &cb_state = *cb_state_ptr;
@@ -392,7 +392,7 @@ bool CoreChecks::PreCallValidateCmdBindPipeline(VkCommandBuffer commandBuffer, V
     skip |= ValidateCmd(*cb_state, error_obj.location);
     skip |= ValidatePipelineBindPoint(*cb_state, pipelineBindPoint, error_obj.location);
 
-    auto pipeline_ptr = Get<vvl::Pipeline>(pipeline);
+    const vvl::Pipeline *pipeline_ptr = GetBorrowed<vvl::Pipeline>(pipeline);
     ASSERT_AND_RETURN_SKIP(pipeline_ptr);
     const vvl::Pipeline &pipeline_state = *pipeline_ptr;
 
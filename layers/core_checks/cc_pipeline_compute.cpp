@@ -31,38 +31,52 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
     bool skip = false;
 
     skip |= ValidateDeviceQueueSupport(error_obj.location);
+
+    SpirvValPrefetch spirv_val_prefetch(*this);
     for (uint32_t i = 0; i < count; i++) {
-        const vvl::Pipeline *pipeline = pipeline_states[i].get();
-        ASSERT_AND_CONTINUE(pipeline);
+        spirv_val_prefetch.Add(pCreateInfos[i].stage);
+    }
 
+    skip |= device_state->ForEachPipeline(count, [&](uint32_t i) {
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
-        const Location stage_info = create_info_loc.dot(Field::stage);
-        const auto &stage_state = pipeline->stage_states[0];
-        skip |= ValidateShaderStage(stage_state, pipeline, stage_info);
-        if (stage_state.pipeline_create_info) {
-            skip |= ValidatePipelineShaderStage(*pipeline, *stage_state.pipeline_create_info, pCreateInfos[i].pNext, stage_info);
-        }
+        return ValidateComputePipeline(pipeline_states, i, pCreateInfos[i], chassis_state, create_info_loc);
+    });
+    return skip;
+}
+
+bool CoreChecks::ValidateComputePipeline(PipelineStates &pipeline_states, uint32_t pipe_index,
+                                         const VkComputePipelineCreateInfo &create_info,
+                                         const chassis::CreateComputePipelines &chassis_state,
+                                         const Location &create_info_loc) const {
+    bool skip = false;
+    const vvl::Pipeline *pipeline = pipeline_states[pipe_index].get();
+    ASSERT_AND_RETURN_SKIP(pipeline);
 
-        skip |= ValidateComputePipelineDerivatives(pipeline_states, i, create_info_loc);
-        const Location flags_loc = pipeline->GetCreateFlagsLoc(create_info_loc);
-        skip |= ValidatePipelineCacheControlFlags(pipeline->create_flags, flags_loc,
-                                                  "VUID-VkComputePipelineCreateInfo-pipelineCreationCacheControl-02875");
-        skip |= ValidatePipelineIndirectBindableFlags(pipeline->create_flags, flags_loc,
-                                                      "VUID-VkComputePipelineCreateInfo-flags-09007");
+    const Location stage_info = create_info_loc.dot(Field::stage);
+    const auto &stage_state = pipeline->stage_states[0];
+    skip |= ValidateShaderStage(stage_state, pipeline, stage_info);
+    if (stage_state.pipeline_create_info) {
+        skip |= ValidatePipelineShaderStage(*pipeline, *stage_state.pipeline_create_info, create_info.pNext, stage_info);
+    }
 
-        if (const auto *pipeline_robustness_info =
-                vku::FindStructInPNextChain<VkPipelineRobustnessCreateInfo>(pCreateInfos[i].pNext)) {
-            skip |= ValidatePipelineRobustnessCreateInfo(*pipeline, *pipeline_robustness_info, create_info_loc);
-        }
+    skip |= ValidateComputePipelineDerivatives(pipeline_states, pipe_index, create_info_loc);
+    const Location flags_loc = pipeline->GetCreateFlagsLoc(create_info_loc);
+    skip |= ValidatePipelineCacheControlFlags(pipeline->create_flags, flags_loc,
+                                              "VUID-VkComputePipelineCreateInfo-pipelineCreationCacheControl-02875");
+    skip |=
+        ValidatePipelineIndirectBindableFlags(pipeline->create_flags, flags_loc, "VUID-VkComputePipelineCreateInfo-flags-09007");
 
-        // From dumping traces, we found almost all apps only create one pipeline at a time. To greatly simplify the logic, only
-        // check the stateless validation in the pNext chain for the first pipeline. (The core issue is because we parse the SPIR-V
-        // at state tracking time, and we state track pipelines first)
-        if (i == 0 && chassis_state.stateless_data.pipeline_pnext_module) {
-            skip |= stateless_spirv_validator.Validate(
-                *chassis_state.stateless_data.pipeline_pnext_module, chassis_state.stateless_data,
-                create_info_loc.dot(Field::stage).pNext(Struct::VkShaderModuleCreateInfo, Field::pCode));
-        }
+    if (const auto *pipeline_robustness_info = vku::FindStructInPNextChain<VkPipelineRobustnessCreateInfo>(create_info.pNext)) {
+        skip |= ValidatePipelineRobustnessCreateInfo(*pipeline, *pipeline_robustness_info, create_info_loc);
+    }
+
+    // From dumping traces, we found almost all apps only create one pipeline at a time. To greatly simplify the logic, only
+    // check the stateless validation in the pNext chain for the first pipeline. (The core issue is because we parse the SPIR-V
+    // at state tracking time, and we state track pipelines first)
+    if (pipe_index == 0 && chassis_state.stateless_data.pipeline_pnext_module) {
+        skip |= stateless_spirv_validator.Validate(
+            *chassis_state.stateless_data.pipeline_pnext_module, chassis_state.stateless_data,
+            create_info_loc.dot(Field::stage).pNext(Struct::VkShaderModuleCreateInfo, Field::pCode));
     }
     return skip;
 }
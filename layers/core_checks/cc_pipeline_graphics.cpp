@@ -53,10 +53,19 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
     bool skip = false;
 
     skip |= ValidateDeviceQueueSupport(error_obj.location);
+
+    SpirvValPrefetch spirv_val_prefetch(*this);
     for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t stage = 0; stage < pCreateInfos[i].stageCount; stage++) {
+            spirv_val_prefetch.Add(pCreateInfos[i].pStages[stage]);
+        }
+    }
+
+    skip |= device_state->ForEachPipeline(count, [&](uint32_t i) {
+        bool pipeline_skip = false;
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
-        skip |= ValidateGraphicsPipeline(*pipeline_states[i].get(), pCreateInfos[i].pNext, create_info_loc);
-        skip |= ValidateGraphicsPipelineDerivatives(pipeline_states, i, create_info_loc);
+        pipeline_skip |= ValidateGraphicsPipeline(*pipeline_states[i].get(), pCreateInfos[i].pNext, create_info_loc);
+        pipeline_skip |= ValidateGraphicsPipelineDerivatives(pipeline_states, i, create_info_loc);
 
         // From dumping traces, we found almost all apps only create one pipeline at a time. To greatly simplify the logic, only
         // check the stateless validation in the pNext chain for the first pipeline. (The core issue is because we parse the SPIR-V
@@ -65,13 +74,14 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
             uint32_t stage_count = std::min(pCreateInfos[0].stageCount, kCommonMaxGraphicsShaderStages);
             for (uint32_t stage = 0; stage < stage_count; stage++) {
                 if (chassis_state.stateless_data[stage].pipeline_pnext_module) {
-                    skip |= stateless_spirv_validator.Validate(
+                    pipeline_skip |= stateless_spirv_validator.Validate(
                         *chassis_state.stateless_data[stage].pipeline_pnext_module, chassis_state.stateless_data[stage],
                         create_info_loc.dot(Field::pStages, stage).pNext(Struct::VkShaderModuleCreateInfo, Field::pCode));
                 }
             }
         }
-    }
+        return pipeline_skip;
+    });
     return skip;
 }
 
@@ -1319,7 +1329,7 @@ bool CoreChecks::ValidateGraphicsPipelineMeshTask(const vvl::Pipeline &pipeline,
         return skip;  // checks require optional task shader
     }
 
-    if (mesh_state->spirv_state && mesh_state->spirv_state->static_data_.has_builtin_draw_index) {
+    if (mesh_state->spirv_state && mesh_state->spirv_state->GetStaticData().has_builtin_draw_index) {
         // There is a dedicated equivalent for shader object
         skip |= LogError("VUID-VkGraphicsPipelineCreateInfo-pStages-09631", device, create_info_loc,
                          "The pipeline is being created with a Task and Mesh shader bound, but the Mesh Shader "
@@ -4169,7 +4179,7 @@ bool CoreChecks::ValidateMultiViewShaders(const vvl::Pipeline &pipeline, const L
         // Stage may not have SPIR-V data (e.g. due to the use of shader module identifier or in Vulkan SC)
         if (!stage.spirv_state) continue;
 
-        if (stage.spirv_state->static_data_.has_builtin_layer) {
+        if (stage.spirv_state->GetStaticData().has_builtin_layer) {
             // Special case for GLSL and Mesh Shading discussed in https://gitlab.khronos.org/vulkan/vulkan/-/issues/4194
             const char *vuid = dynamic_rendering ? "VUID-VkGraphicsPipelineCreateInfo-renderPass-06059"
                                                  : "VUID-VkGraphicsPipelineCreateInfo-renderPass-06050";
@@ -744,7 +744,7 @@ bool CoreChecks::PreCallValidateCmdBeginQuery(VkCommandBuffer commandBuffer, VkQ
     if (disabled[query_validation]) return false;
     bool skip = false;
     auto cb_state = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto query_pool_state = Get<vvl::QueryPool>(queryPool);
+    auto query_pool_state = GetBorrowed<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
 
     if (query_pool_state->create_info.queryType == VK_QUERY_TYPE_PRIMITIVES_GENERATED_EXT) {
@@ -880,7 +880,7 @@ bool CoreChecks::ValidateCmdEndQuery(const vvl::CommandBuffer &cb_state, VkQuery
         skip |= LogError(vuid, objlist, loc, "Ending a query before it was started: %s, index %d.", FormatHandle(queryPool).c_str(),
                          slot);
     }
-    auto query_pool_state = Get<vvl::QueryPool>(queryPool);
+    auto query_pool_state = GetBorrowed<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
 
     const vvl::RenderPass *rp_state = cb_state.active_render_pass.get();
@@ -941,7 +941,7 @@ bool CoreChecks::PreCallValidateCmdEndQuery(VkCommandBuffer commandBuffer, VkQue
     if (disabled[query_validation]) return skip;
     auto cb_state = GetRead<vvl::CommandBuffer>(commandBuffer);
 
-    const auto query_pool_state = Get<vvl::QueryPool>(queryPool);
+    const auto query_pool_state = GetBorrowed<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
 
     const uint32_t available_query_count = query_pool_state->create_info.queryCount;
@@ -1002,7 +1002,7 @@ bool CoreChecks::PreCallValidateCmdResetQueryPool(VkCommandBuffer commandBuffer,
 
     skip |= ValidateCmd(*cb_state, error_obj.location);
 
-    const auto query_pool_state = Get<vvl::QueryPool>(queryPool);
+    const auto query_pool_state = GetBorrowed<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
     skip |= ValidateQueryPoolIndex(commandBuffer, *query_pool_state, firstQuery, queryCount, error_obj.location,
                                    "VUID-vkCmdResetQueryPool-firstQuery-09436", "VUID-vkCmdResetQueryPool-firstQuery-09437");
@@ -1019,7 +1019,7 @@ bool CoreChecks::PreCallValidateCmdCopyQueryPoolResults(VkCommandBuffer commandB
     bool skip = false;
     if (disabled[query_validation]) return skip;
     auto cb_state = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto dst_buff_state = Get<vvl::Buffer>(dstBuffer);
+    auto dst_buff_state = GetBorrowed<vvl::Buffer>(dstBuffer);
     ASSERT_AND_RETURN_SKIP(dst_buff_state);
 
     const LogObjectList buffer_objlist(commandBuffer, dstBuffer);
@@ -1056,7 +1056,7 @@ bool CoreChecks::PreCallValidateCmdCopyQueryPoolResults(VkCommandBuffer commandB
                          "is %" PRIu32 " but stride is zero.", queryCount);
     }
 
-    const auto query_pool_state = Get<vvl::QueryPool>(queryPool);
+    const auto query_pool_state = GetBorrowed<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
 
     skip |= ValidateQueryPoolIndex(commandBuffer, *query_pool_state, firstQuery, queryCount, error_obj.location,
@@ -1115,7 +1115,7 @@ bool CoreChecks::ValidateCmdWriteTimestamp(const vvl::CommandBuffer &cb_state, V
                      FormatHandle(queryPool).c_str(), cb_state.command_pool->queueFamilyIndex);
     }
 
-    const auto query_pool_state = Get<vvl::QueryPool>(queryPool);
+    const auto query_pool_state = GetBorrowed<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
 
     if (query_pool_state->create_info.queryType != VK_QUERY_TYPE_TIMESTAMP) {
@@ -1251,7 +1251,7 @@ bool CoreChecks::PreCallValidateCmdEndQueryIndexedEXT(VkCommandBuffer commandBuf
     skip |= ValidateCmdEndQuery(*cb_state, queryPool, slot, index, error_obj.location);
     skip |= ValidateCmd(*cb_state, error_obj.location);
 
-    const auto query_pool_state = Get<vvl::QueryPool>(queryPool);
+    const auto query_pool_state = GetBorrowed<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
 
     const auto &query_pool_ci = query_pool_state->create_info;
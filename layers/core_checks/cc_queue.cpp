@@ -156,14 +156,14 @@ private:
 bool CoreChecks::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence,
                                             const ErrorObject &error_obj) const {
     bool skip = false;
-    if (auto fence_state = Get<vvl::Fence>(fence)) {
+    if (auto fence_state = GetBorrowed<vvl::Fence>(fence)) {
         const LogObjectList objlist(queue, fence);
         skip |= ValidateFenceForSubmit(*fence_state, "VUID-vkQueueSubmit-fence-00064", "VUID-vkQueueSubmit-fence-00063", objlist,
                                        error_obj.location);
     }
     if (skip) return skip;
 
-    auto queue_state = Get<vvl::Queue>(queue);
+    auto queue_state = GetBorrowed<vvl::Queue>(queue);
     ASSERT_AND_RETURN_SKIP(queue_state);
     CommandBufferSubmitState cb_submit_state(*this, *queue_state);
     SemaphoreSubmitState sem_submit_state(*this, queue, queue_state->queue_family_properties.queueFlags);
@@ -662,14 +662,14 @@ bool CoreChecks::ValidatePrimaryCommandBufferState(
 bool CoreChecks::PreCallValidateQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *pBindInfo,
                                                 VkFence fence, const ErrorObject &error_obj) const {
     bool skip = false;
-    if (auto fence_state = Get<vvl::Fence>(fence)) {
+    if (auto fence_state = GetBorrowed<vvl::Fence>(fence)) {
         const LogObjectList objlist(queue, fence);
         skip |= ValidateFenceForSubmit(*fence_state, "VUID-vkQueueBindSparse-fence-01114", "VUID-vkQueueBindSparse-fence-01113",
                                        objlist, error_obj.location);
     }
     if (skip) return skip;
 
-    auto queue_state = Get<vvl::Queue>(queue);
+    auto queue_state = GetBorrowed<vvl::Queue>(queue);
     const VkQueueFlags queue_flags = queue_state->queue_family_properties.queueFlags;
     if (!(queue_flags & VK_QUEUE_SPARSE_BINDING_BIT)) {
         skip |= LogError("VUID-vkQueueBindSparse-queuetype", queue, error_obj.location,
@@ -1268,8 +1268,8 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructureNV(VkCommandBuffer
                          pInfo->geometryCount);
     }
 
-    auto dst_as_state = Get<vvl::AccelerationStructureNV>(dst);
-    auto src_as_state = Get<vvl::AccelerationStructureNV>(src);
+    auto dst_as_state = GetBorrowed<vvl::AccelerationStructureNV>(dst);
+    auto src_as_state = GetBorrowed<vvl::AccelerationStructureNV>(src);
 
     if (dst_as_state && pInfo) {
         if (dst_as_state->create_info.info.type != pInfo->type) {
@@ -1341,7 +1341,7 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructureNV(VkCommandBuffer
                                          error_obj.location.dot(Field::dst), "VUID-vkCmdBuildAccelerationStructureNV-dst-07787");
     }
 
-    auto scratch_buffer_state = Get<vvl::Buffer>(scratch);
+    auto scratch_buffer_state = GetBorrowed<vvl::Buffer>(scratch);
     if (update == VK_TRUE) {
         if (src == VK_NULL_HANDLE) {
             skip |= LogError("VUID-vkCmdBuildAccelerationStructureNV-update-02489", commandBuffer, error_obj.location,
@@ -1380,7 +1380,7 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructureNV(VkCommandBuffer
         }
     }
     if (instanceData != VK_NULL_HANDLE) {
-        if (auto buffer_state = Get<vvl::Buffer>(instanceData)) {
+        if (auto buffer_state = GetBorrowed<vvl::Buffer>(instanceData)) {
             skip |= ValidateBufferUsageFlags(
                 LogObjectList(commandBuffer, instanceData), *buffer_state, VK_BUFFER_USAGE_2_RAY_TRACING_BIT_NV, true,
                 "VUID-VkAccelerationStructureInfoNV-instanceData-02782", error_obj.location.dot(Field::instanceData));
@@ -1402,8 +1402,8 @@ bool CoreChecks::PreCallValidateCmdCopyAccelerationStructureNV(VkCommandBuffer c
     bool skip = false;
 
     skip |= ValidateCmd(*cb_state, error_obj.location);
-    auto dst_as_state = Get<vvl::AccelerationStructureNV>(dst);
-    auto src_as_state = Get<vvl::AccelerationStructureNV>(src);
+    auto dst_as_state = GetBorrowed<vvl::AccelerationStructureNV>(dst);
+    auto src_as_state = GetBorrowed<vvl::AccelerationStructureNV>(src);
 
     if (dst_as_state) {
         const LogObjectList objlist(commandBuffer, dst);
@@ -1502,7 +1502,7 @@ bool CoreChecks::PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR(
     bool skip = false;
     auto cb_state = GetRead<vvl::CommandBuffer>(commandBuffer);
     skip |= ValidateCmd(*cb_state, error_obj.location);
-    auto query_pool_state = Get<vvl::QueryPool>(queryPool);
+    auto query_pool_state = GetBorrowed<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
     const auto &query_pool_ci = query_pool_state->create_info;
     if (query_pool_ci.queryType != queryType) {
@@ -1513,7 +1513,7 @@ bool CoreChecks::PreCallValidateCmdWriteAccelerationStructuresPropertiesKHR(
     }
     for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
         const Location as_loc = error_obj.location.dot(Field::pAccelerationStructures, i);
-        auto as_state = Get<vvl::AccelerationStructureKHR>(pAccelerationStructures[i]);
+        auto as_state = GetBorrowed<vvl::AccelerationStructureKHR>(pAccelerationStructures[i]);
         ASSERT_AND_CONTINUE(as_state);
 
         skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *as_state->buffer_state, as_loc.dot(Field::buffer),
@@ -1542,7 +1542,7 @@ bool CoreChecks::PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(
     bool skip = false;
     auto cb_state = GetRead<vvl::CommandBuffer>(commandBuffer);
     skip |= ValidateCmd(*cb_state, error_obj.location);
-    auto query_pool_state = Get<vvl::QueryPool>(queryPool);
+    auto query_pool_state = GetBorrowed<vvl::QueryPool>(queryPool);
     ASSERT_AND_RETURN_SKIP(query_pool_state);
     const auto &query_pool_ci = query_pool_state->create_info;
     if (query_pool_ci.queryType != queryType) {
@@ -1553,7 +1553,7 @@ bool CoreChecks::PreCallValidateCmdWriteAccelerationStructuresPropertiesNV(
     }
     for (uint32_t i = 0; i < accelerationStructureCount; ++i) {
         if (queryType == VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_NV) {
-            auto as_state = Get<vvl::AccelerationStructureNV>(pAccelerationStructures[i]);
+            auto as_state = GetBorrowed<vvl::AccelerationStructureNV>(pAccelerationStructures[i]);
             ASSERT_AND_CONTINUE(as_state);
 
             if (!(as_state->build_info.flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR)) {
@@ -1619,11 +1619,11 @@ bool CoreChecks::PreCallValidateCmdCopyAccelerationStructureKHR(VkCommandBuffer
 
     const Location info_loc = error_obj.location.dot(Field::pInfo);
     skip |= ValidateCopyAccelerationStructureInfoKHR(*pInfo, error_obj.handle, info_loc);
-    if (auto src_accel_state = Get<vvl::AccelerationStructureKHR>(pInfo->src)) {
+    if (auto src_accel_state = GetBorrowed<vvl::AccelerationStructureKHR>(pInfo->src)) {
         skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *src_accel_state->buffer_state, info_loc.dot(Field::src),
                                               "VUID-vkCmdCopyAccelerationStructureKHR-buffer-03737");
     }
-    if (auto dst_accel_state = Get<vvl::AccelerationStructureKHR>(pInfo->dst)) {
+    if (auto dst_accel_state = GetBorrowed<vvl::AccelerationStructureKHR>(pInfo->dst)) {
         skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *dst_accel_state->buffer_state, info_loc.dot(Field::dst),
                                               "VUID-vkCmdCopyAccelerationStructureKHR-buffer-03738");
     }
@@ -1710,7 +1710,7 @@ bool CoreChecks::PreCallValidateCmdCopyAccelerationStructureToMemoryKHR(VkComman
     skip |= ValidateCmd(*cb_state, error_obj.location);
     const Location info_loc = error_obj.location.dot(Field::pInfo);
 
-    if (auto src_accel_struct = Get<vvl::AccelerationStructureKHR>(pInfo->src)) {
+    if (auto src_accel_struct = GetBorrowed<vvl::AccelerationStructureKHR>(pInfo->src)) {
         skip |= ValidateVkCopyAccelerationStructureToMemoryInfoKHR(*src_accel_struct, LogObjectList(commandBuffer), info_loc);
 
         if (auto buffer_state = Get<vvl::Buffer>(src_accel_struct->create_info.buffer)) {
@@ -1756,7 +1756,7 @@ bool CoreChecks::PreCallValidateCmdCopyMemoryToAccelerationStructureKHR(VkComman
     skip |= ValidateCmd(*cb_state, error_obj.location);
     const Location info_loc = error_obj.location.dot(Field::pInfo);
 
-    if (auto accel_state = Get<vvl::AccelerationStructureKHR>(pInfo->dst)) {
+    if (auto accel_state = GetBorrowed<vvl::AccelerationStructureKHR>(pInfo->dst)) {
         skip |= ValidateMemoryIsBoundToBuffer(commandBuffer, *accel_state->buffer_state, info_loc.dot(Field::dst),
                                               "VUID-vkCmdCopyMemoryToAccelerationStructureKHR-buffer-03745");
     }
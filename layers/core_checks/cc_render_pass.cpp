@@ -497,8 +497,8 @@ bool CoreChecks::ValidateCmdBeginRenderPass(VkCommandBuffer commandBuffer, const
                                             VkSubpassContents contents, const ErrorObject &error_obj) const {
     bool skip = false;
     const auto &cb_state = *GetRead<vvl::CommandBuffer>(commandBuffer);
-    const auto rp_state = Get<vvl::RenderPass>(pRenderPassBegin->renderPass);
-    const auto fb_state = Get<vvl::Framebuffer>(pRenderPassBegin->framebuffer);
+    const auto rp_state = GetBorrowed<vvl::RenderPass>(pRenderPassBegin->renderPass);
+    const auto fb_state = GetBorrowed<vvl::Framebuffer>(pRenderPassBegin->framebuffer);
     ASSERT_AND_RETURN_SKIP(rp_state && fb_state);
     const Location rp_begin_loc = error_obj.location.dot(Field::pRenderPassBegin);
 
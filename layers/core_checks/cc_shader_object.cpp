@@ -275,7 +275,7 @@ bool CoreChecks::ValidateCreateShadersMesh(const VkShaderCreateInfoEXT& create_i
                                            const Location& create_info_loc) const {
     bool skip = false;
     if (create_info.flags & VK_SHADER_CREATE_NO_TASK_SHADER_BIT_EXT) return skip;
-    if (spirv.static_data_.has_builtin_draw_index) {
+    if (spirv.GetStaticData().has_builtin_draw_index) {
         skip |= LogError(
             "VUID-vkCreateShadersEXT-pCreateInfos-09632", device, create_info_loc,
             "the mesh Shader Object being created uses DrawIndex (gl_DrawID) which will be an undefined value when reading.");
@@ -570,7 +570,7 @@ bool CoreChecks::PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer,
 
     if (vertex_stage_index != stageCount && task_stage_index != stageCount) {
         const auto vertex_state = Get<vvl::ShaderObject>(pShaders[vertex_stage_index]);
-        const auto task_state = Get<vvl::ShaderObject>(pShaders[task_stage_index]);
+        const auto task_state = GetBorrowed<vvl::ShaderObject>(pShaders[task_stage_index]);
         const LogObjectList objlist(commandBuffer, vertex_state->Handle(), task_state->Handle());
         skip |= LogError("VUID-vkCmdBindShadersEXT-pShaders-08470", objlist, error_obj.location,
                          "pStages[%" PRIu32 "] is VK_SHADER_STAGE_VERTEX_BIT and pStages[%" PRIu32
@@ -580,7 +580,7 @@ bool CoreChecks::PreCallValidateCmdBindShadersEXT(VkCommandBuffer commandBuffer,
     }
     if (vertex_stage_index != stageCount && mesh_stage_index != stageCount) {
         const auto vertex_state = Get<vvl::ShaderObject>(pShaders[vertex_stage_index]);
-        const auto mesh_state = Get<vvl::ShaderObject>(pShaders[mesh_stage_index]);
+        const auto mesh_state = GetBorrowed<vvl::ShaderObject>(pShaders[mesh_stage_index]);
         const LogObjectList objlist(commandBuffer, vertex_state->Handle(), mesh_state->Handle());
         skip |= LogError("VUID-vkCmdBindShadersEXT-pShaders-08471", objlist, error_obj.location,
                          "pStages[%" PRIu32 "] is VK_SHADER_STAGE_VERTEX_BIT and pStages[%" PRIu32
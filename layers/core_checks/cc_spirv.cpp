@@ -21,6 +21,7 @@
 #include <cassert>
 #include <cinttypes>
 #include <cstdint>
+#include <cstring>
 #include <spirv/unified1/spirv.hpp>
 #include <sstream>
 #include <string>
@@ -102,7 +103,7 @@ bool CoreChecks::ValidatePushConstantUsage(const spirv::Module &module_state, co
     bool skip = false;
 
     // TODO - Workaround for https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/5911
-    if (module_state.static_data_.has_specialization_constants) {
+    if (module_state.GetStaticData().has_specialization_constants) {
         return skip;
     }
 
@@ -209,7 +210,7 @@ static void TypeToDescriptorTypeSet(const spirv::Module &module_state, uint32_t
 
     switch (type->Opcode()) {
         case spv::OpTypeStruct: {
-            for (const spirv::Instruction *insn : module_state.static_data_.decoration_inst) {
+            for (const spirv::Instruction *insn : module_state.GetStaticData().decoration_inst) {
                 if (insn->Word(1) == type->ResultId()) {
                     if (insn->Word(2) == spv::DecorationBlock) {
                         if (is_storage_buffer) {
@@ -453,7 +454,7 @@ bool CoreChecks::ValidateCooperativeMatrix(const spirv::Module &module_state, co
         return skip;  // If the capability isn't enabled, don't bother with the rest of this function.
     }
 
-    if (!module_state.static_data_.cooperative_matrix_inst.empty() && api_version < VK_API_VERSION_1_3) {
+    if (!module_state.GetStaticData().cooperative_matrix_inst.empty() && api_version < VK_API_VERSION_1_3) {
         bool has_full_subgroups = false;
         if (stage_state.pipeline_create_info) {
             has_full_subgroups =
@@ -509,7 +510,7 @@ bool CoreChecks::ValidateCooperativeMatrix(const spirv::Module &module_state, co
         return ss.str();
     };
 
-    for (const spirv::Instruction *cooperative_matrix_inst : module_state.static_data_.cooperative_matrix_inst) {
+    for (const spirv::Instruction *cooperative_matrix_inst : module_state.GetStaticData().cooperative_matrix_inst) {
         const spirv::Instruction &insn = *cooperative_matrix_inst;
         switch (insn.Opcode()) {
             case spv::OpTypeCooperativeMatrixKHR: {
@@ -892,7 +893,7 @@ bool CoreChecks::ValidateCooperativeVector(const spirv::Module &module_state, co
             id_to_type_id[insn.Word(2)] = insn.Word(1);
         }
     }
-    for (const spirv::Instruction *cooperative_vector_inst : module_state.static_data_.cooperative_vector_inst) {
+    for (const spirv::Instruction *cooperative_vector_inst : module_state.GetStaticData().cooperative_vector_inst) {
         const spirv::Instruction &insn = *cooperative_vector_inst;
         switch (insn.Opcode()) {
             case spv::OpTypeCooperativeVectorNV: {
@@ -1326,7 +1327,7 @@ bool CoreChecks::ValidateWorkgroupSharedMemory(const spirv::Module &module_state
             }
 
             if (enabled_features.cooperativeMatrixWorkgroupScope) {
-                for (auto &cooperative_matrix_inst : module_state.static_data_.cooperative_matrix_inst) {
+                for (auto &cooperative_matrix_inst : module_state.GetStaticData().cooperative_matrix_inst) {
                     if (cooperative_matrix_inst->Opcode() != spv::OpTypeCooperativeMatrixKHR) {
                         continue;
                     }
@@ -1680,7 +1681,7 @@ bool CoreChecks::ValidateTransformFeedbackPipeline(const spirv::Module &module_s
 
 bool CoreChecks::ValidateImageWrite(const spirv::Module &module_state, const Location &loc) const {
     bool skip = false;
-    for (const auto &[insn, load_id] : module_state.static_data_.image_write_load_id_map) {
+    for (const auto &[insn, load_id] : module_state.GetStaticData().image_write_load_id_map) {
         // guaranteed by spirv-val to be an OpTypeImage
         const uint32_t image = module_state.GetTypeId(load_id);
         const spirv::Instruction *image_def = module_state.FindDef(image);
@@ -1749,7 +1750,7 @@ bool CoreChecks::ValidateShaderTileImage(const spirv::Module &module_state, cons
     }
 
     const bool mode_early_fragment_test = entrypoint.execution_mode.Has(spirv::ExecutionModeSet::early_fragment_test_bit);
-    if (module_state.static_data_.has_shader_tile_image_depth_read) {
+    if (module_state.GetStaticData().has_shader_tile_image_depth_read) {
         const auto *ds_state = pipeline.DepthStencilState();
         const bool write_enabled =
             !pipeline.IsDynamic(CB_DYNAMIC_STATE_DEPTH_WRITE_ENABLE) && (ds_state && ds_state->depthWriteEnable);
@@ -1759,7 +1760,7 @@ bool CoreChecks::ValidateShaderTileImage(const spirv::Module &module_state, cons
         }
     }
 
-    if (module_state.static_data_.has_shader_tile_image_stencil_read) {
+    if (module_state.GetStaticData().has_shader_tile_image_stencil_read) {
         const auto *ds_state = pipeline.DepthStencilState();
         const bool is_write_mask_set = !pipeline.IsDynamic(CB_DYNAMIC_STATE_STENCIL_WRITE_MASK) &&
                                        (ds_state && (ds_state->front.writeMask != 0 || ds_state->back.writeMask != 0));
@@ -1772,9 +1773,9 @@ bool CoreChecks::ValidateShaderTileImage(const spirv::Module &module_state, cons
         }
     }
 
-    bool using_tile_image_op = module_state.static_data_.has_shader_tile_image_depth_read ||
-                               module_state.static_data_.has_shader_tile_image_stencil_read ||
-                               module_state.static_data_.has_shader_tile_image_color_read;
+    bool using_tile_image_op = module_state.GetStaticData().has_shader_tile_image_depth_read ||
+                               module_state.GetStaticData().has_shader_tile_image_stencil_read ||
+                               module_state.GetStaticData().has_shader_tile_image_color_read;
     const auto *ms_state = pipeline.MultisampleState();
     if (using_tile_image_op && ms_state && ms_state->sampleShadingEnable && (ms_state->minSampleShading != 1.0)) {
         skip |= LogError("VUID-RuntimeSpirv-minSampleShading-08732", module_state.handle(), loc,
@@ -1823,8 +1824,8 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
         std::stringstream err;
         err << "\"" << stage_state.GetPName() << "\" entry point not found for stage " << string_VkShaderStageFlagBits(stage)
             << ".";
-        if (stage_state.spirv_state->static_data_.entry_points.size() == 1) {
-            auto entry_point = stage_state.spirv_state->static_data_.entry_points[0];
+        if (stage_state.spirv_state->GetStaticData().entry_points.size() == 1) {
+            auto entry_point = stage_state.spirv_state->GetStaticData().entry_points[0];
             if (entry_point) {
                 if (entry_point->stage != stage) {
                     err << " (Seems like you accidently created your SPIR-V with "
@@ -1842,7 +1843,7 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
             }
         } else {
             err << " The following entry points were found in the SPIR-V module:\n";
-            for (const auto &entry_point : stage_state.spirv_state->static_data_.entry_points) {
+            for (const auto &entry_point : stage_state.spirv_state->GetStaticData().entry_points) {
                 if (!entry_point) continue;
                 err << "\"" << entry_point->name << "\"\t(" << string_VkShaderStageFlagBits(entry_point->stage) << ")\n";
             }
@@ -1857,7 +1858,7 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
     uint32_t total_task_payload_memory = 0;
 
     // If specialization-constant instructions are present in the shader, the specializations should be applied.
-    if (module_state.static_data_.has_specialization_constants && global_settings.spirv_const_fold) {
+    if (module_state.GetStaticData().has_specialization_constants && global_settings.spirv_const_fold) {
         // setup the call back if the optimizer fails
         spvtools::Optimizer optimizer(spirv_environment);
         spvtools::MessageConsumer consumer = [&skip, &module_state, &stage, loc, this](
@@ -1880,7 +1881,7 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState &stage_state, const
             id_value_map.reserve(specialization_info->mapEntryCount);
 
             // spirv-val makes sure every OpSpecConstant has a OpDecoration.
-            for (const auto &[result_id, spec_id] : module_state.static_data_.id_to_spec_id) {
+            for (const auto &[result_id, spec_id] : module_state.GetStaticData().id_to_spec_id) {
                 VkSpecializationMapEntry map_entry = {spirv::kInvalidValue, 0, 0};
                 for (uint32_t i = 0; i < specialization_info->mapEntryCount; i++) {
                     if (specialization_info->pMapEntries[i].constantID == spec_id) {
@@ -2175,10 +2176,24 @@ bool CoreChecks::GroupHasValidIndex(const vvl::Pipeline &pipeline, uint32_t grou
 void CoreChecks::PreCallRecordCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                                  const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule,
                                                  const RecordObject &record_obj, chassis::CreateShaderModule &chassis_state) {
+    if (!chassis_state.stateless_data.collected) {
+        // Found in the spirv::ModuleCache (these checks already passed on a previous run), or not parsed at all
+        return;
+    }
     // Normally would validate in PreCallValidate, but need a non-const function to update chassis_state
     // This is on the stack, we don't have to worry about threading hazards and this could be moved and used const_cast
+    //
+    // Can't rely on the returned skip, a filtered VUID (or one over the duplicate limit) would look like the module was fine
+    const uint64_t message_count = DebugReport::ThreadAttemptedMessageCount();
     chassis_state.skip |=
         stateless_spirv_validator.Validate(*chassis_state.module_state, chassis_state.stateless_data, record_obj.location);
+    const bool found_nothing = DebugReport::ThreadAttemptedMessageCount() == message_count;
+
+    // Group decorations are flattened into a new module at creation time, simpler to just never cache those
+    if (found_nothing && chassis_state.module_cache_hash != 0 && chassis_state.module_state->valid_spirv &&
+        !chassis_state.stateless_data.has_group_decoration) {
+        device_state->shader_module_cache->Insert(chassis_state.module_cache_hash);
+    }
 }
 
 void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT *pCreateInfos,
@@ -2190,6 +2205,91 @@ void CoreChecks::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createI
     chassis_state.skip = ValidateCreateShadersSpirv(createInfoCount, pCreateInfos, record_obj.location, chassis_state);
 }
 
+CoreChecks::SpirvValResult CoreChecks::GetSpirvValResult(const spv_const_binary_t &binary, uint64_t spirv_hash) const {
+    std::promise<SpirvValResult> promise;
+    std::shared_future<SpirvValResult> result;
+    bool run_spirv_val = false;
+    {
+        std::lock_guard<std::mutex> guard(spirv_val_in_flight_lock_);
+        SpirvValInFlight &in_flight = spirv_val_in_flight_[spirv_hash];
+        if (!in_flight.result.valid()) {
+            in_flight.result = promise.get_future().share();
+            run_spirv_val = true;
+        }
+        result = in_flight.result;
+    }
+    if (!run_spirv_val) {
+        return result.get();
+    }
+
+    // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
+    // the default values will be used during validation.
+    SpirvValResult spirv_val;
+    spv_context ctx = spvContextCreate(spirv_environment);
+    spv_diagnostic diag = nullptr;
+    spirv_val.result = spvValidateWithOptions(ctx, spirv_val_options, &binary, &diag);
+    if (diag && diag->error) {
+        spirv_val.error_message = diag->error;
+    }
+    spvDiagnosticDestroy(diag);
+    spvContextDestroy(ctx);
+    promise.set_value(std::move(spirv_val));
+
+    {
+        std::lock_guard<std::mutex> guard(spirv_val_in_flight_lock_);
+        auto it = spirv_val_in_flight_.find(spirv_hash);
+        it->second.done = true;
+        if (it->second.pins == 0) {
+            spirv_val_in_flight_.erase(it);
+        }
+    }
+    return result.get();
+}
+
+CoreChecks::SpirvValPrefetch::SpirvValPrefetch(const CoreChecks &core)
+    : core_(core), task_group_(core.device_state->pipeline_thread_pool_.get()) {}
+
+CoreChecks::SpirvValPrefetch::~SpirvValPrefetch() {
+    // The tasks use the SPIR-V of the create infos, which the app can free once the call returns
+    task_group_.Wait();
+    std::lock_guard<std::mutex> guard(core_.spirv_val_in_flight_lock_);
+    for (const uint64_t spirv_hash : pinned_hashes_) {
+        auto it = core_.spirv_val_in_flight_.find(spirv_hash);
+        if (--it->second.pins == 0 && it->second.done) {
+            core_.spirv_val_in_flight_.erase(it);
+        }
+    }
+}
+
+void CoreChecks::SpirvValPrefetch::Add(const VkPipelineShaderStageCreateInfo &stage_ci) {
+    if (!core_.device_state->pipeline_thread_pool_ || core_.disabled[shader_validation] ||
+        core_.global_settings.debug_disable_spirv_val || stage_ci.module != VK_NULL_HANDLE) {
+        return;
+    }
+    // Only worth starting early what ValidateShaderModuleCreateInfo will pass to spirv-val, the other checks are done there
+    const auto module_create_info = vku::FindStructInPNextChain<VkShaderModuleCreateInfo>(stage_ci.pNext);
+    if (!module_create_info || !module_create_info->pCode || SafeModulo(module_create_info->codeSize, 4) != 0 ||
+        module_create_info->pCode[0] != spv::MagicNumber) {
+        return;
+    }
+
+    const spv_const_binary_t binary{module_create_info->pCode, module_create_info->codeSize / sizeof(uint32_t)};
+    if (auto cache = CastFromHandle<ValidationCache *>(core_.core_validation_cache)) {
+        if (cache->Contains(hash_util::Hash32(binary.code, binary.wordCount * sizeof(uint32_t)))) {
+            return;
+        }
+    }
+    const uint64_t spirv_hash = hash_util::Hash64(binary.code, binary.wordCount * sizeof(uint32_t));
+    if (!pinned_hashes_.insert(spirv_hash).second) {
+        return;  // used by several stages of the call
+    }
+    {
+        std::lock_guard<std::mutex> guard(core_.spirv_val_in_flight_lock_);
+        core_.spirv_val_in_flight_[spirv_hash].pins++;
+    }
+    task_group_.Run([this, binary, spirv_hash]() { core_.GetSpirvValResult(binary, spirv_hash); });
+}
+
 bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &loc, ValidationCache *cache) const {
     bool skip = false;
 
@@ -2197,47 +2297,38 @@ bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &
         return skip;
     }
 
+    const size_t spirv_size = binary.wordCount * sizeof(uint32_t);
     uint32_t hash = 0;
     if (cache) {
-        hash = hash_util::Hash32((void *)binary.code, binary.wordCount * sizeof(uint32_t));
+        hash = hash_util::Hash32((void *)binary.code, spirv_size);
         if (cache->Contains(hash)) {
             return skip;
         }
     }
 
-    // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
-    // the default values will be used during validation.
-    spv_context ctx = spvContextCreate(spirv_environment);
-    spv_diagnostic diag = nullptr;
-    const spv_result_t spv_valid = spvValidateWithOptions(ctx, spirv_val_options, &binary, &diag);
-    if (spv_valid != SPV_SUCCESS) {
-        const char *error_message = diag && diag->error ? diag->error : "(no error text)";
+    // The same SPIR-V is often created from several threads at once, or inlined in many pipelines of a single call
+    const SpirvValResult spirv_val = GetSpirvValResult(binary, hash_util::Hash64(binary.code, spirv_size));
+    if (spirv_val.result != SPV_SUCCESS) {
+        const char *error_message = !spirv_val.error_message.empty() ? spirv_val.error_message.c_str() : "(no error text)";
 
         // Umbrella VUID if we can't find one in spirv-val
-        const char *vuid = loc.function == Func::vkCreateShadersEXT ? "VUID-VkShaderCreateInfoEXT-pCode-08737"
+        std::string vuid = loc.function == Func::vkCreateShadersEXT ? "VUID-VkShaderCreateInfoEXT-pCode-08737"
                                                                     : "VUID-VkShaderModuleCreateInfo-pCode-08737";
 
         // We want to search inside the spirv-val error message to see if there is VUID in it as it allows people to silence just
         // that VUID and not the whole spirv-val check
-        char *spirv_val_vuid = nullptr;
-        if (diag && diag->error) {
-            // Note: Will always start with "[VUID-xxx-00000]" if there is one
-            if (std::strncmp(error_message, "[VUID", 5) == 0) {
-                const char *bracket_end = std::strchr(error_message, ']');
-                if (bracket_end) {
-                    const size_t vuid_len = bracket_end - error_message - 1;
-                    spirv_val_vuid = new char[vuid_len + 1];  // +1 for null-terminator
-                    std::strncpy(spirv_val_vuid, error_message + 1, vuid_len);
-                    spirv_val_vuid[vuid_len] = '\0';
-
-                    // Remove VUID from error message now
-                    error_message = bracket_end + 2;
-                }
-                vuid = spirv_val_vuid;
+        // Note: Will always start with "[VUID-xxx-00000]" if there is one
+        if (std::strncmp(error_message, "[VUID", 5) == 0) {
+            const char *bracket_end = std::strchr(error_message, ']');
+            if (bracket_end) {
+                vuid.assign(error_message + 1, bracket_end - error_message - 1);
+
+                // Remove VUID from error message now
+                error_message = bracket_end + 2;
             }
         }
 
-        if (spv_valid == SPV_WARNING) {
+        if (spirv_val.result == SPV_WARNING) {
             skip |= LogWarning(vuid, device, loc.dot(Field::pCode),
                                "(spirv-val produced a warning):\n%s\nCommand to reproduce:\n\t%s\n", error_message,
                                spirv_val_command.c_str());
@@ -2246,18 +2337,11 @@ bool CoreChecks::RunSpirvValidation(spv_const_binary_t &binary, const Location &
                 LogError(vuid, device, loc.dot(Field::pCode), "(spirv-val produced an error):\n%s\nCommand to reproduce:\n\t%s\n",
                          error_message, spirv_val_command.c_str());
         }
-
-        if (spirv_val_vuid) {
-            delete[] spirv_val_vuid;
-        }
     } else if (cache) {
         // No point to cache anything that is not valid, or it will get suppressed on the next run
         cache->Insert(hash);
     }
 
-    spvDiagnosticDestroy(diag);
-    spvContextDestroy(ctx);
-
     return skip;
 }
 
@@ -2564,7 +2648,7 @@ bool CoreChecks::ValidateEmitMeshTasksSize(const spirv::Module &module_state, co
                                            const ShaderStageState &stage_state, const Location &loc) const {
     bool skip = false;
 
-    for (const spirv::Instruction &insn : module_state.static_data_.instructions) {
+    for (const spirv::Instruction &insn : module_state.GetStaticData().instructions) {
         if (insn.Opcode() == spv::OpEmitMeshTasksEXT) {
             uint32_t x, y, z;
             bool found_x = stage_state.GetInt32ConstantValue(*module_state.FindDef(insn.Word(1)), &x);
@@ -2651,16 +2735,16 @@ bool CoreChecks::ValidateTaskPayload(const spirv::Module &task_state, const spir
     uint32_t task_payload_size = 0;
     uint32_t mesh_payload_size = 0;
 
-    if (task_state.static_data_.emit_mesh_tasks_inst.size() > 1) {
+    if (task_state.GetStaticData().emit_mesh_tasks_inst.size() > 1) {
         // If there are multiple OpEmitMeshTasksEXT we will need GPU-AV to know which was actually called
         return skip;
     }
 
-    if (!task_state.static_data_.emit_mesh_tasks_inst.empty()) {
-        const auto emit_mesh_task = task_state.static_data_.emit_mesh_tasks_inst.front();
+    if (!task_state.GetStaticData().emit_mesh_tasks_inst.empty()) {
+        const auto emit_mesh_task = task_state.GetStaticData().emit_mesh_tasks_inst.front();
         // Payload is optional
         if (emit_mesh_task->Length() == 5) {
-            if (task_state.static_data_.has_specialization_constants) {
+            if (task_state.GetStaticData().has_specialization_constants) {
                 // There is a chance this is not resolvable here to match exact size
                 return skip;
             }
@@ -2716,7 +2800,7 @@ bool CoreChecks::ValidateDataGraphPipelineShaderModuleSpirv(VkDevice device, con
     std::vector<std::pair<uint32_t, uint32_t>> tensor_bindings;
     bool name_found = false;
     const auto &stage_state = pipeline.stage_states[0];
-    for (auto &entry_point : module_spirv.static_data_.entry_points) {
+    for (auto &entry_point : module_spirv.GetStaticData().entry_points) {
         if (!entry_point->is_data_graph)
             continue;
 
@@ -2738,7 +2822,7 @@ bool CoreChecks::ValidateDataGraphPipelineShaderModuleSpirv(VkDevice device, con
 
     if (!name_found) {
         std::stringstream wrong_names;
-        for (const auto& entry_point : module_spirv.static_data_.entry_points) {
+        for (const auto& entry_point : module_spirv.GetStaticData().entry_points) {
             if (!wrong_names.str().empty()) {
                 wrong_names << ", ";
             }
@@ -2761,7 +2845,7 @@ bool CoreChecks::ValidateDataGraphPipelineShaderModuleSpirv(VkDevice device, con
         }
     }
     if (!enabled_features.dataGraphSpecializationConstants) {
-        if (module_spirv.static_data_.has_specialization_constants) {
+        if (module_spirv.GetStaticData().has_specialization_constants) {
             skip |= LogError("VUID-VkDataGraphPipelineShaderModuleCreateInfoARM-dataGraphSpecializationConstants-09849", device,
                              module_loc,
                              "contains OpSpec* instruction(s), but the dataGraphSpecializationConstants feature is not enabled.");
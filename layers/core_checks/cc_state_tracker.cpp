@@ -31,6 +31,7 @@
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/query_state.h"
 #include "state_tracker/render_pass_state.h"
+#include "state_tracker/shader_object_state.h"
 
 // Location to add per-queue submit debug info if built with -D DEBUG_CAPTURE_KEYBOARD=ON
 void CoreChecks::DebugCapture() {}
@@ -109,22 +110,43 @@ void CommandBufferSubState::UpdateActionPipelineState(LastBound& last_bound, con
 
             // We can skip updating the state if "nothing" has changed since the last validation.
             // See CoreChecks::ValidateActionState for more details.
-            const bool need_update =  // Update if descriptor set (or contents) has changed
-                ds_slot.validated_set != descriptor_set.get() ||
-                ds_slot.validated_set_change_count != descriptor_set->GetChangeCount() ||
-                (!base.dev_data.disabled[image_layout_validation] &&
-                 ds_slot.validated_set_image_layout_change_count != base.image_layout_change_count);
-            if (need_update) {
-                if (!base.dev_data.disabled[command_buffer_state] && !descriptor_set->IsPushDescriptor()) {
-                    base.AddChild(descriptor_set);
-                }
+            const bool check_image_layouts = !base.dev_data.disabled[image_layout_validation];
+            const uint64_t shaders_key = last_bound.DescriptorValidationKey();
+            if (ds_slot.NeedValidation(base, shaders_key, check_image_layouts)) {
+                if (ds_slot.NeedDrawStateUpdate(base, shaders_key, check_image_layouts)) {
+                    if (!base.dev_data.disabled[command_buffer_state] && !descriptor_set->IsPushDescriptor()) {
+                        base.AddChild(descriptor_set);
+                    }
 
-                // Bind this set and its active descriptor resources to the command buffer
-                descriptor_set->UpdateImageLayoutDrawStates(&base.dev_data, base, binding_req_map);
+                    // Bind this set and its active descriptor resources to the command buffer
+                    descriptor_set->UpdateImageLayoutDrawStates(&base.dev_data, base, binding_req_map);
+                }
+                ds_slot.SetValidated(base, shaders_key);
+            }
+        }
+    }
+}
 
-                ds_slot.validated_set = descriptor_set.get();
-                ds_slot.validated_set_change_count = descriptor_set->GetChangeCount();
-                ds_slot.validated_set_image_layout_change_count = base.image_layout_change_count;
+// Only remembers the descriptor sets validated by CoreChecks::ValidateActionStateDescriptorsShaderObject, the image layouts are not
+// tracked for shader objects
+void CommandBufferSubState::UpdateActionShaderObjectState(LastBound& last_bound) {
+    if (!last_bound.desc_set_pipeline_layout) {
+        return;
+    }
+    const bool check_image_layouts = !base.dev_data.disabled[image_layout_validation];
+    const uint64_t shaders_key = last_bound.DescriptorValidationKey();
+    for (const vvl::ShaderObject* shader_state : last_bound.shader_object_states) {
+        if (!shader_state) {
+            continue;
+        }
+        for (const auto& [set_index, binding_req_map] : shader_state->active_slots) {
+            if (set_index >= last_bound.ds_slots.size()) {
+                continue;
+            }
+            // Sets shared by several stages are only validated once for the draw
+            auto& ds_slot = last_bound.ds_slots[set_index];
+            if (ds_slot.ds_state && ds_slot.NeedValidation(base, shaders_key, check_image_layouts)) {
+                ds_slot.SetValidated(base, shaders_key);
             }
         }
     }
@@ -134,6 +156,8 @@ void CommandBufferSubState::UpdateActionPipelineState(LastBound& last_bound, con
 void CommandBufferSubState::RecordActionCommand(LastBound& last_bound, const Location&) {
     if (last_bound.pipeline_state) {
         UpdateActionPipelineState(last_bound, *last_bound.pipeline_state);
+    } else if (base.descriptor_buffer.binding_info.empty()) {
+        UpdateActionShaderObjectState(last_bound);
     }
 }
 
@@ -195,6 +195,7 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
   private:
     void ResetCBState();
     void UpdateActionPipelineState(LastBound &last_bound, const vvl::Pipeline &pipeline_state);
+    void UpdateActionShaderObjectState(LastBound &last_bound);
 
     // Funnel because Image/Buffer copies have 2 variations for the regions
     template <typename RegionType>
@@ -180,8 +180,8 @@ bool CoreChecks::PreCallValidateCmdCopyTensorARM(VkCommandBuffer commandBuffer,
                                                  const ErrorObject &error_obj) const {
     bool skip = false;
     auto cb_state_ptr = GetRead<vvl::CommandBuffer>(commandBuffer);
-    auto src_tensor_state_ptr = Get<vvl::Tensor>(pCopyTensorInfo->srcTensor);
-    auto dst_tensor_state_ptr = Get<vvl::Tensor>(pCopyTensorInfo->dstTensor);
+    auto src_tensor_state_ptr = GetBorrowed<vvl::Tensor>(pCopyTensorInfo->srcTensor);
+    auto dst_tensor_state_ptr = GetBorrowed<vvl::Tensor>(pCopyTensorInfo->dstTensor);
     ASSERT_AND_RETURN_SKIP(cb_state_ptr && src_tensor_state_ptr && dst_tensor_state_ptr);
     const auto &src_tensor_state = *src_tensor_state_ptr;
     const auto &dst_tensor_state = *dst_tensor_state_ptr;
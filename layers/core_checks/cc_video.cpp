@@ -5024,7 +5024,7 @@ bool CoreChecks::PreCallValidateCmdBeginVideoCodingKHR(VkCommandBuffer commandBu
                          "%s has active queries.", FormatHandle(commandBuffer).c_str());
     }
 
-    auto vs_state = Get<vvl::VideoSession>(pBeginInfo->videoSession);
+    auto vs_state = GetBorrowed<vvl::VideoSession>(pBeginInfo->videoSession);
     if (!vs_state) return skip;
 
     const Location begin_info_loc = error_obj.location.dot(Field::pBeginInfo);
@@ -5197,7 +5197,7 @@ bool CoreChecks::PreCallValidateCmdBeginVideoCodingKHR(VkCommandBuffer commandBu
         }
     }
 
-    auto vsp_state = Get<vvl::VideoSessionParameters>(pBeginInfo->videoSessionParameters);
+    auto vsp_state = GetBorrowed<vvl::VideoSessionParameters>(pBeginInfo->videoSessionParameters);
     if (vsp_state && vsp_state->vs_state->VkHandle() != vs_state->VkHandle()) {
         const LogObjectList objlist(commandBuffer, pBeginInfo->videoSessionParameters, pBeginInfo->videoSession);
         skip |= LogError("VUID-VkVideoBeginCodingInfoKHR-videoSessionParameters-04857", objlist,
@@ -5440,7 +5440,7 @@ bool CoreChecks::PreCallValidateCmdDecodeVideoKHR(VkCommandBuffer commandBuffer,
 
     const auto &profile_caps = vs_state->profile->GetCapabilities();
 
-    if (auto buffer_state = Get<vvl::Buffer>(pDecodeInfo->srcBuffer)) {
+    if (auto buffer_state = GetBorrowed<vvl::Buffer>(pDecodeInfo->srcBuffer)) {
         skip |= ValidateProtectedBuffer(*cb_state, *buffer_state, decode_info_loc.dot(Field::srcBuffer),
                                         "VUID-vkCmdDecodeVideoKHR-commandBuffer-07136");
 
@@ -5928,7 +5928,7 @@ bool CoreChecks::PreCallValidateCmdEncodeVideoKHR(VkCommandBuffer commandBuffer,
 
     skip |= ValidateVideoEncodeIntraRefreshInfo(*cb_state, *vs_state, *pEncodeInfo, encode_info_loc);
 
-    if (auto buffer_state = Get<vvl::Buffer>(pEncodeInfo->dstBuffer)) {
+    if (auto buffer_state = GetBorrowed<vvl::Buffer>(pEncodeInfo->dstBuffer)) {
         skip |= ValidateProtectedBuffer(*cb_state, *buffer_state, encode_info_loc.dot(Field::dstBuffer),
                                         "VUID-vkCmdEncodeVideoKHR-commandBuffer-08202");
         skip |= ValidateUnprotectedBuffer(*cb_state, *buffer_state, encode_info_loc.dot(Field::dstBuffer),
@@ -800,13 +800,13 @@ bool CoreChecks::ValidateImageAcquireWait(const vvl::SwapchainImage &swapchain_i
 bool CoreChecks::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo,
                                                 const ErrorObject &error_obj) const {
     bool skip = false;
-    auto queue_state = Get<vvl::Queue>(queue);
+    auto queue_state = GetBorrowed<vvl::Queue>(queue);
 
     SemaphoreSubmitState sem_submit_state(*this, queue, queue_state->queue_family_properties.queueFlags);
 
     const Location present_info_loc = error_obj.location.dot(Struct::VkPresentInfoKHR, Field::pPresentInfo);
     for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
-        auto semaphore_state = Get<vvl::Semaphore>(pPresentInfo->pWaitSemaphores[i]);
+        auto semaphore_state = GetBorrowed<vvl::Semaphore>(pPresentInfo->pWaitSemaphores[i]);
         ASSERT_AND_CONTINUE(semaphore_state);
 
         if (semaphore_state->type != VK_SEMAPHORE_TYPE_BINARY) {
@@ -41,6 +41,10 @@
 #include <spirv-tools/libspirv.hpp>
 
 #include "utils/sync_utils.h"
+#include "utils/thread_pool.h"
+
+#include <future>
+#include <mutex>
 
 namespace vvl {
 struct DrawDispatchVuid;
@@ -224,6 +228,59 @@ class CoreChecks : public vvl::DeviceProxy {
     spv_target_env spirv_environment;
     stateless::SpirvValidator stateless_spirv_validator;
 
+    struct SpirvValResult {
+        spv_result_t result = SPV_SUCCESS;
+        std::string error_message;  // empty if spirv-val gave no diagnostic
+    };
+    // spirv-val of a SPIR-V, shared by every thread validating the same SPIR-V at the same time
+    struct SpirvValInFlight {
+        std::shared_future<SpirvValResult> result;
+        uint32_t pins = 0;  // pinned entries are kept once done, until the SpirvValPrefetch that started them is destroyed
+        bool done = false;
+    };
+    // Keyed by the 64-bit hash of the SPIR-V, entries are removed once done unless pinned
+    mutable std::mutex spirv_val_in_flight_lock_;
+    mutable vvl::unordered_map<uint64_t, SpirvValInFlight> spirv_val_in_flight_;
+
+    // Starts spirv-val of the SPIR-V inlined in the shader stages of a vkCreate*Pipelines call on the pipeline thread pool, so the
+    // stages of all the pipelines are validated in parallel. RunSpirvValidation then waits for those results instead of running
+    // spirv-val again. Does nothing without parallel_pipeline_validation.
+    class SpirvValPrefetch {
+      public:
+        explicit SpirvValPrefetch(const CoreChecks& core);
+        ~SpirvValPrefetch();
+
+        SpirvValPrefetch(const SpirvValPrefetch&) = delete;
+        SpirvValPrefetch& operator=(const SpirvValPrefetch&) = delete;
+
+        void Add(const VkPipelineShaderStageCreateInfo& stage_ci);
+
+      private:
+        const CoreChecks& core_;
+        vvl::unordered_set<uint64_t> pinned_hashes_;
+        vvl::TaskGroup task_group_;
+    };
+
+    // How often the draw time validation of a bound descriptor set is skipped because nothing changed since the last draw
+    struct DrawStateCacheStats {
+        std::atomic<uint64_t> lookups{0};
+        std::atomic<uint64_t> misses{0};
+
+        // Returns the number of lookups so far
+        uint64_t Add(bool miss) {
+            if (miss) {
+                misses.fetch_add(1, std::memory_order_relaxed);
+            }
+            return lookups.fetch_add(1, std::memory_order_relaxed) + 1;
+        }
+        double HitRate() const {
+            const uint64_t total = lookups.load(std::memory_order_relaxed);
+            return total ? double(total - misses.load(std::memory_order_relaxed)) / double(total) : 0.0;
+        }
+    };
+    mutable DrawStateCacheStats draw_state_cache_stats;
+    static constexpr uint64_t kDrawStateCacheStatsPlotInterval = 1024;
+
     CoreChecks(vvl::dispatch::Device* dev, core::Instance* instance_vo)
         : BaseClass(dev, instance_vo, LayerObjectTypeCoreValidation),
           stateless_spirv_validator(dev->debug_report, dev->stateless_device_data, dev->settings.disabled[shader_validation]) {}
@@ -242,6 +299,9 @@ class CoreChecks : public vvl::DeviceProxy {
                                       const VkPipelineRenderingCreateInfo* rendering_struct, const Location& loc, int lib_index,
                                       const char* vuid) const;
     bool ValidateGraphicsPipelineDerivatives(PipelineStates& pipeline_states, uint32_t pipe_index, const Location& loc) const;
+    bool ValidateComputePipeline(PipelineStates& pipeline_states, uint32_t pipe_index,
+                                 const VkComputePipelineCreateInfo& create_info,
+                                 const chassis::CreateComputePipelines& chassis_state, const Location& create_info_loc) const;
     bool ValidateComputePipelineDerivatives(PipelineStates& pipeline_states, uint32_t pipe_index, const Location& loc) const;
     bool ValidateMultiViewShaders(const vvl::Pipeline& pipeline, const Location& multiview_loc, uint32_t view_mask,
                                   bool dynamic_rendering) const;
@@ -745,6 +805,7 @@ class CoreChecks : public vvl::DeviceProxy {
                                                const VkValidationCacheEXT* pSrcCaches) override;
     VkResult CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize,
                                                 void* pData) override;
+    bool NeedDrawStateValidated(const LastBound& last_bound_state, uint32_t set_index) const;
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
     bool ValidateDrawState(const vvl::DescriptorSet& descriptor_set, uint32_t set_index, const BindingVariableMap& binding_req_map,
                            const vvl::CommandBuffer& cb_state, const vvl::DrawDispatchVuid& vuid,
@@ -896,6 +957,8 @@ class CoreChecks : public vvl::DeviceProxy {
                                        const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders,
                                        const RecordObject& record_obj, chassis::ShaderObject& chassis_state) override;
     bool RunSpirvValidation(spv_const_binary_t& binary, const Location& loc, ValidationCache* cache) const;
+    // Runs spirv-val, unless another thread is already running it on the same SPIR-V, then waits for its result
+    SpirvValResult GetSpirvValResult(const spv_const_binary_t& binary, uint64_t spirv_hash) const;
     bool ValidateShaderModuleCreateInfo(const VkShaderModuleCreateInfo& create_info, const Location& create_info_loc) const;
     bool PreCallValidateCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                            const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule,
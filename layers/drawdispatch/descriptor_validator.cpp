@@ -233,7 +233,7 @@ bool DescriptorValidator::ValidateDescriptorsDynamic(const spirv::ResourceInterf
 }
 
 bool DescriptorValidator::ValidateBindingDynamic(const spirv::ResourceInterfaceVariable &resource_variable,
-                                                 DescriptorBinding &binding, const uint32_t index) {
+                                                 const DescriptorBinding &binding, const uint32_t index) {
     bool skip = false;
 
     switch (binding.descriptor_class) {
@@ -241,18 +241,18 @@ bool DescriptorValidator::ValidateBindingDynamic(const spirv::ResourceInterfaceV
             skip |= ValidateDescriptorsDynamic(resource_variable, static_cast<const BufferBinding &>(binding), index);
             break;
         case DescriptorClass::ImageSampler: {
-            auto &img_sampler_binding = static_cast<ImageSamplerBinding &>(binding);
+            const auto &img_sampler_binding = static_cast<const ImageSamplerBinding &>(binding);
             if (dev_proxy.gpuav_settings.validate_image_layout) {
-                auto &descriptor = img_sampler_binding.descriptors[index];
+                const auto &descriptor = img_sampler_binding.descriptors[index];
                 descriptor.UpdateImageLayoutDrawState(cb_state);
             }
             skip |= ValidateDescriptorsDynamic(resource_variable, img_sampler_binding, index);
             break;
         }
         case DescriptorClass::Image: {
-            auto &img_binding = static_cast<ImageBinding &>(binding);
+            const auto &img_binding = static_cast<const ImageBinding &>(binding);
             if (dev_proxy.gpuav_settings.validate_image_layout) {
-                auto &descriptor = img_binding.descriptors[index];
+                const auto &descriptor = img_binding.descriptors[index];
                 descriptor.UpdateImageLayoutDrawState(cb_state);
             }
             skip |= ValidateDescriptorsDynamic(resource_variable, img_binding, index);
@@ -287,8 +287,10 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
     bool skip = false;
     // Verify that buffers are valid
     const VkBuffer buffer = descriptor.GetBuffer();
-    auto buffer_node = descriptor.GetBufferState();
-    if ((!buffer_node && !dev_proxy.enabled_features.nullDescriptor) || (buffer_node && buffer_node->Destroyed())) {
+    auto buffer_node = descriptor.GetBufferState(*dev_proxy.device_state);
+    // A non-null handle without state was destroyed since the update
+    if ((!buffer_node && (buffer != VK_NULL_HANDLE || !dev_proxy.enabled_features.nullDescriptor)) ||
+        (buffer_node && buffer_node->Destroyed())) {
         const LogObjectList objlist(this->objlist, descriptor_set.Handle());
         skip |= LogError(vuids->descriptor_buffer_bit_set_08114, objlist, loc.Get(),
                          "the %s is using buffer %s that is invalid or has been destroyed.%s",
@@ -346,10 +348,11 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
     bool skip = false;
     std::vector<const Sampler *> sampler_states;
     const VkImageView image_view = image_descriptor.GetImageView();
-    const ImageView *image_view_state = image_descriptor.GetImageViewState();
+    const ImageView *image_view_state = image_descriptor.GetImageViewState(*dev_proxy.device_state);
 
     if (image_descriptor.GetClass() == DescriptorClass::ImageSampler) {
-        sampler_states.emplace_back(static_cast<const ImageSamplerDescriptor &>(image_descriptor).GetSamplerState());
+        sampler_states.emplace_back(
+            static_cast<const ImageSamplerDescriptor &>(image_descriptor).GetSamplerState(*dev_proxy.device_state));
     } else if (is_gpu_av) {
         // TODO - This will skip for GPU-AV because we don't currently capture array of samplers with array of sampled images
         // https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/8922
@@ -363,14 +366,17 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
                 //       shader_validation.cpp. However, without this check some traces still crash.
                 // The issue is we set dynamic image index to zero in samplers_used_by_image so will fail GPU-AV case
                 if (descriptor && (descriptor->GetClass() == DescriptorClass::PlainSampler)) {
-                    const auto *sampler_state = static_cast<const SamplerDescriptor *>(descriptor)->GetSamplerState();
+                    const auto *sampler_state =
+                        static_cast<const SamplerDescriptor *>(descriptor)->GetSamplerState(*dev_proxy.device_state);
                     if (sampler_state) sampler_states.emplace_back(sampler_state);
                 }
             }
         }
     }
 
-    if ((!image_view_state && !dev_proxy.enabled_features.nullDescriptor) || (image_view_state && image_view_state->Destroyed())) {
+    // A non-null handle without state was destroyed since the update
+    if ((!image_view_state && (image_view != VK_NULL_HANDLE || !dev_proxy.enabled_features.nullDescriptor)) ||
+        (image_view_state && image_view_state->Destroyed())) {
         // Image view must have been destroyed since initial update. Could potentially flag the descriptor
         //  as "invalid" (updated = false) at DestroyImageView() time and detect this error at bind time
         const LogObjectList objlist(this->objlist, descriptor_set.Handle());
@@ -967,7 +973,7 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
         return skip;
     }
     skip |= ValidateSamplerDescriptor(resource_variable, index, descriptor.GetSampler(), descriptor.IsImmutableSampler(),
-                                      descriptor.GetSamplerState());
+                                      descriptor.GetSamplerState(*dev_proxy.device_state));
     return skip;
 }
 
@@ -975,8 +981,9 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
                                              VkDescriptorType descriptor_type, const TexelDescriptor &texel_descriptor) const {
     bool skip = false;
     const VkBufferView buffer_view = texel_descriptor.GetBufferView();
-    auto buffer_view_state = texel_descriptor.GetBufferViewState();
-    if ((!buffer_view_state && !dev_proxy.enabled_features.nullDescriptor) ||
+    auto buffer_view_state = texel_descriptor.GetBufferViewState(*dev_proxy.device_state);
+    // A non-null handle without state was destroyed since the update
+    if ((!buffer_view_state && (buffer_view != VK_NULL_HANDLE || !dev_proxy.enabled_features.nullDescriptor)) ||
         (buffer_view_state && buffer_view_state->Destroyed())) {
         const LogObjectList objlist(this->objlist, descriptor_set.Handle());
         skip |= LogError(vuids->descriptor_buffer_bit_set_08114, objlist, loc.Get(),
@@ -1152,7 +1159,7 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
     // Verify that acceleration structures are valid
     if (descriptor.IsKHR()) {
         auto acc = descriptor.GetAccelerationStructure();
-        auto acc_node = descriptor.GetAccelerationStructureStateKHR();
+        auto acc_node = descriptor.GetAccelerationStructureStateKHR(*dev_proxy.device_state);
         if (!acc_node || acc_node->Destroyed()) {
             // the AccelerationStructure could be null via nullDescriptor and accessing it is legal
             if (acc != VK_NULL_HANDLE || !dev_proxy.enabled_features.nullDescriptor) {
@@ -1173,7 +1180,7 @@ bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVaria
         }
     } else {
         auto acc = descriptor.GetAccelerationStructureNV();
-        auto acc_node = descriptor.GetAccelerationStructureStateNV();
+        auto acc_node = descriptor.GetAccelerationStructureStateNV(*dev_proxy.device_state);
         if (!acc_node || acc_node->Destroyed()) {
             // the AccelerationStructure could be null via nullDescriptor and accessing it is legal
             if (acc != VK_NULL_HANDLE || !dev_proxy.enabled_features.nullDescriptor) {
@@ -1207,13 +1214,15 @@ bool DescriptorValidator::ValidateSamplerDescriptor(const spirv::ResourceInterfa
     // are not accessed after they were used to create another object and can be destroyed.
     const bool can_be_destroyed = is_immutable && dev_proxy.enabled_features.maintenance4;
 
-    // Verify Sampler still valid
-    if (!sampler_state || (sampler_state->Destroyed() && !can_be_destroyed)) {
-        const LogObjectList objlist(this->objlist, descriptor_set.Handle());
-        skip |= LogError(vuids->descriptor_buffer_bit_set_08114, objlist, loc.Get(),
-                         "the %s is using sampler %s that is invalid or has been destroyed.%s",
-                         DescribeDescriptor(resource_variable, index, VK_DESCRIPTOR_TYPE_SAMPLER).c_str(),
-                         FormatHandle(sampler).c_str(), DescribeInstruction().c_str());
+    // Verify Sampler still valid, descriptors don't keep destroyed samplers so there is no state for them
+    if (!sampler_state || sampler_state->Destroyed()) {
+        if (!can_be_destroyed) {
+            const LogObjectList objlist(this->objlist, descriptor_set.Handle());
+            skip |= LogError(vuids->descriptor_buffer_bit_set_08114, objlist, loc.Get(),
+                             "the %s is using sampler %s that is invalid or has been destroyed.%s",
+                             DescribeDescriptor(resource_variable, index, VK_DESCRIPTOR_TYPE_SAMPLER).c_str(),
+                             FormatHandle(sampler).c_str(), DescribeInstruction().c_str());
+        }
     } else if (sampler_state->sampler_conversion && !is_immutable) {
         const LogObjectList objlist(this->objlist, descriptor_set.Handle());
         skip |= LogError(vuids->descriptor_buffer_bit_set_08114, objlist, loc.Get(),
@@ -1229,13 +1238,24 @@ bool DescriptorValidator::ValidateSamplerDescriptor(const spirv::ResourceInterfa
 bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVariable &resource_variable, const uint32_t index,
                                              VkDescriptorType descriptor_type, const SamplerDescriptor &descriptor) const {
     return ValidateSamplerDescriptor(resource_variable, index, descriptor.GetSampler(), descriptor.IsImmutableSampler(),
-                                     descriptor.GetSamplerState());
+                                     descriptor.GetSamplerState(*dev_proxy.device_state));
 }
 
 bool DescriptorValidator::ValidateDescriptor(const spirv::ResourceInterfaceVariable &resource_variable, uint32_t index,
                                              VkDescriptorType descriptor_type, const vvl::TensorDescriptor &descriptor) const {
     bool skip = false;
-    const vvl::TensorView *tensor_view_state = descriptor.GetTensorViewState();
+    const vvl::TensorView *tensor_view_state = descriptor.GetTensorViewState(*dev_proxy.device_state);
+    if (!tensor_view_state) {
+        const VkTensorViewARM tensor_view = descriptor.GetTensorViewRef().VkHandle();
+        if (tensor_view == VK_NULL_HANDLE) {
+            return skip;
+        }
+        const LogObjectList objlist(this->objlist, descriptor_set.Handle());
+        return LogError(vuids->descriptor_buffer_bit_set_08114, objlist, loc.Get(),
+                        "the %s is using tensorView %s that is invalid or has been destroyed.%s",
+                        DescribeDescriptor(resource_variable, index, descriptor_type).c_str(),
+                        FormatHandle(tensor_view).c_str(), DescribeInstruction().c_str());
+    }
     const auto tensor_state = tensor_view_state->tensor_state;
     if (tensor_state->unprotected) {
         skip |= dev_proxy.ValidateUnprotectedTensor(cb_state, *tensor_state, loc.Get(), vuids->protected_command_buffer_02712);
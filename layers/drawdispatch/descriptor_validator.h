@@ -48,7 +48,7 @@ class DescriptorValidator : public Logger {
     bool ValidateBindingStatic(const spirv::ResourceInterfaceVariable& binding_info, const vvl::DescriptorBinding& binding) const;
     // Used with GPU-AV when we need to run the GPU to know which descriptors are accessed.
     // The main reason we can't combine is one function needs to be const and the other is non-const.
-    bool ValidateBindingDynamic(const spirv::ResourceInterfaceVariable& binding_info, DescriptorBinding& binding,
+    bool ValidateBindingDynamic(const spirv::ResourceInterfaceVariable& binding_info, const DescriptorBinding& binding,
                                 const uint32_t index);
     void SetSetIndexForGpuAv(uint32_t set_index) { this->set_index = set_index; }
     void SetObjlistForGpuAv(const LogObjectList* objlist) { this->objlist = objlist; }
@@ -27,6 +27,8 @@
 #include "containers/small_vector.h"
 #include "containers/limits.h"
 
+struct LazyLocation;
+
 // Holds the 'Location' of where the code is inside a function/struct/etc
 // see docs/error_object.md for more details
 struct Location {
@@ -78,6 +80,12 @@ struct Location {
         return result;
     }
 
+    // same as dot(), but the Location is only built if Get() is called on the result (see LazyLocation)
+    LazyLocation lazy_dot(vvl::Field sub_field, uint32_t sub_index = vvl::kNoIndex32) const;
+
+    // So helpers can take either a Location or a LazyLocation
+    const Location& Get() const { return *this; }
+
     // same as dot() but will mark these were part of a pNext struct
     Location pNext(vvl::Struct s, vvl::Field sub_field = vvl::Field::Empty, uint32_t sub_index = vvl::kNoIndex32) const {
         Location result(*this, s, sub_field, sub_index, true);
@@ -89,6 +97,21 @@ struct Location {
     const char* StringField() const { return vvl::String(field); }
 };
 
+// What dot() would need to build a Location, kept until a validation helper actually needs the Location (when logging an
+// error). The generated stateless checks pass these for every field they look at, and almost all of them pass.
+// Must not outlive the parent Location, which is the case when passed straight to a function.
+struct LazyLocation {
+    const Location& parent;
+    const vvl::Field field;
+    const uint32_t index;
+
+    Location Get() const { return parent.dot(field, index); }
+};
+
+inline LazyLocation Location::lazy_dot(vvl::Field sub_field, uint32_t sub_index) const {
+    return LazyLocation{*this, sub_field, sub_index};
+}
+
 std::string PrintPNextChain(vvl::Struct in_struct, const void* in_pNext);
 
 // Contains the base information needed for errors to be logged out
@@ -16,7 +16,10 @@
  */
 #include "logging.h"
 
+#include <condition_variable>
 #include <csignal>
+#include <optional>
+#include <thread>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include <debugapi.h>
 #endif
@@ -95,9 +98,284 @@ void DebugReport::RemoveDebugUtilsCallback(uint64_t callback) {
     SetDebugUtilsSeverityFlags(callbacks);
 }
 
+bool MessageCounter::Count(uint32_t vuid_hash, uint32_t limit, bool &out_at_limit) {
+    out_at_limit = false;
+    uint32_t index = vuid_hash & (kTableSize - 1);
+    for (uint32_t probe = 0; probe < kMaxProbes; ++probe, index = (index + 1) & (kTableSize - 1)) {
+        std::atomic<uint64_t> &entry = table_[index];
+        uint64_t value = entry.load(std::memory_order_relaxed);
+        while (true) {
+            if (value == 0) {
+                // First time this message is seen, the count of a used entry is never 0
+                if (entry.compare_exchange_weak(value, (uint64_t(vuid_hash) << 32) | 1, std::memory_order_relaxed)) {
+                    return true;
+                }
+                continue;
+            }
+            if (uint32_t(value >> 32) != vuid_hash) {
+                break;  // used by another message
+            }
+            const uint32_t count = uint32_t(value);
+            if (count >= limit) {
+                return false;
+            }
+            if (entry.compare_exchange_weak(value, value + 1, std::memory_order_relaxed)) {
+                out_at_limit = count + 1 >= limit;
+                return true;
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(overflow_lock_);
+    auto [it, inserted] = overflow_counts_.try_emplace(vuid_hash, 1);
+    if (inserted) {
+        return true;
+    }
+    if (it->second >= limit) {
+        return false;
+    }
+    it->second++;
+    out_at_limit = it->second >= limit;
+    return true;
+}
+
+// Bounded multi-producer single-consumer ring of messages, drained by a dedicated thread.
+//
+// Producers take a ticket with a single atomic increment and own the slot of that ticket once the consumer released it, so
+// pushing never takes a lock unless the ring is full (then the producer sleeps until the consumer frees the slot) or the consumer
+// is asleep. Messages are delivered in ticket order. Duplicate messages past the limit are dropped before they get here.
+//
+// Object names and labels are copied by the producer, they may have changed by the time the message is delivered.
+class DebugReport::AsyncMessageQueue {
+  public:
+    explicit AsyncMessageQueue(DebugReport &debug_report) : debug_report_(debug_report), slots_(new Slot[kCapacity]) {
+        for (uint64_t i = 0; i < kCapacity; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        worker_ = std::thread([this]() { Run(); });
+    }
+
+    ~AsyncMessageQueue() {
+        {
+            std::lock_guard<std::mutex> guard(wake_mutex_);
+            stop_ = true;
+        }
+        wake_cv_.notify_one();
+        worker_.join();
+    }
+
+    void Push(VkFlags msg_flags, std::string_view vuid_text, uint32_t vuid_hash, bool at_message_limit,
+              const LogObjectList &objects, const Location &loc, const std::string &main_message) {
+        // Logged by a callback, the worker holds debug_output_mutex and would wait on itself for a free slot
+        if (std::this_thread::get_id() == worker_.get_id()) {
+            debug_report_.dropped_message_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        DebugReport::MessageObjects message_objects;
+        if (!objects.object_list.empty()) {
+            std::lock_guard<std::mutex> guard(debug_report_.debug_output_mutex);
+            debug_report_.GetMessageObjectsNoLock(objects, message_objects);
+        }
+
+        const uint64_t ticket = enqueue_pos_.fetch_add(1, std::memory_order_relaxed);
+        Slot &slot = slots_[ticket % kCapacity];
+        if (slot.sequence.load(std::memory_order_acquire) != ticket) {
+            // Full, the consumer is busy delivering the previous lap
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            space_waiters_.fetch_add(1, std::memory_order_seq_cst);
+            space_cv_.wait(lock, [&]() { return slot.sequence.load(std::memory_order_seq_cst) == ticket; });
+            space_waiters_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        Message &message = slot.message;
+        message.msg_flags = msg_flags;
+        message.vuid_text = vuid_text;
+        message.vuid_hash = vuid_hash;
+        message.at_message_limit = at_message_limit;
+        message.objects = std::move(message_objects);
+        message.loc.emplace(loc);
+        message.debug_region = loc.debug_region ? *loc.debug_region : std::string();
+        message.main_message = main_message;
+        slot.sequence.store(ticket + 1, std::memory_order_seq_cst);
+
+        if (worker_sleeping_.load(std::memory_order_seq_cst)) {
+            Wake();
+        }
+    }
+
+    void Flush() {
+        // A callback calling into Vulkan would wait on itself
+        if (std::this_thread::get_id() == worker_.get_id()) {
+            return;
+        }
+        const uint64_t target = enqueue_pos_.load(std::memory_order_acquire);
+        if (delivered_.load(std::memory_order_acquire) >= target) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        flush_waiters_.fetch_add(1, std::memory_order_seq_cst);
+        wake_cv_.notify_one();
+        flushed_cv_.wait(lock, [&]() { return delivered_.load(std::memory_order_seq_cst) >= target; });
+        flush_waiters_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+  private:
+    static constexpr uint64_t kCapacity = 1024;
+
+    struct Message {
+        VkFlags msg_flags = 0;
+        std::string vuid_text;
+        uint32_t vuid_hash = 0;
+        bool at_message_limit = false;
+        DebugReport::MessageObjects objects;
+        std::optional<vvl::LocationCapture> loc;
+        std::string debug_region;  // the Location only points to it
+        std::string main_message;
+    };
+
+    struct Slot {
+        // ticket which can write the slot, ticket + 1 once the message is ready to be read
+        std::atomic<uint64_t> sequence{0};
+        Message message;
+    };
+
+    void Wake() {
+        { std::lock_guard<std::mutex> guard(wake_mutex_); }
+        wake_cv_.notify_one();
+    }
+
+    bool IsReady(const Slot &slot) const { return slot.sequence.load(std::memory_order_seq_cst) == dequeue_pos_ + 1; }
+
+    void Run() {
+        while (true) {
+            Slot &slot = slots_[dequeue_pos_ % kCapacity];
+            if (!IsReady(slot)) {
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                worker_sleeping_.store(true, std::memory_order_seq_cst);
+                // Producers check worker_sleeping_ after publishing, so one of the two sees the other
+                wake_cv_.wait(lock, [&]() { return stop_ || IsReady(slot); });
+                worker_sleeping_.store(false, std::memory_order_relaxed);
+                if (!IsReady(slot)) {
+                    // Stopping, drain whatever producers already took a ticket for
+                    if (enqueue_pos_.load(std::memory_order_acquire) == dequeue_pos_) {
+                        return;
+                    }
+                    lock.unlock();
+                    std::this_thread::yield();
+                }
+                continue;
+            }
+
+            Message message = std::move(slot.message);
+            slot.sequence.store(dequeue_pos_ + kCapacity, std::memory_order_seq_cst);
+            ++dequeue_pos_;
+            if (space_waiters_.load(std::memory_order_seq_cst) != 0) {
+                { std::lock_guard<std::mutex> guard(wake_mutex_); }
+                space_cv_.notify_all();
+            }
+
+            {
+                const Location &loc = message.loc->Get();
+                loc.debug_region = message.debug_region.empty() ? nullptr : &message.debug_region;
+                std::unique_lock<std::mutex> lock(debug_report_.debug_output_mutex);
+                debug_report_.DeliverMessage(message.msg_flags, message.vuid_text, message.vuid_hash, message.at_message_limit,
+                                             message.objects, loc, message.main_message);
+            }
+
+            delivered_.store(dequeue_pos_, std::memory_order_seq_cst);
+            if (flush_waiters_.load(std::memory_order_seq_cst) != 0) {
+                { std::lock_guard<std::mutex> guard(wake_mutex_); }
+                flushed_cv_.notify_all();
+            }
+        }
+    }
+
+    DebugReport &debug_report_;
+    std::unique_ptr<Slot[]> slots_;
+    alignas(64) std::atomic<uint64_t> enqueue_pos_{0};
+    alignas(64) std::atomic<uint64_t> delivered_{0};
+    uint64_t dequeue_pos_ = 0;  // only used by the worker
+
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable flushed_cv_;
+    std::condition_variable space_cv_;
+    std::atomic<bool> worker_sleeping_{false};
+    std::atomic<uint32_t> flush_waiters_{0};
+    std::atomic<uint32_t> space_waiters_{0};
+    bool stop_ = false;
+    std::thread worker_;
+};
+
+DebugReport::DebugReport() = default;
+
+DebugReport::~DebugReport() = default;
+
+void DebugReport::StartAsyncMessageDelivery() {
+    if (!async_message_queue_) {
+        async_message_queue_ = std::make_unique<AsyncMessageQueue>(*this);
+    }
+}
+
+void DebugReport::FlushMessages() {
+    if (async_message_queue_) {
+        async_message_queue_->Flush();
+    }
+}
+
+// The capture messages logged by this thread go to, if any
+static thread_local MessageCapture *t_message_capture = nullptr;
+static thread_local uint64_t t_attempted_message_count = 0;
+
+uint64_t DebugReport::ThreadAttemptedMessageCount() { return t_attempted_message_count; }
+
+struct MessageCapture::Message {
+    DebugReport *debug_report;
+    VkFlags msg_flags;
+    std::string vuid_text;
+    LogObjectList objects;
+    vvl::LocationCapture loc;
+    std::string debug_region;  // the Location only points to it
+    std::string main_message;
+};
+
+MessageCapture::Scope::Scope(MessageCapture &capture) : previous_(t_message_capture) { t_message_capture = &capture; }
+
+MessageCapture::Scope::~Scope() { t_message_capture = previous_; }
+
+MessageCapture::MessageCapture() = default;
+MessageCapture::~MessageCapture() = default;
+MessageCapture::MessageCapture(MessageCapture &&) = default;
+MessageCapture &MessageCapture::operator=(MessageCapture &&) = default;
+
+void MessageCapture::Add(DebugReport &debug_report, VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects,
+                         const Location &loc, const std::string &main_message) {
+    messages_.push_back(Message{&debug_report, msg_flags, std::string(vuid_text), objects, vvl::LocationCapture(loc),
+                                loc.debug_region ? *loc.debug_region : std::string(), main_message});
+}
+
+bool MessageCapture::Replay() {
+    bool skip = false;
+    for (const Message &message : messages_) {
+        const Location &loc = message.loc.Get();
+        loc.debug_region = message.debug_region.empty() ? nullptr : &message.debug_region;
+        skip |= message.debug_report->LogMessage(message.msg_flags, message.vuid_text, message.objects, loc, message.main_message);
+    }
+    messages_.clear();
+    return skip;
+}
+
 // We try to return as early as we can if we know we don't need to spend time logging the message
 bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
                              const std::string &main_message) {
+    ++t_attempted_message_count;
+    if (t_message_capture) {
+        // Counted and filtered when replayed
+        t_message_capture->Add(*this, msg_flags, vuid_text, objects, loc, main_message);
+        return false;
+    }
+
     // Convert the info to the VK_EXT_debug_utils format
     VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
     VkDebugUtilsMessageTypeFlagsEXT msg_type;
@@ -120,39 +398,28 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
         // GPU-AV gives lots of warnings on setup to inform user which settings we are adjusting under them
         (vuid_hash == 0x24b5c69f);
 
-    // This lock needs to be here, duplicate_message_count_map is not safe to update on multiple threads
-    // see https://issues.angleproject.org/issues/450466850
-    std::unique_lock<std::mutex> lock(debug_output_mutex);
-
     // Count for this particular message is over the limit, ignore it
     bool at_message_limit = false;
     if (duplicate_message_limit > 0 && !skip_checking_limit) {
-        auto vuid_count_it = duplicate_message_count_map.find(vuid_hash);
-        if (vuid_count_it == duplicate_message_count_map.end()) {
-            duplicate_message_count_map.emplace(vuid_hash, 1);
-        } else if (vuid_count_it->second >= duplicate_message_limit) {
+        if (!duplicate_message_counter.Count(vuid_hash, duplicate_message_limit, at_message_limit)) {
             return false;
-        } else {
-            // In theory we have not locked the mutex yet
-            // 1. Its hard to have 2 exact VUID be called at same time
-            // 2. This limit is rarely, if ever, used to get an exact amount and really just there to stop spamming the user
-            vuid_count_it->second++;
-            if (vuid_count_it->second >= duplicate_message_limit) {
-                at_message_limit = true;
-            }
         }
     }
 
-    std::vector<VkDebugUtilsLabelEXT> queue_labels;
-    std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+    if (async_message_queue_) {
+        async_message_queue_->Push(msg_flags, vuid_text, vuid_hash, at_message_limit, objects, loc, main_message);
+        return false;
+    }
 
-    std::vector<std::string> object_labels;
-    // Ensures that push_back will not reallocate, thereby providing pointer
-    // stability for pushed strings.
-    object_labels.reserve(objects.object_list.size());
+    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    MessageObjects message_objects;
+    GetMessageObjectsNoLock(objects, message_objects);
+    return DeliverMessage(msg_flags, vuid_text, vuid_hash, at_message_limit, message_objects, loc, main_message);
+}
 
-    std::vector<VkDebugUtilsObjectNameInfoEXT> object_name_infos;
-    object_name_infos.reserve(objects.object_list.size());
+void DebugReport::GetMessageObjectsNoLock(const LogObjectList &objects, MessageObjects &out_message_objects) const {
+    out_message_objects.name_infos.reserve(objects.object_list.size());
+    out_message_objects.names.reserve(objects.object_list.size());
     for (uint32_t i = 0; i < objects.object_list.size(); i++) {
         const VulkanTypedHandle &current_object = objects.object_list[i];
         // If only one VkDevice was created, it is just noise to print it out in the error message.
@@ -167,33 +434,51 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
         object_name_info.objectHandle = current_object.handle;
         object_name_info.pObjectName = nullptr;
 
-        std::string object_label = {};
         // Look for any debug utils or marker names to use for this object
-        // NOTE: the lock (debug_output_mutex) is held by the caller (LogMsg)
-        object_label = GetUtilsObjectNameNoLock(current_object.handle);
+        std::string object_label = GetUtilsObjectNameNoLock(current_object.handle);
         if (object_label.empty()) {
             object_label = GetMarkerObjectNameNoLock(current_object.handle);
         }
-        if (!object_label.empty()) {
-            object_labels.push_back(std::move(object_label));
-            object_name_info.pObjectName = object_labels.back().c_str();
-        }
+        out_message_objects.names.emplace_back(std::move(object_label));
 
         // If this is a queue, add any queue labels to the callback data.
         if (VK_OBJECT_TYPE_QUEUE == object_name_info.objectType) {
             auto label_iter = debug_utils_queue_labels.find(reinterpret_cast<VkQueue>(object_name_info.objectHandle));
             if (label_iter != debug_utils_queue_labels.end()) {
-                label_iter->second->Export(queue_labels);
+                label_iter->second->Export(out_message_objects.queue_labels);
             }
             // If this is a command buffer, add any command buffer labels to the callback data.
         } else if (VK_OBJECT_TYPE_COMMAND_BUFFER == object_name_info.objectType) {
             auto label_iter = debug_utils_cmd_buffer_labels.find(reinterpret_cast<VkCommandBuffer>(object_name_info.objectHandle));
             if (label_iter != debug_utils_cmd_buffer_labels.end()) {
-                label_iter->second->Export(cmd_buf_labels);
+                label_iter->second->Export(out_message_objects.cmd_buf_labels);
             }
         }
 
-        object_name_infos.push_back(object_name_info);
+        out_message_objects.name_infos.push_back(object_name_info);
+    }
+}
+
+bool DebugReport::DeliverMessage(VkFlags msg_flags, std::string_view vuid_text, uint32_t vuid_hash, bool at_message_limit,
+                                 MessageObjects &message_objects, const Location &loc, const std::string &main_message) {
+    VkDebugUtilsMessageSeverityFlagsEXT msg_severity;
+    VkDebugUtilsMessageTypeFlagsEXT msg_type;
+    DebugReportFlagsToAnnotFlags(msg_flags, &msg_severity, &msg_type);
+
+    std::vector<VkDebugUtilsObjectNameInfoEXT> &object_name_infos = message_objects.name_infos;
+    for (size_t i = 0; i < object_name_infos.size(); i++) {
+        const std::string &name = message_objects.names[i];
+        object_name_infos[i].pObjectName = name.empty() ? nullptr : name.c_str();
+    }
+    std::vector<VkDebugUtilsLabelEXT> queue_labels;
+    queue_labels.reserve(message_objects.queue_labels.size());
+    for (const LoggingLabel &label : message_objects.queue_labels) {
+        queue_labels.emplace_back(label.Export());
+    }
+    std::vector<VkDebugUtilsLabelEXT> cmd_buf_labels;
+    cmd_buf_labels.reserve(message_objects.cmd_buf_labels.size());
+    for (const LoggingLabel &label : message_objects.cmd_buf_labels) {
+        cmd_buf_labels.emplace_back(label.Export());
     }
 
     VkDebugUtilsMessengerCallbackDataEXT callback_data = vku::InitStructHelper();
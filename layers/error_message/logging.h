@@ -18,6 +18,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdarg>
 #include <mutex>
 #include <string>
@@ -174,6 +175,20 @@ struct LoggingLabelState {
             }
         });
     }
+    // Same, but copies the labels so they are not changed by later label commands
+    void Export(std::vector<LoggingLabel> &exported_labels) const {
+        exported_labels.reserve(exported_labels.size() + 1 + labels.size());
+
+        if (!insert_label.Empty()) {
+            exported_labels.emplace_back(insert_label);
+        }
+
+        std::for_each(labels.rbegin(), labels.rend(), [&exported_labels](const LoggingLabel &label) {
+            if (!label.Empty()) {
+                exported_labels.emplace_back(label);
+            }
+        });
+    }
 };
 
 class TypedHandleWrapper {
@@ -204,8 +219,28 @@ struct MessageFormatSettings {
 #define DECORATE_PRINTF(_fmt_num, _first_param_num)
 #endif
 
+// Counts how many times each VUID was logged, for duplicate_message_limit.
+// Each slot of the table packs {vuid hash, count} in one atomic so counting, and rejecting a message past the limit, never takes a
+// lock. Hashes that do not find a slot within kMaxProbes of their home slot go in a map guarded by a mutex.
+class MessageCounter {
+  public:
+    // Returns false if the message was already counted limit times, otherwise sets out_at_limit if this is the last time
+    bool Count(uint32_t vuid_hash, uint32_t limit, bool &out_at_limit);
+
+  private:
+    static constexpr uint32_t kTableSize = 1024;  // must be a power of 2
+    static constexpr uint32_t kMaxProbes = 16;
+    std::array<std::atomic<uint64_t>, kTableSize> table_{};
+
+    std::mutex overflow_lock_;
+    vvl::unordered_map<uint32_t, uint32_t> overflow_counts_;
+};
+
 class DebugReport {
   public:
+    DebugReport();
+    ~DebugReport();
+
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
     // We use unordered_set to use trivial hashing for filter_message_ids as we already store hashed values
     vvl::unordered_set<uint32_t> filter_message_ids{};
@@ -213,6 +248,11 @@ class DebugReport {
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
     uint32_t duplicate_message_limit = 0;  // zero will keep printing forever
+    // Every message the calling thread tried to log, counted before any filtering (captured ones included). Read before and after
+    // a call, it tells if that call found anything at all, whatever the other threads are doing.
+    static uint64_t ThreadAttemptedMessageCount();
+    // Messages logged from a callback while messages are delivered asynchronously, those can't be delivered
+    std::atomic<uint64_t> dropped_message_count{0};
     const void *instance_pnext_chain{};
     bool force_default_log_callback{false};
     uint32_t device_created = 0;
@@ -246,6 +286,12 @@ class DebugReport {
     bool LogMessage(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
                     const std::string &main_message);
 
+    // Messages are then queued by the validating threads and formatted/delivered to the callbacks by a dedicated thread.
+    // The callbacks return value is ignored in this mode, so the Vulkan call is never skipped.
+    void StartAsyncMessageDelivery();
+    // Returns once every message logged before the call was delivered, does nothing if messages are delivered synchronously
+    void FlushMessages();
+
     void BeginQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
     void EndQueueDebugUtilsLabel(VkQueue queue);
     void InsertQueueDebugUtilsLabel(VkQueue queue, const VkDebugUtilsLabelEXT *label_info);
@@ -257,6 +303,20 @@ class DebugReport {
     void EraseCmdDebugUtilsLabel(VkCommandBuffer command_buffer);
 
   private:
+    class AsyncMessageQueue;
+
+    // Names and labels of the objects of a message, copied when the message is logged
+    struct MessageObjects {
+        std::vector<VkDebugUtilsObjectNameInfoEXT> name_infos;  // pObjectName points in names once delivered
+        std::vector<std::string> names;
+        std::vector<LoggingLabel> queue_labels;
+        std::vector<LoggingLabel> cmd_buf_labels;
+    };
+    // NoLock suffix means that the function itself does not hold debug_output_mutex lock, the caller must
+    void GetMessageObjectsNoLock(const LogObjectList &objects, MessageObjects &out_message_objects) const;
+    // Formatting and callbacks, must hold debug_output_mutex
+    bool DeliverMessage(VkFlags msg_flags, std::string_view vuid_text, uint32_t vuid_hash, bool at_message_limit,
+                        MessageObjects &message_objects, const Location &loc, const std::string &main_message);
     std::string CreateMessageText(const Location &loc, std::string_view vuid_text, const std::string &main_message,
                                   bool at_message_limit);
     std::string CreateMessageJson(VkFlags msg_flags, const Location &loc,
@@ -265,12 +325,50 @@ class DebugReport {
 
     VkDebugUtilsMessageSeverityFlagsEXT active_msg_severities{0};
     VkDebugUtilsMessageTypeFlagsEXT active_msg_types{0};
-    vvl::unordered_map<uint32_t, uint32_t> duplicate_message_count_map{};
+    MessageCounter duplicate_message_counter;
 
     vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debug_utils_queue_labels;
     vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debug_utils_cmd_buffer_labels;
     vvl::unordered_map<uint64_t, std::string> debug_object_name_map;
     vvl::unordered_map<uint64_t, std::string> debug_utils_object_name_map;
+
+    // Last, so the delivery thread is drained and joined while everything it uses is still alive
+    std::unique_ptr<AsyncMessageQueue> async_message_queue_;
+};
+
+// Holds back the messages logged by a thread, so work split across threads can still report them in a deterministic order.
+// Each task logs into its own MessageCapture (through a Scope), the caller then replays them in order once the tasks are done.
+class MessageCapture {
+  public:
+    // While alive, messages logged by the calling thread go in the capture instead of being delivered
+    class Scope {
+      public:
+        explicit Scope(MessageCapture &capture);
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+      private:
+        MessageCapture *previous_;
+    };
+
+    MessageCapture();
+    ~MessageCapture();
+    MessageCapture(MessageCapture &&);
+    MessageCapture &operator=(MessageCapture &&);
+
+    // Logs the messages in the order they were captured, returns true if a callback asked to skip the call
+    bool Replay();
+
+  private:
+    friend class DebugReport;
+    struct Message;
+
+    void Add(DebugReport &debug_report, VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects,
+             const Location &loc, const std::string &main_message);
+
+    std::vector<Message> messages_;
 };
 
 class Logger {
@@ -359,6 +457,8 @@ VKAPI_ATTR VkResult LayerCreateReportCallback(DebugReport *debug_report, bool de
 
 template <typename T>
 static inline void LayerDestroyCallback(DebugReport *debug_report, T callback) {
+    // Messages logged before the callback is destroyed still need to reach it
+    debug_report->FlushMessages();
     std::unique_lock<std::mutex> lock(debug_report->debug_output_mutex);
     debug_report->RemoveDebugUtilsCallback(CastToUint64(callback));
 }
@@ -259,6 +259,15 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
 
     shared_resources_manager.Clear();
 
+    instrumentation_thread_pool_.reset();
+    if (instrumented_shader_cache_) {
+        if (!instrumented_shader_cache_->Save()) {
+            LogInfo("WARNING-cache-write-error", device, record_obj.location, "Cannot write instrumented shader cache to %s",
+                    instrumented_shader_cache_path_.c_str());
+        }
+        instrumented_shader_cache_.reset();
+    }
+
     global_indices_buffer_.Destroy();
     global_resource_descriptor_buffer_.Destroy();
 
@@ -45,6 +45,7 @@ void GpuAVSettings::DisableShaderInstrumentationAndOptions() {
     shader_instrumentation.vertex_attribute_fetch_oob = false;
     // Because of this setting, cannot really have an "enabled" parameter to pass to this method
     select_instrumented_shaders = false;
+    cache_instrumented_shaders = false;
 }
 bool GpuAVSettings::IsBufferValidationEnabled() const {
     return validate_indirect_draws_buffers || validate_indirect_dispatches_buffers || validate_indirect_trace_rays_buffers ||
@@ -98,6 +99,9 @@ void GpuAVSettings::TracyLogSettings() const {
     } else {
         VVL_TracyMessageStream("  shader_selection_regexes: (empty)");
     }
+    VVL_TracyMessageStream("  cache_instrumented_shaders: " << cache_instrumented_shaders);
+    VVL_TracyMessageStream("  instrumented_shader_cache_size_mb: " << instrumented_shader_cache_size_mb);
+    VVL_TracyMessageStream("  parallel_shader_instrumentation: " << parallel_shader_instrumentation);
     VVL_TracyMessageStream("  validate_indirect_draws_buffers: " << validate_indirect_draws_buffers);
     VVL_TracyMessageStream("  validate_indirect_dispatches_buffers: " << validate_indirect_dispatches_buffers);
     VVL_TracyMessageStream("  validate_indirect_trace_rays_buffers: " << validate_indirect_trace_rays_buffers);
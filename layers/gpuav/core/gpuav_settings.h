@@ -27,6 +27,9 @@ struct GpuAVSettings {
     bool force_on_robustness = false;
     bool select_instrumented_shaders = false;
     std::vector<std::string> shader_selection_regexes{};
+    bool cache_instrumented_shaders = true;
+    uint32_t instrumented_shader_cache_size_mb = 256;
+    bool parallel_shader_instrumentation = false;
 
     bool validate_indirect_draws_buffers = true;
     bool validate_indirect_dispatches_buffers = true;
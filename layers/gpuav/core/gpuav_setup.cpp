@@ -28,6 +28,7 @@
 #include "gpuav/shaders/gpuav_error_header.h"
 #include "gpuav/shaders/gpuav_shaders_constants.h"
 #include "utils/dispatch_utils.h"
+#include "utils/file_system_utils.h"
 #include "utils/math_utils.h"
 
 namespace gpuav {
@@ -244,6 +245,33 @@ void Validator::FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const L
     // Need the device to be created before we can query features for settings
     InitSettings(loc);
 
+    // The debug settings are about looking at the instrumentation itself, so always instrument when one is set
+    const bool instrumentation_debugging =
+        gpuav_settings.debug_validate_instrumented_shaders || gpuav_settings.debug_dump_instrumented_shaders ||
+        gpuav_settings.debug_print_instrumentation_info || gpuav_settings.debug_max_instrumentations_count != 0;
+    // Without a build id, a cache written by another layer build could not be told apart
+    if (gpuav_settings.cache_instrumented_shaders && gpuav_settings.IsSpirvModified() && !instrumentation_debugging &&
+        GetLayerBuildId() != 0) {
+        instrumented_shader_cache_path_ = GetTempFilePath() + "/instrumented_shader_cache";
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__GNU__)
+        instrumented_shader_cache_path_ += "-" + std::to_string(getuid());
+#endif
+        instrumented_shader_cache_path_ += ".bin";
+
+        instrumented_shader_cache_ = std::make_unique<InstrumentedShaderCache>(
+            instrumented_shader_cache_path_, GetInstrumentedShaderCacheSettingsHash(),
+            uint64_t(gpuav_settings.instrumented_shader_cache_size_mb) * 1024 * 1024);
+        if (!instrumented_shader_cache_->Load()) {
+            LogInfo("WARNING-cache-file-error", device, loc,
+                    "Cannot use instrumented shader cache at %s (it may not exist yet or is from different settings)",
+                    instrumented_shader_cache_path_.c_str());
+        }
+    }
+
+    if (gpuav_settings.parallel_shader_instrumentation && gpuav_settings.IsSpirvModified()) {
+        instrumentation_thread_pool_ = std::make_unique<vvl::ThreadPool>();
+    }
+
     VkResult result = UtilInitializeVma(instance, physical_device, device, &vma_allocator_);
     if (result != VK_SUCCESS) {
         InternalVmaError(device, result, "Could not initialize VMA");
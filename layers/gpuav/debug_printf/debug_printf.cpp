@@ -234,7 +234,8 @@ void AnalyzeAndGenerateMessage(Validator &gpuav, VkCommandBuffer command_buffer,
             format_string = std::string(op_string);
         } else {
             // We have plumbed the OpString from the instrumented shader
-            for (auto debug_instrumented_info : gpuav.internal_only_debug_printf_) {
+            std::lock_guard<std::mutex> guard(gpuav.internal_only_debug_printf_lock_);
+            for (const auto &debug_instrumented_info : gpuav.internal_only_debug_printf_) {
                 if ((debug_instrumented_info.unique_shader_id == debug_record->shader_id) &&
                     (debug_record->format_string_id == debug_instrumented_info.op_string_id)) {
                     format_string = debug_instrumented_info.op_string_text;
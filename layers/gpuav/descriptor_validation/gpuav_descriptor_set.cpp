@@ -56,89 +56,97 @@ void DescriptorSetSubState::BuildBindingLayouts() {
     }
 }
 
-template <typename StateObject>
-DescriptorId GetId(const StateObject *obj, bool allow_null = true) {
-    if (!obj) {
+// A null handle is a null descriptor. A handle that no longer resolves was destroyed, which the shader reports with id 0.
+template <typename State, typename HandleType>
+DescriptorId GetId(const vvl::DescriptorStateRef<State, HandleType> &ref, const vvl::DeviceState &dev_data,
+                   bool allow_null = true) {
+    if (ref.VkHandle() == VK_NULL_HANDLE) {
         return allow_null ? glsl::kNullDescriptor : 0;
     }
+    const State *obj = ref.Get(dev_data);
+    if (!obj) {
+        return 0;
+    }
     auto &sub_state = SubState(*obj);
     return sub_state.Id();
 }
 
-static glsl::DescriptorState GetInData(const vvl::BufferDescriptor &desc) {
-    return glsl::DescriptorState(DescriptorClass::GeneralBuffer, GetId(desc.GetBufferState()),
-                                 static_cast<uint32_t>(desc.GetEffectiveRange()));
+static glsl::DescriptorState GetInData(const vvl::BufferDescriptor &desc, const vvl::DeviceState &dev_data) {
+    return glsl::DescriptorState(DescriptorClass::GeneralBuffer, GetId(desc.GetBufferRef(), dev_data),
+                                 static_cast<uint32_t>(desc.GetEffectiveRange(dev_data)));
 }
 
-static glsl::DescriptorState GetInData(const vvl::TexelDescriptor &desc) {
-    auto *buffer_view_state = desc.GetBufferViewState();
+static glsl::DescriptorState GetInData(const vvl::TexelDescriptor &desc, const vvl::DeviceState &dev_data) {
+    auto *buffer_view_state = desc.GetBufferViewState(dev_data);
     uint32_t res_size = vvl::kNoIndex32;
     if (buffer_view_state) {
         auto view_size = buffer_view_state->Size();
         res_size = static_cast<uint32_t>(view_size / GetTexelBufferFormatSize(buffer_view_state->create_info.format));
     }
-    return glsl::DescriptorState(DescriptorClass::TexelBuffer, GetId(buffer_view_state), res_size);
+    return glsl::DescriptorState(DescriptorClass::TexelBuffer, GetId(desc.GetBufferViewRef(), dev_data), res_size);
 }
 
-static glsl::DescriptorState GetInData(const vvl::ImageDescriptor &desc) {
-    return glsl::DescriptorState(DescriptorClass::Image, GetId(desc.GetImageViewState()));
+static glsl::DescriptorState GetInData(const vvl::ImageDescriptor &desc, const vvl::DeviceState &dev_data) {
+    return glsl::DescriptorState(DescriptorClass::Image, GetId(desc.GetImageViewRef(), dev_data));
 }
 
-static glsl::DescriptorState GetInData(const vvl::TensorDescriptor &desc) {
-    auto tensor_view_state = static_cast<const vvl::TensorView *>(desc.GetTensorViewState());
-    return glsl::DescriptorState(DescriptorClass::Tensor, tensor_view_state ? tensor_view_state->GetId() : glsl::kNullDescriptor);
+static glsl::DescriptorState GetInData(const vvl::TensorDescriptor &desc, const vvl::DeviceState &) {
+    // Tensors have no GPU-AV sub state, the state tracker id is used as is
+    const uint32_t id = desc.GetTensorViewRef().Id();
+    return glsl::DescriptorState(DescriptorClass::Tensor, id != 0 ? id : glsl::kNullDescriptor);
 }
 
-static glsl::DescriptorState GetInData(const vvl::SamplerDescriptor &desc) {
-    return glsl::DescriptorState(DescriptorClass::PlainSampler, GetId(desc.GetSamplerState()));
+static glsl::DescriptorState GetInData(const vvl::SamplerDescriptor &desc, const vvl::DeviceState &dev_data) {
+    return glsl::DescriptorState(DescriptorClass::PlainSampler, GetId(desc.GetSamplerRef(), dev_data));
 }
 
-static glsl::DescriptorState GetInData(const vvl::ImageSamplerDescriptor &desc) {
+static glsl::DescriptorState GetInData(const vvl::ImageSamplerDescriptor &desc, const vvl::DeviceState &dev_data) {
     // image can be null in some cases, but the sampler can't
-    return glsl::DescriptorState(DescriptorClass::ImageSampler, GetId(desc.GetImageViewState()),
-                                 GetId(desc.GetSamplerState(), false));
+    return glsl::DescriptorState(DescriptorClass::ImageSampler, GetId(desc.GetImageViewRef(), dev_data),
+                                 GetId(desc.GetSamplerRef(), dev_data, false));
 }
 
-static glsl::DescriptorState GetInData(const vvl::AccelerationStructureDescriptor &ac) {
-    uint32_t id = ac.IsKHR() ? GetId(ac.GetAccelerationStructureStateKHR()) : GetId(ac.GetAccelerationStructureStateNV());
+static glsl::DescriptorState GetInData(const vvl::AccelerationStructureDescriptor &ac, const vvl::DeviceState &dev_data) {
+    uint32_t id = ac.IsKHR() ? GetId(ac.GetAccelerationStructureRefKHR(), dev_data)
+                             : GetId(ac.GetAccelerationStructureRefNV(), dev_data);
     return glsl::DescriptorState(DescriptorClass::AccelerationStructure, id);
 }
 
-static glsl::DescriptorState GetInData(const vvl::MutableDescriptor &desc) {
+static glsl::DescriptorState GetInData(const vvl::MutableDescriptor &desc, const vvl::DeviceState &dev_data) {
     auto desc_class = desc.ActiveClass();
     switch (desc_class) {
         case DescriptorClass::GeneralBuffer: {
-            auto buffer_state = desc.GetSharedBufferState();
-            return glsl::DescriptorState(desc_class, GetId(buffer_state.get()),
+            auto *buffer_state = desc.GetBufferState(dev_data);
+            return glsl::DescriptorState(desc_class, GetId(desc.GetBufferRef(), dev_data),
                                          buffer_state ? static_cast<uint32_t>(buffer_state->create_info.size) : vvl::kNoIndex32);
         }
         case DescriptorClass::TexelBuffer: {
-            auto buffer_view_state = desc.GetSharedBufferViewState();
+            auto *buffer_view_state = desc.GetBufferViewState(dev_data);
             uint32_t res_size = vvl::kNoIndex32;
             if (buffer_view_state) {
                 auto view_size = buffer_view_state->Size();
                 res_size = static_cast<uint32_t>(view_size / GetTexelBufferFormatSize(buffer_view_state->create_info.format));
             }
-            return glsl::DescriptorState(desc_class, GetId(buffer_view_state.get()), res_size);
+            return glsl::DescriptorState(desc_class, GetId(desc.GetBufferViewRef(), dev_data), res_size);
         }
         case DescriptorClass::PlainSampler: {
-            return glsl::DescriptorState(desc_class, GetId(desc.GetSharedSamplerState().get()));
+            return glsl::DescriptorState(desc_class, GetId(desc.GetSamplerRef(), dev_data));
         }
         case DescriptorClass::ImageSampler: {
             // image can be null in some cases, but the sampler can't
-            return glsl::DescriptorState(desc_class, GetId(desc.GetSharedImageViewState().get()),
-                                         GetId(desc.GetSharedSamplerState().get(), false));
+            return glsl::DescriptorState(desc_class, GetId(desc.GetImageViewRef(), dev_data),
+                                         GetId(desc.GetSamplerRef(), dev_data, false));
         }
         case DescriptorClass::Image: {
-            return glsl::DescriptorState(DescriptorClass::Image, GetId(desc.GetSharedImageViewState().get()));
+            return glsl::DescriptorState(DescriptorClass::Image, GetId(desc.GetImageViewRef(), dev_data));
         }
         case DescriptorClass::Tensor: {
-            auto tensor_state = std::static_pointer_cast<const vvl::Tensor>(desc.GetSharedTensor());
-            return glsl::DescriptorState(desc_class, tensor_state ? tensor_state->GetId() : glsl::kNullDescriptor);
+            const uint32_t id = desc.GetTensorRef().Id();
+            return glsl::DescriptorState(desc_class, id != 0 ? id : glsl::kNullDescriptor);
         }
         case DescriptorClass::AccelerationStructure: {
-            uint32_t id =
-                desc.IsKHR() ? GetId(desc.GetAccelerationStructureStateKHR()) : GetId(desc.GetAccelerationStructureStateNV());
+            uint32_t id = desc.IsKHR() ? GetId(desc.GetAccelerationStructureRefKHR(), dev_data)
+                                       : GetId(desc.GetAccelerationStructureRefNV(), dev_data);
             return glsl::DescriptorState(DescriptorClass::AccelerationStructure, id);
         }
         case DescriptorClass::InlineUniform:
@@ -152,19 +160,20 @@ static glsl::DescriptorState GetInData(const vvl::MutableDescriptor &desc) {
 }
 
 template <typename Binding>
-void FillBindingInData(const Binding &binding, glsl::DescriptorState *data, uint32_t &index) {
+void FillBindingInData(const Binding &binding, const vvl::DeviceState &dev_data, glsl::DescriptorState *data, uint32_t &index) {
     for (uint32_t di = 0; di < binding.count; di++) {
         if (!binding.updated[di]) {
             data[index++] = glsl::DescriptorState();
         } else {
-            data[index++] = GetInData(binding.descriptors[di]);
+            data[index++] = GetInData(binding.descriptors[di], dev_data);
         }
     }
 }
 
 // Inline Uniforms are currently treated as a single descriptor. Writes to any offsets cause the whole range to be valid.
 template <>
-void FillBindingInData(const vvl::InlineUniformBinding &binding, glsl::DescriptorState *data, uint32_t &index) {
+void FillBindingInData(const vvl::InlineUniformBinding &binding, const vvl::DeviceState &, glsl::DescriptorState *data,
+                       uint32_t &index) {
     // While not techincally a "null descriptor" we want to skip it as if it is one
     data[index++] = glsl::DescriptorState(DescriptorClass::InlineUniform, glsl::kNullDescriptor, vvl::kNoIndex32);
 }
@@ -205,35 +214,36 @@ VkDeviceAddress DescriptorSetSubState::GetTypeAddress(Validator &gpuav) {
 
     auto data = (glsl::DescriptorState *)input_buffer_.GetMappedPtr();
 
+    const vvl::DeviceState &dev_data = *gpuav.device_state;
     uint32_t index = 0;
     for (const auto &binding : base) {
         switch (binding->descriptor_class) {
             case DescriptorClass::InlineUniform:
-                FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::InlineUniformBinding &>(*binding), dev_data, data, index);
                 break;
             case DescriptorClass::GeneralBuffer:
-                FillBindingInData(static_cast<const vvl::BufferBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::BufferBinding &>(*binding), dev_data, data, index);
                 break;
             case DescriptorClass::TexelBuffer:
-                FillBindingInData(static_cast<const vvl::TexelBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::TexelBinding &>(*binding), dev_data, data, index);
                 break;
             case DescriptorClass::Mutable:
-                FillBindingInData(static_cast<const vvl::MutableBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::MutableBinding &>(*binding), dev_data, data, index);
                 break;
             case DescriptorClass::PlainSampler:
-                FillBindingInData(static_cast<const vvl::SamplerBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::SamplerBinding &>(*binding), dev_data, data, index);
                 break;
             case DescriptorClass::ImageSampler:
-                FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::ImageSamplerBinding &>(*binding), dev_data, data, index);
                 break;
             case DescriptorClass::Image:
-                FillBindingInData(static_cast<const vvl::ImageBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::ImageBinding &>(*binding), dev_data, data, index);
                 break;
             case DescriptorClass::AccelerationStructure:
-                FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::AccelerationStructureBinding &>(*binding), dev_data, data, index);
                 break;
             case DescriptorClass::Tensor:
-                FillBindingInData(static_cast<const vvl::TensorBinding &>(*binding), data, index);
+                FillBindingInData(static_cast<const vvl::TensorBinding &>(*binding), dev_data, data, index);
                 break;
             case DescriptorClass::Invalid:
                 gpuav.InternalError(gpuav.device, Location(vvl::Func::Empty), "Unknown DescriptorClass");
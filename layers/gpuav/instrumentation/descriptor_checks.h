@@ -48,7 +48,7 @@ class DescriptorHeap {
 
 // Descriptor Ids are used on the GPU to identify if a given descriptor is valid.
 // In some applications there are very large bindless descriptor arrays where it isn't feasible to track validity
-// via the StateObject::parent_nodes_ map as usual. Instead, these ids are stored in a giant GPU accessible bitmap
+// via the StateObject parent links as usual. Instead, these ids are stored in a giant GPU accessible bitmap
 // so that the instrumentation can decide if a descriptor is actually valid when it is used in a shader.
 class DescriptorIdTracker {
   public:
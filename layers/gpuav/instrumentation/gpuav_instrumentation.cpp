@@ -852,14 +852,18 @@ bool LogMessageInstDescriptorClass(Validator &gpuav, const CommandBufferSubState
                 assert(false);
                 return false;
             }
-            const vvl::Buffer *buffer_state =
-                static_cast<const vvl::BufferBinding *>(binding_state)->descriptors[desc_index].GetBufferState();
+            const auto &buffer_descriptor = static_cast<const vvl::BufferBinding *>(binding_state)->descriptors[desc_index];
+            const vvl::Buffer *buffer_state = buffer_descriptor.GetBufferState(*gpuav.device_state);
             if (buffer_state) {
                 const uint32_t byte_offset = error_record[kInstDescriptorIndexingParamOffset_0];
                 const uint32_t resource_size = error_record[kInstDescriptorIndexingParamOffset_1];
                 strm << " access out of bounds. The descriptor buffer (" << gpuav.FormatHandle(buffer_state->Handle())
                      << ") size is " << buffer_state->create_info.size << " bytes, " << resource_size
                      << " bytes were bound, and the highest out of bounds access was at [" << byte_offset << "] bytes";
+            } else if (buffer_descriptor.GetBuffer() != VK_NULL_HANDLE) {
+                // Descriptors don't keep the buffer alive, it was destroyed since the command buffer was submitted
+                strm << " access out of bounds. The descriptor buffer (" << gpuav.FormatHandle(buffer_descriptor.GetBuffer())
+                     << ") has since been destroyed";
             } else {
                 // This will only get called when using nullDescriptor without bindless
                 strm << "Trying to access a null descriptor, but vkUpdateDescriptorSets was not called with VK_NULL_HANDLE for "
@@ -882,8 +886,8 @@ bool LogMessageInstDescriptorClass(Validator &gpuav, const CommandBufferSubState
                 return false;
             }
 
-            const vvl::BufferView *buffer_view_state =
-                static_cast<const vvl::TexelBinding *>(binding_state)->descriptors[desc_index].GetBufferViewState();
+            const auto &texel_descriptor = static_cast<const vvl::TexelBinding *>(binding_state)->descriptors[desc_index];
+            const vvl::BufferView *buffer_view_state = texel_descriptor.GetBufferViewState(*gpuav.device_state);
             if (buffer_view_state) {
                 const uint32_t byte_offset = error_record[kInstDescriptorIndexingParamOffset_0];
                 const uint32_t resource_size = error_record[kInstDescriptorIndexingParamOffset_1];
@@ -891,6 +895,10 @@ bool LogMessageInstDescriptorClass(Validator &gpuav, const CommandBufferSubState
                 strm << " access out of bounds. The descriptor texel buffer (" << gpuav.FormatHandle(buffer_view_state->Handle())
                      << ") size is " << resource_size << " texels and the highest out of bounds access was at [" << byte_offset
                      << "] bytes";
+            } else if (texel_descriptor.GetBufferView() != VK_NULL_HANDLE) {
+                // Descriptors don't keep the buffer view alive, it was destroyed since the command buffer was submitted
+                strm << " access out of bounds. The descriptor texel buffer ("
+                     << gpuav.FormatHandle(texel_descriptor.GetBufferView()) << ") has since been destroyed";
             } else {
                 // This will only get called when using nullDescriptor without bindless
                 strm << "Trying to access a null descriptor, but vkUpdateDescriptorSets was not called with VK_NULL_HANDLE for "
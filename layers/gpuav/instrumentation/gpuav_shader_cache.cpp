@@ -0,0 +1,215 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gpuav/instrumentation/gpuav_shader_cache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+#include "utils/hash_util.h"
+
+namespace gpuav {
+
+InstrumentedShaderCache::InstrumentedShaderCache(std::string path, uint64_t settings_hash, uint64_t max_size_bytes)
+    : path_(std::move(path)), settings_hash_(settings_hash), max_size_bytes_(max_size_bytes) {}
+
+static uint64_t EntryChecksum(const std::vector<uint32_t> &shader_id_words, const std::vector<uint32_t> &spirv) {
+    const uint64_t hashes[2] = {hash_util::Hash64(shader_id_words.data(), shader_id_words.size() * sizeof(uint32_t)),
+                                hash_util::Hash64(spirv.data(), spirv.size() * sizeof(uint32_t))};
+    return hash_util::Hash64(hashes, sizeof(hashes));
+}
+
+bool InstrumentedShaderCache::Load() {
+    std::lock_guard<std::mutex> guard(lock_);
+    file_.open(path_.c_str(), std::ios::in | std::ios::binary);
+    if (!file_) {
+        return false;
+    }
+    FileHeader header = {};
+    if (!file_.read(reinterpret_cast<char *>(&header), sizeof(FileHeader)) || header.header_size != sizeof(FileHeader) ||
+        header.settings_hash != settings_hash_) {
+        file_.close();
+        return false;  // different layer build or settings, start over
+    }
+    generation_ = header.generation + 1;
+
+    for (uint64_t i = 0; i < header.entry_count; ++i) {
+        EntryHeader entry_header = {};
+        if (!file_.read(reinterpret_cast<char *>(&entry_header), sizeof(EntryHeader)) ||
+            entry_header.shader_id_word_count > entry_header.word_count) {
+            break;  // truncated or corrupt, keep what was read so far
+        }
+        std::vector<uint32_t> shader_id_words(entry_header.shader_id_word_count);
+        if (!file_.read(reinterpret_cast<char *>(shader_id_words.data()), shader_id_words.size() * sizeof(uint32_t))) {
+            break;
+        }
+        const std::streamoff file_offset = file_.tellg();
+        if (!file_.seekg(std::streamoff(entry_header.word_count) * sizeof(uint32_t), std::ios::cur)) {
+            break;
+        }
+        const bool valid_offsets = std::all_of(shader_id_words.begin(), shader_id_words.end(),
+                                               [&entry_header](uint32_t word) { return word < entry_header.word_count; });
+        if (!valid_offsets) {
+            continue;
+        }
+
+        Entry &entry = entries_[entry_header.key];
+        entry.word_count = entry_header.word_count;
+        entry.checksum = entry_header.checksum;
+        entry.last_used = entry_header.last_used;
+        entry.shader_id_words = std::move(shader_id_words);
+        entry.file_offset = file_offset;
+    }
+    file_.clear();
+    return true;
+}
+
+bool InstrumentedShaderCache::ReadEntrySpirv(const Entry &entry, std::vector<uint32_t> &out_spirv) {
+    if (entry.file_offset < 0) {
+        out_spirv = entry.spirv;
+        return true;
+    }
+    out_spirv.resize(entry.word_count);
+    file_.clear();
+    if (!file_.seekg(entry.file_offset) ||
+        !file_.read(reinterpret_cast<char *>(out_spirv.data()), out_spirv.size() * sizeof(uint32_t))) {
+        file_.clear();
+        return false;
+    }
+    return EntryChecksum(entry.shader_id_words, out_spirv) == entry.checksum;
+}
+
+bool InstrumentedShaderCache::Find(uint64_t key, uint32_t unique_shader_id, std::vector<uint32_t> &out_instrumented_spirv) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return false;
+    }
+    Entry &entry = it->second;
+    if (!ReadEntrySpirv(entry, out_instrumented_spirv)) {
+        entries_.erase(it);
+        out_instrumented_spirv.clear();
+        return false;
+    }
+    for (const uint32_t word : entry.shader_id_words) {
+        uint32_t &value = out_instrumented_spirv[word];
+        value = (value & ~glsl::kShaderIdMask) | unique_shader_id;
+    }
+    entry.last_used = generation_;
+    return true;
+}
+
+void InstrumentedShaderCache::Insert(uint64_t key, const std::vector<uint32_t> &instrumented_spirv,
+                                     const std::vector<uint32_t> &shader_id_words) {
+    const uint64_t size = sizeof(EntryHeader) + (shader_id_words.size() + instrumented_spirv.size()) * sizeof(uint32_t);
+    std::lock_guard<std::mutex> guard(lock_);
+    // Anything past the limit would be evicted by Save() anyway, no need to hold on to it
+    if (inserted_bytes_ + size > max_size_bytes_) {
+        return;
+    }
+    auto [it, inserted] = entries_.try_emplace(key);
+    if (!inserted) {
+        return;  // the same shader was instrumented twice in this run
+    }
+    Entry &entry = it->second;
+    entry.word_count = static_cast<uint32_t>(instrumented_spirv.size());
+    entry.checksum = EntryChecksum(shader_id_words, instrumented_spirv);
+    entry.last_used = generation_;
+    entry.shader_id_words = shader_id_words;
+    entry.spirv = instrumented_spirv;
+    inserted_bytes_ += size;
+}
+
+bool InstrumentedShaderCache::Save() {
+    std::lock_guard<std::mutex> guard(lock_);
+
+    // Most recently used first, the key only makes the order stable
+    std::vector<std::pair<uint64_t, Entry *>> ordered_entries;
+    ordered_entries.reserve(entries_.size());
+    bool has_new_entries = false;
+    for (auto &[key, entry] : entries_) {
+        ordered_entries.emplace_back(key, &entry);
+        has_new_entries |= entry.last_used == generation_;
+    }
+    if (!has_new_entries) {
+        return true;  // nothing was used, keep the current file
+    }
+    std::sort(ordered_entries.begin(), ordered_entries.end(), [](const auto &a, const auto &b) {
+        return a.second->last_used != b.second->last_used ? a.second->last_used > b.second->last_used : a.first < b.first;
+    });
+
+    // Unique per process, so concurrent runs do not write over each other before the rename
+    const std::string tmp_path =
+        path_ + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "-" +
+        std::to_string(reinterpret_cast<uintptr_t>(this)) + ".tmp";
+    std::ofstream write_file(tmp_path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!write_file) {
+        return false;
+    }
+
+    FileHeader header = {};
+    header.header_size = sizeof(FileHeader);
+    header.settings_hash = settings_hash_;
+    header.generation = generation_;
+    write_file.write(reinterpret_cast<const char *>(&header), sizeof(FileHeader));
+
+    uint64_t written_bytes = sizeof(FileHeader);
+    std::vector<uint32_t> spirv;
+    for (const auto &[key, entry] : ordered_entries) {
+        const uint64_t size =
+            sizeof(EntryHeader) + (uint64_t(entry->shader_id_words.size()) + entry->word_count) * sizeof(uint32_t);
+        if (written_bytes + size > max_size_bytes_) {
+            break;
+        }
+        if (!ReadEntrySpirv(*entry, spirv)) {
+            continue;
+        }
+        EntryHeader entry_header = {};
+        entry_header.key = key;
+        entry_header.checksum = entry->checksum;
+        entry_header.last_used = entry->last_used;
+        entry_header.shader_id_word_count = static_cast<uint32_t>(entry->shader_id_words.size());
+        entry_header.word_count = entry->word_count;
+        write_file.write(reinterpret_cast<const char *>(&entry_header), sizeof(EntryHeader));
+        write_file.write(reinterpret_cast<const char *>(entry->shader_id_words.data()),
+                         entry->shader_id_words.size() * sizeof(uint32_t));
+        write_file.write(reinterpret_cast<const char *>(spirv.data()), spirv.size() * sizeof(uint32_t));
+        written_bytes += size;
+        header.entry_count++;
+    }
+
+    write_file.seekp(0);
+    write_file.write(reinterpret_cast<const char *>(&header), sizeof(FileHeader));
+    write_file.close();
+
+    std::error_code ec;
+    if (!write_file) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    // On Windows the rename fails while file_ is open
+    file_.close();
+    std::filesystem::rename(tmp_path, path_, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace gpuav
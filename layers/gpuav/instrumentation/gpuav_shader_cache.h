@@ -0,0 +1,92 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "gpuav/shaders/gpuav_shaders_constants.h"
+
+namespace gpuav {
+
+// Keeps the instrumented SPIR-V across runs so that creating pipelines with a warm cache can skip the instrumentation passes.
+//
+// Entries are keyed by the hash of the original SPIR-V and of the descriptor set layouts seen by the passes. Everything else that
+// changes the passes output (settings, features, layer build) goes in the settings hash of the file, a mismatch drops the file.
+//
+// The unique shader id is in the instrumented SPIR-V, so each entry also keeps the offsets of the words holding it (see
+// spirv::Module::FindShaderIdWords()). A hit gets the id of the shader being created patched in, so a cached shader can be used
+// by any number of pipelines.
+//
+// Only the entry headers and id offsets are read when loading, the SPIR-V itself is read from the file on a hit.
+class InstrumentedShaderCache {
+  public:
+    InstrumentedShaderCache(std::string path, uint64_t settings_hash, uint64_t max_size_bytes);
+
+    // Returns false if there is no usable cache at the path, in which case we start with an empty one
+    bool Load();
+    // Writes to a temporary file which is then renamed over the cache, so other processes never see a partial file.
+    // Least recently used entries are dropped to fit in the size limit.
+    bool Save();
+
+    // Returns true and the instrumented SPIR-V, with unique_shader_id patched in, if the key is in the cache
+    bool Find(uint64_t key, uint32_t unique_shader_id, std::vector<uint32_t> &out_instrumented_spirv);
+    void Insert(uint64_t key, const std::vector<uint32_t> &instrumented_spirv, const std::vector<uint32_t> &shader_id_words);
+
+  private:
+    struct FileHeader {
+        uint64_t header_size;
+        uint64_t settings_hash;
+        uint64_t generation;  // incremented on every Save(), used for LRU
+        uint64_t entry_count;
+    };
+    struct EntryHeader {
+        uint64_t key;
+        uint64_t checksum;              // of the shader id offsets and SPIR-V words, guards against a corrupt file
+        uint64_t last_used;             // generation the entry was last used or inserted
+        uint32_t shader_id_word_count;  // followed by the offsets of the shader id words, then the SPIR-V words
+        uint32_t word_count;
+    };
+
+    struct Entry {
+        uint32_t word_count = 0;
+        uint64_t checksum = 0;
+        uint64_t last_used = 0;
+        std::vector<uint32_t> shader_id_words;
+        std::streamoff file_offset = -1;  // position of the words in file_, -1 for entries inserted during this run
+        std::vector<uint32_t> spirv;      // only for entries inserted during this run
+    };
+
+    // Must hold lock_
+    bool ReadEntrySpirv(const Entry &entry, std::vector<uint32_t> &out_spirv);
+
+    const std::string path_;
+    const uint64_t settings_hash_;
+    const uint64_t max_size_bytes_;
+    uint64_t generation_ = 1;
+
+    std::mutex lock_;  // guards everything below
+    std::ifstream file_;
+    vvl::unordered_map<uint64_t, Entry> entries_;
+    uint64_t inserted_bytes_ = 0;
+};
+
+}  // namespace gpuav
@@ -25,6 +25,8 @@
 #include "chassis/chassis_modification_state.h"
 #include "gpuav/core/gpuav_constants.h"
 #include "utils/shader_utils.h"
+#include "utils/hash_util.h"
+#include "utils/file_system_utils.h"
 
 #include "gpuav/shaders/gpuav_shaders_constants.h"
 #include "gpuav/shaders/gpuav_error_codes.h"
@@ -423,28 +425,32 @@ void GpuShaderInstrumentor::PreCallRecordGetShaderBinaryDataEXT(VkDevice device,
     chassis_state.modified_shader_handle = sub_state.original_handle;
 }
 
-bool GpuShaderInstrumentor::PreCallRecordShaderObjectInstrumentation(
-    vku::safe_VkShaderCreateInfoEXT &modified_create_info, const Location &create_info_loc,
-    chassis::ShaderObjectInstrumentationData &instrumentation_data) {
+void GpuShaderInstrumentor::PreCallRecordShaderObjectInstrumentation(vku::safe_VkShaderCreateInfoEXT &modified_create_info,
+                                                                     const Location &create_info_loc,
+                                                                     chassis::ShaderObjectInstrumentationData &instrumentation_data,
+                                                                     InstrumentationBatch &batch, bool &out_is_modified) {
     if (gpuav_settings.select_instrumented_shaders && !IsSelectiveInstrumentationEnabled(modified_create_info.pNext)) {
-        return false;
+        return;
     }
 
-    std::vector<uint32_t> &instrumented_spirv = instrumentation_data.instrumented_spirv;
-    InstrumentationDescriptorSetLayouts instrumentation_dsl;
-    BuildDescriptorSetLayoutInfo(modified_create_info, instrumentation_dsl);
+    auto instrumentation_dsl = std::make_shared<InstrumentationDescriptorSetLayouts>();
+    BuildDescriptorSetLayoutInfo(modified_create_info, *instrumentation_dsl);
 
-    const uint32_t unique_shader_id = unique_shader_module_id_++;
-    const bool is_shader_instrumented = InstrumentShader(
+    batch.Instrument(
         vvl::make_span(static_cast<const uint32_t *>(modified_create_info.pCode), modified_create_info.codeSize / sizeof(uint32_t)),
-        unique_shader_id, instrumentation_dsl, create_info_loc, instrumented_spirv);
-
-    if (is_shader_instrumented) {
-        instrumentation_data.unique_shader_id = unique_shader_id;
-        modified_create_info.pCode = instrumented_spirv.data();
-        modified_create_info.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
-    }
-    return is_shader_instrumented;
+        std::move(instrumentation_dsl), create_info_loc,
+        [&modified_create_info, &instrumentation_data, &out_is_modified](bool is_shader_instrumented, uint32_t unique_shader_id,
+                                                                         std::vector<uint32_t> &instrumented_spirv) {
+            if (is_shader_instrumented) {
+                std::vector<uint32_t> &stored_spirv = instrumentation_data.instrumented_spirv;
+                stored_spirv = std::move(instrumented_spirv);
+                instrumentation_data.unique_shader_id = unique_shader_id;
+                modified_create_info.pCode = stored_spirv.data();
+                modified_create_info.codeSize = stored_spirv.size() * sizeof(uint32_t);
+                out_is_modified = true;
+            }
+            return true;
+        });
 }
 
 void GpuShaderInstrumentor::PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount,
@@ -457,6 +463,7 @@ void GpuShaderInstrumentor::PreCallRecordCreateShadersEXT(VkDevice device, uint3
     chassis_state.instrumentations_data.resize(createInfoCount);
     chassis_state.modified_create_infos.resize(createInfoCount);
 
+    InstrumentationBatch batch(*this);
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         // Need deep copy as there might be pNext items
         vku::safe_VkShaderCreateInfoEXT &new_create_info = chassis_state.modified_create_infos[i];
@@ -510,10 +517,12 @@ void GpuShaderInstrumentor::PreCallRecordCreateShadersEXT(VkDevice device, uint3
             }
             new_create_info.pSetLayouts[instrumentation_desc_set_bind_index_] = instrumentation_desc_layout_[mode];
 
-            chassis_state.is_modified |=
-                PreCallRecordShaderObjectInstrumentation(new_create_info, create_info_loc, instrumentation_data);
+            PreCallRecordShaderObjectInstrumentation(new_create_info, create_info_loc, instrumentation_data, batch,
+                                                     chassis_state.is_modified);
         }
     }
+    // Only the instrumentation itself is done in the batch, nothing can fail
+    (void)batch.Finish();
 
     chassis_state.pCreateInfos = reinterpret_cast<VkShaderCreateInfoEXT *>(chassis_state.modified_create_infos.data());
 }
@@ -586,6 +595,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    // Shaders of all the pipelines are instrumented in parallel when possible
+    InstrumentationBatch batch(*this);
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
@@ -600,19 +611,25 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
 
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
-        bool success = false;
         if (pipeline_state->linking_shaders != 0) {
-            success = PreCallRecordPipelineCreationShaderInstrumentationGPL(pAllocator, *pipeline_state, new_pipeline_ci,
-                                                                            create_info_loc, shader_instrumentation_metadata);
+            // Libraries can be shared between the pipelines, the previous pipelines must be done to know if the libraries were
+            // already instrumented
+            if (!batch.Finish()) {
+                return;
+            }
+            if (!PreCallRecordPipelineCreationShaderInstrumentationGPL(pAllocator, *pipeline_state, new_pipeline_ci,
+                                                                       create_info_loc, shader_instrumentation_metadata)) {
+                return;
+            }
         } else {
-            success = PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci,
-                                                                         uint32_t(pipeline_state->stage_states.size()),
-                                                                         create_info_loc, shader_instrumentation_metadata);
-        }
-        if (!success) {
-            return;
+            PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci,
+                                                               uint32_t(pipeline_state->stage_states.size()), create_info_loc,
+                                                               shader_instrumentation_metadata, batch);
         }
     }
+    if (!batch.Finish()) {
+        return;
+    }
 
     chassis_state.is_modified = true;
     chassis_state.pCreateInfos = reinterpret_cast<VkGraphicsPipelineCreateInfo *>(chassis_state.modified_create_infos.data());
@@ -628,6 +645,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    // Shaders of all the pipelines are instrumented in parallel when possible
+    InstrumentationBatch batch(*this);
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
@@ -642,11 +661,11 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
 
         auto &shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
-        bool success = PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, 1,
-                                                                          create_info_loc, shader_instrumentation_metadata);
-        if (!success) {
-            return;
-        }
+        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, 1, create_info_loc,
+                                                           shader_instrumentation_metadata, batch);
+    }
+    if (!batch.Finish()) {
+        return;
     }
 
     chassis_state.is_modified = true;
@@ -664,6 +683,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    // Shaders of all the pipelines are instrumented in parallel when possible
+    InstrumentationBatch batch(*this);
     for (uint32_t i = 0; i < count; ++i) {
         const auto &pipeline_state = pipeline_states[i];
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
@@ -684,12 +705,12 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
         // stop at VkRayTracingPipelineCreateInfoKHR::stageCount
         // Note: This code implicitly relies on the fact that in pipeline_state->stage_states,
         // stages coming from libraries are added last.
-        bool success = PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci,
-                                                                          new_pipeline_ci.stageCount, create_info_loc,
-                                                                          shader_instrumentation_metadata);
-        if (!success) {
-            return;
-        }
+        PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci,
+                                                           new_pipeline_ci.stageCount, create_info_loc,
+                                                           shader_instrumentation_metadata, batch);
+    }
+    if (!batch.Finish()) {
+        return;
     }
 
     chassis_state.is_modified = true;
@@ -1102,15 +1123,15 @@ bool GpuShaderInstrumentor::IsShaderSelectedForInstrumentation(vku::safe_VkShade
 //    We will skip these as we don't know the incoming SPIR-V
 // Note: Shader Objects are handled in their own path as they don't use pipelines
 template <typename SafeCreateInfo>
-bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
+void GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
     const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, SafeCreateInfo &modified_pipeline_ci,
     uint32_t stages_count, const Location &loc,
-    std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata) {
+    std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata, InstrumentationBatch &batch) {
     // Init here instead of in chassis so we don't pay cost when GPU-AV is not used
     shader_instrumentation_metadata.resize(stages_count);
 
-    InstrumentationDescriptorSetLayouts instrumentation_dsl;
-    BuildDescriptorSetLayoutInfo(pipeline_state, instrumentation_dsl);
+    auto instrumentation_dsl = std::make_shared<InstrumentationDescriptorSetLayouts>();
+    BuildDescriptorSetLayoutInfo(pipeline_state, *instrumentation_dsl);
 
     for (uint32_t stage_state_i = 0; stage_state_i < stages_count; ++stage_state_i) {
         const auto &stage_state = pipeline_state.stage_states[stage_state_i];
@@ -1119,7 +1140,6 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
         if (!modified_module_state->spirv) {
             continue; // Hit when using VK_KHR_pipeline_binary
         }
-        std::unique_lock<std::mutex> module_lock(modified_module_state->module_mutex_);
 
         auto &instrumentation_metadata = shader_instrumentation_metadata[stage_state_i];
 
@@ -1139,47 +1159,54 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
                 continue;
             }
         }
-        std::vector<uint32_t> instrumented_spirv;
-        const uint32_t unique_shader_id = unique_shader_module_id_++;
-        const bool is_shader_instrumented =
-            InstrumentShader(modified_module_state->spirv->words_, unique_shader_id, instrumentation_dsl, loc, instrumented_spirv);
-        if (is_shader_instrumented) {
-            instrumentation_metadata.unique_shader_id = unique_shader_id;
-            if (modified_module_state->VkHandle() != VK_NULL_HANDLE) {
-                // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
-                // shader
-                VkShaderModuleCreateInfo instrumented_shader_module_ci = vku::InitStructHelper();
-                instrumented_shader_module_ci.pCode = instrumented_spirv.data();
-                instrumented_shader_module_ci.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
-                VkShaderModule instrumented_shader_module = VK_NULL_HANDLE;
-                VkResult result =
-                    DispatchCreateShaderModule(device, &instrumented_shader_module_ci, pAllocator, &instrumented_shader_module);
-                if (result == VK_SUCCESS) {
-                    SetShaderModule(modified_pipeline_ci, *stage_state.pipeline_create_info, instrumented_shader_module,
-                                    stage_state_i);
-
-                    pipeline_state.instrumentation_data.shader_modules.emplace_back(instrumented_shader_module);
-                    pipeline_state.instrumentation_data.was_instrumented = true;
+
+        // The module state holds on to the SPIR-V until the batch is finished
+        batch.Instrument(
+            modified_module_state->spirv->words_, instrumentation_dsl, loc,
+            [this, pAllocator, &pipeline_state, &modified_pipeline_ci, &instrumentation_metadata, modified_shader_module_ci,
+             modified_module_state, stage_state_i, loc_capture = vvl::LocationCapture(loc)](
+                bool is_shader_instrumented, uint32_t unique_shader_id, std::vector<uint32_t> &instrumented_spirv) {
+                if (!is_shader_instrumented) {
+                    return true;
+                }
+                std::unique_lock<std::mutex> module_lock(modified_module_state->module_mutex_);
+                instrumentation_metadata.unique_shader_id = unique_shader_id;
+                if (modified_module_state->VkHandle() != VK_NULL_HANDLE) {
+                    // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
+                    // shader
+                    VkShaderModuleCreateInfo instrumented_shader_module_ci = vku::InitStructHelper();
+                    instrumented_shader_module_ci.pCode = instrumented_spirv.data();
+                    instrumented_shader_module_ci.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
+                    VkShaderModule instrumented_shader_module = VK_NULL_HANDLE;
+                    VkResult result =
+                        DispatchCreateShaderModule(device, &instrumented_shader_module_ci, pAllocator, &instrumented_shader_module);
+                    if (result == VK_SUCCESS) {
+                        SetShaderModule(modified_pipeline_ci, *pipeline_state.stage_states[stage_state_i].pipeline_create_info,
+                                        instrumented_shader_module, stage_state_i);
+
+                        pipeline_state.instrumentation_data.shader_modules.emplace_back(instrumented_shader_module);
+                        pipeline_state.instrumentation_data.was_instrumented = true;
+                    } else {
+                        InternalError(device, loc_capture.Get(),
+                                      "Unable to replace non-instrumented shader with instrumented one.");
+                        return false;
+                    }
+                } else if (modified_shader_module_ci) {
+                    // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
+                    instrumentation_metadata.passed_in_shader_stage_ci = true;
+                    // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL).
+                    // The core issue is we always use std::vector<uint32_t> but Safe Struct manages its own version of the pCode
+                    // memory. It would be much harder to change everything from std::vector and instead to adjust Safe Struct to
+                    // not double-free the memory on us. If making any changes, we have to consider a case where the user inlines
+                    // the fragment shader, but use a normal VkShaderModule in the vertex shader.
+                    modified_shader_module_ci->SetCode(instrumented_spirv);
                 } else {
-                    InternalError(device, loc, "Unable to replace non-instrumented shader with instrumented one.");
+                    assert(false);
                     return false;
                 }
-            } else if (modified_shader_module_ci) {
-                // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
-                instrumentation_metadata.passed_in_shader_stage_ci = true;
-                // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL).
-                // The core issue is we always use std::vector<uint32_t> but Safe Struct manages its own version of the pCode
-                // memory. It would be much harder to change everything from std::vector and instead to adjust Safe Struct to not
-                // double-free the memory on us. If making any changes, we have to consider a case where the user inlines the
-                // fragment shader, but use a normal VkShaderModule in the vertex shader.
-                modified_shader_module_ci->SetCode(instrumented_spirv);
-            } else {
-                assert(false);
-                return false;
-            }
-        }
+                return true;
+            });
     }
-    return true;
 }
 
 // Now that we have created the pipeline (and have its handle) build up the shader map for each shader we instrumented
@@ -1230,8 +1257,9 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
     const size_t total_stages = linked_pipeline_state.stage_states.size();
     shader_instrumentation_metadata.resize(total_stages);
 
-    InstrumentationDescriptorSetLayouts instrumentation_dsl;
-    BuildDescriptorSetLayoutInfo(linked_pipeline_state, instrumentation_dsl);
+    auto instrumentation_dsl = std::make_shared<InstrumentationDescriptorSetLayouts>();
+    BuildDescriptorSetLayoutInfo(linked_pipeline_state, *instrumentation_dsl);
+    InstrumentationBatch batch(*this);
 
     auto modified_library_ci = const_cast<VkPipelineLibraryCreateInfoKHR *>(
         vku::FindStructInPNextChain<VkPipelineLibraryCreateInfoKHR>(modified_pipeline_ci.pNext));
@@ -1263,12 +1291,18 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
             continue;
         }
 
-        vku::safe_VkGraphicsPipelineCreateInfo new_lib_ci(modified_lib->GraphicsCreateInfo());
+        // Shared by the deferred work of the stages of this library
+        struct LibraryInstrumentation {
+            vku::safe_VkGraphicsPipelineCreateInfo new_lib_ci;
+            bool need_new_pipeline = false;
+        };
+        auto lib_instrumentation = std::make_shared<LibraryInstrumentation>();
+        vku::safe_VkGraphicsPipelineCreateInfo &new_lib_ci = lib_instrumentation->new_lib_ci;
+        new_lib_ci.initialize(&modified_lib->GraphicsCreateInfo());
         // If the application supplied pipeline might be interested in failing to be created
         // if the driver does not find it in its cache, GPU-AV needs to succeed in the instrumented pipeline library
         // creation process no matter caching state.
         new_lib_ci.flags &= ~VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT;
-        bool need_new_pipeline = false;
 
         // If pipeline library is selected for instrumentation, force instrumentation of all its shaders
         const bool should_instrument_pipeline =
@@ -1281,7 +1315,6 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
             if (!modified_module_state->spirv) {
                 continue;  // Hit when using VK_KHR_pipeline_binary
             }
-            std::unique_lock<std::mutex> module_lock(modified_module_state->module_mutex_);
 
             chassis::ShaderInstrumentationMetadata &instrumentation_metadata = shader_instrumentation_metadata[shader_i++];
 
@@ -1320,75 +1353,86 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
 
             // Instrument shader
             // ---
-            std::vector<uint32_t> instrumented_spirv;
-            const uint32_t unique_shader_id = unique_shader_module_id_++;
-            const bool is_shader_instrumented = InstrumentShader(modified_module_state->spirv->words_, unique_shader_id,
-                                                                 instrumentation_dsl, loc, instrumented_spirv);
-
-            if (is_shader_instrumented) {
-                instrumentation_metadata.unique_shader_id = unique_shader_id;
-                need_new_pipeline = true;
-            }
-
-            if (modified_module_state->VkHandle() != VK_NULL_HANDLE) {
-                // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
-                // shader
-                VkShaderModule instrumented_shader_module;
-                VkShaderModuleCreateInfo create_info = vku::InitStructHelper();
-                if (is_shader_instrumented) {
-                    create_info.pCode = instrumented_spirv.data();
-                    create_info.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
-                } else {
-                    // We need to replace the shader regardless as the user may have destroyed the original VkShaderModule and
-                    // we will crash trying to unwrap it. So just make a duplicate VkShaderModule. (This is rare we hit this,
-                    // only when the user has a shader with nothing to instrument, which tends to be passthrough vertex shaders
-                    // which are quick enough to re-create)
-                    create_info.pCode = modified_module_state->spirv->words_.data();
-                    create_info.codeSize = modified_module_state->spirv->words_.size() * sizeof(uint32_t);
-                }
-                VkResult result = DispatchCreateShaderModule(device, &create_info, pAllocator, &instrumented_shader_module);
-                if (result == VK_SUCCESS) {
-                    new_lib_ci.pStages[stage_state_i] = *modified_stage_state.pipeline_create_info;
-                    new_lib_ci.pStages[stage_state_i].module = instrumented_shader_module;
-
-                    modified_lib->instrumentation_data.shader_modules.emplace_back(instrumented_shader_module);
+            batch.Instrument(
+                modified_module_state->spirv->words_, instrumentation_dsl, loc,
+                [this, pAllocator, lib_instrumentation, modified_lib, &instrumentation_metadata, modified_shader_module_ci,
+                 modified_module_state, stage_state_i, loc_capture = vvl::LocationCapture(loc)](
+                    bool is_shader_instrumented, uint32_t unique_shader_id, std::vector<uint32_t> &instrumented_spirv) {
+                    std::unique_lock<std::mutex> module_lock(modified_module_state->module_mutex_);
+                    if (is_shader_instrumented) {
+                        instrumentation_metadata.unique_shader_id = unique_shader_id;
+                        lib_instrumentation->need_new_pipeline = true;
+                    }
 
-                } else {
-                    InternalError(device, loc, "Unable to replace non-instrumented shader with instrumented one.");
-                    return false;
-                }
-            } else if (modified_shader_module_ci) {
-                // If inlining and not instrumented, leave it alone
-                if (is_shader_instrumented) {
-                    // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
-                    instrumentation_metadata.passed_in_shader_stage_ci = true;
-                    // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL).
-                    // The core issue is we always use std::vector<uint32_t> but Safe Struct manages its own version of the pCode
-                    // memory. It would be much harder to change everything from std::vector and instead to adjust Safe Struct to
-                    // not double-free the memory on us. If making any changes, we have to consider a case where the user inlines
-                    // the fragment shader, but use a normal VkShaderModule in the vertex shader.
-                    modified_shader_module_ci->SetCode(instrumented_spirv);
-                }
-            } else {
-                assert(false);
-                return false;
-            }
+                    if (modified_module_state->VkHandle() != VK_NULL_HANDLE) {
+                        // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
+                        // shader
+                        VkShaderModule instrumented_shader_module;
+                        VkShaderModuleCreateInfo create_info = vku::InitStructHelper();
+                        if (is_shader_instrumented) {
+                            create_info.pCode = instrumented_spirv.data();
+                            create_info.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
+                        } else {
+                            // We need to replace the shader regardless as the user may have destroyed the original VkShaderModule
+                            // and we will crash trying to unwrap it. So just make a duplicate VkShaderModule. (This is rare we hit
+                            // this, only when the user has a shader with nothing to instrument, which tends to be passthrough
+                            // vertex shaders which are quick enough to re-create)
+                            create_info.pCode = modified_module_state->spirv->words_.data();
+                            create_info.codeSize = modified_module_state->spirv->words_.size() * sizeof(uint32_t);
+                        }
+                        VkResult result = DispatchCreateShaderModule(device, &create_info, pAllocator, &instrumented_shader_module);
+                        if (result == VK_SUCCESS) {
+                            vku::safe_VkPipelineShaderStageCreateInfo &lib_stage_ci =
+                                lib_instrumentation->new_lib_ci.pStages[stage_state_i];
+                            lib_stage_ci = *modified_lib->stage_states[stage_state_i].pipeline_create_info;
+                            lib_stage_ci.module = instrumented_shader_module;
+
+                            modified_lib->instrumentation_data.shader_modules.emplace_back(instrumented_shader_module);
+
+                        } else {
+                            InternalError(device, loc_capture.Get(),
+                                          "Unable to replace non-instrumented shader with instrumented one.");
+                            return false;
+                        }
+                    } else if (modified_shader_module_ci) {
+                        // If inlining and not instrumented, leave it alone
+                        if (is_shader_instrumented) {
+                            // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
+                            instrumentation_metadata.passed_in_shader_stage_ci = true;
+                            // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL).
+                            // The core issue is we always use std::vector<uint32_t> but Safe Struct manages its own version of the
+                            // pCode memory. It would be much harder to change everything from std::vector and instead to adjust
+                            // Safe Struct to not double-free the memory on us. If making any changes, we have to consider a case
+                            // where the user inlines the fragment shader, but use a normal VkShaderModule in the vertex shader.
+                            modified_shader_module_ci->SetCode(instrumented_spirv);
+                        }
+                    } else {
+                        assert(false);
+                        return false;
+                    }
+                    return true;
+                });
         }
 
         // Create instrumented pipeline library if we have instrumented one of the libraries inside of it
-        if (need_new_pipeline) {
+        batch.Then([this, pAllocator, lib_instrumentation, modified_lib, modified_lib_i, modified_library_ci,
+                    &linked_pipeline_state, &modified_pipeline_ci, loc_capture = vvl::LocationCapture(loc)]() {
+            if (!lib_instrumentation->need_new_pipeline) {
+                return true;
+            }
+            vku::safe_VkGraphicsPipelineCreateInfo &lib_ci = lib_instrumentation->new_lib_ci;
             VkPipeline instrumented_pipeline_lib = VK_NULL_HANDLE;
 
             // The library could have destroyed its pipelineLayout, but will have a valid, compatible, version when linking
-            if (new_lib_ci.layout != VK_NULL_HANDLE && !Get<vvl::PipelineLayout>(new_lib_ci.layout)) {
-                new_lib_ci.layout = modified_pipeline_ci.layout;
+            if (lib_ci.layout != VK_NULL_HANDLE && !Get<vvl::PipelineLayout>(lib_ci.layout)) {
+                lib_ci.layout = modified_pipeline_ci.layout;
             }
 
-            const VkResult result = DispatchCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, new_lib_ci.ptr(), pAllocator,
-                                                                    &instrumented_pipeline_lib);
+            const VkResult result =
+                DispatchCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, lib_ci.ptr(), pAllocator, &instrumented_pipeline_lib);
             if (result != VK_SUCCESS || instrumented_pipeline_lib == VK_NULL_HANDLE) {
                 // could just check result, but being extra cautious around GPL and checking handle as well
-                InternalError(device, loc, "Failed to recreate instrumented pipeline library.");
+                InternalError(device, loc_capture.Get(), "Failed to recreate instrumented pipeline library.");
                 return false;
             }
 
@@ -1397,9 +1441,10 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
             linked_pipeline_state.instrumentation_data.was_instrumented = true;
 
             const_cast<VkPipeline *>(modified_library_ci->pLibraries)[modified_lib_i] = instrumented_pipeline_lib;
-        }
+            return true;
+        });
     }
-    return true;
+    return batch.Finish();
 }
 
 void GpuShaderInstrumentor::PostCallRecordPipelineCreationShaderInstrumentationGPL(
@@ -1471,7 +1516,9 @@ static bool GpuValidateShader(const std::vector<uint32_t> &input, spv_target_env
 // Call the SPIR-V Optimizer to run the instrumentation pass on the shader.
 bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
                                              const InstrumentationDescriptorSetLayouts &instrumentation_dsl, const Location &loc,
-                                             std::vector<uint32_t> &out_instrumented_spirv) {
+                                             std::vector<uint32_t> &out_instrumented_spirv,
+                                             std::vector<spirv::InternalOnlyDebugPrintf> &out_internal_only_debug_printf,
+                                             std::vector<uint32_t> &out_shader_id_words) {
     if (input_spirv[0] != spv::MagicNumber) {
         return false;
     }
@@ -1568,7 +1615,7 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
     // 2. We might want to debug the above passes and want to inject our own debug printf calls
     if (gpuav_settings.debug_printf_enabled) {
         // binding slot allows debug printf to be slotted in the same set as GPU-AV if needed
-        spirv::DebugPrintfPass pass(module, internal_only_debug_printf_, glsl::kBindingInstDebugPrintf);
+        spirv::DebugPrintfPass pass(module, out_internal_only_debug_printf, glsl::kBindingInstDebugPrintf);
         modified |= pass.Run();
     }
 
@@ -1581,6 +1628,7 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
     module.PostProcess();
     // translate internal representation of SPIR-V into legal SPIR-V binary
     module.ToBinary(out_instrumented_spirv);
+    out_shader_id_words = module.FindShaderIdWords(out_instrumented_spirv);
 
     // (Maybe) validate the instrumented and linked shader
     bool is_instrumented_spirv_valid = true;
@@ -1615,6 +1663,104 @@ bool GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t> &in
     return true;
 }
 
+bool GpuShaderInstrumentor::InstrumentShaderWithCache(const vvl::span<const uint32_t> &input_spirv,
+                                                      const InstrumentationDescriptorSetLayouts &instrumentation_dsl,
+                                                      const Location &loc, uint32_t &out_unique_shader_id,
+                                                      std::vector<uint32_t> &out_instrumented_spirv) {
+    uint64_t cache_key = 0;
+    if (instrumented_shader_cache_) {
+        std::vector<uint32_t> dsl_words = {instrumentation_dsl.has_bindless_descriptors ? 1u : 0u};
+        for (const auto &bindings_layout : instrumentation_dsl.set_index_to_bindings_layout_lut) {
+            dsl_words.emplace_back(static_cast<uint32_t>(bindings_layout.size()));
+            for (const spirv::BindingLayout &binding_layout : bindings_layout) {
+                dsl_words.emplace_back(binding_layout.start);
+                dsl_words.emplace_back(binding_layout.count);
+            }
+        }
+        const uint64_t hashes[2] = {hash_util::Hash64(input_spirv.data(), input_spirv.size() * sizeof(uint32_t)),
+                                    hash_util::Hash64(dsl_words.data(), dsl_words.size() * sizeof(uint32_t))};
+        cache_key = hash_util::Hash64(hashes, sizeof(hashes));
+    }
+
+    out_unique_shader_id = unique_shader_module_id_++;
+    // Past the limit, InstrumentShader() warns about it
+    if (instrumented_shader_cache_ && out_unique_shader_id < glsl::kMaxInstrumentedShaders &&
+        instrumented_shader_cache_->Find(cache_key, out_unique_shader_id, out_instrumented_spirv)) {
+        return true;
+    }
+
+    // Anything reported while instrumenting, or kept on the side by the passes, would be lost on a cache hit. The count is per
+    // thread, the other shaders of the batch are instrumented at the same time.
+    const uint64_t message_count = DebugReport::ThreadAttemptedMessageCount();
+    std::vector<spirv::InternalOnlyDebugPrintf> internal_only_debug_printf;
+    std::vector<uint32_t> shader_id_words;
+    const bool is_shader_instrumented = InstrumentShader(input_spirv, out_unique_shader_id, instrumentation_dsl, loc,
+                                                         out_instrumented_spirv, internal_only_debug_printf, shader_id_words);
+    if (!internal_only_debug_printf.empty()) {
+        std::lock_guard<std::mutex> guard(internal_only_debug_printf_lock_);
+        internal_only_debug_printf_.insert(internal_only_debug_printf_.end(),
+                                           std::make_move_iterator(internal_only_debug_printf.begin()),
+                                           std::make_move_iterator(internal_only_debug_printf.end()));
+    } else if (instrumented_shader_cache_ && is_shader_instrumented &&
+               message_count == DebugReport::ThreadAttemptedMessageCount()) {
+        instrumented_shader_cache_->Insert(cache_key, out_instrumented_spirv, shader_id_words);
+    }
+    return is_shader_instrumented;
+}
+
+void GpuShaderInstrumentor::InstrumentationBatch::Instrument(
+    vvl::span<const uint32_t> input_spirv, std::shared_ptr<const InstrumentationDescriptorSetLayouts> instrumentation_dsl,
+    const Location &loc, ApplyFunc &&apply) {
+    Job &job = jobs_.emplace_back(input_spirv, std::move(instrumentation_dsl), loc, std::move(apply));
+    task_group_.Run([this, &job]() {
+        job.is_shader_instrumented = instrumentor_.InstrumentShaderWithCache(
+            job.input_spirv, *job.instrumentation_dsl, job.loc.Get(), job.unique_shader_id, job.instrumented_spirv);
+    });
+}
+
+void GpuShaderInstrumentor::InstrumentationBatch::Then(std::function<bool()> &&func) {
+    jobs_.emplace_back(Location(vvl::Func::Empty), std::move(func));
+}
+
+bool GpuShaderInstrumentor::InstrumentationBatch::Finish() {
+    task_group_.Wait();
+
+    bool success = true;
+    for (Job &job : jobs_) {
+        if (job.apply) {
+            success = job.apply(job.is_shader_instrumented, job.unique_shader_id, job.instrumented_spirv);
+        } else {
+            success = job.then();
+        }
+        if (!success) {
+            break;
+        }
+    }
+    // The batch can be reused for following pipelines
+    jobs_.clear();
+    return success;
+}
+
+uint64_t GpuShaderInstrumentor::GetInstrumentedShaderCacheSettingsHash() const {
+    // A rebuilt layer may instrument differently, and the functions linked in by the passes are part of the build
+    const uint64_t build_id = GetLayerBuildId();
+    std::string settings_id(reinterpret_cast<const char *>(&build_id), sizeof(build_id));
+
+    const uint32_t setting_values[] = {gpuav_settings.safe_mode,
+                                       gpuav_settings.debug_printf_enabled,
+                                       gpuav_settings.shader_instrumentation.descriptor_checks,
+                                       gpuav_settings.shader_instrumentation.buffer_device_address,
+                                       gpuav_settings.shader_instrumentation.ray_query,
+                                       gpuav_settings.shader_instrumentation.post_process_descriptor_indexing,
+                                       gpuav_settings.shader_instrumentation.vertex_attribute_fetch_oob,
+                                       instrumentation_desc_set_bind_index_,
+                                       IsExtEnabled(extensions.vk_khr_shader_non_semantic_info) &&
+                                           !IsExtEnabled(extensions.vk_khr_portability_subset)};
+    settings_id.append(reinterpret_cast<const char *>(setting_values), sizeof(setting_values));
+    settings_id.append(reinterpret_cast<const char *>(&modified_features), sizeof(DeviceFeatures));
+    return hash_util::Hash64(settings_id.data(), settings_id.size());
+}
+
 void GpuShaderInstrumentor::InternalError(LogObjectList objlist, const Location &loc, const char *const specific_message) const {
     aborted_ = true;
     std::string error_message = specific_message;
@@ -21,8 +21,12 @@
 #include "state_tracker/shader_instruction.h"
 #include "state_tracker/state_tracker.h"
 #include "gpuav/spirv/interface.h"
+#include "gpuav/instrumentation/gpuav_shader_cache.h"
 #include "containers/custom_containers.h"
+#include "utils/thread_pool.h"
 
+#include <deque>
+#include <functional>
 #include <vector>
 
 // There is a spirv::Instruction used for normal validation.
@@ -107,9 +111,11 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
                                           const RecordObject &record_obj, chassis::CreateShaderModule &chassis_state) override;
     void PreCallRecordGetShaderBinaryDataEXT(VkDevice device, VkShaderEXT shader, size_t *pDataSize, void *pData,
                                              const RecordObject &record_obj, chassis::ShaderBinaryData &chassis_state) override;
-    bool PreCallRecordShaderObjectInstrumentation(vku::safe_VkShaderCreateInfoEXT &modified_create_info,
+    class InstrumentationBatch;
+    void PreCallRecordShaderObjectInstrumentation(vku::safe_VkShaderCreateInfoEXT &modified_create_info,
                                                   const Location &create_info_loc,
-                                                  chassis::ShaderObjectInstrumentationData &shader_instrumentation_data);
+                                                  chassis::ShaderObjectInstrumentationData &shader_instrumentation_data,
+                                                  InstrumentationBatch &batch, bool &out_is_modified);
     void PreCallRecordCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT *pCreateInfos,
                                        const VkAllocationCallbacks *pAllocator, VkShaderEXT *pShaders,
                                        const RecordObject &record_obj, chassis::ShaderObject &chassis_state) override;
@@ -186,6 +192,55 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
         // < set , [ bindings ] >
         std::vector<std::vector<spirv::BindingLayout>> set_index_to_bindings_layout_lut;
     };
+
+  public:
+    // Shaders of a single vkCreate*Pipelines/vkCreateShadersEXT call. Each shader is instrumented on instrumentation_thread_pool_
+    // as soon as it is queued, and everything needing the instrumented SPIR-V (creating the replacement VkShaderModule, patching
+    // the create info) is deferred to Finish(), which is called right before the driver call.
+    // Without a thread pool the shaders are instrumented inline when queued.
+    class InstrumentationBatch {
+      public:
+        using ApplyFunc = std::function<bool(bool is_shader_instrumented, uint32_t unique_shader_id,
+                                             std::vector<uint32_t> &instrumented_spirv)>;
+
+        explicit InstrumentationBatch(GpuShaderInstrumentor &instrumentor)
+            : instrumentor_(instrumentor), task_group_(instrumentor.instrumentation_thread_pool_.get()) {}
+
+        // input_spirv and instrumentation_dsl must stay alive until Finish() (apply can hold a reference to their owner)
+        void Instrument(vvl::span<const uint32_t> input_spirv,
+                        std::shared_ptr<const InstrumentationDescriptorSetLayouts> instrumentation_dsl, const Location &loc,
+                        ApplyFunc &&apply);
+        // Run by Finish() once the shaders queued before it are applied
+        void Then(std::function<bool()> &&func);
+
+        // Waits for the instrumentation and runs the deferred work in queue order, stops at the first failure
+        [[nodiscard]] bool Finish();
+
+      private:
+        struct Job {
+            Job(vvl::span<const uint32_t> input_spirv, std::shared_ptr<const InstrumentationDescriptorSetLayouts> dsl,
+                const Location &loc, ApplyFunc &&apply)
+                : input_spirv(input_spirv), instrumentation_dsl(std::move(dsl)), loc(loc), apply(std::move(apply)) {}
+            Job(const Location &loc, std::function<bool()> &&then) : loc(loc), then(std::move(then)) {}
+
+            vvl::span<const uint32_t> input_spirv;
+            std::shared_ptr<const InstrumentationDescriptorSetLayouts> instrumentation_dsl;
+            vvl::LocationCapture loc;
+            ApplyFunc apply;
+            std::function<bool()> then;
+
+            bool is_shader_instrumented = false;
+            uint32_t unique_shader_id = 0;
+            std::vector<uint32_t> instrumented_spirv;
+        };
+
+        GpuShaderInstrumentor &instrumentor_;
+        std::deque<Job> jobs_;  // deque so the queued tasks keep valid references while more jobs are added
+        // Last so it is destroyed (and waited on) first
+        vvl::TaskGroup task_group_;
+    };
+
+  protected:
     void BuildDescriptorSetLayoutInfo(const vvl::Pipeline &pipeline_state,
                                       InstrumentationDescriptorSetLayouts &out_instrumentation_dsl);
     void BuildDescriptorSetLayoutInfo(const vku::safe_VkShaderCreateInfoEXT &modified_create_info,
@@ -194,10 +249,10 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
                                       InstrumentationDescriptorSetLayouts &out_instrumentation_dsl);
 
     template <typename SafeCreateInfo>
-    [[nodiscard]] bool PreCallRecordPipelineCreationShaderInstrumentation(
+    void PreCallRecordPipelineCreationShaderInstrumentation(
         const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, SafeCreateInfo &modified_pipeline_ci,
         uint32_t stages_count, const Location &loc,
-        std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
+        std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata, InstrumentationBatch &batch);
     void PostCallRecordPipelineCreationShaderInstrumentation(
         vvl::Pipeline &pipeline_state, uint32_t stages_count,
         std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
@@ -212,9 +267,18 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
 
     // GPU-AV and DebugPrint are using the same way to do the actual shader instrumentation logic
     // Returns if shader was instrumented successfully or not
+    // Can be called from multiple threads at once
     bool InstrumentShader(const vvl::span<const uint32_t> &input_spirv, uint32_t unique_shader_id,
                           const InstrumentationDescriptorSetLayouts &instrumentation_dsl, const Location &loc,
-                          std::vector<uint32_t> &out_instrumented_spirv);
+                          std::vector<uint32_t> &out_instrumented_spirv,
+                          std::vector<spirv::InternalOnlyDebugPrintf> &out_internal_only_debug_printf,
+                          std::vector<uint32_t> &out_shader_id_words);
+    // Picks the unique shader id and calls InstrumentShader, unless the shader is found in instrumented_shader_cache_
+    bool InstrumentShaderWithCache(const vvl::span<const uint32_t> &input_spirv,
+                                   const InstrumentationDescriptorSetLayouts &instrumentation_dsl, const Location &loc,
+                                   uint32_t &out_unique_shader_id, std::vector<uint32_t> &out_instrumented_spirv);
+    // Everything, besides the shader and descriptor set layouts, that changes the output of InstrumentShader
+    uint64_t GetInstrumentedShaderCacheSettingsHash() const;
 
   public:
     void SetupClassicDescriptor(const Location &loc);
@@ -235,6 +299,10 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     mutable bool aborted_ = false;
 
     std::atomic<uint32_t> unique_shader_module_id_ = 1;  // zero represents no shader module found
+    // Only created if gpuav_settings.cache_instrumented_shaders is on
+    std::unique_ptr<InstrumentedShaderCache> instrumented_shader_cache_;
+    // Only created if gpuav_settings.parallel_shader_instrumentation is on
+    std::unique_ptr<vvl::ThreadPool> instrumentation_thread_pool_;
     // The descriptor slot we will be injecting our error buffer into
     uint32_t instrumentation_desc_set_bind_index_ = 0;
     // This is a layout used to "pad" a pipeline layout to fill in any gaps to the selected bind index
@@ -242,6 +310,8 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     vvl::concurrent_unordered_map<uint32_t, InstrumentedShader> instrumented_shaders_map_;
     std::vector<VkDescriptorSetLayoutBinding> instrumentation_bindings_;
 
+    // Appended to while instrumenting, which can happen on instrumentation_thread_pool_
+    std::mutex internal_only_debug_printf_lock_;
     std::vector<spirv::InternalOnlyDebugPrintf> internal_only_debug_printf_;
 
     // Size to reserve in front of every resource descriptor buffer
@@ -451,7 +451,7 @@ void DebugPrintfPass::CreateBufferWriteFunction(uint32_t argument_count, uint32_
         store_block.CreateInstruction(spv::OpAccessChain,
                                       {pointer_type_id, access_chain_id, output_buffer_variable_id, one_id, int_add_id});
 
-        const uint32_t shader_id = module_.type_manager_.GetConstantUInt32(module_.settings_.shader_id).Id();
+        const uint32_t shader_id = module_.GetShaderIdConstant().Id();
         store_block.CreateInstruction(spv::OpStore, {access_chain_id, shader_id});
     }
 
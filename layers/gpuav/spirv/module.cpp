@@ -376,6 +376,36 @@ void Module::AddInterfaceVariables(uint32_t id, spv::StorageClass storage_class)
     }
 }
 
+const Constant& Module::GetShaderIdConstant(uint32_t other_bits) {
+    assert((other_bits & glsl::kShaderIdMask) == 0);
+    const Constant*& constant = shader_id_constants_[other_bits];
+    if (!constant) {
+        constant = &type_manager_.CreateUnsharedConstantUInt32(settings_.shader_id | other_bits);
+        shader_id_constant_bits_[constant->Id()] = other_bits;
+    }
+    return *constant;
+}
+
+std::vector<uint32_t> Module::FindShaderIdWords(const std::vector<uint32_t>& binary) const {
+    std::vector<uint32_t> word_offsets;
+    if (shader_id_constant_bits_.empty()) {
+        return word_offsets;
+    }
+    uint32_t offset = 5;  // skip header
+    while (offset < binary.size()) {
+        const uint32_t opcode = binary[offset] & 0x0ffffu;
+        const uint32_t length = binary[offset] >> 16;
+        if (opcode == spv::OpFunction) {
+            break;  // constants are all declared before the first function
+        }
+        if (opcode == spv::OpConstant && length == 4 && shader_id_constant_bits_.count(binary[offset + 2]) != 0) {
+            word_offsets.push_back(offset + 3);
+        }
+        offset += length;
+    }
+    return word_offsets;
+}
+
 // Link functions into this module
 // First, any new Types/Constants/Variables are inserted, then functions' instructions
 void Module::LinkFunctions(const LinkInfo& info) {
@@ -518,6 +548,16 @@ void Module::LinkFunctions(const LinkInfo& info) {
 
             id_swap_map[old_result_id] = type_id;
 
+        } else if (opcode == spv::OpSpecConstant && new_inst->Word(3) == glsl::kLinkShaderId) {
+            // The shader id, and anything folded with it, get their own constants so a cached copy can be given a new id
+            id_swap_map[old_result_id] = GetShaderIdConstant().Id();
+        } else if (opcode == spv::OpSpecConstantOp && new_inst->Word(3) == spv::OpBitwiseOr &&
+                   (shader_id_constant_bits_.count(id_swap_map[new_inst->Word(4)]) != 0 ||
+                    shader_id_constant_bits_.count(id_swap_map[new_inst->Word(5)]) != 0)) {
+            const Constant* op_1 = type_manager_.FindConstantById(id_swap_map[new_inst->Word(4)]);
+            const Constant* op_2 = type_manager_.FindConstantById(id_swap_map[new_inst->Word(5)]);
+            const uint32_t other_bits = (op_1->GetValueUint32() | op_2->GetValueUint32()) & ~glsl::kShaderIdMask;
+            id_swap_map[old_result_id] = GetShaderIdConstant(other_bits).Id();
         } else if (ConstantOperation(opcode) || IsSpecConstant(opcode)) {
             if (opcode == spv::OpSpecConstant) {
                 // Replace LinkConstants with a OpCostant
@@ -525,9 +565,7 @@ void Module::LinkFunctions(const LinkInfo& info) {
                 new_op_constant[0] = (4 << 16) | spv::OpConstant;
                 new_op_constant[1] = new_inst->Word(1);
                 new_op_constant[2] = new_inst->Word(2);
-                if (new_inst->Word(3) == glsl::kLinkShaderId) {
-                    new_op_constant[3] = settings_.shader_id;
-                }
+                new_op_constant[3] = new_inst->Word(3);
                 new_inst.reset(new Instruction(new_op_constant, kLinkedInstruction));
             } else if (opcode == spv::OpSpecConstantOp) {
                 // Apply the SpecConstantOp and generate a new OpCostant
@@ -99,6 +99,12 @@ class Module {
     // The class is designed to be written out to a binary file.
     void ToBinary(std::vector<uint32_t>& out);
 
+    // Constant holding the shader id, OR'd with other_bits (which must not overlap glsl::kShaderIdMask). These constants are never
+    // shared with other values, so the id can be replaced in the binary without instrumenting again.
+    const Constant& GetShaderIdConstant(uint32_t other_bits = 0);
+    // Offsets, in the output of ToBinary(), of the words that hold the shader id (in their glsl::kShaderIdMask bits)
+    std::vector<uint32_t> FindShaderIdWords(const std::vector<uint32_t>& binary) const;
+
     void AddInterfaceVariables(uint32_t id, spv::StorageClass storage_class);
     vvl::unordered_set<uint32_t> added_interface_variables_;
 
@@ -136,6 +142,11 @@ class Module {
     // Used when UseErrorPayloadVariable is set. Needs to be same for all passes.
     // Will be set in the LogErrorPass
     uint32_t error_payload_variable_id_ = 0;
+
+  private:
+    // < other_bits, constant > and < constant id, other_bits >
+    vvl::unordered_map<uint32_t, const Constant*> shader_id_constants_;
+    vvl::unordered_map<uint32_t, uint32_t> shader_id_constant_bits_;
 };
 
 }  // namespace spirv
@@ -521,6 +521,19 @@ const Constant& TypeManager::CreateConstantUInt32(uint32_t value) {
     return AddConstant(std::move(new_inst), type);
 }
 
+const Constant& TypeManager::CreateUnsharedConstantUInt32(uint32_t value) {
+    const Type& type = GetTypeInt(32, 0);
+    const uint32_t constant_id = module_.TakeNextId();
+    auto new_inst = std::make_unique<Instruction>(4, spv::OpConstant);
+    new_inst->Fill({type.Id(), constant_id, value});
+    const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
+
+    // Unlike AddConstant(), not added to int_32bit_constants_
+    auto& constant = id_to_constant_[constant_id];
+    constant = std::make_unique<Constant>(type, *inst);
+    return *constant;
+}
+
 const Constant& TypeManager::GetConstantUInt32(uint32_t value) {
     if (value == 0) {
         return GetConstantZeroUint32();
@@ -146,6 +146,8 @@ class TypeManager {
     // most constants are uint
     const Constant& CreateConstantUInt32(uint32_t value);
     const Constant& GetConstantUInt32(uint32_t value);
+    // Never returned by the lookups above, so its value can be changed in the final binary without affecting anything else
+    const Constant& CreateUnsharedConstantUInt32(uint32_t value);
     const Constant& GetConstantZeroUint32();
     const Constant& GetConstantZeroFloat32();
     const Constant& GetConstantZeroVec3();
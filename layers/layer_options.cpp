@@ -167,10 +167,12 @@ const char *VK_LAYER_MESSAGE_ID_FILTER = "message_id_filter";
 const char *VK_LAYER_CUSTOM_STYPE_LIST = "custom_stype_list";
 const char *VK_LAYER_ENABLE_MESSAGE_LIMIT = "enable_message_limit";
 const char *VK_LAYER_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
+const char *VK_LAYER_ASYNC_MESSAGE_DELIVERY = "async_message_delivery";
 
 // Global settings
 // ---
 const char *VK_LAYER_FINE_GRAINED_LOCKING = "fine_grained_locking";
+const char *VK_LAYER_PARALLEL_PIPELINE_VALIDATION = "parallel_pipeline_validation";
 // Debug settings used for internal development
 const char *VK_LAYER_DEBUG_DISABLE_SPIRV_VAL = "debug_disable_spirv_val";
 
@@ -196,6 +198,9 @@ const char *VK_LAYER_GPUAV_POST_PROCESS_DESCRIPTOR_INDEXING = "gpuav_post_proces
 const char *VK_LAYER_GPUAV_VERTEX_ATTRIBUTE_FETCH_OOB = "gpuav_vertex_attribute_fetch_oob";
 const char *VK_LAYER_GPUAV_SELECT_INSTRUMENTED_SHADERS = "gpuav_select_instrumented_shaders";
 const char *VK_LAYER_GPUAV_SHADERS_TO_INSTRUMENT = "gpuav_shaders_to_instrument";
+const char *VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS = "gpuav_cache_instrumented_shaders";
+const char *VK_LAYER_GPUAV_INSTRUMENTED_SHADER_CACHE_SIZE = "gpuav_instrumented_shader_cache_size";
+const char *VK_LAYER_GPUAV_PARALLEL_SHADER_INSTRUMENTATION = "gpuav_parallel_shader_instrumentation";
 
 const char *VK_LAYER_GPUAV_BUFFERS_VALIDATION = "gpuav_buffers_validation";
 const char *VK_LAYER_GPUAV_INDIRECT_DRAWS_BUFFERS = "gpuav_indirect_draws_buffers";
@@ -219,6 +224,7 @@ const char *VK_LAYER_GPUAV_DEBUG_PRINT_INSTRUMENTATION_INFO = "gpuav_debug_print
 // ---
 const char *VK_LAYER_SYNCVAL_SUBMIT_TIME_VALIDATION = "syncval_submit_time_validation";
 const char *VK_LAYER_SYNCVAL_SHADER_ACCESSES_HEURISTIC = "syncval_shader_accesses_heuristic";
+const char *VK_LAYER_SYNCVAL_PARALLEL_SUBMIT_REPLAY = "syncval_parallel_submit_replay";
 const char *VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES = "syncval_message_extra_properties";
 
 // Message Formatting
@@ -585,6 +591,14 @@ static void ProcessDebugReportSettings(ConfigAndEnvSettings *settings_data, VkuL
     }
     debug_report->duplicate_message_limit = duplicate_message_limit;
 
+    bool async_message_delivery = false;
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_ASYNC_MESSAGE_DELIVERY)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_ASYNC_MESSAGE_DELIVERY, async_message_delivery);
+    }
+    if (async_message_delivery) {
+        debug_report->StartAsyncMessageDelivery();
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_JSON)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MESSAGE_FORMAT_JSON, debug_report->message_format_settings.json);
     }
@@ -847,6 +861,10 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_FINE_GRAINED_LOCKING)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_FINE_GRAINED_LOCKING, global_settings.fine_grained_locking);
     }
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PARALLEL_PIPELINE_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PARALLEL_PIPELINE_VALIDATION,
+                                global_settings.parallel_pipeline_validation);
+    }
 
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DEBUG_DISABLE_SPIRV_VAL)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DEBUG_DISABLE_SPIRV_VAL, global_settings.debug_disable_spirv_val);
@@ -905,6 +923,19 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
             gpuav_settings.SetShaderSelectionRegexes(std::move(shaders_to_instrument));
         }
 
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_CACHE_INSTRUMENTED_SHADERS,
+                                    gpuav_settings.cache_instrumented_shaders);
+        }
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_CACHE_SIZE)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_INSTRUMENTED_SHADER_CACHE_SIZE,
+                                    gpuav_settings.instrumented_shader_cache_size_mb);
+        }
+        if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_SHADER_INSTRUMENTATION)) {
+            vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_SHADER_INSTRUMENTATION,
+                                    gpuav_settings.parallel_shader_instrumentation);
+        }
+
         // No need to enable shader instrumentation options is no instrumentation is done
         if (!gpuav_settings.IsShaderInstrumentationEnabled()) {
             gpuav_settings.DisableShaderInstrumentationAndOptions();
@@ -1009,6 +1040,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                                 syncval_settings.shader_accesses_heuristic);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_PARALLEL_SUBMIT_REPLAY)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_PARALLEL_SUBMIT_REPLAY,
+                                syncval_settings.parallel_submit_replay);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_MESSAGE_EXTRA_PROPERTIES,
                                 syncval_settings.message_extra_properties);
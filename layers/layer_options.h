@@ -82,6 +82,8 @@ using ValidationEnabled = std::array<bool, kMaxEnableFlags>;
 // General settings to be used by all parts of the Validation Layers
 struct GlobalSettings {
     bool fine_grained_locking = true;
+    // Validate and build the state of the pipelines of a single vkCreate*Pipelines call on worker threads
+    bool parallel_pipeline_validation = false;
 
     bool debug_disable_spirv_val = false;
 
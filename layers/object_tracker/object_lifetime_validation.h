@@ -17,6 +17,7 @@
  */
 
 #include "chassis/validation_object.h"
+#include "containers/slot_table.h"
 #include "containers/small_vector.h"
 
 namespace object_lifetimes {
@@ -35,6 +36,7 @@ struct ObjTrackState {
     ObjectStatusFlags status;                                      // Object state
     uint64_t parent_object;                                        // Parent object
     std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
+    bool in_slot_table = false;                                    // Also in Tracker::object_slots
 };
 
 typedef vvl::concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
@@ -105,6 +107,14 @@ class Tracker : public Logger {
         node->parent_object = HandleToUint64(parent_object);
 
         const bool inserted = obj_map.insert(object_handle, node);
+        if (inserted && UsesObjectSlots(object_type)) {
+            node->in_slot_table = vvl::dispatch::HandleSlotAllocator::HasSlot(object_handle) &&
+                                  object_slots.insert(vvl::dispatch::HandleSlotAllocator::Slot(object_handle), object_handle,
+                                                      object_type);
+            if (!node->in_slot_table) {
+                unslotted_object_count.fetch_add(1, std::memory_order_release);
+            }
+        }
         if (!inserted) {
             // The object should not already exist. If we couldn't add it to the map, there was probably
             // a race condition in the app. Report an error and move on.
@@ -127,7 +137,7 @@ class Tracker : public Logger {
     void RecordDestroyObject(T1 object_handle, VulkanObjectType object_type, const Location &loc) {
         auto object = HandleToUint64(object_handle);
         if (object != HandleToUint64(VK_NULL_HANDLE)) {
-            if (object_map[object_type].contains(object)) {
+            if (TracksObject(object, object_type)) {
                 DestroyObjectSilently(object, object_type, loc);
             }
         }
@@ -139,6 +149,17 @@ class Tracker : public Logger {
     // Vector of unordered_maps per object type to hold ObjTrackState info
     object_map_type object_map[kVulkanObjectTypeMax + 1];
 
+    // When handles are wrapped, existence checks of non-dispatchable objects go to object_slots first, indexed by the slot that
+    // handle wrapping puts in the handle. Only objects that could not get a slot (unslotted_object_count of them), because the
+    // handle has none or the slot is used by a handle we did not wrap, need the object map to know they are alive.
+    static bool UsesObjectSlots(VulkanObjectType object_type) {
+        return vvl::dispatch::HandleWrapper::wrap_handles && object_type != kVulkanObjectTypeInstance &&
+               object_type != kVulkanObjectTypePhysicalDevice && object_type != kVulkanObjectTypeDevice &&
+               object_type != kVulkanObjectTypeQueue && object_type != kVulkanObjectTypeCommandBuffer;
+    }
+    vvl::slot_table<VulkanObjectType, vvl::dispatch::HandleSlotAllocator::kSlotBits> object_slots;
+    std::atomic<uint32_t> unslotted_object_count{0};
+
     void SetDeviceHandle(VkDevice device);
     void SetInstanceHandle(VkInstance instance);
 
@@ -57,6 +57,18 @@ VulkanTypedHandle ObjTrackStateTypedHandle(const ObjTrackState &track_state) {
 }
 
 bool Tracker::TracksObject(uint64_t object_handle, VulkanObjectType object_type) const {
+    if (UsesObjectSlots(object_type)) {
+        VulkanObjectType slot_object_type = kVulkanObjectTypeUnknown;
+        if (vvl::dispatch::HandleSlotAllocator::HasSlot(object_handle) &&
+            object_slots.find(vvl::dispatch::HandleSlotAllocator::Slot(object_handle), object_handle, slot_object_type) &&
+            slot_object_type == object_type) {
+            return true;
+        }
+        // Every live object of this tracker got a slot, so the object map would not find it either
+        if (unslotted_object_count.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+    }
     // Look for object in object map
     return object_map[object_type].contains(object_handle);
 }
@@ -146,6 +158,12 @@ void Tracker::DestroyObjectSilently(uint64_t object, VulkanObjectType object_typ
 
         return;
     }
+    if (item->second->in_slot_table) {
+        VulkanObjectType slot_object_type;
+        object_slots.erase(vvl::dispatch::HandleSlotAllocator::Slot(object), object, slot_object_type);
+    } else if (UsesObjectSlots(object_type)) {
+        unslotted_object_count.fetch_sub(1, std::memory_order_release);
+    }
 }
 
 void Tracker::DestroyUndestroyedObjects(VulkanObjectType object_type, const Location &loc) {
@@ -1061,7 +1079,7 @@ bool Device::PreCallValidateDebugMarkerSetObjectTagEXT(VkDevice device, const Vk
         if (pTagInfo->object == (uint64_t)VK_NULL_HANDLE) {
             skip |= LogError("VUID-VkDebugMarkerObjectTagInfoEXT-object-01494", device,
                              error_obj.location.dot(Field::pTagInfo).dot(Field::object), "is VK_NULL_HANDLE.");
-        } else if (!tracker.object_map[object_type].contains(pTagInfo->object)) {
+        } else if (!tracker.TracksObject(pTagInfo->object, object_type)) {
             skip |= LogError("VUID-VkDebugMarkerObjectTagInfoEXT-object-01495", device,
                              error_obj.location.dot(Field::pTagInfo).dot(Field::objectType),
                              "(%s) doesn't match the object (0x%" PRIx64 ").",
@@ -1084,7 +1102,7 @@ bool Device::PreCallValidateDebugMarkerSetObjectNameEXT(VkDevice device, const V
         if (pNameInfo->object == (uint64_t)VK_NULL_HANDLE) {
             skip |= LogError("VUID-VkDebugMarkerObjectNameInfoEXT-object-01491", device,
                              error_obj.location.dot(Field::pNameInfo).dot(Field::object), "is VK_NULL_HANDLE.");
-        } else if (!tracker.object_map[object_type].contains(pNameInfo->object)) {
+        } else if (!tracker.TracksObject(pNameInfo->object, object_type)) {
             skip |= LogError("VUID-VkDebugMarkerObjectNameInfoEXT-object-01492", device,
                              error_obj.location.dot(Field::pNameInfo).dot(Field::objectType),
                              "(%s) doesn't match the object (0x%" PRIx64 ").",
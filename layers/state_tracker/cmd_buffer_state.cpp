@@ -20,6 +20,7 @@
  */
 #include "state_tracker/cmd_buffer_state.h"
 #include <vulkan/vulkan_core.h>
+#include <algorithm>
 #include <vulkan/utility/vk_format_utils.h>
 #include "error_message/error_location.h"
 #include "generated/command_validation.h"
@@ -217,8 +218,69 @@ const vvl::ImageView *CommandBuffer::GetActiveAttachmentImageViewState(uint32_t
     return active_attachments[index].image_view;
 }
 
+bool CommandBufferBindings::contains(const StateObject &object) const {
+    const uint32_t id = object.GetId();
+    if (id != 0) {
+        return ids_.test(id);
+    }
+    return std::any_of(objects_.begin(), objects_.end(), [&object](const auto &bound) { return bound.get() == &object; });
+}
+
+bool CommandBufferBindings::insert(const std::shared_ptr<StateObject> &object) {
+    const uint32_t id = object->GetId();
+    if (id != 0) {
+        if (!ids_.set(id)) {
+            return false;
+        }
+        positions_.set(id, static_cast<uint32_t>(objects_.size()));
+    } else if (contains(*object)) {
+        return false;
+    }
+    objects_.emplace_back(object);
+    return true;
+}
+
+bool CommandBufferBindings::erase(const StateObject &object) {
+    const uint32_t id = object.GetId();
+    if (id && !ids_.test(id)) return false;
+
+    uint32_t position = 0;
+    if (id != 0) {
+        ids_.reset(id);
+        position = positions_.get(id);
+    } else {
+        auto it = std::find_if(objects_.begin(), objects_.end(), [&object](const auto &bound) { return bound.get() == &object; });
+        if (it == objects_.end()) {
+            return false;
+        }
+        position = static_cast<uint32_t>(it - objects_.begin());
+    }
+    assert(position < objects_.size() && objects_[position].get() == &object);
+
+    if (position + 1 != objects_.size()) {
+        objects_[position] = std::move(objects_.back());
+        if (const uint32_t moved_id = objects_[position]->GetId(); moved_id != 0) {
+            positions_.set(moved_id, position);
+        }
+    }
+    objects_.pop_back();
+    return true;
+}
+
+void CommandBufferBindings::clear() {
+    for (const auto &object : objects_) {
+        ids_.reset(object->GetId());
+    }
+    objects_.clear();
+}
+
 void CommandBuffer::AddChild(std::shared_ptr<StateObject> &child_node) {
     assert(child_node);
+    // Resources are usually bound many times per recording. Checking the bindings of this command buffer first
+    // avoids taking the tree lock of the child, which command buffers recorded on other threads contend on.
+    if (object_bindings.contains(*child_node)) {
+        return;
+    }
     if (child_node->AddParent(this)) {
         object_bindings.insert(child_node);
     }
@@ -227,7 +289,7 @@ void CommandBuffer::AddChild(std::shared_ptr<StateObject> &child_node) {
 void CommandBuffer::RemoveChild(std::shared_ptr<StateObject> &child_node) {
     assert(child_node);
     child_node->RemoveParent(this);
-    object_bindings.erase(child_node);
+    object_bindings.erase(*child_node);
 }
 
 // Reset the command buffer state
@@ -247,6 +309,7 @@ void CommandBuffer::ResetCBState() {
     command_count = 0;
     submit_count = 0;
     image_layout_change_count = 1;  // Start at 1. 0 is insert value for validation cache versions, s.t. new == dirty
+    attachments_change_count = 1;
 
     dynamic_state_status.cb.reset();
     dynamic_state_status.pipeline.reset();
@@ -353,8 +416,8 @@ void CommandBuffer::NotifyInvalidate(const StateObject::NodeList &invalid_nodes,
         for (auto &obj : invalid_nodes) {
             // Only record a broken binding if one of the nodes in the invalid chain is still
             // being tracked by the command buffer. This is to try to avoid race conditions
-            // caused by separate CommandBuffer and StateObject::parent_nodes locking.
-            if (object_bindings.erase(obj)) {
+            // caused by separate CommandBuffer and StateObject parent links locking.
+            if (object_bindings.erase(*obj)) {
                 obj->RemoveParent(this);
                 found_invalid = true;
             }
@@ -596,6 +659,7 @@ void CommandBuffer::UpdateSubpassAttachments() {
     ASSERT_AND_RETURN(active_render_pass);
     const auto &subpass = active_render_pass->create_info.pSubpasses[GetActiveSubpass()];
     assert(active_subpasses.size() == active_attachments.size());
+    attachments_change_count++;
 
     for (size_t i = 0; i < active_attachments.size(); ++i) {
         active_attachments[i].type = AttachmentInfo::Type::Empty;
@@ -852,6 +916,7 @@ void CommandBuffer::RecordBeginRendering(const VkRenderingInfo &rendering_info,
 
     // Currently reserve the maximum possible size for |active_attachments| so when looping, we NEED to check for null
     active_attachments.resize(attachment_count);
+    attachments_change_count++;
 
     for (uint32_t i = 0; i < rendering_info.colorAttachmentCount; ++i) {
         const auto &rendering_attachment = rendering_info.pColorAttachments[i];
@@ -2109,6 +2174,7 @@ void CommandBuffer::BindShader(VkShaderStageFlagBits shader_stage, vvl::ShaderOb
     const auto stage_index = static_cast<uint32_t>(ConvertToShaderObjectStage(shader_stage));
     last_bound_state.shader_object_bound[stage_index] = true;
     last_bound_state.shader_object_states[stage_index] = shader_object_state;
+    last_bound_state.shader_objects_change_count++;
 }
 
 // Only called for Graphics and during Multiview
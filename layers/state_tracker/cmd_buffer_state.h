@@ -20,6 +20,8 @@
  */
 #pragma once
 #include "state_tracker/state_object.h"
+#include "containers/paged_array.h"
+#include "containers/paged_bitset.h"
 #include "state_tracker/image_layout_map.h"
 #include "state_tracker/pipeline_library_state.h"
 #include "state_tracker/video_session_state.h"
@@ -186,6 +188,35 @@ struct LabelCommand {
     std::string label_name;  // used when begin == true
 };
 
+// Objects referenced by the commands recorded in a command buffer, the command buffer is one of their parents.
+//
+// Objects are looked up by their dense StateObject::GetId(), referencing an object which is already bound is a bit test
+// instead of hashing and refcounting a shared_ptr. The strong references are kept in a flat list, which reset walks to clear
+// the bits, and the position of each object in the list is kept by id so invalidating an object does not search the list.
+// Ids come from the device and are never reused, objects without an id are searched in the list.
+class CommandBufferBindings {
+  public:
+    using List = std::vector<std::shared_ptr<StateObject>>;
+
+    bool contains(const StateObject &object) const;
+    // Returns false if the object was already bound
+    bool insert(const std::shared_ptr<StateObject> &object);
+    // Returns false if the object was not bound
+    bool erase(const StateObject &object);
+    void clear();
+
+    List::const_iterator begin() const { return objects_.begin(); }
+    List::const_iterator end() const { return objects_.end(); }
+    bool empty() const { return objects_.empty(); }
+    size_t size() const { return objects_.size(); }
+
+  private:
+    paged_bitset<> ids_;
+    // Index in objects_, only meaningful while the bit of the id is set
+    paged_array<uint32_t> positions_;
+    List objects_;
+};
+
 class CommandBuffer : public RefcountedStateObject, public SubStateManager<CommandBufferSubState> {
     using Func = vvl::Func;
 
@@ -208,6 +239,7 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     uint64_t command_count;  // Number of commands recorded. Currently only used with VK_KHR_performance_query
     uint64_t submit_count;   // Number of times CB has been submitted
     uint64_t image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
+    uint64_t attachments_change_count;   // The sequence number for changes to the active attachments (for cached validation)
 
     // Track status of all vkCmdSet* calls, if 1, means it was set
     struct DynamicStateStatus {
@@ -476,7 +508,7 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     std::shared_ptr<vvl::Framebuffer> active_framebuffer;
     // Unified data structs to track objects bound to this command buffer as well as object
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    vvl::unordered_set<std::shared_ptr<StateObject>> object_bindings;
+    CommandBufferBindings object_bindings;
     vvl::unordered_map<VulkanTypedHandle, LogObjectList> broken_bindings;
 
     std::vector<TensorBarrier> tensor_barriers;
@@ -20,6 +20,7 @@
 #include "state_tracker/descriptor_sets.h"
 #include <vulkan/vk_enum_string_helper.h>
 #include <vulkan/vulkan_core.h>
+#include <algorithm>
 #include <cstdint>
 #include "state_tracker/image_state.h"
 #include "state_tracker/buffer_state.h"
@@ -613,6 +614,67 @@ vvl::DescriptorSetLayout::DescriptorSetLayout(vvl::DeviceState &device_state, co
     }
 }
 
+vvl::DescriptorUpdateTemplate::DescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle,
+                                                        const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                                                        const DescriptorSetLayout *layout)
+    : StateObject(handle, kVulkanObjectTypeDescriptorUpdateTemplate),
+      safe_create_info(pCreateInfo),
+      create_info(*safe_create_info.ptr()),
+      decode_plan(layout ? BuildDecodePlan(create_info, *layout) : DecodePlan()) {}
+
+vvl::DescriptorUpdateTemplate::DecodePlan vvl::DescriptorUpdateTemplate::BuildDecodePlan(
+    const VkDescriptorUpdateTemplateCreateInfo &create_info, const DescriptorSetLayout &layout) {
+    DecodePlan plan;
+    plan.reserve(create_info.descriptorUpdateEntryCount);
+    const uint32_t binding_count = layout.GetBindingCount();
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        const auto &entry = create_info.pDescriptorUpdateEntries[i];
+        // The descriptorCount of inline uniform blocks is the size of the data written into a single binding
+        const bool single_run = entry.descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK;
+        DecodeRun run{entry.dstBinding, layout.GetIndexFromBinding(entry.dstBinding), entry.dstArrayElement, 0,
+                      entry.descriptorType, entry.offset, entry.stride, false};
+        uint32_t remaining = entry.descriptorCount;
+        while (remaining > 0) {
+            uint32_t descriptor_count = layout.GetDescriptorCountFromIndex(run.binding_index);
+            if (run.array_element >= descriptor_count) {
+                run.binding = layout.GetNextValidBinding(run.binding);
+                run.binding_index = layout.GetIndexFromBinding(run.binding);
+                run.array_element = 0;
+                descriptor_count = layout.GetDescriptorCountFromIndex(run.binding_index);
+            }
+            // Past the last binding the rest of the entry stays in one run, validation reports the missing binding
+            if (single_run || run.binding_index >= binding_count) {
+                run.count = remaining;
+            } else {
+                run.count = std::min(remaining, descriptor_count - run.array_element);
+            }
+            plan.emplace_back(run);
+            remaining -= run.count;
+            run.array_element += run.count;
+            run.offset += run.count * run.stride;
+            run.rolled_over = true;
+        }
+    }
+    return plan;
+}
+
+std::shared_ptr<const vvl::DescriptorUpdateTemplate::DecodePlan> vvl::DescriptorUpdateTemplate::GetPushDecodePlan(
+    const DescriptorSetLayout &layout) const {
+    const DescriptorSetLayoutDef *layout_def = layout.GetLayoutDef();
+    {
+        ReadLockGuard guard(push_decode_plans_lock_);
+        auto it = push_decode_plans_.find(layout_def);
+        if (it != push_decode_plans_.end()) {
+            return it->second.plan;
+        }
+    }
+    auto plan = std::make_shared<const DecodePlan>(BuildDecodePlan(create_info, layout));
+    WriteLockGuard guard(push_decode_plans_lock_);
+    // Another thread may have built it first, both plans are the same
+    auto inserted = push_decode_plans_.emplace(layout_def, PushDecodePlan{layout.GetLayoutId(), std::move(plan)});
+    return inserted.first->second.plan;
+}
+
 vvl::DescriptorSet::DescriptorSet(const VkDescriptorSet handle, vvl::DescriptorPool *pool_state,
                                   const std::shared_ptr<DescriptorSetLayout const> &layout, uint32_t variable_count,
                                   vvl::DeviceState *state_data)
@@ -644,11 +706,11 @@ vvl::DescriptorSet::DescriptorSet(const VkDescriptorSet handle, vvl::DescriptorP
                 auto binding = MakeBinding<SamplerBinding>(free_binding++, *create_info, descriptor_count, flags);
                 if (auto immutable_sampler_handles = layout_->GetImmutableSamplerPtrFromIndex(i)) {
                     for (uint32_t di = 0; di < descriptor_count; ++di) {
-                        auto sampler = state_data->GetConstCastShared<vvl::Sampler>(immutable_sampler_handles[di]);
-                        if (sampler) {
+                        const VkSampler sampler = immutable_sampler_handles[di];
+                        if (auto sampler_state = state_data->GetBorrowed<vvl::Sampler>(sampler)) {
                             some_update_ = true;  // Immutable samplers are updated at creation
-                            binding->updated[di] = true;
-                            binding->descriptors[di].SetImmutableSampler(std::move(sampler));
+                            binding->updated.set(di);
+                            binding->descriptors.GetForWrite(di).SetImmutableSampler(SamplerRef(sampler, sampler_state));
                         }
                     }
                 }
@@ -659,11 +721,11 @@ vvl::DescriptorSet::DescriptorSet(const VkDescriptorSet handle, vvl::DescriptorP
                 auto binding = MakeBinding<ImageSamplerBinding>(free_binding++, *create_info, descriptor_count, flags);
                 if (auto immutable_sampler_handles = layout_->GetImmutableSamplerPtrFromIndex(i)) {
                     for (uint32_t di = 0; di < descriptor_count; ++di) {
-                        auto sampler = state_data->GetConstCastShared<vvl::Sampler>(immutable_sampler_handles[di]);
-                        if (sampler) {
+                        const VkSampler sampler = immutable_sampler_handles[di];
+                        if (auto sampler_state = state_data->GetBorrowed<vvl::Sampler>(sampler)) {
                             some_update_ = true;  // Immutable samplers are updated at creation
-                            binding->updated[di] = true;
-                            binding->descriptors[di].SetImmutableSampler(std::move(sampler));
+                            binding->updated.set(di);
+                            binding->descriptors.GetForWrite(di).SetImmutableSampler(SamplerRef(sampler, sampler_state));
                         }
                     }
                 }
@@ -716,7 +778,7 @@ vvl::DescriptorSet::DescriptorSet(const VkDescriptorSet handle, vvl::DescriptorP
 void vvl::DescriptorSet::LinkChildNodes() {
     // Connect child node(s), which cannot safely be done in the constructor.
     for (auto &binding : bindings_) {
-        binding->AddParent(this);
+        binding->AddParent(this, *state_data_);
     }
 }
 
@@ -763,7 +825,7 @@ std::pair<uint32_t, uint32_t> vvl::DescriptorSet::GetBindingAndIndex(const uint3
 
 void vvl::DescriptorSet::Destroy() {
     for (auto &binding : bindings_) {
-        binding->RemoveParent(this);
+        binding->RemoveParent(this, *state_data_);
     }
     StateObject::Destroy();
 }
@@ -820,6 +882,94 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet &update)
     NotifyUpdate();
 }
 
+void vvl::DescriptorSet::PerformTemplateUpdate(const DescriptorUpdateTemplate &template_state, const void *pData) {
+    bool any_update = false;
+    bool invalidate = false;
+    const DescriptorBinding *entry_binding = nullptr;  // first binding of the current update entry
+    for (const auto &run : template_state.decode_plan) {
+        DescriptorBinding *run_binding = run.binding_index < bindings_.size() ? bindings_[run.binding_index].get() : nullptr;
+        if (!run.rolled_over) {
+            entry_binding = run_binding;
+        } else if (entry_binding && run_binding && !entry_binding->IsConsistent(*run_binding)) {
+            // Like PerformWriteUpdate, stop the entry where the next binding does not match the type, stages and flags
+            entry_binding = nullptr;
+        }
+        if (!entry_binding || !run_binding || run.count == 0) {
+            continue;
+        }
+        DescriptorBinding &binding = *run_binding;
+        const bool is_bindless = IsBindless(binding.binding_flags);
+        const uint8_t *run_data = static_cast<const uint8_t *>(pData) + run.offset;
+
+        // Each descriptor gets a write pointing at its element of pData, so the stride never has to be repacked
+        VkWriteDescriptorSet write{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        write.dstSet = VkHandle();
+        write.dstBinding = run.binding;
+        write.descriptorCount = 1;
+        write.descriptorType = run.type;
+        VkWriteDescriptorSetAccelerationStructureKHR as_info_khr{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR};
+        as_info_khr.accelerationStructureCount = 1;
+        VkWriteDescriptorSetAccelerationStructureNV as_info_nv{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV};
+        as_info_nv.accelerationStructureCount = 1;
+        if (run.type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR) {
+            write.pNext = &as_info_khr;
+        } else if (run.type == VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV) {
+            write.pNext = &as_info_nv;
+        }
+
+        const uint32_t end = std::min(run.array_element + run.count, binding.count);
+        for (uint32_t array_element = run.array_element; array_element < end; ++array_element) {
+            const uint8_t *element_data = run_data + (array_element - run.array_element) * run.stride;
+            switch (run.type) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    write.pImageInfo = reinterpret_cast<const VkDescriptorImageInfo *>(element_data);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    write.pBufferInfo = reinterpret_cast<const VkDescriptorBufferInfo *>(element_data);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    write.pTexelBufferView = reinterpret_cast<const VkBufferView *>(element_data);
+                    break;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
+                    as_info_khr.pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureKHR *>(element_data);
+                    break;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                    as_info_nv.pAccelerationStructures = reinterpret_cast<const VkAccelerationStructureNV *>(element_data);
+                    break;
+                default:
+                    // Inline uniform block bytes only need to be marked as updated
+                    break;
+            }
+            write.dstArrayElement = array_element;
+            binding.GetDescriptorForWrite(array_element)->WriteUpdate(*this, *state_data_, write, 0, is_bindless);
+            binding.updated.set(array_element);
+        }
+
+        any_update = true;
+        if (!(binding.binding_flags &
+              (VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT))) {
+            invalidate = true;
+        }
+    }
+    if (!any_update) {
+        return;
+    }
+    some_update_ = true;
+    ++change_count_;
+    if (invalidate && !IsPushDescriptor()) {
+        Invalidate(false);
+    }
+    NotifyUpdate();
+}
+
 // Perform Copy update
 void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, const DescriptorSet &src_set) {
     auto src_iter = src_set.FindDescriptor(update.srcBinding, update.srcArrayElement);
@@ -827,9 +977,9 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet &update, co
     ASSERT_AND_RETURN(src_iter.IsValid() && dst_iter.IsValid());
     // Update parameters all look good so perform update
     for (uint32_t i = 0; i < update.descriptorCount; ++i, ++src_iter, ++dst_iter) {
-        auto &src = *src_iter;
-        auto &dst = *dst_iter;
         if (src_iter.updated()) {
+            const auto &src = *src_iter;
+            auto &dst = *dst_iter;
             auto type = src_iter.CurrentBinding().type;
             if (type == VK_DESCRIPTOR_TYPE_MUTABLE_EXT) {
                 const auto &mutable_src = static_cast<const MutableDescriptor &>(src);
@@ -877,24 +1027,21 @@ void vvl::DescriptorSet::UpdateImageLayoutDrawStates(vvl::DeviceState *device_da
 
         switch (binding->descriptor_class) {
             case DescriptorClass::Image: {
-                auto *image_binding = static_cast<ImageBinding *>(binding);
-                for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state);
-                }
+                const auto *image_binding = static_cast<const ImageBinding *>(binding);
+                image_binding->updated.ForEachSet(
+                    [&](uint32_t i) { image_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state); });
                 break;
             }
             case DescriptorClass::ImageSampler: {
-                auto *image_binding = static_cast<ImageSamplerBinding *>(binding);
-                for (uint32_t i = 0; i < image_binding->count; ++i) {
-                    image_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state);
-                }
+                const auto *image_binding = static_cast<const ImageSamplerBinding *>(binding);
+                image_binding->updated.ForEachSet(
+                    [&](uint32_t i) { image_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state); });
                 break;
             }
             case DescriptorClass::Mutable: {
-                auto *mutable_binding = static_cast<MutableBinding *>(binding);
-                for (uint32_t i = 0; i < mutable_binding->count; ++i) {
-                    mutable_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state);
-                }
+                const auto *mutable_binding = static_cast<const MutableBinding *>(binding);
+                mutable_binding->updated.ForEachSet(
+                    [&](uint32_t i) { mutable_binding->descriptors[i].UpdateImageLayoutDrawState(cb_state); });
                 break;
             }
             default:
@@ -927,27 +1074,252 @@ bool vvl::DescriptorSet::ValidateBindingOnGPU(const DescriptorBinding &binding,
     return false;
 }
 
-// Helper template to change shared pointer members of a Descriptor, while
-// correctly managing links to the parent DescriptorSet.
-// src and dst are shared pointers.
-template <typename T>
-static void ReplaceStatePtr(DescriptorSet &set_state, T &dst, const T &src, bool is_bindless) {
-    if (dst && !is_bindless) {
-        dst->RemoveParent(&set_state);
+template <typename State, typename HandleType>
+State *vvl::DescriptorStateRef<State, HandleType>::Get(const DeviceState &dev_data) const {
+    if (handle_ == VK_NULL_HANDLE) {
+        return nullptr;
+    }
+    // Same as GetConstCastShared(), descriptors hand out non-const state objects
+    auto *state = const_cast<State *>(dev_data.GetBorrowed<State>(handle_));
+    return (state && state->GetId() == id_) ? state : nullptr;
+}
+
+template <typename State, typename HandleType>
+std::shared_ptr<State> vvl::DescriptorStateRef<State, HandleType>::GetShared(const DeviceState &dev_data) const {
+    if (handle_ == VK_NULL_HANDLE) {
+        return nullptr;
+    }
+    auto state = dev_data.GetConstCastShared<State>(handle_);
+    return (state && state->GetId() == id_) ? std::move(state) : nullptr;
+}
+
+namespace vvl {
+template class DescriptorStateRef<Sampler, VkSampler>;
+template class DescriptorStateRef<ImageView, VkImageView>;
+template class DescriptorStateRef<Buffer, VkBuffer>;
+template class DescriptorStateRef<BufferView, VkBufferView>;
+template class DescriptorStateRef<AccelerationStructureKHR, VkAccelerationStructureKHR>;
+template class DescriptorStateRef<AccelerationStructureNV, VkAccelerationStructureNV>;
+template class DescriptorStateRef<Tensor, VkTensorARM>;
+template class DescriptorStateRef<TensorView, VkTensorViewARM>;
+}  // namespace vvl
+
+// Helper templates to change the state references of a Descriptor, while correctly managing links to the parent DescriptorSet.
+// The new state object is passed along when the caller already looked it up.
+template <typename State, typename HandleType>
+static void ReplaceStateRef(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
+                            vvl::DescriptorStateRef<State, HandleType> &dst, const vvl::DescriptorStateRef<State, HandleType> &src,
+                            State *src_state, bool is_bindless) {
+    // Rewriting the same object (common when refreshing bindless sets) would only add and remove the same parent link
+    if (dst == src) {
+        return;
     }
-    dst = src;
     // For descriptor bindings with UPDATE_AFTER_BIND or PARTIALLY_BOUND only set the object as a child, but not the descriptor as a
-    // parent, so that destroying the object wont invalidate the descriptor
-    if (dst && !is_bindless) {
-        dst->AddParent(&set_state);
+    // parent, so that destroying the object wont invalidate the descriptor.
+    // An object that was destroyed already dropped its parent links, so it not being found is fine.
+    if (!is_bindless) {
+        if (auto *dst_state = dst.Get(dev_data)) {
+            dst_state->RemoveParent(&set_state);
+        }
+    }
+    dst = src;
+    if (src_state && !is_bindless) {
+        src_state->AddParent(&set_state);
+    }
+}
+
+// Copy from another descriptor
+template <typename State, typename HandleType>
+static void ReplaceStateRef(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
+                            vvl::DescriptorStateRef<State, HandleType> &dst, const vvl::DescriptorStateRef<State, HandleType> &src,
+                            bool is_bindless) {
+    if (dst != src) {
+        ReplaceStateRef(set_state, dev_data, dst, src, src.Get(dev_data), is_bindless);
+    }
+}
+
+// Write from a handle in a VkWriteDescriptorSet
+template <typename State, typename HandleType>
+static void ReplaceStateRef(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
+                            vvl::DescriptorStateRef<State, HandleType> &dst, HandleType handle, bool is_bindless) {
+    auto *state = const_cast<State *>(dev_data.GetBorrowed<State>(handle));
+    ReplaceStateRef(set_state, dev_data, dst, vvl::DescriptorStateRef<State, HandleType>(handle, state), state, is_bindless);
+}
+
+// The Descriptor functions below forward to the derived class. A class missing from a switch does not have the function and
+// gets the default behavior, listing it would call straight back into the base function.
+void vvl::Descriptor::WriteUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data, const VkWriteDescriptorSet &update,
+                                  const uint32_t index, bool is_bindless) {
+    switch (descriptor_class_) {
+        case DescriptorClass::PlainSampler:
+            return static_cast<SamplerDescriptor *>(this)->WriteUpdate(set_state, dev_data, update, index, is_bindless);
+        case DescriptorClass::ImageSampler:
+            return static_cast<ImageSamplerDescriptor *>(this)->WriteUpdate(set_state, dev_data, update, index, is_bindless);
+        case DescriptorClass::Image:
+            return static_cast<ImageDescriptor *>(this)->WriteUpdate(set_state, dev_data, update, index, is_bindless);
+        case DescriptorClass::TexelBuffer:
+            return static_cast<TexelDescriptor *>(this)->WriteUpdate(set_state, dev_data, update, index, is_bindless);
+        case DescriptorClass::GeneralBuffer:
+            return static_cast<BufferDescriptor *>(this)->WriteUpdate(set_state, dev_data, update, index, is_bindless);
+        case DescriptorClass::AccelerationStructure:
+            return static_cast<AccelerationStructureDescriptor *>(this)->WriteUpdate(set_state, dev_data, update, index,
+                                                                                     is_bindless);
+        case DescriptorClass::Mutable:
+            return static_cast<MutableDescriptor *>(this)->WriteUpdate(set_state, dev_data, update, index, is_bindless);
+        case DescriptorClass::Tensor:
+            return static_cast<TensorDescriptor *>(this)->WriteUpdate(set_state, dev_data, update, index, is_bindless);
+        case DescriptorClass::InlineUniform:
+        case DescriptorClass::Invalid:
+            break;
+    }
+}
+
+void vvl::Descriptor::CopyUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data, const Descriptor &src,
+                                 bool is_bindless, VkDescriptorType type) {
+    switch (descriptor_class_) {
+        case DescriptorClass::PlainSampler:
+            return static_cast<SamplerDescriptor *>(this)->CopyUpdate(set_state, dev_data, src, is_bindless, type);
+        case DescriptorClass::ImageSampler:
+            return static_cast<ImageSamplerDescriptor *>(this)->CopyUpdate(set_state, dev_data, src, is_bindless, type);
+        case DescriptorClass::Image:
+            return static_cast<ImageDescriptor *>(this)->CopyUpdate(set_state, dev_data, src, is_bindless, type);
+        case DescriptorClass::TexelBuffer:
+            return static_cast<TexelDescriptor *>(this)->CopyUpdate(set_state, dev_data, src, is_bindless, type);
+        case DescriptorClass::GeneralBuffer:
+            return static_cast<BufferDescriptor *>(this)->CopyUpdate(set_state, dev_data, src, is_bindless, type);
+        case DescriptorClass::AccelerationStructure:
+            return static_cast<AccelerationStructureDescriptor *>(this)->CopyUpdate(set_state, dev_data, src, is_bindless, type);
+        case DescriptorClass::Mutable:
+            return static_cast<MutableDescriptor *>(this)->CopyUpdate(set_state, dev_data, src, is_bindless, type);
+        case DescriptorClass::Tensor:
+            return static_cast<TensorDescriptor *>(this)->CopyUpdate(set_state, dev_data, src, is_bindless, type);
+        case DescriptorClass::InlineUniform:
+        case DescriptorClass::Invalid:
+            break;
+    }
+}
+
+bool vvl::Descriptor::IsImmutableSampler() const {
+    switch (descriptor_class_) {
+        case DescriptorClass::PlainSampler:
+            return static_cast<const SamplerDescriptor *>(this)->IsImmutableSampler();
+        case DescriptorClass::ImageSampler:
+            return static_cast<const ImageSamplerDescriptor *>(this)->IsImmutableSampler();
+        default:
+            return false;
+    }
+}
+
+bool vvl::Descriptor::AddParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    switch (descriptor_class_) {
+        case DescriptorClass::PlainSampler:
+            return static_cast<SamplerDescriptor *>(this)->AddParent(state_object, dev_data);
+        case DescriptorClass::ImageSampler:
+            return static_cast<ImageSamplerDescriptor *>(this)->AddParent(state_object, dev_data);
+        case DescriptorClass::Image:
+            return static_cast<ImageDescriptor *>(this)->AddParent(state_object, dev_data);
+        case DescriptorClass::TexelBuffer:
+            return static_cast<TexelDescriptor *>(this)->AddParent(state_object, dev_data);
+        case DescriptorClass::GeneralBuffer:
+            return static_cast<BufferDescriptor *>(this)->AddParent(state_object, dev_data);
+        case DescriptorClass::AccelerationStructure:
+            return static_cast<AccelerationStructureDescriptor *>(this)->AddParent(state_object, dev_data);
+        case DescriptorClass::Mutable:
+            return static_cast<MutableDescriptor *>(this)->AddParent(state_object, dev_data);
+        default:
+            return false;
+    }
+}
+
+void vvl::Descriptor::RemoveParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    switch (descriptor_class_) {
+        case DescriptorClass::PlainSampler:
+            return static_cast<SamplerDescriptor *>(this)->RemoveParent(state_object, dev_data);
+        case DescriptorClass::ImageSampler:
+            return static_cast<ImageSamplerDescriptor *>(this)->RemoveParent(state_object, dev_data);
+        case DescriptorClass::Image:
+            return static_cast<ImageDescriptor *>(this)->RemoveParent(state_object, dev_data);
+        case DescriptorClass::TexelBuffer:
+            return static_cast<TexelDescriptor *>(this)->RemoveParent(state_object, dev_data);
+        case DescriptorClass::GeneralBuffer:
+            return static_cast<BufferDescriptor *>(this)->RemoveParent(state_object, dev_data);
+        case DescriptorClass::AccelerationStructure:
+            return static_cast<AccelerationStructureDescriptor *>(this)->RemoveParent(state_object, dev_data);
+        case DescriptorClass::Mutable:
+            return static_cast<MutableDescriptor *>(this)->RemoveParent(state_object, dev_data);
+        default:
+            break;
+    }
+}
+
+void vvl::Descriptor::InvalidateNode(const std::shared_ptr<StateObject> &invalid_node, bool unlink) {
+    switch (descriptor_class_) {
+        case DescriptorClass::ImageSampler:
+        case DescriptorClass::Image:
+            return static_cast<ImageDescriptor *>(this)->InvalidateNode(invalid_node, unlink);
+        default:
+            break;
+    }
+}
+
+void vvl::Descriptor::UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) const {
+    switch (descriptor_class_) {
+        case DescriptorClass::ImageSampler:
+        case DescriptorClass::Image:
+            return static_cast<const ImageDescriptor *>(this)->UpdateImageLayoutDrawState(cb_state);
+        case DescriptorClass::Mutable:
+            return static_cast<const MutableDescriptor *>(this)->UpdateImageLayoutDrawState(cb_state);
+        default:
+            break;
     }
 }
 
+bool vvl::Descriptor::Invalid(const vvl::DeviceState &dev_data) const {
+    switch (descriptor_class_) {
+        case DescriptorClass::PlainSampler:
+            return static_cast<const SamplerDescriptor *>(this)->Invalid(dev_data);
+        case DescriptorClass::ImageSampler:
+            return static_cast<const ImageSamplerDescriptor *>(this)->Invalid(dev_data);
+        case DescriptorClass::Image:
+            return static_cast<const ImageDescriptor *>(this)->Invalid(dev_data);
+        case DescriptorClass::TexelBuffer:
+            return static_cast<const TexelDescriptor *>(this)->Invalid(dev_data);
+        case DescriptorClass::GeneralBuffer:
+            return static_cast<const BufferDescriptor *>(this)->Invalid(dev_data);
+        case DescriptorClass::AccelerationStructure:
+            return static_cast<const AccelerationStructureDescriptor *>(this)->Invalid(dev_data);
+        case DescriptorClass::Mutable:
+            return static_cast<const MutableDescriptor *>(this)->Invalid(dev_data);
+        default:
+            return false;
+    }
+}
+
+// Links the descriptor set to the state object, if it still exists
+template <typename Ref>
+static bool AddParentTo(const Ref &ref, vvl::StateObject *state_object, const vvl::DeviceState &dev_data) {
+    auto *state = ref.Get(dev_data);
+    return state ? state->AddParent(state_object) : false;
+}
+
+// A destroyed object already dropped all of its parent links
+template <typename Ref>
+static void RemoveParentFrom(const Ref &ref, vvl::StateObject *state_object, const vvl::DeviceState &dev_data) {
+    if (auto *state = ref.Get(dev_data)) {
+        state->RemoveParent(state_object);
+    }
+}
+
+template <typename Ref>
+static bool InvalidRef(const Ref &ref, const vvl::DeviceState &dev_data) {
+    const auto *state = ref.Get(dev_data);
+    return !state || state->Invalid();
+}
+
 void vvl::SamplerDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
                                          const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
     if (!immutable_ && update.pImageInfo) {
-        ReplaceStatePtr(set_state, sampler_state_, dev_data.GetConstCastShared<vvl::Sampler>(update.pImageInfo[index].sampler),
-                        is_bindless);
+        ReplaceStateRef(set_state, dev_data, sampler_, update.pImageInfo[index].sampler, is_bindless);
     }
 }
 
@@ -956,47 +1328,39 @@ void vvl::SamplerDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::Dev
     if (src.GetClass() == DescriptorClass::Mutable) {
         auto &sampler_src = static_cast<const MutableDescriptor &>(src);
         if (!immutable_) {
-            ReplaceStatePtr(set_state, sampler_state_, sampler_src.GetSharedSamplerState(), is_bindless);
+            ReplaceStateRef(set_state, dev_data, sampler_, sampler_src.GetSamplerRef(), is_bindless);
         }
         return;
     }
     auto &sampler_src = static_cast<const SamplerDescriptor &>(src);
     if (!immutable_) {
-        ReplaceStatePtr(set_state, sampler_state_, sampler_src.sampler_state_, is_bindless);
+        ReplaceStateRef(set_state, dev_data, sampler_, sampler_src.sampler_, is_bindless);
     }
 }
 
-VkSampler vvl::SamplerDescriptor::GetSampler() const { return sampler_state_ ? sampler_state_->VkHandle() : VK_NULL_HANDLE; }
-
-void vvl::SamplerDescriptor::SetImmutableSampler(std::shared_ptr<vvl::Sampler> &&state) {
-    sampler_state_ = std::move(state);
+void vvl::SamplerDescriptor::SetImmutableSampler(const SamplerRef &sampler) {
+    sampler_ = sampler;
     immutable_ = true;
 }
 
-bool vvl::SamplerDescriptor::AddParent(StateObject *state_object) {
-    bool result = false;
-    if (sampler_state_) {
-        result = sampler_state_->AddParent(state_object);
-    }
-    return result;
+bool vvl::SamplerDescriptor::AddParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    return AddParentTo(sampler_, state_object, dev_data);
 }
-void vvl::SamplerDescriptor::RemoveParent(StateObject *state_object) {
-    if (sampler_state_) {
-        sampler_state_->RemoveParent(state_object);
-    }
+void vvl::SamplerDescriptor::RemoveParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    RemoveParentFrom(sampler_, state_object, dev_data);
 }
-bool vvl::SamplerDescriptor::Invalid() const { return !sampler_state_ || sampler_state_->Invalid(); }
+bool vvl::SamplerDescriptor::Invalid(const vvl::DeviceState &dev_data) const { return InvalidRef(sampler_, dev_data); }
 
 void vvl::ImageSamplerDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
                                               const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
     if (!update.pImageInfo) return;
     const auto &image_info = update.pImageInfo[index];
     if (!immutable_) {
-        ReplaceStatePtr(set_state, sampler_state_, dev_data.GetConstCastShared<vvl::Sampler>(image_info.sampler), is_bindless);
+        ReplaceStateRef(set_state, dev_data, sampler_, image_info.sampler, is_bindless);
     }
     image_layout_ = image_info.imageLayout;
-    ReplaceStatePtr(set_state, image_view_state_, dev_data.GetConstCastShared<vvl::ImageView>(image_info.imageView), is_bindless);
-    UpdateKnownValidView(is_bindless);
+    ReplaceStateRef(set_state, dev_data, image_view_, image_info.imageView, is_bindless);
+    UpdateKnownValidView(dev_data, is_bindless);
 }
 
 void vvl::ImageSamplerDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data, const Descriptor &src,
@@ -1004,41 +1368,35 @@ void vvl::ImageSamplerDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl
     if (src.GetClass() == DescriptorClass::Mutable) {
         auto &image_src = static_cast<const MutableDescriptor &>(src);
         if (!immutable_) {
-            ReplaceStatePtr(set_state, sampler_state_, image_src.GetSharedSamplerState(), is_bindless);
+            ReplaceStateRef(set_state, dev_data, sampler_, image_src.GetSamplerRef(), is_bindless);
         }
         ImageDescriptor::CopyUpdate(set_state, dev_data, src, is_bindless, src_type);
         return;
     }
     auto &image_src = static_cast<const ImageSamplerDescriptor &>(src);
     if (!immutable_) {
-        ReplaceStatePtr(set_state, sampler_state_, image_src.sampler_state_, is_bindless);
+        ReplaceStateRef(set_state, dev_data, sampler_, image_src.sampler_, is_bindless);
     }
     ImageDescriptor::CopyUpdate(set_state, dev_data, src, is_bindless, src_type);
 }
 
-VkSampler vvl::ImageSamplerDescriptor::GetSampler() const { return sampler_state_ ? sampler_state_->VkHandle() : VK_NULL_HANDLE; }
-
-void vvl::ImageSamplerDescriptor::SetImmutableSampler(std::shared_ptr<vvl::Sampler> &&state) {
-    sampler_state_ = std::move(state);
+void vvl::ImageSamplerDescriptor::SetImmutableSampler(const SamplerRef &sampler) {
+    sampler_ = sampler;
     immutable_ = true;
 }
 
-bool vvl::ImageSamplerDescriptor::AddParent(StateObject *state_object) {
-    bool result = ImageDescriptor::AddParent(state_object);
-    if (sampler_state_) {
-        result |= sampler_state_->AddParent(state_object);
-    }
+bool vvl::ImageSamplerDescriptor::AddParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    bool result = ImageDescriptor::AddParent(state_object, dev_data);
+    result |= AddParentTo(sampler_, state_object, dev_data);
     return result;
 }
-void vvl::ImageSamplerDescriptor::RemoveParent(StateObject *state_object) {
-    ImageDescriptor::RemoveParent(state_object);
-    if (sampler_state_) {
-        sampler_state_->RemoveParent(state_object);
-    }
+void vvl::ImageSamplerDescriptor::RemoveParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    ImageDescriptor::RemoveParent(state_object, dev_data);
+    RemoveParentFrom(sampler_, state_object, dev_data);
 }
 
-bool vvl::ImageSamplerDescriptor::Invalid() const {
-    return ImageDescriptor::Invalid() || !sampler_state_ || sampler_state_->Invalid();
+bool vvl::ImageSamplerDescriptor::Invalid(const vvl::DeviceState &dev_data) const {
+    return ImageDescriptor::Invalid(dev_data) || InvalidRef(sampler_, dev_data);
 }
 
 void vvl::ImageDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
@@ -1046,8 +1404,8 @@ void vvl::ImageDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::Devi
     if (!update.pImageInfo) return;
     const auto &image_info = update.pImageInfo[index];
     image_layout_ = image_info.imageLayout;
-    ReplaceStatePtr(set_state, image_view_state_, dev_data.GetConstCastShared<vvl::ImageView>(image_info.imageView), is_bindless);
-    UpdateKnownValidView(is_bindless);
+    ReplaceStateRef(set_state, dev_data, image_view_, image_info.imageView, is_bindless);
+    UpdateKnownValidView(dev_data, is_bindless);
 }
 
 void vvl::ImageDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data, const Descriptor &src,
@@ -1056,60 +1414,54 @@ void vvl::ImageDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::Devic
         auto &image_src = static_cast<const MutableDescriptor &>(src);
 
         image_layout_ = image_src.GetImageLayout();
-        ReplaceStatePtr(set_state, image_view_state_, image_src.GetSharedImageViewState(), is_bindless);
-        UpdateKnownValidView(is_bindless);
+        ReplaceStateRef(set_state, dev_data, image_view_, image_src.GetImageViewRef(), is_bindless);
+        UpdateKnownValidView(dev_data, is_bindless);
         return;
     }
     auto &image_src = static_cast<const ImageDescriptor &>(src);
 
     image_layout_ = image_src.image_layout_;
-    ReplaceStatePtr(set_state, image_view_state_, image_src.image_view_state_, is_bindless);
-    UpdateKnownValidView(is_bindless);
+    ReplaceStateRef(set_state, dev_data, image_view_, image_src.image_view_, is_bindless);
+    UpdateKnownValidView(dev_data, is_bindless);
 }
 
-void vvl::ImageDescriptor::UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) {
+void vvl::ImageDescriptor::UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) const {
     // Add binding for image
-    if (auto iv_state = GetImageViewState()) {
+    if (auto iv_state = GetImageViewState(cb_state.dev_data)) {
         cb_state.TrackImageViewFirstLayout(*iv_state, image_layout_);
     }
 }
 
-VkImageView vvl::ImageDescriptor::GetImageView() const {
-    return image_view_state_ ? image_view_state_->VkHandle() : VK_NULL_HANDLE;
-}
-
-bool vvl::ImageDescriptor::AddParent(StateObject *state_object) {
-    bool result = false;
-    if (image_view_state_) {
-        result = image_view_state_->AddParent(state_object);
-    }
-    return result;
+bool vvl::ImageDescriptor::AddParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    return AddParentTo(image_view_, state_object, dev_data);
 }
-void vvl::ImageDescriptor::RemoveParent(StateObject *state_object) {
-    if (image_view_state_) {
-        image_view_state_->RemoveParent(state_object);
-    }
+void vvl::ImageDescriptor::RemoveParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    RemoveParentFrom(image_view_, state_object, dev_data);
 }
 void vvl::ImageDescriptor::InvalidateNode(const std::shared_ptr<StateObject> &invalid_node, bool unlink) {
-    if (invalid_node == image_view_state_) {
+    // Nothing to unlink, the view is looked up again and won't be found once destroyed
+    if (image_view_.Is(*invalid_node)) {
         known_valid_view_ = false;
-        if (unlink) {
-            image_view_state_.reset();
-        }
     }
 }
 
-bool vvl::ImageDescriptor::Invalid() const { return !known_valid_view_ && ComputeInvalid(); }
-bool vvl::ImageDescriptor::ComputeInvalid() const { return !image_view_state_ || image_view_state_->Invalid(); }
-void vvl::ImageDescriptor::UpdateKnownValidView(bool is_bindless) { known_valid_view_ = !is_bindless && !ComputeInvalid(); }
+bool vvl::ImageDescriptor::Invalid(const vvl::DeviceState &dev_data) const {
+    return !known_valid_view_ && ComputeInvalid(dev_data);
+}
+bool vvl::ImageDescriptor::ComputeInvalid(const vvl::DeviceState &dev_data) const {
+    const vvl::ImageView *image_view_state = image_view_.Get(dev_data);
+    return !image_view_state || image_view_state->Invalid();
+}
+void vvl::ImageDescriptor::UpdateKnownValidView(const vvl::DeviceState &dev_data, bool is_bindless) {
+    known_valid_view_ = !is_bindless && !ComputeInvalid(dev_data);
+}
 
 void vvl::BufferDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
                                         const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
     const auto &buffer_info = update.pBufferInfo[index];
     offset_ = buffer_info.offset;
     range_ = buffer_info.range;
-    auto buffer_state = dev_data.GetConstCastShared<vvl::Buffer>(buffer_info.buffer);
-    ReplaceStatePtr(set_state, buffer_state_, buffer_state, is_bindless);
+    ReplaceStateRef(set_state, dev_data, buffer_, buffer_info.buffer, is_bindless);
 }
 
 void vvl::BufferDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data, const Descriptor &src,
@@ -1118,76 +1470,59 @@ void vvl::BufferDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::Devi
         const auto &buff_desc = static_cast<const MutableDescriptor &>(src);
         offset_ = buff_desc.GetOffset();
         range_ = buff_desc.GetRange();
-        ReplaceStatePtr(set_state, buffer_state_, buff_desc.GetSharedBufferState(), is_bindless);
+        ReplaceStateRef(set_state, dev_data, buffer_, buff_desc.GetBufferRef(), is_bindless);
         return;
     }
     const auto &buff_desc = static_cast<const BufferDescriptor &>(src);
     offset_ = buff_desc.offset_;
     range_ = buff_desc.range_;
-    ReplaceStatePtr(set_state, buffer_state_, buff_desc.buffer_state_, is_bindless);
+    ReplaceStateRef(set_state, dev_data, buffer_, buff_desc.buffer_, is_bindless);
 }
 
-VkBuffer vvl::BufferDescriptor::GetBuffer() const { return buffer_state_ ? buffer_state_->VkHandle() : VK_NULL_HANDLE; }
-
-bool vvl::BufferDescriptor::AddParent(StateObject *state_object) {
-    bool result = false;
-    if (buffer_state_) {
-        result = buffer_state_->AddParent(state_object);
-    }
-    return result;
+bool vvl::BufferDescriptor::AddParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    return AddParentTo(buffer_, state_object, dev_data);
 }
-void vvl::BufferDescriptor::RemoveParent(StateObject *state_object) {
-    if (buffer_state_) {
-        buffer_state_->RemoveParent(state_object);
-    }
+void vvl::BufferDescriptor::RemoveParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    RemoveParentFrom(buffer_, state_object, dev_data);
 }
-bool vvl::BufferDescriptor::Invalid() const { return !buffer_state_ || buffer_state_->Invalid(); }
+bool vvl::BufferDescriptor::Invalid(const vvl::DeviceState &dev_data) const { return InvalidRef(buffer_, dev_data); }
 
-VkDeviceSize vvl::BufferDescriptor::GetEffectiveRange() const {
+VkDeviceSize vvl::BufferDescriptor::GetEffectiveRange(const vvl::DeviceState &dev_data) const {
+    if (range_ != VK_WHOLE_SIZE) {
+        return range_;
+    }
     // The buffer can be null if using nullDescriptors, if that is the case, the size/range will not be accessed
-    if (range_ == VK_WHOLE_SIZE && buffer_state_) {
+    if (const vvl::Buffer *buffer_state = buffer_.Get(dev_data)) {
         // When range is VK_WHOLE_SIZE the effective range is calculated at vkUpdateDescriptorSets is by taking the size of buffer
         // minus the offset.
-        return buffer_state_->create_info.size - offset_;
-    } else {
-        return range_;
+        return buffer_state->create_info.size - offset_;
     }
+    return range_;
 }
 
 void vvl::TexelDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
                                        const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
-    auto buffer_view = dev_data.GetConstCastShared<vvl::BufferView>(update.pTexelBufferView[index]);
-    ReplaceStatePtr(set_state, buffer_view_state_, buffer_view, is_bindless);
+    ReplaceStateRef(set_state, dev_data, buffer_view_, update.pTexelBufferView[index], is_bindless);
 }
 
 void vvl::TexelDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data, const Descriptor &src,
                                       bool is_bindless, VkDescriptorType src_type) {
     if (src.GetClass() == DescriptorClass::Mutable) {
-        ReplaceStatePtr(set_state, buffer_view_state_, static_cast<const MutableDescriptor &>(src).GetSharedBufferViewState(),
+        ReplaceStateRef(set_state, dev_data, buffer_view_, static_cast<const MutableDescriptor &>(src).GetBufferViewRef(),
                         is_bindless);
         return;
     }
-    ReplaceStatePtr(set_state, buffer_view_state_, static_cast<const TexelDescriptor &>(src).buffer_view_state_, is_bindless);
+    ReplaceStateRef(set_state, dev_data, buffer_view_, static_cast<const TexelDescriptor &>(src).buffer_view_, is_bindless);
 }
 
-VkBufferView vvl::TexelDescriptor::GetBufferView() const {
-    return buffer_view_state_ ? buffer_view_state_->VkHandle() : VK_NULL_HANDLE;
+bool vvl::TexelDescriptor::AddParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    return AddParentTo(buffer_view_, state_object, dev_data);
 }
-
-bool vvl::TexelDescriptor::AddParent(StateObject *state_object) {
-    bool result = false;
-    if (buffer_view_state_) {
-        result = buffer_view_state_->AddParent(state_object);
-    }
-    return result;
-}
-void vvl::TexelDescriptor::RemoveParent(StateObject *state_object) {
-    if (buffer_view_state_) {
-        buffer_view_state_->RemoveParent(state_object);
-    }
+void vvl::TexelDescriptor::RemoveParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    RemoveParentFrom(buffer_view_, state_object, dev_data);
 }
 
-bool vvl::TexelDescriptor::Invalid() const { return !buffer_view_state_ || buffer_view_state_->Invalid(); }
+bool vvl::TexelDescriptor::Invalid(const vvl::DeviceState &dev_data) const { return InvalidRef(buffer_view_, dev_data); }
 
 void vvl::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
                                                        const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
@@ -1199,16 +1534,14 @@ void vvl::AccelerationStructureDescriptor::WriteUpdate(DescriptorSet &set_state,
 
     if (acc_info_partition_nv) {
         acc_partition_nv_ = acc_info_partition_nv->pAccelerationStructures[index];
-        ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_), is_bindless);
+        ReplaceStateRef(set_state, dev_data, acc_, acc_.VkHandle(), is_bindless);
         return;
     }
     is_khr_ = (acc_info != NULL);
     if (is_khr_) {
-        acc_ = acc_info->pAccelerationStructures[index];
-        ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_), is_bindless);
+        ReplaceStateRef(set_state, dev_data, acc_, acc_info->pAccelerationStructures[index], is_bindless);
     } else {
-        acc_nv_ = acc_info_nv->pAccelerationStructures[index];
-        ReplaceStatePtr(set_state, acc_state_nv_, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_), is_bindless);
+        ReplaceStateRef(set_state, dev_data, acc_nv_, acc_info_nv->pAccelerationStructures[index], is_bindless);
     }
 }
 
@@ -1218,62 +1551,48 @@ void vvl::AccelerationStructureDescriptor::CopyUpdate(DescriptorSet &set_state,
         auto &acc_desc = static_cast<const MutableDescriptor &>(src);
         is_khr_ = acc_desc.IsAccelerationStructureKHR();
         if (is_khr_) {
-            acc_ = acc_desc.GetAccelerationStructureKHR();
-            ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_), is_bindless);
+            ReplaceStateRef(set_state, dev_data, acc_, acc_desc.GetAccelerationStructureKHR(), is_bindless);
         } else {
-            acc_nv_ = acc_desc.GetAccelerationStructureNV();
-            ReplaceStatePtr(set_state, acc_state_nv_, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
-                            is_bindless);
+            ReplaceStateRef(set_state, dev_data, acc_nv_, acc_desc.GetAccelerationStructureNV(), is_bindless);
         }
         return;
     }
-    auto acc_desc = static_cast<const AccelerationStructureDescriptor &>(src);
+    auto &acc_desc = static_cast<const AccelerationStructureDescriptor &>(src);
     is_khr_ = acc_desc.is_khr_;
     if (is_khr_) {
-        acc_ = acc_desc.acc_;
-        ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_), is_bindless);
+        ReplaceStateRef(set_state, dev_data, acc_, acc_desc.acc_.VkHandle(), is_bindless);
     } else {
-        acc_nv_ = acc_desc.acc_nv_;
-        ReplaceStatePtr(set_state, acc_state_nv_, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_), is_bindless);
+        ReplaceStateRef(set_state, dev_data, acc_nv_, acc_desc.acc_nv_.VkHandle(), is_bindless);
     }
 }
 
-bool vvl::AccelerationStructureDescriptor::AddParent(StateObject *state_object) {
+bool vvl::AccelerationStructureDescriptor::AddParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
     bool result = false;
-    if (acc_state_) {
-        result |= acc_state_->AddParent(state_object);
-    }
-    if (acc_state_nv_) {
-        result |= acc_state_nv_->AddParent(state_object);
-    }
+    result |= AddParentTo(acc_, state_object, dev_data);
+    result |= AddParentTo(acc_nv_, state_object, dev_data);
     return result;
 }
-void vvl::AccelerationStructureDescriptor::RemoveParent(StateObject *state_object) {
-    if (acc_state_) {
-        acc_state_->RemoveParent(state_object);
-    }
-    if (acc_state_nv_) {
-        acc_state_nv_->RemoveParent(state_object);
-    }
+void vvl::AccelerationStructureDescriptor::RemoveParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    RemoveParentFrom(acc_, state_object, dev_data);
+    RemoveParentFrom(acc_nv_, state_object, dev_data);
 }
-bool vvl::AccelerationStructureDescriptor::Invalid() const {
+bool vvl::AccelerationStructureDescriptor::Invalid(const vvl::DeviceState &dev_data) const {
     if (is_khr_) {
-        return !acc_state_ || acc_state_->Invalid();
+        return InvalidRef(acc_, dev_data);
     } else {
-        return !acc_state_nv_ || acc_state_nv_->Invalid();
+        return InvalidRef(acc_nv_, dev_data);
     }
 }
 
 vvl::MutableDescriptor::MutableDescriptor()
-    : Descriptor(),
+    : Descriptor(DescriptorClass::Mutable),
       buffer_size_(0),
       active_descriptor_type_(VK_DESCRIPTOR_TYPE_MUTABLE_EXT),
       immutable_(false),
       image_layout_(VK_IMAGE_LAYOUT_UNDEFINED),
       offset_(0),
       range_(0),
-      is_khr_(false),
-      acc_(VK_NULL_HANDLE) {}
+      is_khr_(false) {}
 
 void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::DeviceState &dev_data,
                                          const VkWriteDescriptorSet &update, const uint32_t index, bool is_bindless) {
@@ -1281,20 +1600,17 @@ void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::De
     switch (DescriptorTypeToClass(update.descriptorType)) {
         case DescriptorClass::PlainSampler:
             if (!immutable_ && update.pImageInfo) {
-                ReplaceStatePtr(set_state, sampler_state_,
-                                dev_data.GetConstCastShared<vvl::Sampler>(update.pImageInfo[index].sampler), is_bindless);
+                ReplaceStateRef(set_state, dev_data, sampler_, update.pImageInfo[index].sampler, is_bindless);
             }
             break;
         case DescriptorClass::ImageSampler: {
             if (update.pImageInfo) {
                 const auto &image_info = update.pImageInfo[index];
                 if (!immutable_) {
-                    ReplaceStatePtr(set_state, sampler_state_, dev_data.GetConstCastShared<vvl::Sampler>(image_info.sampler),
-                                    is_bindless);
+                    ReplaceStateRef(set_state, dev_data, sampler_, image_info.sampler, is_bindless);
                 }
                 image_layout_ = image_info.imageLayout;
-                ReplaceStatePtr(set_state, image_view_state_, dev_data.GetConstCastShared<vvl::ImageView>(image_info.imageView),
-                                is_bindless);
+                ReplaceStateRef(set_state, dev_data, image_view_, image_info.imageView, is_bindless);
             }
             break;
         }
@@ -1302,8 +1618,7 @@ void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::De
             if (update.pImageInfo) {
                 const auto &image_info = update.pImageInfo[index];
                 image_layout_ = image_info.imageLayout;
-                ReplaceStatePtr(set_state, image_view_state_, dev_data.GetConstCastShared<vvl::ImageView>(image_info.imageView),
-                                is_bindless);
+                ReplaceStateRef(set_state, dev_data, image_view_, image_info.imageView, is_bindless);
             }
             break;
         }
@@ -1313,11 +1628,12 @@ void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::De
                 offset_ = buffer_info.offset;
                 range_ = buffer_info.range;
                 // can be null if using nullDescriptors
-                const auto buffer_state = dev_data.GetConstCastShared<vvl::Buffer>(update.pBufferInfo->buffer);
+                auto *buffer_state = const_cast<vvl::Buffer *>(dev_data.GetBorrowed<vvl::Buffer>(update.pBufferInfo->buffer));
                 if (buffer_state) {
                     buffer_size = buffer_state->create_info.size;
                 }
-                ReplaceStatePtr(set_state, buffer_state_, buffer_state, is_bindless);
+                ReplaceStateRef(set_state, dev_data, buffer_, BufferRef(update.pBufferInfo->buffer, buffer_state), buffer_state,
+                                is_bindless);
             }
             break;
         }
@@ -1325,19 +1641,22 @@ void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::De
             const auto *tensor_info = vku::FindStructInPNextChain<VkWriteDescriptorSetTensorARM>(update.pNext);
             assert(tensor_info);
             assert(index < tensor_info->tensorViewCount);
-            const auto tensor_view_state = dev_data.GetConstCastShared<vvl::TensorView>(tensor_info->pTensorViews[index]);
-            const auto &tensor_state = tensor_view_state->tensor_state;
-            ReplaceStatePtr(set_state, tensor_state_, tensor_state, is_bindless);
+            const auto *tensor_view_state = dev_data.GetBorrowed<vvl::TensorView>(tensor_info->pTensorViews[index]);
+            vvl::Tensor *tensor_state = tensor_view_state->tensor_state.get();
+            ReplaceStateRef(set_state, dev_data, tensor_, TensorRef(tensor_view_state->create_info.tensor, tensor_state),
+                            tensor_state, is_bindless);
             break;
         }
         case DescriptorClass::TexelBuffer: {
             if (update.pTexelBufferView) {
                 // can be null if using nullDescriptors
-                const auto buffer_view = dev_data.GetConstCastShared<vvl::BufferView>(update.pTexelBufferView[index]);
+                auto *buffer_view =
+                    const_cast<vvl::BufferView *>(dev_data.GetBorrowed<vvl::BufferView>(update.pTexelBufferView[index]));
                 if (buffer_view) {
                     buffer_size = buffer_view->buffer_state->create_info.size;
                 }
-                ReplaceStatePtr(set_state, buffer_view_state_, buffer_view, is_bindless);
+                ReplaceStateRef(set_state, dev_data, buffer_view_, BufferViewRef(update.pTexelBufferView[index], buffer_view),
+                                buffer_view, is_bindless);
             }
             break;
         }
@@ -1347,13 +1666,9 @@ void vvl::MutableDescriptor::WriteUpdate(DescriptorSet &set_state, const vvl::De
             assert(acc_info || acc_info_nv);
             is_khr_ = (acc_info != NULL);
             if (is_khr_) {
-                acc_ = acc_info->pAccelerationStructures[index];
-                ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_),
-                                is_bindless);
+                ReplaceStateRef(set_state, dev_data, acc_, acc_info->pAccelerationStructures[index], is_bindless);
             } else {
-                acc_nv_ = acc_info_nv->pAccelerationStructures[index];
-                ReplaceStatePtr(set_state, acc_state_nv_, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
-                                is_bindless);
+                ReplaceStateRef(set_state, dev_data, acc_nv_, acc_info_nv->pAccelerationStructures[index], is_bindless);
             }
             break;
         }
@@ -1372,51 +1687,48 @@ void vvl::MutableDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::Dev
         case DescriptorClass::PlainSampler: {
             auto &sampler_src = static_cast<const SamplerDescriptor &>(src);
             if (!immutable_) {
-                ReplaceStatePtr(set_state, sampler_state_, sampler_src.GetSharedSamplerState(), is_bindless);
+                ReplaceStateRef(set_state, dev_data, sampler_, sampler_src.GetSamplerRef(), is_bindless);
             }
             break;
         }
         case DescriptorClass::ImageSampler: {
             auto &image_src = static_cast<const ImageSamplerDescriptor &>(src);
             if (!immutable_) {
-                ReplaceStatePtr(set_state, sampler_state_, image_src.GetSharedSamplerState(), is_bindless);
+                ReplaceStateRef(set_state, dev_data, sampler_, image_src.GetSamplerRef(), is_bindless);
             }
 
             image_layout_ = image_src.GetImageLayout();
-            ReplaceStatePtr(set_state, image_view_state_, image_src.GetSharedImageViewState(), is_bindless);
+            ReplaceStateRef(set_state, dev_data, image_view_, image_src.GetImageViewRef(), is_bindless);
             break;
         }
         case DescriptorClass::Image: {
             auto &image_src = static_cast<const ImageDescriptor &>(src);
 
             image_layout_ = image_src.GetImageLayout();
-            ReplaceStatePtr(set_state, image_view_state_, image_src.GetSharedImageViewState(), is_bindless);
+            ReplaceStateRef(set_state, dev_data, image_view_, image_src.GetImageViewRef(), is_bindless);
             break;
         }
         case DescriptorClass::TexelBuffer: {
-            ReplaceStatePtr(set_state, buffer_view_state_, static_cast<const TexelDescriptor &>(src).GetSharedBufferViewState(),
+            ReplaceStateRef(set_state, dev_data, buffer_view_, static_cast<const TexelDescriptor &>(src).GetBufferViewRef(),
                             is_bindless);
-            buffer_size = buffer_view_state_ ? buffer_view_state_->Size() : vvl::kNoIndex32;
+            const vvl::BufferView *buffer_view_state = buffer_view_.Get(dev_data);
+            buffer_size = buffer_view_state ? buffer_view_state->Size() : vvl::kNoIndex32;
             break;
         }
         case DescriptorClass::GeneralBuffer: {
-            const auto buff_desc = static_cast<const BufferDescriptor &>(src);
+            const auto &buff_desc = static_cast<const BufferDescriptor &>(src);
             offset_ = buff_desc.GetOffset();
             range_ = buff_desc.GetRange();
-            ReplaceStatePtr(set_state, buffer_state_, buff_desc.GetSharedBufferState(), is_bindless);
+            ReplaceStateRef(set_state, dev_data, buffer_, buff_desc.GetBufferRef(), is_bindless);
             buffer_size = range_;
             break;
         }
         case DescriptorClass::AccelerationStructure: {
             auto &acc_desc = static_cast<const AccelerationStructureDescriptor &>(src);
             if (is_khr_) {
-                acc_ = acc_desc.GetAccelerationStructure();
-                ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_),
-                                is_bindless);
+                ReplaceStateRef(set_state, dev_data, acc_, acc_desc.GetAccelerationStructure(), is_bindless);
             } else {
-                acc_nv_ = acc_desc.GetAccelerationStructureNV();
-                ReplaceStatePtr(set_state, acc_state_nv_, dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_),
-                                is_bindless);
+                ReplaceStateRef(set_state, dev_data, acc_nv_, acc_desc.GetAccelerationStructureNV(), is_bindless);
             }
             break;
         }
@@ -1426,41 +1738,37 @@ void vvl::MutableDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::Dev
             switch (active_class) {
                 case DescriptorClass::PlainSampler: {
                     if (!immutable_) {
-                        ReplaceStatePtr(set_state, sampler_state_, mutable_src.GetSharedSamplerState(), is_bindless);
+                        ReplaceStateRef(set_state, dev_data, sampler_, mutable_src.sampler_, is_bindless);
                     }
                 } break;
                 case DescriptorClass::ImageSampler: {
                     if (!immutable_) {
-                        ReplaceStatePtr(set_state, sampler_state_, mutable_src.GetSharedSamplerState(), is_bindless);
+                        ReplaceStateRef(set_state, dev_data, sampler_, mutable_src.sampler_, is_bindless);
                     }
 
                     image_layout_ = mutable_src.GetImageLayout();
-                    ReplaceStatePtr(set_state, image_view_state_, mutable_src.GetSharedImageViewState(), is_bindless);
+                    ReplaceStateRef(set_state, dev_data, image_view_, mutable_src.image_view_, is_bindless);
                 } break;
                 case DescriptorClass::Image: {
                     image_layout_ = mutable_src.GetImageLayout();
-                    ReplaceStatePtr(set_state, image_view_state_, mutable_src.GetSharedImageViewState(), is_bindless);
+                    ReplaceStateRef(set_state, dev_data, image_view_, mutable_src.image_view_, is_bindless);
                 } break;
                 case DescriptorClass::GeneralBuffer: {
                     offset_ = mutable_src.GetOffset();
                     range_ = mutable_src.GetRange();
-                    ReplaceStatePtr(set_state, buffer_state_, mutable_src.GetSharedBufferState(), is_bindless);
+                    ReplaceStateRef(set_state, dev_data, buffer_, mutable_src.buffer_, is_bindless);
                 } break;
                 case DescriptorClass::TexelBuffer: {
-                    ReplaceStatePtr(set_state, buffer_view_state_, mutable_src.GetSharedBufferViewState(), is_bindless);
+                    ReplaceStateRef(set_state, dev_data, buffer_view_, mutable_src.buffer_view_, is_bindless);
                 } break;
                 case DescriptorClass::Tensor: {
-                    ReplaceStatePtr(set_state, tensor_state_, mutable_src.GetSharedTensor(), is_bindless);
+                    ReplaceStateRef(set_state, dev_data, tensor_, mutable_src.tensor_, is_bindless);
                 } break;
                 case DescriptorClass::AccelerationStructure: {
                     if (mutable_src.IsKHR()) {
-                        acc_ = mutable_src.GetAccelerationStructureKHR();
-                        ReplaceStatePtr(set_state, acc_state_, dev_data.GetConstCastShared<vvl::AccelerationStructureKHR>(acc_),
-                                        is_bindless);
+                        ReplaceStateRef(set_state, dev_data, acc_, mutable_src.GetAccelerationStructureKHR(), is_bindless);
                     } else {
-                        acc_nv_ = mutable_src.GetAccelerationStructureNV();
-                        ReplaceStatePtr(set_state, acc_state_nv_,
-                                        dev_data.GetConstCastShared<vvl::AccelerationStructureNV>(acc_nv_), is_bindless);
+                        ReplaceStateRef(set_state, dev_data, acc_nv_, mutable_src.GetAccelerationStructureNV(), is_bindless);
                     }
 
                 } break;
@@ -1476,7 +1784,7 @@ void vvl::MutableDescriptor::CopyUpdate(DescriptorSet &set_state, const vvl::Dev
             const auto tensor_desc = static_cast<const MutableDescriptor *>(&src);
             tensor_view_count_ = tensor_desc->GetTensorViewCount();
             tensor_views_ = tensor_desc->GetTensorViews();
-            ReplaceStatePtr(set_state, tensor_state_, std::shared_ptr<vvl::Tensor>(), is_bindless);
+            ReplaceStateRef(set_state, dev_data, tensor_, TensorRef(), is_bindless);
         } break;
         case vvl::DescriptorClass::InlineUniform:
         case vvl::DescriptorClass::Invalid:
@@ -1490,70 +1798,54 @@ void vvl::MutableDescriptor::SetDescriptorType(VkDescriptorType type, VkDeviceSi
     buffer_size_ = buffer_size;
 }
 
-VkDeviceSize vvl::MutableDescriptor::GetEffectiveRange() const {
+VkDeviceSize vvl::MutableDescriptor::GetEffectiveRange(const vvl::DeviceState &dev_data) const {
+    if (range_ != VK_WHOLE_SIZE) {
+        return range_;
+    }
     // The buffer can be null if using nullDescriptors, if that is the case, the size/range will not be accessed
-    if (range_ == VK_WHOLE_SIZE && buffer_state_) {
+    if (const vvl::Buffer *buffer_state = buffer_.Get(dev_data)) {
         // When range is VK_WHOLE_SIZE the effective range is calculated at vkUpdateDescriptorSets is by taking the size of buffer
         // minus the offset.
-        return buffer_state_->create_info.size - offset_;
-    } else {
-        return range_;
+        return buffer_state->create_info.size - offset_;
     }
+    return range_;
 }
 
-void vvl::MutableDescriptor::UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) {
+void vvl::MutableDescriptor::UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) const {
     const vvl::DescriptorClass active_class = ActiveClass();
     if (active_class == DescriptorClass::Image || active_class == DescriptorClass::ImageSampler) {
-        if (image_view_state_) {
-            cb_state.TrackImageViewFirstLayout(*image_view_state_, image_layout_);
+        if (auto *image_view_state = image_view_.Get(cb_state.dev_data)) {
+            cb_state.TrackImageViewFirstLayout(*image_view_state, image_layout_);
         }
     }
 }
 
-bool vvl::MutableDescriptor::AddParent(StateObject *state_object) {
+bool vvl::MutableDescriptor::AddParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
     bool result = false;
     const vvl::DescriptorClass active_class = ActiveClass();
     switch (active_class) {
         case DescriptorClass::PlainSampler:
-            if (sampler_state_) {
-                result |= sampler_state_->AddParent(state_object);
-            }
+            result |= AddParentTo(sampler_, state_object, dev_data);
             break;
         case DescriptorClass::ImageSampler:
-            if (sampler_state_) {
-                result |= sampler_state_->AddParent(state_object);
-            }
-            if (image_view_state_) {
-                result = image_view_state_->AddParent(state_object);
-            }
+            result |= AddParentTo(sampler_, state_object, dev_data);
+            result |= AddParentTo(image_view_, state_object, dev_data);
             break;
         case DescriptorClass::TexelBuffer:
-            if (buffer_view_state_) {
-                result = buffer_view_state_->AddParent(state_object);
-            }
+            result = AddParentTo(buffer_view_, state_object, dev_data);
             break;
         case DescriptorClass::Image:
-            if (image_view_state_) {
-                result = image_view_state_->AddParent(state_object);
-            }
+            result = AddParentTo(image_view_, state_object, dev_data);
             break;
         case DescriptorClass::GeneralBuffer:
-            if (buffer_state_) {
-                result = buffer_state_->AddParent(state_object);
-            }
+            result = AddParentTo(buffer_, state_object, dev_data);
             break;
         case DescriptorClass::AccelerationStructure:
-            if (acc_state_) {
-                result |= acc_state_->AddParent(state_object);
-            }
-            if (acc_state_nv_) {
-                result |= acc_state_nv_->AddParent(state_object);
-            }
+            result |= AddParentTo(acc_, state_object, dev_data);
+            result |= AddParentTo(acc_nv_, state_object, dev_data);
             break;
         case DescriptorClass::Tensor:
-            if (tensor_state_) {
-                result |= tensor_state_->AddParent(state_object);
-            }
+            result |= AddParentTo(tensor_, state_object, dev_data);
             break;
         case DescriptorClass::InlineUniform:
         case DescriptorClass::Mutable:
@@ -1562,55 +1854,41 @@ bool vvl::MutableDescriptor::AddParent(StateObject *state_object) {
     }
     return result;
 }
-void vvl::MutableDescriptor::RemoveParent(StateObject *state_object) {
-    if (sampler_state_) {
-        sampler_state_->RemoveParent(state_object);
-    }
-    if (image_view_state_) {
-        image_view_state_->RemoveParent(state_object);
-    }
-    if (buffer_view_state_) {
-        buffer_view_state_->RemoveParent(state_object);
-    }
-    if (buffer_state_) {
-        buffer_state_->RemoveParent(state_object);
-    }
-    if (acc_state_) {
-        acc_state_->RemoveParent(state_object);
-    }
-    if (acc_state_nv_) {
-        acc_state_nv_->RemoveParent(state_object);
-    }
-    if (tensor_state_) {
-        tensor_state_->RemoveParent(state_object);
-    }
+void vvl::MutableDescriptor::RemoveParent(StateObject *state_object, const vvl::DeviceState &dev_data) {
+    RemoveParentFrom(sampler_, state_object, dev_data);
+    RemoveParentFrom(image_view_, state_object, dev_data);
+    RemoveParentFrom(buffer_view_, state_object, dev_data);
+    RemoveParentFrom(buffer_, state_object, dev_data);
+    RemoveParentFrom(acc_, state_object, dev_data);
+    RemoveParentFrom(acc_nv_, state_object, dev_data);
+    RemoveParentFrom(tensor_, state_object, dev_data);
 }
 
-bool vvl::MutableDescriptor::Invalid() const {
+bool vvl::MutableDescriptor::Invalid(const vvl::DeviceState &dev_data) const {
     switch (ActiveClass()) {
         case DescriptorClass::PlainSampler:
-            return !sampler_state_ || sampler_state_->Destroyed();
+            return InvalidRef(sampler_, dev_data);
 
         case DescriptorClass::ImageSampler:
-            return !sampler_state_ || sampler_state_->Invalid() || !image_view_state_ || image_view_state_->Invalid();
+            return InvalidRef(sampler_, dev_data) || InvalidRef(image_view_, dev_data);
 
         case DescriptorClass::TexelBuffer:
-            return !buffer_view_state_ || buffer_view_state_->Invalid();
+            return InvalidRef(buffer_view_, dev_data);
 
         case DescriptorClass::Image:
-            return !image_view_state_ || image_view_state_->Invalid();
+            return InvalidRef(image_view_, dev_data);
 
         case DescriptorClass::GeneralBuffer:
-            return !buffer_state_ || buffer_state_->Invalid();
+            return InvalidRef(buffer_, dev_data);
 
         case DescriptorClass::AccelerationStructure:
             if (is_khr_) {
-                return !acc_state_ || acc_state_->Invalid();
+                return InvalidRef(acc_, dev_data);
             } else {
-                return !acc_state_nv_ || acc_state_nv_->Invalid();
+                return InvalidRef(acc_nv_, dev_data);
             }
         case DescriptorClass::Tensor:
-            return !tensor_state_ || tensor_state_->Invalid();
+            return InvalidRef(tensor_, dev_data);
 
         case DescriptorClass::InlineUniform:
         case DescriptorClass::Mutable:
@@ -1636,8 +1914,7 @@ void vvl::TensorDescriptor::WriteUpdate(DescriptorSet &set_state, const DeviceSt
     const auto tensor_info = reinterpret_cast<const VkWriteDescriptorSetTensorARM *>(update.pNext);
     tensor_view_count_ = tensor_info->tensorViewCount;
     tensor_views_ = tensor_info->pTensorViews;
-    auto tensor_view = dev_data.GetConstCastShared<vvl::TensorView>(tensor_views_[index]);
-    ReplaceStatePtr(set_state, tensor_view_state_, tensor_view, is_bindless);
+    ReplaceStateRef(set_state, dev_data, tensor_view_, tensor_views_[index], is_bindless);
 }
 
 void vvl::TensorDescriptor::CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &src,
@@ -1646,11 +1923,11 @@ void vvl::TensorDescriptor::CopyUpdate(DescriptorSet &set_state, const DeviceSta
         const auto tensor_desc = static_cast<const MutableDescriptor *>(&src);
         tensor_view_count_ = tensor_desc->GetTensorViewCount();
         tensor_views_ = tensor_desc->GetTensorViews();
-        ReplaceStatePtr(set_state, tensor_state_, std::shared_ptr<vvl::Tensor>(), is_bindless);
+        ReplaceStateRef(set_state, dev_data, tensor_, TensorRef(), is_bindless);
         return;
     }
     const auto tensor_desc = static_cast<const TensorDescriptor *>(&src);
     tensor_view_count_ = tensor_desc->tensor_view_count_;
     tensor_views_ = tensor_desc->tensor_views_;
-    ReplaceStatePtr(set_state, tensor_state_, std::shared_ptr<vvl::Tensor>(), is_bindless);
+    ReplaceStateRef(set_state, dev_data, tensor_, TensorRef(), is_bindless);
 }
@@ -27,7 +27,9 @@
 #include "containers/small_vector.h"
 #include "generated/vk_object_types.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
+#include <atomic>
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -41,6 +43,8 @@ void ClearDescriptorSetLayoutCanonicalIdDict();
 namespace vvl {
 class Sampler;
 class DescriptorSet;
+class DescriptorSetLayout;
+class DescriptorSetLayoutDef;
 class DeviceState;
 class CommandBuffer;
 class ImageView;
@@ -119,12 +123,42 @@ class DescriptorUpdateTemplate : public StateObject {
     const vku::safe_VkDescriptorUpdateTemplateCreateInfo safe_create_info;
     const VkDescriptorUpdateTemplateCreateInfo &create_info;
 
-    DescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
-        : StateObject(handle, kVulkanObjectTypeDescriptorUpdateTemplate),
-          safe_create_info(pCreateInfo),
-          create_info(*safe_create_info.ptr()) {}
+    // Descriptors written by an update entry into a single binding, the binding rollover is already resolved.
+    // For inline uniform blocks the count and array element are in bytes, acceleration structures always use a single run.
+    struct DecodeRun {
+        uint32_t binding;
+        uint32_t binding_index;  // index in the layout, GetBindingCount() if the entry rolled past the last binding
+        uint32_t array_element;
+        uint32_t count;
+        VkDescriptorType type;
+        size_t offset;  // of the first descriptor in pData
+        size_t stride;
+        bool rolled_over;  // continues the entry of the previous run in the next binding
+    };
+    using DecodePlan = std::vector<DecodeRun>;
+
+    // Only DESCRIPTOR_SET templates know their layout at creation, the plan of push descriptor templates is empty
+    const DecodePlan decode_plan;
+
+    DescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo,
+                             const DescriptorSetLayout *layout);
 
     VkDescriptorUpdateTemplate VkHandle() const { return handle_.Cast<VkDescriptorUpdateTemplate>(); };
+
+    // Walks the update entries over the layout bindings once, so updates do not have to look up the layout and bindings
+    static DecodePlan BuildDecodePlan(const VkDescriptorUpdateTemplateCreateInfo &create_info, const DescriptorSetLayout &layout);
+
+    // Push descriptor templates get their layout when recorded, the plan is built the first time a layout is used with them
+    std::shared_ptr<const DecodePlan> GetPushDecodePlan(const DescriptorSetLayout &layout) const;
+
+  private:
+    struct PushDecodePlan {
+        std::shared_ptr<const DescriptorSetLayoutDef> layout_def;  // keeps the key alive
+        std::shared_ptr<const DecodePlan> plan;
+    };
+    // Keyed on the canonical layout definition, most templates are only ever pushed with a single layout
+    mutable vvl::unordered_map<const DescriptorSetLayoutDef *, PushDecodePlan> push_decode_plans_;
+    mutable std::shared_mutex push_decode_plans_lock_;
 };
 
 // Index range for global indices below
@@ -411,7 +445,7 @@ class DescriptorSetLayout : public StateObject {
 };
 
 // Slightly broader than type, each c++ "class" will has a corresponding "DescriptorClass"
-enum class DescriptorClass {
+enum class DescriptorClass : uint8_t {
     PlainSampler,           // SAMPLER
     ImageSampler,           // COMBINED_IMAGE_SAMPLER
     Image,                  // SAMPLED_IMAGE/STORAGE_IMAGE/INPUT_ATTACHMENT
@@ -428,31 +462,76 @@ DescriptorClass DescriptorTypeToClass(VkDescriptorType type);
 
 class DescriptorSet;
 
-// Descriptor is an abstract base class from which many separate descriptor types are derived.
+// What a descriptor keeps of a state object it was written with. It holds no reference: the handle is kept for the handle
+// getters and error messages, and the id the state tracker gave the object (see StateObject::SetId()) is checked against the
+// object found in the device state map on lookup. Ids are never reused within a device, so once the object is destroyed, even if
+// the driver hands the same handle to a new object, Get() returns null.
+template <typename State, typename HandleType>
+class DescriptorStateRef {
+  public:
+    DescriptorStateRef() = default;
+    // state is null when the handle had no state object when written (VK_NULL_HANDLE with nullDescriptor)
+    DescriptorStateRef(HandleType handle, const State *state) : handle_(handle), id_(state ? state->GetId() : 0) {}
+
+    HandleType VkHandle() const { return handle_; }
+    uint32_t Id() const { return id_; }
+    bool Is(const StateObject &state_object) const { return id_ != 0 && id_ == state_object.GetId(); }
+
+    // Null if the handle is VK_NULL_HANDLE or the object written to the descriptor was destroyed. Like DeviceState::GetBorrowed()
+    // the pointer is only valid while the object is, use GetShared() to keep it past the current command.
+    State *Get(const DeviceState &dev_data) const;
+    std::shared_ptr<State> GetShared(const DeviceState &dev_data) const;
+
+    bool operator==(const DescriptorStateRef &other) const { return handle_ == other.handle_ && id_ == other.id_; }
+    bool operator!=(const DescriptorStateRef &other) const { return !(*this == other); }
+
+  private:
+    HandleType handle_{VK_NULL_HANDLE};
+    uint32_t id_{0};  // 0 is an invalid id
+};
+
+using SamplerRef = DescriptorStateRef<vvl::Sampler, VkSampler>;
+using ImageViewRef = DescriptorStateRef<vvl::ImageView, VkImageView>;
+using BufferRef = DescriptorStateRef<vvl::Buffer, VkBuffer>;
+using BufferViewRef = DescriptorStateRef<vvl::BufferView, VkBufferView>;
+using AccelerationStructureKHRRef = DescriptorStateRef<vvl::AccelerationStructureKHR, VkAccelerationStructureKHR>;
+using AccelerationStructureNVRef = DescriptorStateRef<vvl::AccelerationStructureNV, VkAccelerationStructureNV>;
+using TensorRef = DescriptorStateRef<vvl::Tensor, VkTensorARM>;
+using TensorViewRef = DescriptorStateRef<vvl::TensorView, VkTensorViewARM>;
+static_assert(sizeof(BufferRef) <= 16, "Descriptors are stored by value, keep their state references small");
+
+// Descriptor is the base class from which many separate descriptor types are derived.
 // This allows the WriteUpdate() and CopyUpdate() operations to be specialized per descriptor type, but all descriptors in a set can
 // be accessed via the common Descriptor.
+//
+// Bindings store their descriptors by value and bindless sets have hundreds of thousands of them, so there is no vtable. Each
+// descriptor knows its class instead, and the calls made through a Descriptor switch on it to the derived class.
 class Descriptor {
   public:
     static bool SupportsNotifyInvalidate() { return false; }
     static bool IsNotifyInvalidateType(VulkanObjectType) { return false; }
-    virtual void InvalidateNode(const std::shared_ptr<StateObject> &, bool) {}  // Most descriptor types will not call
-
-    Descriptor() {}
-    virtual ~Descriptor() {}
-    virtual void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &, const uint32_t,
-                             bool is_bindless) = 0;
-    virtual void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &, bool is_bindless,
-                            VkDescriptorType type) = 0;
-    virtual DescriptorClass GetClass() const = 0;
+    void InvalidateNode(const std::shared_ptr<StateObject> &invalid_node, bool unlink);  // Most descriptor types will not call
+
+    void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &update,
+                     const uint32_t index, bool is_bindless);
+    void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &src, bool is_bindless,
+                    VkDescriptorType type);
+    DescriptorClass GetClass() const { return descriptor_class_; }
     // Special fast-path check for SamplerDescriptors that are immutable
-    virtual bool IsImmutableSampler() const { return false; };
-    virtual bool AddParent(StateObject *state_object) { return false; }
-    virtual void RemoveParent(StateObject *state_object) {}
+    bool IsImmutableSampler() const;
+    bool AddParent(StateObject *state_object, const DeviceState &dev_data);
+    void RemoveParent(StateObject *state_object, const DeviceState &dev_data);
 
-    virtual void UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) {}
+    void UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) const;
 
     // return true if resources used by this descriptor are destroyed or otherwise missing
-    virtual bool Invalid() const { return false; }
+    bool Invalid(const DeviceState &dev_data) const;
+
+  protected:
+    explicit Descriptor(DescriptorClass descriptor_class) : descriptor_class_(descriptor_class) {}
+
+    // Derived classes declare their small members first, so that GCC and Clang put them in the padding after this
+    DescriptorClass descriptor_class_;
 };
 
 // All Dynamic descriptor types
@@ -467,27 +546,25 @@ inline bool IsBufferDescriptor(VkDescriptorType type) {
 
 class SamplerDescriptor : public Descriptor {
   public:
-    SamplerDescriptor() = default;
-    DescriptorClass GetClass() const override { return DescriptorClass::PlainSampler; }
+    SamplerDescriptor() : Descriptor(DescriptorClass::PlainSampler) {}
     void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &, const uint32_t,
-                     bool is_bindless) override;
+                     bool is_bindless);
     void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &, bool is_bindless,
-                    VkDescriptorType type) override;
-    virtual bool IsImmutableSampler() const override { return immutable_; };
-    VkSampler GetSampler() const;
+                    VkDescriptorType type);
+    bool IsImmutableSampler() const { return immutable_; };
+    VkSampler GetSampler() const { return sampler_.VkHandle(); }
 
-    void SetImmutableSampler(std::shared_ptr<vvl::Sampler> &&state);
-    const vvl::Sampler *GetSamplerState() const { return sampler_state_.get(); }
-    vvl::Sampler *GetSamplerState() { return sampler_state_.get(); }
-    std::shared_ptr<vvl::Sampler> GetSharedSamplerState() const { return sampler_state_; }
+    void SetImmutableSampler(const SamplerRef &sampler);
+    const SamplerRef &GetSamplerRef() const { return sampler_; }
+    vvl::Sampler *GetSamplerState(const DeviceState &dev_data) const { return sampler_.Get(dev_data); }
 
-    bool AddParent(StateObject *state_object) override;
-    void RemoveParent(StateObject *state_object) override;
-    bool Invalid() const override;
+    bool AddParent(StateObject *state_object, const DeviceState &dev_data);
+    void RemoveParent(StateObject *state_object, const DeviceState &dev_data);
+    bool Invalid(const DeviceState &dev_data) const;
 
   private:
     bool immutable_{false};
-    std::shared_ptr<vvl::Sampler> sampler_state_;
+    SamplerRef sampler_;
 };
 
 class ImageDescriptor : public Descriptor {
@@ -496,192 +573,191 @@ class ImageDescriptor : public Descriptor {
     static bool IsNotifyInvalidateType(const VulkanObjectType node_type) {
         return node_type == VulkanObjectType::kVulkanObjectTypeImageView;
     }
-    ImageDescriptor() = default;
-    DescriptorClass GetClass() const override { return DescriptorClass::Image; }
+    ImageDescriptor() : Descriptor(DescriptorClass::Image) {}
     void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &, const uint32_t,
-                     bool is_bindless) override;
+                     bool is_bindless);
     void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &, bool is_bindless,
-                    VkDescriptorType type) override;
-    void UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) override;
-    VkImageView GetImageView() const;
-    const vvl::ImageView *GetImageViewState() const { return image_view_state_.get(); }
-    vvl::ImageView *GetImageViewState() { return image_view_state_.get(); }
-    std::shared_ptr<vvl::ImageView> GetSharedImageViewState() const { return image_view_state_; }
+                    VkDescriptorType type);
+    void UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) const;
+    VkImageView GetImageView() const { return image_view_.VkHandle(); }
+    const ImageViewRef &GetImageViewRef() const { return image_view_; }
+    vvl::ImageView *GetImageViewState(const DeviceState &dev_data) const { return image_view_.Get(dev_data); }
     VkImageLayout GetImageLayout() const { return image_layout_; }
 
-    bool AddParent(StateObject *state_object) override;
-    void RemoveParent(StateObject *state_object) override;
-    void InvalidateNode(const std::shared_ptr<StateObject> &invalid_node, bool unlink) override;
-    bool Invalid() const override;
+    bool AddParent(StateObject *state_object, const DeviceState &dev_data);
+    void RemoveParent(StateObject *state_object, const DeviceState &dev_data);
+    void InvalidateNode(const std::shared_ptr<StateObject> &invalid_node, bool unlink);
+    bool Invalid(const DeviceState &dev_data) const;
 
   protected:
-    bool ComputeInvalid() const;
-    void UpdateKnownValidView(bool is_bindless);
+    explicit ImageDescriptor(DescriptorClass descriptor_class) : Descriptor(descriptor_class) {}
+    bool ComputeInvalid(const DeviceState &dev_data) const;
+    void UpdateKnownValidView(const DeviceState &dev_data, bool is_bindless);
 
-    std::shared_ptr<vvl::ImageView> image_view_state_;
-    VkImageLayout image_layout_{VK_IMAGE_LAYOUT_UNDEFINED};
     bool known_valid_view_ = false;
+    VkImageLayout image_layout_{VK_IMAGE_LAYOUT_UNDEFINED};
+    ImageViewRef image_view_;
 };
 
 class TensorDescriptor : public Descriptor {
   public:
-    TensorDescriptor() = default;
-    DescriptorClass GetClass() const override { return DescriptorClass::Tensor; }
+    TensorDescriptor() : Descriptor(DescriptorClass::Tensor) {}
     void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &update,
-                     const uint32_t index, bool is_bindless) override;
+                     const uint32_t index, bool is_bindless);
     void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &src, bool is_bindless,
-                    VkDescriptorType type) override;
+                    VkDescriptorType type);
     uint32_t GetTensorViewCount() const { return tensor_view_count_; }
     const VkTensorViewARM *GetTensorViews() const { return tensor_views_; }
-    const vvl::TensorView *GetTensorViewState() const { return tensor_view_state_.get(); }
-    const vvl::Tensor *GetTensorState() const { return tensor_state_.get(); }
+    const TensorViewRef &GetTensorViewRef() const { return tensor_view_; }
+    const vvl::TensorView *GetTensorViewState(const DeviceState &dev_data) const { return tensor_view_.Get(dev_data); }
+    const vvl::Tensor *GetTensorState(const DeviceState &dev_data) const { return tensor_.Get(dev_data); }
 
   private:
     uint32_t tensor_view_count_{0};
     const VkTensorViewARM *tensor_views_{VK_NULL_HANDLE};
-    std::shared_ptr<vvl::Tensor> tensor_state_;
-    std::shared_ptr<vvl::TensorView> tensor_view_state_;
+    TensorRef tensor_;
+    TensorViewRef tensor_view_;
 };
 
 class ImageSamplerDescriptor : public ImageDescriptor {
   public:
-    ImageSamplerDescriptor() = default;
-    DescriptorClass GetClass() const override { return DescriptorClass::ImageSampler; }
+    ImageSamplerDescriptor() : ImageDescriptor(DescriptorClass::ImageSampler) {}
     void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &, const uint32_t,
-                     bool is_bindless) override;
+                     bool is_bindless);
     void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &, bool is_bindless,
-                    VkDescriptorType type) override;
-    virtual bool IsImmutableSampler() const override { return immutable_; };
-    VkSampler GetSampler() const;
-    void SetImmutableSampler(std::shared_ptr<vvl::Sampler> &&state);
-    const vvl::Sampler *GetSamplerState() const { return sampler_state_.get(); }
-    vvl::Sampler *GetSamplerState() { return sampler_state_.get(); }
-    std::shared_ptr<vvl::Sampler> GetSharedSamplerState() const { return sampler_state_; }
-
-    bool AddParent(StateObject *state_object) override;
-    void RemoveParent(StateObject *state_object) override;
-    bool Invalid() const override;
+                    VkDescriptorType type);
+    bool IsImmutableSampler() const { return immutable_; };
+    VkSampler GetSampler() const { return sampler_.VkHandle(); }
+    void SetImmutableSampler(const SamplerRef &sampler);
+    const SamplerRef &GetSamplerRef() const { return sampler_; }
+    vvl::Sampler *GetSamplerState(const DeviceState &dev_data) const { return sampler_.Get(dev_data); }
+
+    bool AddParent(StateObject *state_object, const DeviceState &dev_data);
+    void RemoveParent(StateObject *state_object, const DeviceState &dev_data);
+    bool Invalid(const DeviceState &dev_data) const;
 
   private:
-    std::shared_ptr<vvl::Sampler> sampler_state_;
+    SamplerRef sampler_;
     bool immutable_{false};
 };
 
 class TexelDescriptor : public Descriptor {
   public:
-    TexelDescriptor() = default;
-    DescriptorClass GetClass() const override { return DescriptorClass::TexelBuffer; }
+    TexelDescriptor() : Descriptor(DescriptorClass::TexelBuffer) {}
     void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &, const uint32_t,
-                     bool is_bindless) override;
+                     bool is_bindless);
     void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &, bool is_bindless,
-                    VkDescriptorType type) override;
-    VkBufferView GetBufferView() const;
-    const vvl::BufferView *GetBufferViewState() const { return buffer_view_state_.get(); }
-    vvl::BufferView *GetBufferViewState() { return buffer_view_state_.get(); }
-    std::shared_ptr<vvl::BufferView> GetSharedBufferViewState() const { return buffer_view_state_; }
+                    VkDescriptorType type);
+    VkBufferView GetBufferView() const { return buffer_view_.VkHandle(); }
+    const BufferViewRef &GetBufferViewRef() const { return buffer_view_; }
+    vvl::BufferView *GetBufferViewState(const DeviceState &dev_data) const { return buffer_view_.Get(dev_data); }
 
-    bool AddParent(StateObject *state_object) override;
-    void RemoveParent(StateObject *state_object) override;
-    bool Invalid() const override;
+    bool AddParent(StateObject *state_object, const DeviceState &dev_data);
+    void RemoveParent(StateObject *state_object, const DeviceState &dev_data);
+    bool Invalid(const DeviceState &dev_data) const;
 
   private:
-    std::shared_ptr<vvl::BufferView> buffer_view_state_;
+    BufferViewRef buffer_view_;
 };
 
 class BufferDescriptor : public Descriptor {
   public:
-    BufferDescriptor() = default;
-    DescriptorClass GetClass() const override { return DescriptorClass::GeneralBuffer; }
+    BufferDescriptor() : Descriptor(DescriptorClass::GeneralBuffer) {}
     void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &, const uint32_t,
-                     bool is_bindless) override;
+                     bool is_bindless);
     void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &, bool is_bindless,
-                    VkDescriptorType type) override;
-    VkBuffer GetBuffer() const;
-    const vvl::Buffer *GetBufferState() const { return buffer_state_.get(); }
-    vvl::Buffer *GetBufferState() { return buffer_state_.get(); }
-    std::shared_ptr<vvl::Buffer> GetSharedBufferState() const { return buffer_state_; }
+                    VkDescriptorType type);
+    VkBuffer GetBuffer() const { return buffer_.VkHandle(); }
+    const BufferRef &GetBufferRef() const { return buffer_; }
+    vvl::Buffer *GetBufferState(const DeviceState &dev_data) const { return buffer_.Get(dev_data); }
     VkDeviceSize GetOffset() const { return offset_; }
     VkDeviceSize GetRange() const { return range_; }
-    VkDeviceSize GetEffectiveRange() const;
+    VkDeviceSize GetEffectiveRange(const DeviceState &dev_data) const;
 
-    bool AddParent(StateObject *state_object) override;
-    void RemoveParent(StateObject *state_object) override;
-    bool Invalid() const override;
+    bool AddParent(StateObject *state_object, const DeviceState &dev_data);
+    void RemoveParent(StateObject *state_object, const DeviceState &dev_data);
+    bool Invalid(const DeviceState &dev_data) const;
 
   private:
     VkDeviceSize offset_{0};
     VkDeviceSize range_{0};
-    std::shared_ptr<vvl::Buffer> buffer_state_;
+    BufferRef buffer_;
 };
 
 class InlineUniformDescriptor : public Descriptor {
   public:
-    InlineUniformDescriptor() = default;
-    DescriptorClass GetClass() const override { return DescriptorClass::InlineUniform; }
+    InlineUniformDescriptor() : Descriptor(DescriptorClass::InlineUniform) {}
     void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &, const uint32_t,
-                     bool is_bindless) override {}
+                     bool is_bindless) {}
     void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &, bool is_bindless,
-                    VkDescriptorType type) override {}
+                    VkDescriptorType type) {}
 };
 
 class AccelerationStructureDescriptor : public Descriptor {
   public:
-    AccelerationStructureDescriptor() = default;
-    DescriptorClass GetClass() const override { return DescriptorClass::AccelerationStructure; }
+    AccelerationStructureDescriptor() : Descriptor(DescriptorClass::AccelerationStructure) {}
     void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &, const uint32_t,
-                     bool is_bindless) override;
-    VkAccelerationStructureKHR GetAccelerationStructure() const { return acc_; }
-    const vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR() const { return acc_state_.get(); }
-    vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR() { return acc_state_.get(); }
-    VkAccelerationStructureNV GetAccelerationStructureNV() const { return acc_nv_; }
-    const vvl::AccelerationStructureNV *GetAccelerationStructureStateNV() const { return acc_state_nv_.get(); }
-    vvl::AccelerationStructureNV *GetAccelerationStructureStateNV() { return acc_state_nv_.get(); }
+                     bool is_bindless);
+    VkAccelerationStructureKHR GetAccelerationStructure() const { return acc_.VkHandle(); }
+    const AccelerationStructureKHRRef &GetAccelerationStructureRefKHR() const { return acc_; }
+    vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR(const DeviceState &dev_data) const {
+        return acc_.Get(dev_data);
+    }
+    VkAccelerationStructureNV GetAccelerationStructureNV() const { return acc_nv_.VkHandle(); }
+    const AccelerationStructureNVRef &GetAccelerationStructureRefNV() const { return acc_nv_; }
+    vvl::AccelerationStructureNV *GetAccelerationStructureStateNV(const DeviceState &dev_data) const {
+        return acc_nv_.Get(dev_data);
+    }
     void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &, bool is_bindless,
-                    VkDescriptorType type) override;
+                    VkDescriptorType type);
     bool IsKHR() const { return is_khr_; }
 
-    bool AddParent(StateObject *state_object) override;
-    void RemoveParent(StateObject *state_object) override;
-    bool Invalid() const override;
+    bool AddParent(StateObject *state_object, const DeviceState &dev_data);
+    void RemoveParent(StateObject *state_object, const DeviceState &dev_data);
+    bool Invalid(const DeviceState &dev_data) const;
 
   private:
     bool is_khr_{false};
-    VkAccelerationStructureKHR acc_{VK_NULL_HANDLE};
-    std::shared_ptr<vvl::AccelerationStructureKHR> acc_state_;
-    VkAccelerationStructureNV acc_nv_{VK_NULL_HANDLE};
-    std::shared_ptr<vvl::AccelerationStructureNV> acc_state_nv_;
+    AccelerationStructureKHRRef acc_;
+    AccelerationStructureNVRef acc_nv_;
     VkDeviceAddress acc_partition_nv_{0};
-    std::shared_ptr<VkDeviceAddress> acc_state_partition_nv_;
 };
 
 class MutableDescriptor : public Descriptor {
   public:
     MutableDescriptor();
-    DescriptorClass GetClass() const override { return DescriptorClass::Mutable; }
     void WriteUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const VkWriteDescriptorSet &, const uint32_t,
-                     bool is_bindless) override;
+                     bool is_bindless);
     void CopyUpdate(DescriptorSet &set_state, const DeviceState &dev_data, const Descriptor &, bool is_bindless,
-                    VkDescriptorType type) override;
+                    VkDescriptorType type);
 
     void SetDescriptorType(VkDescriptorType type, VkDeviceSize buffer_size);
     VkDeviceSize GetBufferSize() const { return buffer_size_; }
 
-    std::shared_ptr<vvl::Sampler> GetSharedSamplerState() const { return sampler_state_; }
-    std::shared_ptr<vvl::ImageView> GetSharedImageViewState() const { return image_view_state_; }
+    const SamplerRef &GetSamplerRef() const { return sampler_; }
+    vvl::Sampler *GetSamplerState(const DeviceState &dev_data) const { return sampler_.Get(dev_data); }
+    const ImageViewRef &GetImageViewRef() const { return image_view_; }
+    vvl::ImageView *GetImageViewState(const DeviceState &dev_data) const { return image_view_.Get(dev_data); }
     VkImageLayout GetImageLayout() const { return image_layout_; }
-    std::shared_ptr<vvl::Buffer> GetSharedBufferState() const { return buffer_state_; }
+    const BufferRef &GetBufferRef() const { return buffer_; }
+    vvl::Buffer *GetBufferState(const DeviceState &dev_data) const { return buffer_.Get(dev_data); }
     VkDeviceSize GetOffset() const { return offset_; }
     VkDeviceSize GetRange() const { return range_; }
-    VkDeviceSize GetEffectiveRange() const;
-    std::shared_ptr<vvl::BufferView> GetSharedBufferViewState() const { return buffer_view_state_; }
-    std::shared_ptr<vvl::Tensor> GetSharedTensor() const { return tensor_state_; }
-    std::shared_ptr<vvl::TensorView> GetSharedTensorView() const { return tensor_view_state_; }
-    VkAccelerationStructureKHR GetAccelerationStructureKHR() const { return acc_; }
-    const vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR() const { return acc_state_.get(); }
-    vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR() { return acc_state_.get(); }
-    VkAccelerationStructureNV GetAccelerationStructureNV() const { return acc_nv_; }
-    const vvl::AccelerationStructureNV *GetAccelerationStructureStateNV() const { return acc_state_nv_.get(); }
-    vvl::AccelerationStructureNV *GetAccelerationStructureStateNV() { return acc_state_nv_.get(); }
+    VkDeviceSize GetEffectiveRange(const DeviceState &dev_data) const;
+    const BufferViewRef &GetBufferViewRef() const { return buffer_view_; }
+    vvl::BufferView *GetBufferViewState(const DeviceState &dev_data) const { return buffer_view_.Get(dev_data); }
+    const TensorRef &GetTensorRef() const { return tensor_; }
+    const TensorViewRef &GetTensorViewRef() const { return tensor_view_; }
+    VkAccelerationStructureKHR GetAccelerationStructureKHR() const { return acc_.VkHandle(); }
+    const AccelerationStructureKHRRef &GetAccelerationStructureRefKHR() const { return acc_; }
+    vvl::AccelerationStructureKHR *GetAccelerationStructureStateKHR(const DeviceState &dev_data) const {
+        return acc_.Get(dev_data);
+    }
+    VkAccelerationStructureNV GetAccelerationStructureNV() const { return acc_nv_.VkHandle(); }
+    const AccelerationStructureNVRef &GetAccelerationStructureRefNV() const { return acc_nv_; }
+    vvl::AccelerationStructureNV *GetAccelerationStructureStateNV(const DeviceState &dev_data) const {
+        return acc_nv_.Get(dev_data);
+    }
     // Returns true if there is a stored KHR acceleration structure and false if there is a stored NV acceleration structure.
     // Asserts that there is only one of the two.
     bool IsAccelerationStructureKHR() const {
@@ -690,15 +766,15 @@ class MutableDescriptor : public Descriptor {
         return acc_khr != VK_NULL_HANDLE;
     }
 
-    void UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) override;
+    void UpdateImageLayoutDrawState(vvl::CommandBuffer &cb_state) const;
     uint32_t GetTensorViewCount() const { return tensor_view_count_; }
     const VkTensorViewARM *GetTensorViews() const { return tensor_views_; }
 
-    bool AddParent(StateObject *state_object) override;
-    void RemoveParent(StateObject *state_object) override;
+    bool AddParent(StateObject *state_object, const DeviceState &dev_data);
+    void RemoveParent(StateObject *state_object, const DeviceState &dev_data);
 
     bool IsKHR() const { return is_khr_; }
-    bool Invalid() const override;
+    bool Invalid(const DeviceState &dev_data) const;
 
     VkDescriptorType ActiveType() const { return active_descriptor_type_; }
     DescriptorClass ActiveClass() const { return DescriptorTypeToClass(active_descriptor_type_); }
@@ -709,27 +785,25 @@ class MutableDescriptor : public Descriptor {
 
     // Sampler and ImageSampler Descriptor
     bool immutable_{false};
-    std::shared_ptr<vvl::Sampler> sampler_state_;
+    SamplerRef sampler_;
     // Image Descriptor
-    std::shared_ptr<vvl::ImageView> image_view_state_;
+    ImageViewRef image_view_;
     VkImageLayout image_layout_{VK_IMAGE_LAYOUT_UNDEFINED};
     // Texel Descriptor
-    std::shared_ptr<vvl::BufferView> buffer_view_state_;
+    BufferViewRef buffer_view_;
     // Buffer Descriptor
     VkDeviceSize offset_{0};
     VkDeviceSize range_{0};
-    std::shared_ptr<vvl::Buffer> buffer_state_;
+    BufferRef buffer_;
     // Acceleration Structure Descriptor
     bool is_khr_{false};
-    VkAccelerationStructureKHR acc_{VK_NULL_HANDLE};
-    std::shared_ptr<vvl::AccelerationStructureKHR> acc_state_;
-    VkAccelerationStructureNV acc_nv_{VK_NULL_HANDLE};
-    std::shared_ptr<vvl::AccelerationStructureNV> acc_state_nv_;
+    AccelerationStructureKHRRef acc_;
+    AccelerationStructureNVRef acc_nv_;
     // Tensor Descriptor
     uint32_t tensor_view_count_{0};
     const VkTensorViewARM *tensor_views_{VK_NULL_HANDLE};
-    std::shared_ptr<vvl::TensorView> tensor_view_state_;
-    std::shared_ptr<vvl::Tensor> tensor_state_;
+    TensorViewRef tensor_view_;
+    TensorRef tensor_;
 };
 
 // We will want to build this map and list of layouts once in order to record in the state tracker at PostCallRecord time.
@@ -741,6 +815,51 @@ struct AllocateDescriptorSetsData {
 // "Perform" does the update with the assumption that ValidateUpdateDescriptorSets() has passed for the given update
 void PerformUpdateDescriptorSets(DeviceState &, uint32_t, const VkWriteDescriptorSet *, uint32_t, const VkCopyDescriptorSet *);
 
+// One bit per descriptor of a binding, set once the descriptor has been written.
+// Bindless bindings can hold millions of descriptors and apps usually write a few of them, so the bits are packed and
+// ForEachSet() skips the words with nothing written.
+class DescriptorUpdatedBits {
+  public:
+    explicit DescriptorUpdatedBits(uint32_t count) : count_(count), words_((count + 63) / 64, 0) {}
+
+    uint32_t size() const { return count_; }
+
+    bool operator[](uint32_t index) const {
+        assert(index < count_);
+        return (words_[index >> 6] & BitMask(index)) != 0;
+    }
+
+    void set(uint32_t index, bool value = true) {
+        assert(index < count_);
+        if (value) {
+            words_[index >> 6] |= BitMask(index);
+        } else {
+            words_[index >> 6] &= ~BitMask(index);
+        }
+    }
+
+    template <typename Fn>
+    void ForEachSet(Fn &&fn) const {
+        for (uint32_t word_index = 0; word_index < words_.size(); ++word_index) {
+            const uint64_t word = words_[word_index];
+            if (word == 0) {
+                continue;
+            }
+            for (uint32_t bit = 0; bit < 64; ++bit) {
+                if (word & (uint64_t(1) << bit)) {
+                    fn((word_index << 6) | bit);
+                }
+            }
+        }
+    }
+
+  private:
+    static uint64_t BitMask(uint32_t index) { return uint64_t(1) << (index & 63); }
+
+    const uint32_t count_;
+    small_vector<uint64_t, 1, uint32_t> words_;
+};
+
 class DescriptorBinding {
   public:
     using NodeList = StateObject::NodeList;
@@ -752,15 +871,16 @@ class DescriptorBinding {
           binding_flags(binding_flags_),
           count(count_),
           has_immutable_samplers(create_info.pImmutableSamplers != nullptr),
-          updated(count_, false) {}
+          updated(count_) {}
     virtual ~DescriptorBinding() {}
 
-    virtual void AddParent(DescriptorSet *ds) = 0;
-    virtual void RemoveParent(DescriptorSet *ds) = 0;
+    virtual void AddParent(DescriptorSet *ds, const DeviceState &dev_data) = 0;
+    virtual void RemoveParent(DescriptorSet *ds, const DeviceState &dev_data) = 0;
     virtual void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) = 0;
 
     virtual const Descriptor *GetDescriptor(const uint32_t index) const = 0;
-    virtual Descriptor *GetDescriptor(const uint32_t index) = 0;
+    // Only for writing the descriptor, it constructs the page of a paged binding (see DescriptorStorage)
+    virtual Descriptor *GetDescriptorForWrite(const uint32_t index) = 0;
 
     bool IsVariableCount() const { return (binding_flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) != 0; }
 
@@ -781,36 +901,121 @@ class DescriptorBinding {
     const VkDescriptorBindingFlags binding_flags;
     const uint32_t count;
     const bool has_immutable_samplers;
-    small_vector<bool, 1, uint32_t> updated;
+    DescriptorUpdatedBits updated;
+};
+
+// Holds the descriptors of a binding.
+//
+// PARTIALLY_BOUND and VARIABLE_DESCRIPTOR_COUNT bindings are how bindless arrays of up to millions of descriptors are declared,
+// and apps usually write a small part of them. Large ones are paged: a page of descriptors is only constructed the first time
+// one of them is accessed through a non-const reference (a write), and reading from a missing page returns a default
+// descriptor, which is what the page would have held. Pages are published like in vvl::slot_table, draw time validation can
+// read a set that is bound while an UPDATE_AFTER_BIND binding is being written.
+//
+// Every other binding keeps its descriptors in a small_vector, most have a single descriptor which is then inline.
+template <typename T>
+class DescriptorStorage {
+  public:
+    static constexpr uint32_t kPageBits = 10;
+    static constexpr uint32_t kPageSize = 1u << kPageBits;
+
+    DescriptorStorage(uint32_t count, bool paged) : count_(count) {
+        if (paged && count > kPageSize) {
+            page_count_ = (count + kPageSize - 1) >> kPageBits;
+            pages_ = std::make_unique<std::atomic<T *>[]>(page_count_);
+            for (uint32_t i = 0; i < page_count_; ++i) {
+                pages_[i].store(nullptr, std::memory_order_relaxed);
+            }
+        } else {
+            dense_.resize(count);
+        }
+    }
+    DescriptorStorage(const DescriptorStorage &) = delete;
+    DescriptorStorage &operator=(const DescriptorStorage &) = delete;
+    ~DescriptorStorage() {
+        for (uint32_t i = 0; i < page_count_; ++i) {
+            delete[] pages_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t size() const { return count_; }
+    bool IsPaged() const { return page_count_ != 0; }
+
+    const T &operator[](uint32_t index) const {
+        assert(index < count_);
+        if (!IsPaged()) {
+            return dense_[index];
+        }
+        const T *page = pages_[index >> kPageBits].load(std::memory_order_acquire);
+        if (!page) {
+            static const T kNotWritten;
+            return kNotWritten;
+        }
+        return page[index & kPageMask];
+    }
+
+    // Constructs the page holding the descriptor if needed, reading must go through operator[] so that it does not add pages
+    T &GetForWrite(uint32_t index) {
+        assert(index < count_);
+        if (!IsPaged()) {
+            return dense_[index];
+        }
+        return GetOrCreatePage(index >> kPageBits)[index & kPageMask];
+    }
+
+  private:
+    static constexpr uint32_t kPageMask = kPageSize - 1;
+
+    T *GetOrCreatePage(uint32_t page_index) {
+        std::atomic<T *> &page_ptr = pages_[page_index];
+        T *page = page_ptr.load(std::memory_order_acquire);
+        if (!page) {
+            // The last page only holds what is left of the binding
+            const uint32_t page_size = std::min(kPageSize, count_ - (page_index << kPageBits));
+            T *new_page = new T[page_size];
+            if (page_ptr.compare_exchange_strong(page, new_page, std::memory_order_acq_rel)) {
+                page = new_page;
+            } else {
+                delete[] new_page;  // another thread added the page first
+            }
+        }
+        return page;
+    }
+
+    const uint32_t count_;
+    uint32_t page_count_ = 0;
+    small_vector<T, 1, uint32_t> dense_;
+    std::unique_ptr<std::atomic<T *>[]> pages_;
 };
 
 template <typename T>
 class DescriptorBindingImpl : public DescriptorBinding {
   public:
     DescriptorBindingImpl(const VkDescriptorSetLayoutBinding &create_info, uint32_t count_, VkDescriptorBindingFlags binding_flags_)
-        : DescriptorBinding(create_info, count_, binding_flags_), descriptors(count_) {}
+        : DescriptorBinding(create_info, count_, binding_flags_),
+          descriptors(count_, (binding_flags_ & (VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+                                                 VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT)) != 0 &&
+                                  !create_info.pImmutableSamplers) {}
 
     const Descriptor *GetDescriptor(const uint32_t index) const override { return index < count ? &descriptors[index] : nullptr; }
 
-    Descriptor *GetDescriptor(const uint32_t index) override { return index < count ? &descriptors[index] : nullptr; }
+    Descriptor *GetDescriptorForWrite(const uint32_t index) override {
+        return index < count ? &descriptors.GetForWrite(index) : nullptr;
+    }
 
     template <typename Fn>
     void ForAllUpdated(Fn &&op) {
-        auto size = updated.size();
-        for (uint32_t i = 0; i < size; i++) {
-            if (updated[i] != 0) {
-                op(descriptors[i]);
-            }
-        }
+        // The pages of written descriptors already exist
+        updated.ForEachSet([this, &op](uint32_t i) { op(descriptors.GetForWrite(i)); });
     }
 
-    void AddParent(DescriptorSet *ds) override {
-        auto add_parent = [ds](T &descriptor) { descriptor.AddParent(ds); };
+    void AddParent(DescriptorSet *ds, const DeviceState &dev_data) override {
+        auto add_parent = [ds, &dev_data](T &descriptor) { descriptor.AddParent(ds, dev_data); };
         ForAllUpdated(add_parent);
     }
 
-    void RemoveParent(DescriptorSet *ds) override {
-        auto remove_parent = [ds](T &descriptor) { descriptor.RemoveParent(ds); };
+    void RemoveParent(DescriptorSet *ds, const DeviceState &dev_data) override {
+        auto remove_parent = [ds, &dev_data](T &descriptor) { descriptor.RemoveParent(ds, dev_data); };
         ForAllUpdated(remove_parent);
     }
 
@@ -826,8 +1031,8 @@ class DescriptorBindingImpl : public DescriptorBinding {
     }
 
     // Most descriptor bindings will only have a single descriptor, so want to assume that
-    // If they don't have 1, we will resize on construction (and never resize again) to the exact size with small_vector
-    small_vector<T, 1, uint32_t> descriptors;
+    // If they don't have 1, we will resize on construction (and never resize again) to the exact size, or use pages (see above)
+    DescriptorStorage<T> descriptors;
 };
 
 using SamplerBinding = DescriptorBindingImpl<SamplerDescriptor>;
@@ -919,6 +1124,8 @@ class DescriptorSet : public StateObject, public SubStateManager<DescriptorSetSu
     virtual void PerformWriteUpdate(const VkWriteDescriptorSet &);
     // Perform a CopyUpdate whose contents were just validated using ValidateCopyUpdate
     virtual void PerformCopyUpdate(const VkCopyDescriptorSet &, const DescriptorSet &src_set);
+    // Perform a templated update whose contents were just validated, writing pData straight into the bindings of the plan
+    void PerformTemplateUpdate(const DescriptorUpdateTemplate &template_state, const void *pData);
 
     const std::shared_ptr<DescriptorSetLayout const> &GetLayout() const { return layout_; };
     VkDescriptorSet VkHandle() const { return handle_.Cast<VkDescriptorSet>(); };
@@ -973,11 +1180,6 @@ class DescriptorSet : public StateObject, public SubStateManager<DescriptorSetSu
         return binding_data ? binding_data->GetDescriptor(index) : nullptr;
     }
 
-    Descriptor *GetDescriptorFromBinding(const uint32_t binding, const uint32_t index = 0) {
-        auto *binding_data = GetBinding(binding);
-        return binding_data ? binding_data->GetDescriptor(index) : nullptr;
-    }
-
     // For a given dynamic offset array, return the corresponding index into the list of descriptors in set
     const Descriptor *GetDescriptorFromDynamicOffsetIndex(const uint32_t index) const {
         auto pos = dynamic_offset_idx_to_descriptor_list_.at(index);
@@ -1088,16 +1290,17 @@ class DescriptorSet : public StateObject, public SubStateManager<DescriptorSetSu
         }
         const Descriptor &operator*() const { return *(this->operator->()); }
 
+        // The non-const iterator is used to write the descriptors
         Descriptor *operator->() {
             assert(iter_ != end_);
             assert(index_ < (*iter_)->count);
-            return (*iter_)->GetDescriptor(index_);
+            return (*iter_)->GetDescriptorForWrite(index_);
         }
         Descriptor &operator*() { return *(this->operator->()); }
 
-        bool updated() const { return CurrentBinding().updated[index_] != 0; }
+        bool updated() const { return CurrentBinding().updated[index_]; }
 
-        void updated(bool val) { CurrentBinding().updated[index_] = static_cast<uint32_t>(val); }
+        void updated(bool val) { CurrentBinding().updated.set(index_, val); }
 
       private:
         Iter iter_;
@@ -205,15 +205,12 @@ class Image : public Bindable, public SubStateManager<ImageSubState> {
     bool CompareCreateInfo(const Image &other) const;
 
     template <typename UnaryPredicate>
-    bool AnyAliasBindingOf(const StateObject::NodeMap &bindings, const UnaryPredicate &pred) const {
-        for (auto &entry : bindings) {
-            if (entry.first.type == kVulkanObjectTypeImage) {
-                auto state_object = entry.second.lock();
-                if (state_object) {
-                    auto other_image = static_cast<Image *>(state_object.get());
-                    if ((other_image != this) && other_image->IsCompatibleAliasing(this)) {
-                        if (pred(*other_image)) return true;
-                    }
+    bool AnyAliasBindingOf(const StateObject::NodeList &bindings, const UnaryPredicate &pred) const {
+        for (auto &state_object : bindings) {
+            if (state_object->Type() == kVulkanObjectTypeImage) {
+                auto other_image = static_cast<Image *>(state_object.get());
+                if ((other_image != this) && other_image->IsCompatibleAliasing(this)) {
+                    if (pred(*other_image)) return true;
                 }
             }
         }
@@ -223,9 +220,8 @@ class Image : public Bindable, public SubStateManager<ImageSubState> {
     template <typename UnaryPredicate>
     bool AnyImageAliasOf(const UnaryPredicate &pred) const {
         // Look for another aliasing image and
-        // ObjectBindings() is thread safe since returns by value, and once
-        // the weak_ptr is successfully locked, the other image state won't
-        // be freed out from under us.
+        // ObjectBindings() is thread safe since it returns shared_ptrs to the
+        // parents, the other image state won't be freed out from under us.
         for (auto const &memory_state : GetBoundMemoryStates()) {
             if (AnyAliasBindingOf(memory_state->ObjectBindings(), pred)) return true;
         }
@@ -45,6 +45,10 @@ void LastBound::UnbindAndResetPushDescriptorSet(std::shared_ptr<vvl::DescriptorS
 
 bool LastBound::IsDynamic(const CBDynamicState state) const { return !pipeline_state || pipeline_state->IsDynamic(state); }
 
+uint64_t LastBound::DescriptorValidationKey() const {
+    return pipeline_state ? pipeline_state->GetId() : (uint64_t(1) << 32) | shader_objects_change_count;
+}
+
 void LastBound::Reset() {
     pipeline_state = nullptr;
     desc_set_pipeline_layout.reset();
@@ -57,6 +61,30 @@ void LastBound::Reset() {
     descriptor_mode = vvl::DescriptorModeUnknown;
 }
 
+bool LastBound::DescriptorSetSlot::NeedValidation(const vvl::CommandBuffer &cb_state, uint64_t shaders_key,
+                                                  bool check_image_layouts) const {
+    return validated_dynamic_offsets != dynamic_offsets || NeedDrawStateUpdate(cb_state, shaders_key, check_image_layouts);
+}
+
+bool LastBound::DescriptorSetSlot::NeedDrawStateUpdate(const vvl::CommandBuffer &cb_state, uint64_t shaders_key,
+                                                       bool check_image_layouts) const {
+    // Revalidate if descriptor set (or contents) has changed
+    return validated_set != ds_state.get() || validated_set_change_count != ds_state->GetChangeCount() ||
+           validated_shaders_key != shaders_key ||
+           // Descriptors are checked against the attachments of the current subpass
+           validated_set_attachments_change_count != cb_state.attachments_change_count ||
+           (check_image_layouts && validated_set_image_layout_change_count != cb_state.image_layout_change_count);
+}
+
+void LastBound::DescriptorSetSlot::SetValidated(const vvl::CommandBuffer &cb_state, uint64_t shaders_key) {
+    validated_set = ds_state.get();
+    validated_set_change_count = ds_state->GetChangeCount();
+    validated_set_image_layout_change_count = cb_state.image_layout_change_count;
+    validated_set_attachments_change_count = cb_state.attachments_change_count;
+    validated_shaders_key = shaders_key;
+    validated_dynamic_offsets = dynamic_offsets;
+}
+
 bool LastBound::IsDepthTestEnable() const {
     if (IsDynamic(CB_DYNAMIC_STATE_DEPTH_TEST_ENABLE)) {
         if (cb_state.IsDynamicStateSet(CB_DYNAMIC_STATE_DEPTH_TEST_ENABLE)) {
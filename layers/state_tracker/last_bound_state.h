@@ -20,6 +20,7 @@
 
 #include "state_tracker/pipeline_layout_state.h"
 #include "state_tracker/descriptor_mode.h"
+#include "state_tracker/shader_stage_state.h"
 #include "utils/shader_utils.h"
 #include "generated/dynamic_state_helper.h"
 #include "generated/error_location_helper.h"
@@ -50,6 +51,8 @@ struct LastBound {
     // We have to track shader_object_bound, because shader_object_states will be nullptr when VK_NULL_HANDLE is used
     bool shader_object_bound[kShaderObjectStageCount]{false};
     vvl::ShaderObject *shader_object_states[kShaderObjectStageCount]{nullptr};
+    // Incremented by every vkCmdBindShadersEXT, the shader objects a descriptor set was validated for are known by this count
+    uint32_t shader_objects_change_count{0};
     // The compatible layout used binding descriptor sets (track location to provide better error message)
     std::shared_ptr<const vvl::PipelineLayout> desc_set_pipeline_layout;
     vvl::Func desc_set_bound_command = vvl::Func::Empty;  // will be something like vkCmdBindDescriptorSets
@@ -73,6 +76,17 @@ struct LastBound {
         const vvl::DescriptorSet *validated_set{nullptr};
         uint64_t validated_set_change_count{~0ULL};
         uint64_t validated_set_image_layout_change_count{~0ULL};
+        uint64_t validated_set_attachments_change_count{~0ULL};
+        // DescriptorValidationKey() of the pipeline or shader objects the set was validated for, their binding_req_map holds the
+        // bindings statically used, a different pipeline can use other bindings of the same set
+        uint64_t validated_shaders_key{~0ULL};
+        std::vector<uint32_t> validated_dynamic_offsets;
+
+        // Returns false if nothing the draw time descriptor checks look at changed since the last SetValidated()
+        bool NeedValidation(const vvl::CommandBuffer &cb_state, uint64_t shaders_key, bool check_image_layouts) const;
+        // Same, but ignores the dynamic offsets which only the buffer checks look at
+        bool NeedDrawStateUpdate(const vvl::CommandBuffer &cb_state, uint64_t shaders_key, bool check_image_layouts) const;
+        void SetValidated(const vvl::CommandBuffer &cb_state, uint64_t shaders_key);
 
         void Reset() {
             ds_state.reset();
@@ -91,6 +105,10 @@ struct LastBound {
     // For shaderObject, everything is dynamic
     bool IsDynamic(const CBDynamicState state) const;
 
+    // Identifies the shaders the draw time descriptor checks are done for. The GetId() of the bound pipeline (ids are never reused,
+    // unlike handles), or shader_objects_change_count above the range of ids when shader objects are used.
+    uint64_t DescriptorValidationKey() const;
+
     // Dynamic State helpers that require both the Pipeline and CommandBuffer state are here
     bool IsDepthTestEnable() const;
     bool IsDepthBoundTestEnable() const;
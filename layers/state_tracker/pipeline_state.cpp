@@ -193,7 +193,7 @@ std::vector<ShaderStageState> Pipeline::GetStageStates(const DeviceState &state_
         if (auto *pipeline_shader_module =
                 vku::FindStructInPNextChain<VkDataGraphPipelineShaderModuleCreateInfoARM>(pipe_state.DataGraphCreateInfo().pNext)) {
             if (auto module_state = state_data.Get<vvl::ShaderModule>(pipeline_shader_module->module)) {
-                for (auto &entry_point : module_state->spirv->static_data_.entry_points) {
+                for (auto &entry_point : module_state->spirv->GetStaticData().entry_points) {
                     if (entry_point->is_data_graph) {
                         VkPipelineShaderStageCreateInfo stage_ci = vku::InitStructHelper();
                         stage_ci.module = module_state->VkHandle();
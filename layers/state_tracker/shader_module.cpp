@@ -16,6 +16,8 @@
 
 #include "state_tracker/shader_module.h"
 
+#include <algorithm>
+#include <fstream>
 #include <sstream>
 #include <string>
 #include <queue>
@@ -23,6 +25,7 @@
 #include <vulkan/utility/vk_format_utils.h>
 #include "layer_options.h"
 #include "utils/assert_utils.h"
+#include "utils/file_system_utils.h"
 #include "utils/hash_util.h"
 #include "generated/spirv_grammar_helper.h"
 #include "generated/spirv_validation_helper.h"
@@ -899,7 +902,15 @@ Module::StaticData::StaticData(const Module& module_state, bool parse, Stateless
     if (!module_state.valid_spirv || !parse) {
         return;
     }
+    Parse(module_state, stateless_data);
+}
 
+// Fills in place (instead of returning a new StaticData) because the later passes call back into module_state (FindDef, etc)
+// which expects to be looking at this same object
+void Module::StaticData::Parse(const Module& module_state, StatelessData* stateless_data) {
+    if (stateless_data) {
+        stateless_data->collected = true;
+    }
     // Parse the words first so we have instruction class objects to use
     {
         std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
@@ -1316,8 +1327,8 @@ std::shared_ptr<const TypeStructInfo> Module::GetTypeStructInfo(const Instructio
             insn = FindDef(insn->Word(2));
         } else if (insn->Opcode() == spv::OpTypeStruct) {
             // return the actual execution modes for this id, or a default empty set.
-            const auto it = static_data_.type_struct_map.find(insn->ResultId());
-            return (it != static_data_.type_struct_map.end()) ? it->second : nullptr;
+            const auto it = GetStaticData().type_struct_map.find(insn->ResultId());
+            return (it != GetStaticData().type_struct_map.end()) ? it->second : nullptr;
         } else {
             return nullptr;
         }
@@ -1462,14 +1473,14 @@ std::string Module::DescribeVariable(uint32_t id) const {
 }
 
 std::string Module::DescribeInstruction(const Instruction& error_insn) const {
-    if (static_data_.shader_debug_info_set_id == 0 && !static_data_.using_legacy_debug_info) {
+    if (GetStaticData().shader_debug_info_set_id == 0 && !GetStaticData().using_legacy_debug_info) {
         return error_insn.Describe();
     }
 
     const Instruction* last_line_inst = nullptr;
-    for (const auto& insn : static_data_.instructions) {
+    for (const auto& insn : GetStaticData().instructions) {
         const uint32_t opcode = insn.Opcode();
-        if (opcode == spv::OpExtInst && insn.Word(3) == static_data_.shader_debug_info_set_id &&
+        if (opcode == spv::OpExtInst && insn.Word(3) == GetStaticData().shader_debug_info_set_id &&
             insn.Word(4) == NonSemanticShaderDebugInfo100DebugLine) {
             last_line_inst = &insn;
         } else if (opcode == spv::OpLine) {
@@ -1493,9 +1504,24 @@ std::string Module::DescribeInstruction(const Instruction& error_insn) const {
     return ss.str();
 }
 
+void Module::ParseDeferred() const {
+    // Parse() looks up its own results through the accessors, which must not wait for the parse in progress
+    static thread_local const Module* parsing_module = nullptr;
+    if (parsing_module == this) {
+        return;
+    }
+    // The object itself is never created const (always through make_shared), only handed out as const
+    std::call_once(parse_once_, [this]() {
+        parsing_module = this;
+        const_cast<Module*>(this)->static_data_.Parse(*this, nullptr);
+        parsing_module = nullptr;
+        parsed_.store(true, std::memory_order_release);
+    });
+}
+
 std::shared_ptr<const EntryPoint> Module::FindEntrypoint(const char* name, VkShaderStageFlagBits stageBits) const {
     if (!name) return nullptr;
-    for (const auto& entry_point : static_data_.entry_points) {
+    for (const auto& entry_point : GetStaticData().entry_points) {
         if (entry_point->name.compare(name) == 0 && entry_point->stage == stageBits) {
             return entry_point;
         }
@@ -1511,8 +1537,8 @@ LocalSize Module::FindLocalSize(const EntryPoint& entrypoint) const {
     LocalSize local_size;
     // "If an object is decorated with the WorkgroupSize decoration, this takes precedence over any LocalSize or LocalSizeId
     // execution mode."
-    if (static_data_.has_builtin_workgroup_size) {
-        const Instruction* composite_def = FindDef(static_data_.builtin_workgroup_size_id);
+    if (GetStaticData().has_builtin_workgroup_size) {
+        const Instruction* composite_def = FindDef(GetStaticData().builtin_workgroup_size_id);
         if (composite_def->Opcode() == spv::OpConstantComposite) {
             // VUID-WorkgroupSize-WorkgroupSize-04427 makes sure this is a OpTypeVector of int32
             local_size.x = GetConstantValueById(composite_def->Word(3));
@@ -1542,7 +1568,7 @@ uint32_t Module::CalculateWorkgroupSharedMemory() const {
     // In this case we want to find the MAX not ADD the block sizes
     bool find_max_block = false;
 
-    for (const Instruction* insn : static_data_.variable_inst) {
+    for (const Instruction* insn : GetStaticData().variable_inst) {
         // StorageClass Workgroup is shared memory
         if (insn->StorageClass() == spv::StorageClassWorkgroup) {
             if (GetDecorationSet(insn->Word(2)).Has(DecorationSet::aliased_bit)) {
@@ -2244,7 +2270,7 @@ PushConstantVariable::PushConstantVariable(const Module& module_state, const Ins
 TaskPayloadVariable::TaskPayloadVariable(const Module& module_state, const Instruction& insn, VkShaderStageFlagBits stage,
                                          const ParsedInfo& parsed)
     : VariableBase(module_state, insn, stage, parsed), size(0) {
-    if (module_state.static_data_.has_specialization_constants) {
+    if (module_state.GetStaticData().has_specialization_constants) {
         size = kInvalidValue;
     } else {
         const Instruction* type = module_state.GetVariablePointerType(insn);
@@ -2367,7 +2393,7 @@ uint32_t Module::GetTypeBitsSize(const Instruction* insn) const {
         // ArrayStride is only between element, not applied on the end of last element
         // Things like Private variable don't have explicit layout and can use element size
         uint32_t array_stride = element_width;
-        for (const spirv::Instruction* decoration_inst : static_data_.decoration_inst) {
+        for (const spirv::Instruction* decoration_inst : GetStaticData().decoration_inst) {
             if (decoration_inst->Word(1) == insn->ResultId()) {
                 if (decoration_inst->Word(2) == spv::DecorationArrayStride) {
                     // Need to represent as bits here
@@ -2607,6 +2633,82 @@ bool Module::UsesStorageCapabilityStorageClass(const Instruction& insn) const {
     }
 }
 
+bool ModuleCache::Load(const std::string& path, const uint8_t uuid[VK_UUID_SIZE]) {
+    path_ = path;
+    std::memcpy(uuid_, uuid, VK_UUID_SIZE);
+
+    if (!file_.Map(path) || file_.Size() < sizeof(Header)) {
+        file_.Unmap();
+        return false;
+    }
+    Header header = {};
+    std::memcpy(&header, file_.Data(), sizeof(Header));
+    if (header.header_size != sizeof(Header) || header.version != kVersion ||
+        std::memcmp(header.uuid, uuid_, VK_UUID_SIZE) != 0 ||
+        file_.Size() != sizeof(Header) + size_t(header.hash_count) * sizeof(uint64_t)) {
+        file_.Unmap();
+        return false;  // different layer build or device configuration (or a damaged file), start over
+    }
+    // The mapping is page aligned and the header keeps the array 8 byte aligned. The array is not checked for order here, that
+    // would touch every page; a damaged file can only make binary_search miss, a hash it finds is really in the file.
+    loaded_hashes_ = reinterpret_cast<const uint64_t*>(file_.Data() + sizeof(Header));
+    loaded_hash_count_ = header.hash_count;
+    return true;
+}
+
+bool ModuleCache::Save() {
+    if (path_.empty()) {
+        return false;
+    }
+    std::vector<uint64_t> hashes(loaded_hashes_, loaded_hashes_ + loaded_hash_count_);
+    {
+        std::lock_guard<std::mutex> guard(new_hashes_lock_);
+        if (new_hashes_.empty()) {
+            return true;  // nothing new, keep the current file
+        }
+        hashes.insert(hashes.end(), new_hashes_.begin(), new_hashes_.end());
+    }
+    // Some platforms can't replace a file that is still mapped
+    loaded_hashes_ = nullptr;
+    loaded_hash_count_ = 0;
+    file_.Unmap();
+
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+    Header header = {};
+    header.header_size = sizeof(Header);
+    header.version = kVersion;
+    header.hash_count = static_cast<uint32_t>(hashes.size());
+    std::memcpy(header.uuid, uuid_, VK_UUID_SIZE);
+
+    // Another device (or process) may be loading the file, so it is replaced as a whole
+    std::vector<uint8_t> data(sizeof(Header) + hashes.size() * sizeof(uint64_t));
+    std::memcpy(data.data(), &header, sizeof(Header));
+    std::memcpy(data.data() + sizeof(Header), hashes.data(), hashes.size() * sizeof(uint64_t));
+    return WriteFileAtomically(path_, data.data(), data.size());
+}
+
+bool ModuleCache::ContainsLoaded(uint64_t hash) const {
+    return std::binary_search(loaded_hashes_, loaded_hashes_ + loaded_hash_count_, hash);
+}
+
+bool ModuleCache::Contains(uint64_t hash) const {
+    if (ContainsLoaded(hash)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> guard(new_hashes_lock_);
+    return new_hashes_.count(hash) != 0;
+}
+
+void ModuleCache::Insert(uint64_t hash) {
+    if (ContainsLoaded(hash)) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(new_hashes_lock_);
+    new_hashes_.insert(hash);
+}
+
 }  // namespace spirv
 
 namespace vvl {
@@ -2619,4 +2721,15 @@ std::shared_ptr<spirv::Module> CreateSpirvModuleState(size_t codeSize, const uin
     }
     return std::make_shared<spirv::Module>(codeSize, pCode, is_valid_spirv, global_settings.spirv_parse, stateless_data);
 }
+
+std::shared_ptr<spirv::Module> CreateDeferredSpirvModuleState(size_t codeSize, const uint32_t* pCode,
+                                                              const GlobalSettings& global_settings) {
+    if (!global_settings.spirv_store) {
+        return std::make_shared<spirv::Module>(true);
+    }
+    if (!global_settings.spirv_parse) {
+        return std::make_shared<spirv::Module>(codeSize, pCode, true, false, nullptr);
+    }
+    return std::make_shared<spirv::Module>(codeSize, pCode, spirv::Module::DeferParse{});
+}
 }  // namespace vvl
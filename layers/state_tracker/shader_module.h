@@ -19,9 +19,11 @@
 #pragma once
 
 #include <vulkan/vulkan_core.h>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -31,6 +33,7 @@
 #include "state_tracker/sampler_state.h"
 #include <spirv/unified1/spirv.hpp>
 #include "containers/limits.h"
+#include "utils/file_system_utils.h"
 
 namespace vvl {
 class Pipeline;
@@ -612,6 +615,49 @@ struct StatelessData {
     bool has_invocation_repack_instruction{false};
     bool has_group_decoration{false};
     bool has_ext_inst_with_forward_refs{false};  // OpExtInstWithForwardRefsKHR
+
+    // Set when the module was parsed with this StatelessData. A module created with DeferParse never fills it in, the checks
+    // that use it passed on the run that added the module to the ModuleCache.
+    bool collected{false};
+};
+
+// Persistent set of SPIR-V hashes that were parsed and passed all vkCreateShaderModule time checks on a previous run with the same
+// layer build and device configuration (the UUID). A hit skips those checks and defers building StaticData until something needs
+// it, so modules that no pipeline uses are never parsed. The parsed StaticData itself is not cached, a module that does get used
+// is still parsed in full on first use.
+//
+// The file is a fixed size header followed by a sorted array of 64-bit hashes. Load() maps it and searches the array in place,
+// so opening a large cache does not read or decode it up front.
+class ModuleCache {
+  public:
+    static constexpr uint32_t kVersion = 1;
+    struct Header {
+        uint32_t header_size;
+        uint32_t version;
+        uint32_t hash_count;
+        uint32_t reserved;  // keeps the hash array 8 byte aligned
+        uint8_t uuid[VK_UUID_SIZE];
+    };
+
+    // Returns false if there was no usable file, the cache still works and will be written out on Save()
+    bool Load(const std::string &path, const uint8_t uuid[VK_UUID_SIZE]);
+    // Replaces the file and releases the mapping of the loaded one, so it is the last call
+    bool Save();
+
+    bool Contains(uint64_t hash) const;
+    void Insert(uint64_t hash);
+
+  private:
+    bool ContainsLoaded(uint64_t hash) const;
+
+    std::string path_;
+    uint8_t uuid_[VK_UUID_SIZE] = {};
+    // Read only after Load(), so no lock is needed to search it
+    MappedFile file_;
+    const uint64_t *loaded_hashes_ = nullptr;
+    uint32_t loaded_hash_count_ = 0;
+    vvl::unordered_set<uint64_t> new_hashes_;
+    mutable std::mutex new_hashes_lock_;
 };
 
 // Represents a SPIR-V Module
@@ -625,6 +671,8 @@ struct Module {
         StaticData &operator=(StaticData &&) = default;
         StaticData(StaticData &&) = default;
 
+        void Parse(const Module &module_state, StatelessData *stateless_data);
+
         // List of all instructions in the order they appear in the binary
         std::vector<Instruction> instructions;
         // Instructions that can be referenced by Ids
@@ -696,8 +744,6 @@ struct Module {
     // This is the SPIR-V module data content
     const std::vector<uint32_t> words_;
 
-    const StaticData static_data_;
-
     // Hold a handle so error message can know where the SPIR-V was from (VkShaderModule or VkShaderEXT)
     VulkanTypedHandle handle_;                            // Will be updated once its known its valid SPIR-V
     VulkanTypedHandle handle() const { return handle_; }  // matches normal convention to get handle
@@ -717,24 +763,40 @@ struct Module {
           words_(pCode, pCode + codeSize / sizeof(uint32_t)),
           static_data_(*this, parse, stateless_data) {}
 
+    // Used when the SPIR-V was found in the ModuleCache, it already passed the vkCreateShaderModule time checks on a previous run,
+    // so building StaticData is pushed back until something (normally pipeline creation) actually needs it
+    struct DeferParse {};
+    Module(size_t codeSize, const uint32_t *pCode, DeferParse)
+        : valid_spirv(true), words_(pCode, pCode + codeSize / sizeof(uint32_t)), parse_deferred_(true) {}
+
+    // Parses a module created with DeferParse the first time its data is needed
+    const StaticData &GetStaticData() const {
+        EnsureParsed();
+        return static_data_;
+    }
+    bool IsParseDeferred() const { return parse_deferred_; }
+
     const Instruction *FindDef(uint32_t id) const {
-        auto it = static_data_.definitions.find(id);
-        if (it == static_data_.definitions.end()) return nullptr;
+        const StaticData &static_data = GetStaticData();
+        auto it = static_data.definitions.find(id);
+        if (it == static_data.definitions.end()) return nullptr;
         return it->second;
     }
 
-    const std::vector<Instruction> &GetInstructions() const { return static_data_.instructions; }
+    const std::vector<Instruction> &GetInstructions() const { return GetStaticData().instructions; }
 
     const DecorationSet &GetDecorationSet(uint32_t id) const {
         // return the actual decorations for this id, or a default empty set.
-        const auto it = static_data_.decorations.find(id);
-        return (it != static_data_.decorations.end()) ? it->second : static_data_.empty_decoration;
+        const StaticData &static_data = GetStaticData();
+        const auto it = static_data.decorations.find(id);
+        return (it != static_data.decorations.end()) ? it->second : static_data.empty_decoration;
     }
 
     const ExecutionModeSet &GetExecutionModeSet(uint32_t function_id) const {
         // return the actual execution modes for this id, or a default empty set.
-        const auto it = static_data_.execution_modes.find(function_id);
-        return (it != static_data_.execution_modes.end()) ? it->second : static_data_.empty_execution_mode;
+        const StaticData &static_data = GetStaticData();
+        const auto it = static_data.execution_modes.find(function_id);
+        return (it != static_data.execution_modes.end()) ? it->second : static_data.empty_execution_mode;
     }
 
     std::shared_ptr<const TypeStructInfo> GetTypeStructInfo(const Instruction *insn) const;
@@ -778,9 +840,25 @@ struct Module {
     bool UsesStorageCapabilityStorageClass(const Instruction &insn) const;
 
     bool HasCapability(spv::Capability find_capability) const {
-        return std::any_of(static_data_.capability_list.begin(), static_data_.capability_list.end(),
+        const StaticData &static_data = GetStaticData();
+        return std::any_of(static_data.capability_list.begin(), static_data.capability_list.end(),
                            [find_capability](const spv::Capability &capability) { return capability == find_capability; });
     }
+
+  private:
+    void EnsureParsed() const {
+        if (parse_deferred_ && !parsed_.load(std::memory_order_acquire)) {
+            ParseDeferred();
+        }
+    }
+    void ParseDeferred() const;
+
+    // Declared before static_data_, parsing in the constructor already goes through EnsureParsed()
+    const bool parse_deferred_ = false;
+    mutable std::once_flag parse_once_;
+    mutable std::atomic<bool> parsed_{false};
+    // Not const only so a module created with DeferParse can fill it in later
+    StaticData static_data_;
 };
 
 }  // namespace spirv
@@ -793,6 +871,9 @@ namespace vvl {
 // Need to allow a way to not waste time copying over to spirv::Module::words_ when we don't want to store the SPIR-V
 std::shared_ptr<spirv::Module> CreateSpirvModuleState(size_t codeSize, const uint32_t *pCode, const GlobalSettings &global_settings,
                                                       spirv::StatelessData *stateless_data = nullptr);
+// Same as CreateSpirvModuleState, but for a module found in the ModuleCache that has its parsing deferred
+std::shared_ptr<spirv::Module> CreateDeferredSpirvModuleState(size_t codeSize, const uint32_t *pCode,
+                                                              const GlobalSettings &global_settings);
 
 struct ShaderModule : public StateObject {
     ShaderModule(VkShaderModule handle, std::shared_ptr<spirv::Module> &spirv_module)
@@ -88,7 +88,7 @@ bool ShaderStageState::GetInt32ConstantValue(const spirv::Instruction &insn, uin
     } else if (insn.Opcode() == spv::OpSpecConstant) {
         *value = insn.Word(3);  // default value
         const auto *spec_info = GetSpecializationInfo();
-        const uint32_t spec_id = spirv_state->static_data_.id_to_spec_id.at(insn.Word(2));
+        const uint32_t spec_id = spirv_state->GetStaticData().id_to_spec_id.at(insn.Word(2));
         if (spec_info && spec_id < spec_info->mapEntryCount) {
             memcpy(value, (uint8_t *)spec_info->pData + spec_info->pMapEntries[spec_id].offset,
                    spec_info->pMapEntries[spec_id].size);
@@ -115,7 +115,7 @@ bool ShaderStageState::GetBooleanConstantValue(const spirv::Instruction &insn, b
     } else if (insn.Opcode() == spv::OpSpecConstantTrue || insn.Opcode() == spv::OpSpecConstantFalse) {
         *value = insn.Opcode() == spv::OpSpecConstantTrue;  // default value
         const auto *spec_info = GetSpecializationInfo();
-        const uint32_t spec_id = spirv_state->static_data_.id_to_spec_id.at(insn.Word(2));
+        const uint32_t spec_id = spirv_state->GetStaticData().id_to_spec_id.at(insn.Word(2));
         if (spec_info && spec_id < spec_info->mapEntryCount) {
             memcpy(value, (uint8_t *)spec_info->pData + spec_info->pMapEntries[spec_id].offset, 1);
         }
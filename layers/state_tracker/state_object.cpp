@@ -18,6 +18,8 @@
  */
 #include "state_tracker/state_object.h"
 
+#include <utility>
+
 vvl::StateObject::~StateObject() { Destroy(); }
 
 void vvl::StateObject::Destroy() {
@@ -29,8 +31,8 @@ const VulkanTypedHandle* vvl::StateObject::InUse() const {
     // NOTE: for performance reasons, this method calls up the tree
     // with the read lock held.
     auto guard = ReadLockTree();
-    for (auto& item : parent_nodes_) {
-        auto node = item.second.lock();
+    for (const ParentLink* link = parent_links_; link; link = link->next) {
+        auto node = link->parent_weak.lock();
         if (!node) {
             continue;
         }
@@ -41,36 +43,84 @@ const VulkanTypedHandle* vvl::StateObject::InUse() const {
     return nullptr;
 }
 
+vvl::StateObject::ParentLink* vvl::StateObject::FindParentLink(const StateObject* parent_node) const {
+    if (parent_index_) {
+        auto it = parent_index_->find(parent_node);
+        return it != parent_index_->end() ? it->second : nullptr;
+    }
+    for (ParentLink* link = parent_links_; link; link = link->next) {
+        if (link->parent == parent_node) {
+            return link;
+        }
+    }
+    return nullptr;
+}
+
+vvl::StateObject::ParentLink* vvl::StateObject::DetachParentLinks() {
+    parent_index_.reset();
+    parent_count_ = 0;
+    return std::exchange(parent_links_, nullptr);
+}
+
 bool vvl::StateObject::AddParent(StateObject* parent_node) {
     auto guard = WriteLockTree();
-    auto result = parent_nodes_.emplace(parent_node->Handle(), std::weak_ptr<StateObject>(parent_node->shared_from_this()));
-    return result.second;
+    if (FindParentLink(parent_node)) {
+        return false;
+    }
+    auto* link = new ParentLink{parent_node, parent_node->weak_from_this(), nullptr, parent_links_};
+    if (parent_links_) {
+        parent_links_->prev = link;
+    }
+    parent_links_ = link;
+    ++parent_count_;
+
+    if (parent_index_) {
+        parent_index_->emplace(parent_node, link);
+    } else if (parent_count_ > kParentIndexThreshold) {
+        parent_index_ = std::make_unique<ParentIndex>();
+        parent_index_->reserve(parent_count_);
+        for (ParentLink* it = parent_links_; it; it = it->next) {
+            parent_index_->emplace(it->parent, it);
+        }
+    }
+    return true;
 }
 
 void vvl::StateObject::RemoveParent(StateObject* parent_node) {
     assert(parent_node);
     auto guard = WriteLockTree();
-    parent_nodes_.erase(parent_node->Handle());
-}
-
-// copy the current set of parents so that we don't need to hold the lock
-// while calling NotifyInvalidate on them, as that would lead to recursive locking.
-vvl::StateObject::NodeMap vvl::StateObject::GetParentsForInvalidate(bool unlink) {
-    NodeMap result;
-    if (unlink) {
-        auto guard = WriteLockTree();
-        result = std::move(parent_nodes_);
-        parent_nodes_.clear();
+    ParentLink* link = FindParentLink(parent_node);
+    if (!link) {
+        return;
+    }
+    if (link->prev) {
+        link->prev->next = link->next;
     } else {
-        auto guard = ReadLockTree();
-        result = parent_nodes_;
+        parent_links_ = link->next;
+    }
+    if (link->next) {
+        link->next->prev = link->prev;
     }
-    return result;
+    --parent_count_;
+    if (parent_index_) {
+        if (parent_count_ == 0) {
+            parent_index_.reset();
+        } else {
+            parent_index_->erase(parent_node);
+        }
+    }
+    delete link;
 }
 
-vvl::StateObject::NodeMap vvl::StateObject::ObjectBindings() const {
+vvl::StateObject::NodeList vvl::StateObject::ObjectBindings() const {
+    NodeList parents;
     auto guard = ReadLockTree();
-    return parent_nodes_;
+    for (const ParentLink* link = parent_links_; link; link = link->next) {
+        if (auto node = link->parent_weak.lock()) {
+            parents.emplace_back(std::move(node));
+        }
+    }
+    return parents;
 }
 
 void vvl::StateObject::Invalidate(bool unlink) {
@@ -82,17 +132,38 @@ void vvl::StateObject::Invalidate(bool unlink) {
     StateObject::NotifyInvalidate(empty, unlink);
 }
 
+// The parents are notified without the tree lock held, as they can call RemoveParent() on this object.
+// When unlinking, the whole list is detached under the lock and walked after, otherwise the live parents are collected first.
 void vvl::StateObject::NotifyInvalidate(const NodeList& invalid_nodes, bool unlink) {
-    auto current_parents = GetParentsForInvalidate(unlink);
-    if (current_parents.empty()) {
+    if (unlink) {
+        ParentLink* links = nullptr;
+        {
+            auto guard = WriteLockTree();
+            links = DetachParentLinks();
+        }
+        if (!links) {
+            return;
+        }
+        NodeList up_nodes = invalid_nodes;
+        up_nodes.emplace_back(shared_from_this());
+        while (links) {
+            std::unique_ptr<ParentLink> link(std::exchange(links, links->next));
+            auto node = link->parent_weak.lock();
+            if (node && !node->Destroyed()) {
+                node->NotifyInvalidate(up_nodes, unlink);
+            }
+        }
         return;
     }
 
+    NodeList current_parents = ObjectBindings();
+    if (current_parents.empty()) {
+        return;
+    }
     NodeList up_nodes = invalid_nodes;
     up_nodes.emplace_back(shared_from_this());
-    for (auto& item : current_parents) {
-        auto node = item.second.lock();
-        if (node && !node->Destroyed()) {
+    for (auto& node : current_parents) {
+        if (!node->Destroyed()) {
             node->NotifyInvalidate(up_nodes, unlink);
         }
     }
@@ -27,6 +27,7 @@
 
 #include <atomic>
 #include <map>
+#include <memory>
 
 // Intentionally ignore VulkanTypedHandle::node, it is optional
 inline bool operator==(const VulkanTypedHandle &a, const VulkanTypedHandle &b) noexcept {
@@ -45,11 +46,6 @@ namespace vvl {
 // be created with std::make_shared<> and it MUST NOT be used from the constructor
 class StateObject: public std::enable_shared_from_this<StateObject>, public TypedHandleWrapper {
   public:
-    // Parent nodes are stored as weak_ptrs to avoid cyclic memory dependencies.
-    // Because weak_ptrs cannot safely be used as hash keys, the parents are stored
-    // in a map keyed by VulkanTypedHandle. This also allows looking for specific
-    // parent types without locking every weak_ptr.
-    using NodeMap = unordered_map<VulkanTypedHandle, std::weak_ptr<StateObject>>;
     using NodeList = small_vector<std::shared_ptr<StateObject>, 4, uint32_t>;
 
     template <typename Handle>
@@ -97,7 +93,7 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     void Invalidate(bool unlink = true);
 
     // Helper to let objects examine their immediate parents without holding the tree lock.
-    NodeMap ObjectBindings() const;
+    NodeList ObjectBindings() const;
 
   protected:
     template <typename Derived, typename Shared = std::shared_ptr<Derived>>
@@ -110,23 +106,41 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
     // Called recursively for every parent object of something that has become invalid
     virtual void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink);
 
-    // returns a copy of the current set of parents so that they can be walked
-    // without the tree lock held. If unlink == true, parent_nodes_ is also cleared.
-    NodeMap GetParentsForInvalidate(bool unlink);
-
     // Set to true when the API-level object is destroyed, but this object may
     // hang around until its shared_ptr refcount goes to zero.
     std::atomic<bool> destroyed_;
     uint32_t id_;
 
   private:
+    // Edge to one of the immediate parents of this object. Edges are doubly linked into a list owned by the child, so that a
+    // parent is unlinked without moving the others and all of them are detached at once when the object is invalidated.
+    // Parents are held as weak_ptrs to avoid cyclic memory dependencies, the raw pointer is only used as a key. It cannot be
+    // reused by another object while the weak_ptr keeps the control block (and the make_shared allocation) alive.
+    struct ParentLink {
+        const StateObject *parent;
+        std::weak_ptr<StateObject> parent_weak;
+        ParentLink *prev;
+        ParentLink *next;
+    };
+    // Short lists are searched linearly, objects with many parents (a texture used by thousands of command buffers) get an
+    // index to find the edge of a parent.
+    using ParentIndex = unordered_map<const StateObject *, ParentLink *>;
+    static constexpr uint32_t kParentIndexThreshold = 16;
+
     ReadLockGuard ReadLockTree() const { return ReadLockGuard(tree_lock_); }
     WriteLockGuard WriteLockTree() { return WriteLockGuard(tree_lock_); }
 
-    // Set of immediate parent nodes for this object. For an in-use object, the
+    // Must hold tree_lock_
+    ParentLink *FindParentLink(const StateObject *parent_node) const;
+    // Must hold tree_lock_ for writing, the returned list is owned by the caller
+    ParentLink *DetachParentLinks();
+
+    // Immediate parent nodes of this object. For an in-use object, the
     // parent nodes should form a tree with the root being a command buffer.
-    NodeMap parent_nodes_;
-    // Lock guarding parent_nodes_, this lock MUST NOT be used for other purposes.
+    ParentLink *parent_links_ = nullptr;
+    std::unique_ptr<ParentIndex> parent_index_;
+    uint32_t parent_count_ = 0;
+    // Lock guarding the parent links, this lock MUST NOT be used for other purposes.
     mutable std::shared_mutex tree_lock_;
 };
 
@@ -49,6 +49,8 @@
 
 #include "utils/image_utils.h" // GetExternalFormat
 #include "utils/sync_utils.h"
+#include "utils/hash_util.h"
+#include "utils/thread_pool.h"
 #include "chassis/chassis.h"
 
 namespace vvl {
@@ -59,6 +61,9 @@ DeviceState::DeviceState(vvl::dispatch::Device *dev, InstanceState *instance)
       special_supported(dev->stateless_device_data.special_supported) {
     physical_device_state = instance_state->Get<vvl::PhysicalDevice>(physical_device).get();
     physical_device_state->has_maintenance9 = dev->stateless_device_data.special_supported.has_maintenance9;
+    if (global_settings.parallel_pipeline_validation) {
+        pipeline_thread_pool_ = std::make_unique<vvl::ThreadPool>();
+    }
 }
 
 DeviceState::~DeviceState() { DestroyObjectMaps(); }
@@ -91,6 +96,31 @@ void DeviceState::RemoveSubState(LayerObjectTypeId id) {
     ForEachShared<vvl::ShaderObject>([id](std::shared_ptr<vvl::ShaderObject> state) { state->RemoveSubState(id); });
 }
 
+ReadLockGuard DeviceState::CommandBufferReadLock() const {
+    if (global_settings.fine_grained_locking) {
+        return ReadLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return ReadLock();
+    }
+}
+
+WriteLockGuard DeviceState::CommandBufferWriteLock() {
+    if (global_settings.fine_grained_locking) {
+        return WriteLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return WriteLock();
+    }
+}
+
+WriteLockGuard DeviceState::CommandBufferSharedStateLock() {
+    if (global_settings.fine_grained_locking) {
+        return WriteLockGuard(validation_object_mutex);
+    } else {
+        // Already held by CommandBufferWriteLock()
+        return WriteLockGuard(validation_object_mutex, std::defer_lock);
+    }
+}
+
 VkDeviceAddress DeviceState::GetBufferDeviceAddressHelper(VkBuffer buffer, const DeviceExtensions *exts = nullptr) const {
     // GPU-AV needs to pass in the modified extensions, since it may turn on BDA on its own
     if (!exts) {
@@ -1648,6 +1678,8 @@ void DeviceState::PostCallRecordQueueWaitIdle(VkQueue queue, const RecordObject
             }
         }
     }
+    // With async_message_delivery, the errors found while retiring the submissions must reach the callbacks before returning
+    debug_report->FlushMessages();
 }
 
 void DeviceState::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObject &record_obj) {
@@ -1683,6 +1715,7 @@ void DeviceState::PostCallRecordDeviceWaitIdle(VkDevice device, const RecordObje
             semaphore_state->ClearSwapchainWaitInfo();
         }
     }
+    debug_report->FlushMessages();
 }
 
 void DeviceState::PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator,
@@ -1953,6 +1986,34 @@ void DeviceState::PreCallRecordDestroyPipelineCache(VkDevice device, VkPipelineC
     Destroy<PipelineCache>(pipelineCache);
 }
 
+bool DeviceState::ForEachPipeline(uint32_t count, const std::function<bool(uint32_t index)> &func) const {
+    bool skip = false;
+    if (!pipeline_thread_pool_ || count < 2) {
+        for (uint32_t i = 0; i < count; i++) {
+            skip |= func(i);
+        }
+        return skip;
+    }
+
+    std::vector<MessageCapture> captures(count);
+    std::vector<uint8_t> results(count, 0);  // not vector<bool>, each task writes its own element
+    {
+        vvl::TaskGroup task_group(pipeline_thread_pool_.get());
+        for (uint32_t i = 0; i < count; i++) {
+            task_group.Run([&func, &captures, &results, i]() {
+                MessageCapture::Scope capture_scope(captures[i]);
+                results[i] = func(i) ? 1 : 0;
+            });
+        }
+        task_group.Wait();
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= results[i] != 0;
+        skip |= captures[i].Replay();
+    }
+    return skip;
+}
+
 std::shared_ptr<Pipeline> DeviceState::CreateGraphicsPipelineState(
     const VkGraphicsPipelineCreateInfo *create_info, std::shared_ptr<const PipelineCache> pipeline_cache,
     std::shared_ptr<const RenderPass> &&render_pass, std::shared_ptr<const PipelineLayout> &&layout,
@@ -1967,11 +2028,10 @@ bool DeviceState::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipe
                                                          const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                          const ErrorObject &error_obj, PipelineStates &pipeline_states,
                                                          chassis::CreateGraphicsPipelines &chassis_state) const {
-    bool skip = false;
     // Set up the state that CoreChecks, gpu_validation and later StateTracker Record will use.
-    pipeline_states.reserve(count);
+    pipeline_states.resize(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    return ForEachPipeline(count, [&](uint32_t i) {
         const auto &create_info = pCreateInfos[i];
         auto layout_state = Get<PipelineLayout>(create_info.layout);
         std::shared_ptr<const RenderPass> render_pass;
@@ -1990,10 +2050,13 @@ bool DeviceState::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipe
 
             render_pass = std::make_shared<RenderPass>(pipeline_rendering_ci, rasterization_enabled);
         }
-        pipeline_states.push_back(CreateGraphicsPipelineState(&create_info, pipeline_cache, std::move(render_pass),
-                                                              std::move(layout_state), chassis_state.stateless_data));
-    }
-    return skip;
+        // CoreChecks only runs the stateless SPIR-V checks of the first pipeline, the other pipelines must not write over its data
+        spirv::StatelessData unused_stateless_data[kCommonMaxGraphicsShaderStages];
+        pipeline_states[i] =
+            CreateGraphicsPipelineState(&create_info, pipeline_cache, std::move(render_pass), std::move(layout_state),
+                                        i == 0 ? chassis_state.stateless_data : unused_stateless_data);
+        return false;
+    });
 }
 
 void DeviceState::PostCallRecordCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -2026,14 +2089,17 @@ bool DeviceState::PreCallValidateCreateComputePipelines(VkDevice device, VkPipel
                                                         const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines,
                                                         const ErrorObject &error_obj, PipelineStates &pipeline_states,
                                                         chassis::CreateComputePipelines &chassis_state) const {
-    pipeline_states.reserve(count);
+    pipeline_states.resize(count);
     auto pipeline_cache = Get<PipelineCache>(pipelineCache);
-    for (uint32_t i = 0; i < count; i++) {
+    return ForEachPipeline(count, [&](uint32_t i) {
+        // CoreChecks only runs the stateless SPIR-V checks of the first pipeline, the other pipelines must not write over its data
+        spirv::StatelessData unused_stateless_data;
         // Create and initialize internal tracking data structure
-        pipeline_states.push_back(CreateComputePipelineState(
-            &pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout), &chassis_state.stateless_data));
-    }
-    return false;
+        pipeline_states[i] =
+            CreateComputePipelineState(&pCreateInfos[i], pipeline_cache, Get<PipelineLayout>(pCreateInfos[i].layout),
+                                       i == 0 ? &chassis_state.stateless_data : &unused_stateless_data);
+        return false;
+    });
 }
 
 void DeviceState::PostCallRecordCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t count,
@@ -2613,6 +2679,7 @@ void DeviceState::RecordDeviceAccelerationStructureBuildInfo(CommandBuffer &cb_s
 void DeviceState::PostCallRecordCmdBuildAccelerationStructuresKHR(
     VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos,
     const VkAccelerationStructureBuildRangeInfoKHR *const *ppBuildRangeInfos, const RecordObject &record_obj) {
+    auto shared_state_guard = CommandBufferSharedStateLock();
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
     ASSERT_AND_RETURN(cb_state);
 
@@ -2631,6 +2698,7 @@ void DeviceState::PostCallRecordCmdBuildAccelerationStructuresIndirectKHR(VkComm
                                                                           const uint32_t *pIndirectStrides,
                                                                           const uint32_t *const *ppMaxPrimitiveCounts,
                                                                           const RecordObject &record_obj) {
+    auto shared_state_guard = CommandBufferSharedStateLock();
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
     ASSERT_AND_RETURN(cb_state);
 
@@ -2688,6 +2756,7 @@ void DeviceState::PostCallRecordCmdBuildAccelerationStructureNV(VkCommandBuffer
                                                                 VkAccelerationStructureNV dst, VkAccelerationStructureNV src,
                                                                 VkBuffer scratch, VkDeviceSize scratchOffset,
                                                                 const RecordObject &record_obj) {
+    auto shared_state_guard = CommandBufferSharedStateLock();
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
     if (!cb_state) {
         return;
@@ -2735,6 +2804,7 @@ void DeviceState::PostCallRecordCmdCopyAccelerationStructureNV(VkCommandBuffer c
                                                                VkAccelerationStructureNV src,
                                                                VkCopyAccelerationStructureModeNV mode,
                                                                const RecordObject &record_obj) {
+    auto shared_state_guard = CommandBufferSharedStateLock();
     if (disabled[command_buffer_state]) return;
 
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
@@ -4615,7 +4685,11 @@ void DeviceState::PostCallRecordCreateDescriptorUpdateTemplate(VkDevice device,
     if (record_obj.result != VK_SUCCESS) {
         return;
     }
-    Add(std::make_shared<DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo));
+    std::shared_ptr<const DescriptorSetLayout> layout_state;
+    if (pCreateInfo->templateType == VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET) {
+        layout_state = Get<DescriptorSetLayout>(pCreateInfo->descriptorSetLayout);
+    }
+    Add(std::make_shared<DescriptorUpdateTemplate>(*pDescriptorUpdateTemplate, pCreateInfo, layout_state.get()));
 }
 
 void DeviceState::PostCallRecordCreateDescriptorUpdateTemplateKHR(VkDevice device,
@@ -4859,10 +4933,9 @@ void DeviceState::PostCallRecordResetQueryPool(VkDevice device, VkQueryPool quer
 
 void DeviceState::PerformUpdateDescriptorSetsWithTemplateKHR(VkDescriptorSet descriptorSet,
                                                              const DescriptorUpdateTemplate &template_state, const void *pData) {
-    // Translate the templated update into a normal update for validation...
-    DecodedTemplateUpdate decoded_template(*this, descriptorSet, template_state, pData);
-    PerformUpdateDescriptorSets(static_cast<uint32_t>(decoded_template.desc_writes.size()), decoded_template.desc_writes.data(), 0,
-                                NULL);
+    if (auto set_state = Get<DescriptorSet>(descriptorSet)) {
+        set_state->PerformTemplateUpdate(template_state, pData);
+    }
 }
 
 void DeviceState::PostCallRecordCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
@@ -5108,6 +5181,14 @@ void DeviceState::PreCallRecordCreateShaderModule(VkDevice device, const VkShade
         return;
     }
 
+    if (shader_module_cache) {
+        chassis_state.module_cache_hash = hash_util::Hash64(pCreateInfo->pCode, pCreateInfo->codeSize);
+        if (shader_module_cache->Contains(chassis_state.module_cache_hash)) {
+            chassis_state.module_state = CreateDeferredSpirvModuleState(pCreateInfo->codeSize, pCreateInfo->pCode, global_settings);
+            return;
+        }
+    }
+
     chassis_state.module_state =
         CreateSpirvModuleState(pCreateInfo->codeSize, pCreateInfo->pCode, global_settings, &chassis_state.stateless_data);
     if (chassis_state.module_state && chassis_state.stateless_data.has_group_decoration) {
@@ -5198,6 +5279,7 @@ void DeviceState::PostCallRecordCopyAccelerationStructureKHR(VkDevice device, Vk
 void DeviceState::PostCallRecordCmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer,
                                                                 const VkCopyAccelerationStructureInfoKHR *pInfo,
                                                                 const RecordObject &record_obj) {
+    auto shared_state_guard = CommandBufferSharedStateLock();
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
     ASSERT_AND_RETURN(cb_state);
     cb_state->RecordCommand(record_obj.location);
@@ -5231,6 +5313,7 @@ void DeviceState::PostCallRecordCmdCopyAccelerationStructureToMemoryKHR(VkComman
 void DeviceState::PostCallRecordCmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer,
                                                                         const VkCopyMemoryToAccelerationStructureInfoKHR *pInfo,
                                                                         const RecordObject &record_obj) {
+    auto shared_state_guard = CommandBufferSharedStateLock();
     auto cb_state = GetWrite<CommandBuffer>(commandBuffer);
     ASSERT_AND_RETURN(cb_state);
     cb_state->RecordCommand(record_obj.location);
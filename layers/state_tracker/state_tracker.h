@@ -30,6 +30,7 @@
 #include "error_message/logging.h"
 #include "containers/span.h"
 #include "containers/custom_containers.h"
+#include "containers/read_mostly_map.h"
 #include "utils/android_ndk_types.h"
 #include "utils/vk_api_utils.h"
 #include "containers/range_map.h"
@@ -41,6 +42,7 @@
 
 namespace vvl {
 struct AllocateDescriptorSetsData;
+class ThreadPool;
 class Fence;
 class DescriptorPool;
 class DescriptorSet;
@@ -90,6 +92,7 @@ struct CreateShaderModule;
 
 namespace spirv {
 struct StatelessData;
+class ModuleCache;
 }  // namespace spirv
 
 namespace subresource_adapter {
@@ -98,8 +101,46 @@ class RangeGenerator;
 
 class CommandBufferImageLayoutMap;
 
+namespace vvl {
+
+// Device level state object storage. The state objects are owned by a concurrent_unordered_map, and the same
+// pointers are indexed by a read_mostly_map, so GetBorrowed() can resolve a handle without a bucket lock or
+// reference count traffic. The index entry is removed before the owning reference is dropped.
+template <typename Handle, typename State>
+class StateObjectMap {
+    using OwnerMap = concurrent_unordered_map<Handle, std::shared_ptr<State>>;
+
+  public:
+    auto find(const Handle& handle) const { return owners_.find(handle); }
+    auto end() const { return owners_.end(); }
+    State* find_borrowed(const Handle& handle) const { return index_.find(handle); }
+
+    void insert_or_assign(const Handle& handle, std::shared_ptr<State>&& state) {
+        index_.insert_or_assign(handle, state.get());
+        owners_.insert_or_assign(handle, std::move(state));
+    }
+    auto pop(const Handle& handle) {
+        index_.erase(handle);
+        return owners_.pop(handle);
+    }
+    void clear() {
+        index_.clear();
+        owners_.clear();
+    }
+
+    size_t size() const { return owners_.size(); }
+    bool empty() const { return owners_.empty(); }
+    auto snapshot() const { return owners_.snapshot(); }
+
+  private:
+    OwnerMap owners_;
+    read_mostly_map<Handle, State> index_;
+};
+
+}  // namespace vvl
+
 #define VALSTATETRACK_MAP_AND_TRAITS(handle_type, state_type, map_member)                 \
-    vvl::concurrent_unordered_map<handle_type, std::shared_ptr<state_type>> map_member;   \
+    vvl::StateObjectMap<handle_type, state_type> map_member;                              \
     template <typename Dummy>                                                             \
     struct MapTraits<state_type, Dummy> {                                                 \
         static constexpr bool kInstanceScope = false;                                     \
@@ -553,6 +594,14 @@ class DeviceState : public vvl::base::Device {
     void RemoveProxy(LayerObjectTypeId id);
     void RemoveSubState(LayerObjectTypeId id);
 
+    // With fine grained locking, vkCmd* hooks only rely on the command buffer lock taken by GetWrite<CommandBuffer>()
+    ReadLockGuard CommandBufferReadLock() const override;
+    WriteLockGuard CommandBufferWriteLock() override;
+    // Taken by the few vkCmd* record hooks that also modify state objects shared between command buffers
+    // (acceleration structure build state), these must stay serialized with each other and with the
+    // corresponding host commands
+    WriteLockGuard CommandBufferSharedStateLock();
+
     template <typename State, typename HandleType = typename state_object::Traits<State>::HandleType>
     void Add(std::shared_ptr<State>&& state_object) {
         auto& map = GetStateMap<State>();
@@ -628,6 +677,19 @@ class DeviceState : public vvl::base::Device {
         return std::static_pointer_cast<State>(std::move(found_it->second));
     }
 
+    // GetBorrowed() is a lock-free lookup that does not take a reference. The returned pointer is only valid while
+    // the handle is, so use it for handles passed to the current command (the application can't destroy them during
+    // the call) and take a reference with Get() to keep the state object past the call.
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    typename Traits::StateType* GetBorrowed(typename Traits::HandleType handle) {
+        return static_cast<typename Traits::StateType*>(GetStateMap<State>().find_borrowed(handle));
+    }
+
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    const typename Traits::StateType* GetBorrowed(typename Traits::HandleType handle) const {
+        return static_cast<const typename Traits::StateType*>(GetStateMap<State>().find_borrowed(handle));
+    }
+
     // GetRead() and GetWrite() return an already locked state object. Currently this is only supported by
     // vvl::CommandBuffer, because it has public ReadLock() and WriteLock() methods.
     // NOTE: Calling base class hook methods with a vvl::CommandBuffer lock held will lead to deadlock. Instead,
@@ -894,6 +956,11 @@ class DeviceState : public vvl::base::Device {
     void PostCallRecordResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags,
                                         const RecordObject& record_obj) override;
 
+    // Runs func(i) for each create info of a vkCreate*Pipelines call, on worker threads if parallel_pipeline_validation is on.
+    // Messages logged by func are held back and reported in index order, as if the calls were made one after the other.
+    // Returns true if any call of func returned true.
+    bool ForEachPipeline(uint32_t count, const std::function<bool(uint32_t index)>& func) const;
+
     virtual std::shared_ptr<vvl::Pipeline> CreateComputePipelineState(const VkComputePipelineCreateInfo* create_info,
                                                                       std::shared_ptr<const vvl::PipelineCache> pipeline_cache,
                                                                       std::shared_ptr<const vvl::PipelineLayout>&& layout,
@@ -2011,6 +2078,12 @@ class DeviceState : public vvl::base::Device {
     vvl::unordered_map<VkShaderModuleIdentifierEXT, std::shared_ptr<vvl::ShaderModule>> shader_identifier_map_;
     mutable std::shared_mutex shader_identifier_map_lock_;
 
+    // Set up by CoreChecks (which owns the checks the cache vouches for), null if not in use
+    std::unique_ptr<spirv::ModuleCache> shader_module_cache;
+
+    // Only created if parallel_pipeline_validation is on
+    std::unique_ptr<vvl::ThreadPool> pipeline_thread_pool_;
+
     // If vkGetMemoryFdKHR is called, keep track of fd handle -> allocation info
     vvl::unordered_map<int, ExternalOpaqueInfo> fd_handle_map_;
     mutable std::shared_mutex fd_handle_map_lock_;
@@ -2119,6 +2192,16 @@ class DeviceProxy : public vvl::base::Device {
         return device_state->Get<State>(handle);
     }
 
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    typename Traits::StateType* GetBorrowed(typename Traits::HandleType handle) {
+        return device_state->GetBorrowed<State>(handle);
+    }
+
+    template <typename State, typename Traits = typename state_object::Traits<State>>
+    const typename Traits::StateType* GetBorrowed(typename Traits::HandleType handle) const {
+        return const_cast<const vvl::DeviceState*>(device_state)->GetBorrowed<State>(handle);
+    }
+
     template <typename State, typename Traits = typename state_object::Traits<State>,
               typename ReadLockedType = typename Traits::ReadLockedType>
     ReadLockedType GetRead(typename Traits::HandleType handle) const {
@@ -31,7 +31,8 @@ bool Device::manual_PreCallValidateCreateBuffer(VkDevice device, const VkBufferC
     const auto &error_obj = context.error_obj;
 
     const Location create_info_loc = error_obj.location.dot(Field::pCreateInfo);
-    skip |= context.ValidateNotZero(pCreateInfo->size == 0, "VUID-VkBufferCreateInfo-size-00912", create_info_loc.dot(Field::size));
+    skip |= context.ValidateNotZero(pCreateInfo->size == 0, "VUID-VkBufferCreateInfo-size-00912",
+                                    create_info_loc.lazy_dot(Field::size));
 
     if (pCreateInfo->sharingMode == VK_SHARING_MODE_CONCURRENT) {
         if (pCreateInfo->queueFamilyIndexCount <= 1) {
@@ -48,7 +49,7 @@ bool Device::manual_PreCallValidateCreateBuffer(VkDevice device, const VkBufferC
 
     const auto *usage_flags2 = vku::FindStructInPNextChain<VkBufferUsageFlags2CreateInfo>(pCreateInfo->pNext);
     if (!usage_flags2) {
-        skip |= context.ValidateFlags(create_info_loc.dot(Field::usage), vvl::FlagBitmask::VkBufferUsageFlagBits,
+        skip |= context.ValidateFlags(create_info_loc.lazy_dot(Field::usage), vvl::FlagBitmask::VkBufferUsageFlagBits,
                                       AllVkBufferUsageFlagBits, pCreateInfo->usage, kRequiredFlags,
                                       "VUID-VkBufferCreateInfo-None-09499", "VUID-VkBufferCreateInfo-None-09500");
     }
@@ -715,21 +715,21 @@ bool Device::manual_PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuf
         }
 
         if (enabled_features.inheritedQueries) {
-            skip |= context.ValidateFlags(inheritance_loc.dot(Field::queryFlags), vvl::FlagBitmask::VkQueryControlFlagBits,
+            skip |= context.ValidateFlags(inheritance_loc.lazy_dot(Field::queryFlags), vvl::FlagBitmask::VkQueryControlFlagBits,
                                           AllVkQueryControlFlagBits, info.queryFlags, kOptionalFlags,
                                           "VUID-VkCommandBufferInheritanceInfo-queryFlags-00057");
         } else {  // !inheritedQueries
-            skip |= context.ValidateReservedFlags(inheritance_loc.dot(Field::queryFlags), info.queryFlags,
+            skip |= context.ValidateReservedFlags(inheritance_loc.lazy_dot(Field::queryFlags), info.queryFlags,
                                                   "VUID-VkCommandBufferInheritanceInfo-queryFlags-02788");
         }
 
         if (enabled_features.pipelineStatisticsQuery) {
-            skip |= context.ValidateFlags(inheritance_loc.dot(Field::pipelineStatistics),
+            skip |= context.ValidateFlags(inheritance_loc.lazy_dot(Field::pipelineStatistics),
                                           vvl::FlagBitmask::VkQueryPipelineStatisticFlagBits, AllVkQueryPipelineStatisticFlagBits,
                                           info.pipelineStatistics, kOptionalFlags,
                                           "VUID-VkCommandBufferInheritanceInfo-pipelineStatistics-02789");
         } else {  // !pipelineStatisticsQuery
-            skip |= context.ValidateReservedFlags(inheritance_loc.dot(Field::pipelineStatistics), info.pipelineStatistics,
+            skip |= context.ValidateReservedFlags(inheritance_loc.lazy_dot(Field::pipelineStatistics), info.pipelineStatistics,
                                                   "VUID-VkCommandBufferInheritanceInfo-pipelineStatistics-00058");
         }
 
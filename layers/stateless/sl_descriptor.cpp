@@ -400,14 +400,14 @@ bool Device::ValidateSamplerCreateInfo(const VkSamplerCreateInfo &create_info, c
     }
 
     if (create_info.compareEnable == VK_TRUE) {
-        skip |= context.ValidateRangedEnum(create_info_loc.dot(Field::compareOp), vvl::Enum::VkCompareOp, create_info.compareOp,
-                                           "VUID-VkSamplerCreateInfo-compareEnable-01080");
+        skip |= context.ValidateRangedEnum(create_info_loc.lazy_dot(Field::compareOp), vvl::Enum::VkCompareOp,
+                                           create_info.compareOp, "VUID-VkSamplerCreateInfo-compareEnable-01080");
     }
 
     if ((create_info.addressModeU == VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER) ||
         (create_info.addressModeV == VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER) ||
         (create_info.addressModeW == VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER)) {
-        skip |= context.ValidateRangedEnum(create_info_loc.dot(Field::borderColor), vvl::Enum::VkBorderColor,
+        skip |= context.ValidateRangedEnum(create_info_loc.lazy_dot(Field::borderColor), vvl::Enum::VkBorderColor,
                                            create_info.borderColor, "VUID-VkSamplerCreateInfo-addressModeU-01078");
     }
 
@@ -756,7 +756,7 @@ bool Device::ValidateWriteDescriptorSet(const Context &context, const Location &
         // If called from vkCmdPushDescriptorSetKHR, the dstSet member is ignored.
         if (!is_push_descriptor) {
             // dstSet must be a valid VkDescriptorSet handle
-            skip |= context.ValidateRequiredHandle(writes_loc.dot(Field::dstSet), descriptor_writes.dstSet);
+            skip |= context.ValidateRequiredHandle(writes_loc.lazy_dot(Field::dstSet), descriptor_writes.dstSet);
         }
 
         const VkDescriptorType descriptor_type = descriptor_writes.descriptorType;
@@ -83,26 +83,26 @@ bool Device::ValidateIndirectExecutionSetShaderInfo(const Context& context, cons
     // implicit checks - done manually as code gen is hard to get correct
     skip |= context.ValidateStructType(shader_info_loc, &shader_info, VK_STRUCTURE_TYPE_INDIRECT_EXECUTION_SET_SHADER_INFO_EXT,
                                        false, kVUIDUndefined, "VUID-VkIndirectExecutionSetShaderInfoEXT-sType-sType");
-    skip |= context.ValidateStructTypeArray(shader_info_loc.dot(Field::shaderCount), shader_info_loc.dot(Field::pSetLayoutInfos),
-                                            shader_info.shaderCount, shader_info.pSetLayoutInfos,
-                                            VK_STRUCTURE_TYPE_INDIRECT_EXECUTION_SET_SHADER_LAYOUT_INFO_EXT, true, false,
-                                            "VUID-VkIndirectExecutionSetShaderLayoutInfoEXT-sType-sType",
-                                            "VUID-VkIndirectExecutionSetShaderInfoEXT-pSetLayoutInfos-parameter",
-                                            "VUID-VkIndirectExecutionSetShaderInfoEXT-shaderCount-arraylength");
+    skip |= context.ValidateStructTypeArray(
+        shader_info_loc.lazy_dot(Field::shaderCount), shader_info_loc.lazy_dot(Field::pSetLayoutInfos), shader_info.shaderCount,
+        shader_info.pSetLayoutInfos, VK_STRUCTURE_TYPE_INDIRECT_EXECUTION_SET_SHADER_LAYOUT_INFO_EXT, true, false,
+        "VUID-VkIndirectExecutionSetShaderLayoutInfoEXT-sType-sType",
+        "VUID-VkIndirectExecutionSetShaderInfoEXT-pSetLayoutInfos-parameter",
+        "VUID-VkIndirectExecutionSetShaderInfoEXT-shaderCount-arraylength");
 
     // Validate shaderCount once above
-    skip |= context.ValidateArray(shader_info_loc.dot(Field::shaderCount), shader_info_loc.dot(Field::pInitialShaders),
+    skip |= context.ValidateArray(shader_info_loc.lazy_dot(Field::shaderCount), shader_info_loc.lazy_dot(Field::pInitialShaders),
                                   shader_info.shaderCount, &shader_info.pInitialShaders, false, true, kVUIDUndefined,
                                   "VUID-VkIndirectExecutionSetShaderInfoEXT-pInitialShaders-parameter");
-    skip |=
-        context.ValidateArray(shader_info_loc.dot(Field::pushConstantRangeCount), shader_info_loc.dot(Field::pPushConstantRanges),
-                              shader_info.pushConstantRangeCount, &shader_info.pPushConstantRanges, false, true, kVUIDUndefined,
-                              "VUID-VkIndirectExecutionSetShaderInfoEXT-pPushConstantRanges-parameter");
+    skip |= context.ValidateArray(shader_info_loc.lazy_dot(Field::pushConstantRangeCount),
+                                  shader_info_loc.lazy_dot(Field::pPushConstantRanges), shader_info.pushConstantRangeCount,
+                                  &shader_info.pPushConstantRanges, false, true, kVUIDUndefined,
+                                  "VUID-VkIndirectExecutionSetShaderInfoEXT-pPushConstantRanges-parameter");
 
     if (shader_info.pPushConstantRanges != nullptr) {
         for (uint32_t i = 0; i < shader_info.pushConstantRangeCount; ++i) {
             const Location pc_range_loc = shader_info_loc.dot(Field::pPushConstantRanges, i);
-            skip |= context.ValidateFlags(pc_range_loc.dot(Field::stageFlags), vvl::FlagBitmask::VkShaderStageFlagBits,
+            skip |= context.ValidateFlags(pc_range_loc.lazy_dot(Field::stageFlags), vvl::FlagBitmask::VkShaderStageFlagBits,
                                           AllVkShaderStageFlagBits, shader_info.pPushConstantRanges[i].stageFlags, kRequiredFlags,
                                           "VUID-VkPushConstantRange-stageFlags-parameter",
                                           "VUID-VkPushConstantRange-stageFlags-requiredbitmask");
@@ -187,10 +187,10 @@ bool Device::ValidateIndirectCommandsIndexBufferToken(const Context& context,
                                                       const VkIndirectCommandsIndexBufferTokenEXT& index_buffer_token,
                                                       const Location& index_buffer_token_loc) const {
     bool skip = false;
-    skip |= context.ValidateFlags(index_buffer_token_loc.dot(Field::mode), vvl::FlagBitmask::VkIndirectCommandsInputModeFlagBitsEXT,
-                                  AllVkIndirectCommandsInputModeFlagBitsEXT, index_buffer_token.mode, kRequiredSingleBit,
-                                  "VUID-VkIndirectCommandsIndexBufferTokenEXT-mode-parameter",
-                                  "VUID-VkIndirectCommandsIndexBufferTokenEXT-mode-11135");
+    skip |= context.ValidateFlags(
+        index_buffer_token_loc.lazy_dot(Field::mode), vvl::FlagBitmask::VkIndirectCommandsInputModeFlagBitsEXT,
+        AllVkIndirectCommandsInputModeFlagBitsEXT, index_buffer_token.mode, kRequiredSingleBit,
+        "VUID-VkIndirectCommandsIndexBufferTokenEXT-mode-parameter", "VUID-VkIndirectCommandsIndexBufferTokenEXT-mode-11135");
 
     const auto& props = phys_dev_ext_props.device_generated_commands_props;
     if ((index_buffer_token.mode & props.supportedIndirectCommandsInputModes) == 0) {
@@ -206,10 +206,10 @@ bool Device::ValidateIndirectCommandsExecutionSetToken(const Context& context,
                                                        const VkIndirectCommandsExecutionSetTokenEXT& exe_set_token,
                                                        const Location& exe_set_token_loc) const {
     bool skip = false;
-    skip |= context.ValidateRangedEnum(exe_set_token_loc.dot(Field::type), vvl::Enum::VkIndirectExecutionSetInfoTypeEXT,
+    skip |= context.ValidateRangedEnum(exe_set_token_loc.lazy_dot(Field::type), vvl::Enum::VkIndirectExecutionSetInfoTypeEXT,
                                        exe_set_token.type, "VUID-VkIndirectCommandsExecutionSetTokenEXT-type-parameter");
 
-    skip |= context.ValidateFlags(exe_set_token_loc.dot(Field::shaderStages), vvl::FlagBitmask::VkShaderStageFlagBits,
+    skip |= context.ValidateFlags(exe_set_token_loc.lazy_dot(Field::shaderStages), vvl::FlagBitmask::VkShaderStageFlagBits,
                                   AllVkShaderStageFlagBits, exe_set_token.shaderStages, kRequiredFlags,
                                   "VUID-VkIndirectCommandsExecutionSetTokenEXT-shaderStages-parameter",
                                   "VUID-VkIndirectCommandsExecutionSetTokenEXT-shaderStages-requiredbitmask");
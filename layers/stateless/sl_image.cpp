@@ -60,9 +60,9 @@ bool Device::manual_PreCallValidateCreateImage(VkDevice device, const VkImageCre
                                     create_info_loc.dot(Field::extent).dot(Field::depth));
 
     skip |= context.ValidateNotZero(pCreateInfo->mipLevels == 0, "VUID-VkImageCreateInfo-mipLevels-00947",
-                                    create_info_loc.dot(Field::mipLevels));
+                                    create_info_loc.lazy_dot(Field::mipLevels));
     skip |= context.ValidateNotZero(pCreateInfo->arrayLayers == 0, "VUID-VkImageCreateInfo-arrayLayers-00948",
-                                    create_info_loc.dot(Field::arrayLayers));
+                                    create_info_loc.lazy_dot(Field::arrayLayers));
 
     if (!IsValueIn(pCreateInfo->initialLayout,
                    {VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_PREINITIALIZED, VK_IMAGE_LAYOUT_ZERO_INITIALIZED_EXT})) {
@@ -125,14 +125,14 @@ bool Instance::PreCallValidateCreateInstance(const VkInstanceCreateInfo *pCreate
     DeviceExtensions device_extensions(instance_extensions, local_api_version);
     Context context(*this, error_obj, device_extensions);
 
-    skip |= context.ValidateStructType(loc.dot(Field::pCreateInfo), pCreateInfo, VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO, true,
+    skip |= context.ValidateStructType(loc.lazy_dot(Field::pCreateInfo), pCreateInfo, VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO, true,
                                        "VUID-vkCreateInstance-pCreateInfo-parameter", "VUID-VkInstanceCreateInfo-sType-sType");
 
     if (pAllocator != nullptr) {
         [[maybe_unused]] const Location pAllocator_loc = loc.dot(Field::pAllocator);
         skip |= context.ValidateAllocationCallbacks(*pAllocator, pAllocator_loc);
     }
-    skip |= context.ValidateRequiredPointer(loc.dot(Field::pInstance), pInstance, "VUID-vkCreateInstance-pInstance-parameter");
+    skip |= context.ValidateRequiredPointer(loc.lazy_dot(Field::pInstance), pInstance, "VUID-vkCreateInstance-pInstance-parameter");
 
     uint32_t api_version_nopatch = VK_MAKE_VERSION(VK_VERSION_MAJOR(local_api_version), VK_VERSION_MINOR(local_api_version), 0);
     const Location create_info_loc = loc.dot(Field::pCreateInfo);
@@ -152,13 +152,13 @@ bool Instance::PreCallValidateCreateInstance(const VkInstanceCreateInfo *pCreate
     }
 
     if (pCreateInfo != nullptr) {
-        skip |= context.ValidateFlags(create_info_loc.dot(Field::flags), vvl::FlagBitmask::VkInstanceCreateFlagBits,
+        skip |= context.ValidateFlags(create_info_loc.lazy_dot(Field::flags), vvl::FlagBitmask::VkInstanceCreateFlagBits,
                                       AllVkInstanceCreateFlagBits, pCreateInfo->flags, kOptionalFlags,
                                       "VUID-VkInstanceCreateInfo-flags-parameter");
 
         skip |= context.ValidateStructType(
-            create_info_loc.dot(Field::pApplicationInfo), pCreateInfo->pApplicationInfo, VK_STRUCTURE_TYPE_APPLICATION_INFO, false,
-            "VUID-VkInstanceCreateInfo-pApplicationInfo-parameter", "VUID-VkApplicationInfo-sType-sType");
+            create_info_loc.lazy_dot(Field::pApplicationInfo), pCreateInfo->pApplicationInfo, VK_STRUCTURE_TYPE_APPLICATION_INFO,
+            false, "VUID-VkInstanceCreateInfo-pApplicationInfo-parameter", "VUID-VkApplicationInfo-sType-sType");
 
         if (pCreateInfo->pApplicationInfo != nullptr) {
             [[maybe_unused]] const Location pApplicationInfo_loc = create_info_loc.dot(Field::pApplicationInfo);
@@ -467,19 +467,20 @@ bool Device::manual_PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPi
             }
 
             skip |= context.ValidateStructTypeArray(
-                create_info_loc.dot(Field::stageCount), create_info_loc.dot(Field::pStages), create_info.stageCount,
+                create_info_loc.lazy_dot(Field::stageCount), create_info_loc.lazy_dot(Field::pStages), create_info.stageCount,
                 create_info.pStages, VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, true, true,
                 "VUID-VkPipelineShaderStageCreateInfo-sType-sType", "VUID-VkGraphicsPipelineCreateInfo-pStages-06600",
                 "VUID-VkGraphicsPipelineCreateInfo-pStages-06600");
             // Can be null with enough dynamic states
-            skip |= context.ValidateStructType(create_info_loc.dot(Field::pRasterizationState), create_info.pRasterizationState,
+            skip |= context.ValidateStructType(create_info_loc.lazy_dot(Field::pRasterizationState),
+                                               create_info.pRasterizationState,
                                                VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO, false,
                                                "VUID-VkGraphicsPipelineCreateInfo-pRasterizationState-09040",
                                                "VUID-VkPipelineRasterizationStateCreateInfo-sType-sType");
         }
 
         if (graphics_lib_info && (graphics_lib_info->flags & (VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT))) {
-            skip |= context.ValidateArray(create_info_loc.dot(Field::stageCount), create_info_loc.dot(Field::pStages),
+            skip |= context.ValidateArray(create_info_loc.lazy_dot(Field::stageCount), create_info_loc.lazy_dot(Field::pStages),
                                           create_info.stageCount, &create_info.pStages, true, true,
                                           "VUID-VkGraphicsPipelineCreateInfo-flags-06644",
                                           "VUID-VkGraphicsPipelineCreateInfo-flags-06640");
@@ -1084,9 +1085,9 @@ bool Device::manual_PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPi
 
                 // If logicOpEnable is VK_TRUE, logicOp must be a valid VkLogicOp value
                 if (color_blend_state.logicOpEnable == VK_TRUE) {
-                    skip |=
-                        context.ValidateRangedEnum(color_loc.dot(Field::logicOp), vvl::Enum::VkLogicOp, color_blend_state.logicOp,
-                                                   "VUID-VkPipelineColorBlendStateCreateInfo-logicOpEnable-00607");
+                    skip |= context.ValidateRangedEnum(color_loc.lazy_dot(Field::logicOp), vvl::Enum::VkLogicOp,
+                                                       color_blend_state.logicOp,
+                                                       "VUID-VkPipelineColorBlendStateCreateInfo-logicOpEnable-00607");
                 }
 
                 const bool dynamic_not_set = (!vvl::Contains(dynamic_state_map, VK_DYNAMIC_STATE_COLOR_BLEND_ADVANCED_EXT) ||
@@ -1096,9 +1097,10 @@ bool Device::manual_PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPi
 
                 // If any of the dynamic states are not set still need a valid array
                 if ((color_blend_state.attachmentCount > 0) && dynamic_not_set) {
-                    skip |= context.ValidateArray(color_loc.dot(Field::attachmentCount), color_loc.dot(Field::pAttachments),
-                                                  color_blend_state.attachmentCount, &color_blend_state.pAttachments, false, true,
-                                                  kVUIDUndefined, "VUID-VkPipelineColorBlendStateCreateInfo-pAttachments-07353");
+                    skip |= context.ValidateArray(color_loc.lazy_dot(Field::attachmentCount),
+                                                  color_loc.lazy_dot(Field::pAttachments), color_blend_state.attachmentCount,
+                                                  &color_blend_state.pAttachments, false, true, kVUIDUndefined,
+                                                  "VUID-VkPipelineColorBlendStateCreateInfo-pAttachments-07353");
                 }
 
                 auto color_write = vku::FindStructInPNextChain<VkPipelineColorWriteCreateInfoEXT>(color_blend_state.pNext);
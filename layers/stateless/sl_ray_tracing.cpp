@@ -174,7 +174,7 @@ bool Device::ValidateAccelerationStructureInfoNV(const Context &context, const V
                              "or VK_GEOMETRY_TYPE_AABBS_NV.");
         }
     }
-    skip |= context.ValidateFlags(loc.dot(Field::flags), vvl::FlagBitmask::VkBuildAccelerationStructureFlagBitsKHR,
+    skip |= context.ValidateFlags(loc.lazy_dot(Field::flags), vvl::FlagBitmask::VkBuildAccelerationStructureFlagBitsKHR,
                                   AllVkBuildAccelerationStructureFlagBitsKHR, info.flags, kOptionalFlags,
                                   "VUID-VkAccelerationStructureInfoNV-flags-parameter");
     return skip;
@@ -1030,7 +1030,7 @@ bool Device::ValidateAccelerationStructureBuildGeometryInfoKHR(const Context &co
         const Location geometry_ptr_loc = info_loc.dot(info.pGeometries ? Field::pGeometries : Field::ppGeometries, geom_i);
         const Location geometry_loc = geometry_ptr_loc.dot(Field::geometry);
 
-        skip |= context.ValidateRangedEnum(geometry_ptr_loc.dot(Field::geometryType), vvl::Enum::VkGeometryTypeKHR,
+        skip |= context.ValidateRangedEnum(geometry_ptr_loc.lazy_dot(Field::geometryType), vvl::Enum::VkGeometryTypeKHR,
                                            geom.geometryType, "VUID-VkAccelerationStructureGeometryKHR-geometryType-parameter");
         if (geom.geometryType == VK_GEOMETRY_TYPE_TRIANGLES_KHR) {
             const Location triangles_loc = geometry_loc.dot(Field::triangles);
@@ -1172,8 +1172,8 @@ bool Device::manual_PreCallValidateCmdBuildAccelerationStructuresKHR(
                              info.scratchData.deviceAddress,
                              phys_dev_ext_props.acc_structure_props.minAccelerationStructureScratchOffsetAlignment);
         }
-        skip |= context.ValidateRangedEnum(info_loc.dot(Field::mode), vvl::Enum::VkBuildAccelerationStructureModeKHR, info.mode,
-                                           "VUID-vkCmdBuildAccelerationStructuresKHR-mode-04628");
+        skip |= context.ValidateRangedEnum(info_loc.lazy_dot(Field::mode), vvl::Enum::VkBuildAccelerationStructureModeKHR,
+                                           info.mode, "VUID-vkCmdBuildAccelerationStructuresKHR-mode-04628");
         if (info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR && info.srcAccelerationStructure == VK_NULL_HANDLE) {
             skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-04630", commandBuffer, info_loc.dot(Field::mode),
                              "is VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR, but srcAccelerationStructure is VK_NULL_HANDLE.");
@@ -1279,8 +1279,9 @@ bool Device::manual_PreCallValidateCmdBuildAccelerationStructuresKHR(
                     }
             }
         }
-        skip |= context.ValidateArray(info_loc.dot(Field::geometryCount), error_obj.location.dot(Field::ppBuildRangeInfos, info_i),
-                                      info.geometryCount, &ppBuildRangeInfos[info_i], false, true, kVUIDUndefined,
+        skip |= context.ValidateArray(info_loc.lazy_dot(Field::geometryCount),
+                                      error_obj.location.dot(Field::ppBuildRangeInfos, info_i), info.geometryCount,
+                                      &ppBuildRangeInfos[info_i], false, true, kVUIDUndefined,
                                       "VUID-vkCmdBuildAccelerationStructuresKHR-ppBuildRangeInfos-03676");
     }
 
@@ -1318,8 +1319,8 @@ bool Device::manual_PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(
                              info.scratchData.deviceAddress,
                              phys_dev_ext_props.acc_structure_props.minAccelerationStructureScratchOffsetAlignment);
         }
-        skip |= context.ValidateRangedEnum(info_loc.dot(Field::mode), vvl::Enum::VkBuildAccelerationStructureModeKHR, info.mode,
-                                           "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-mode-04628");
+        skip |= context.ValidateRangedEnum(info_loc.lazy_dot(Field::mode), vvl::Enum::VkBuildAccelerationStructureModeKHR,
+                                           info.mode, "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-mode-04628");
 
         if (info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR && info.srcAccelerationStructure == VK_NULL_HANDLE) {
             skip |=
@@ -1493,11 +1494,12 @@ bool Device::manual_PreCallValidateBuildAccelerationStructuresKHR(
 
         skip |= ValidateAccelerationStructureBuildGeometryInfoKHR(context, info, error_obj.handle, error_obj.location);
 
-        skip |= context.ValidateRangedEnum(info_loc.dot(Field::mode), vvl::Enum::VkBuildAccelerationStructureModeKHR, info.mode,
-                                           "VUID-vkBuildAccelerationStructuresKHR-mode-04628");
+        skip |= context.ValidateRangedEnum(info_loc.lazy_dot(Field::mode), vvl::Enum::VkBuildAccelerationStructureModeKHR,
+                                           info.mode, "VUID-vkBuildAccelerationStructuresKHR-mode-04628");
 
-        skip |= context.ValidateArray(info_loc.dot(Field::geometryCount), error_obj.location.dot(Field::ppBuildRangeInfos, info_i),
-                                      info.geometryCount, &ppBuildRangeInfos[info_i], false, true, kVUIDUndefined,
+        skip |= context.ValidateArray(info_loc.lazy_dot(Field::geometryCount),
+                                      error_obj.location.dot(Field::ppBuildRangeInfos, info_i), info.geometryCount,
+                                      &ppBuildRangeInfos[info_i], false, true, kVUIDUndefined,
                                       "VUID-vkBuildAccelerationStructuresKHR-ppBuildRangeInfos-03676");
 
         if (info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR) {
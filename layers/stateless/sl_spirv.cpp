@@ -99,7 +99,7 @@ bool SpirvValidator::Validate(const spirv::Module &module_state, const spirv::St
         skip |= ValidateSubgroupRotateClustered(module_state, insn, loc);
     }
 
-    for (const auto &entry_point : module_state.static_data_.entry_points) {
+    for (const auto &entry_point : module_state.GetStaticData().entry_points) {
         skip |= ValidateShaderStageGroupNonUniform(module_state, stateless_data, entry_point->stage, loc);
         skip |= ValidateShaderStageInputOutputLimits(module_state, *entry_point, stateless_data, loc);
         skip |= ValidateShaderFloatControl(module_state, *entry_point, stateless_data, loc);
@@ -391,7 +391,7 @@ bool SpirvValidator::ValidateFma(const spirv::Module &module_state, const spirv:
 bool SpirvValidator::ValidateVariables(const spirv::Module &module_state, const Location &loc) const {
     bool skip = false;
 
-    for (const spirv::Instruction *insn : module_state.static_data_.explicit_memory_inst) {
+    for (const spirv::Instruction *insn : module_state.GetStaticData().explicit_memory_inst) {
         const uint32_t opcode = insn->Opcode();
         if (opcode == spv::OpVariable || opcode == spv::OpUntypedVariableKHR) {
             const uint32_t storage_class = insn->StorageClass();
@@ -662,7 +662,7 @@ bool SpirvValidator::ValidateTransformFeedbackDecorations(const spirv::Module &m
     std::vector<const spirv::Instruction *> xfb_buffers;
     std::vector<const spirv::Instruction *> xfb_offsets;
 
-    for (const spirv::Instruction *op_decorate : module_state.static_data_.decoration_inst) {
+    for (const spirv::Instruction *op_decorate : module_state.GetStaticData().decoration_inst) {
         uint32_t decoration = op_decorate->Word(2);
         if (decoration == spv::DecorationXfbStride) {
             uint32_t stride = op_decorate->Word(3);
@@ -1361,7 +1361,7 @@ bool SpirvValidator::ValidateShaderFloatControl(const spirv::Module &module_stat
         }
     }
 
-    for (const spirv::Instruction *insn : module_state.static_data_.decoration_inst) {
+    for (const spirv::Instruction *insn : module_state.GetStaticData().decoration_inst) {
         uint32_t decoration = insn->Word(2);
         if (decoration != spv::DecorationFPFastMathMode) {
             continue;
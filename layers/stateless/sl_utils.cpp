@@ -150,25 +150,25 @@ bool Context::ValidateRequiredPointer(const Location &loc, const void *value, co
 
 bool Context::ValidateAllocationCallbacks(const VkAllocationCallbacks &callback, const Location &loc) const {
     bool skip = false;
-    skip |= ValidateRequiredPointer(loc.dot(Field::pfnAllocation), reinterpret_cast<const void *>(callback.pfnAllocation),
+    skip |= ValidateRequiredPointer(loc.lazy_dot(Field::pfnAllocation), reinterpret_cast<const void *>(callback.pfnAllocation),
                                     "VUID-VkAllocationCallbacks-pfnAllocation-00632");
 
-    skip |= ValidateRequiredPointer(loc.dot(Field::pfnReallocation), reinterpret_cast<const void *>(callback.pfnReallocation),
+    skip |= ValidateRequiredPointer(loc.lazy_dot(Field::pfnReallocation), reinterpret_cast<const void *>(callback.pfnReallocation),
                                     "VUID-VkAllocationCallbacks-pfnReallocation-00633");
 
-    skip |= ValidateRequiredPointer(loc.dot(Field::pfnFree), reinterpret_cast<const void *>(callback.pfnFree),
+    skip |= ValidateRequiredPointer(loc.lazy_dot(Field::pfnFree), reinterpret_cast<const void *>(callback.pfnFree),
                                     "VUID-VkAllocationCallbacks-pfnFree-00634");
 
     if (callback.pfnInternalAllocation) {
-        skip |=
-            ValidateRequiredPointer(loc.dot(Field::pfnInternalAllocation), reinterpret_cast<const void *>(callback.pfnInternalFree),
-                                    "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+        skip |= ValidateRequiredPointer(loc.lazy_dot(Field::pfnInternalAllocation),
+                                        reinterpret_cast<const void *>(callback.pfnInternalFree),
+                                        "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
     }
 
     if (callback.pfnInternalFree) {
-        skip |=
-            ValidateRequiredPointer(loc.dot(Field::pfnInternalFree), reinterpret_cast<const void *>(callback.pfnInternalAllocation),
-                                    "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
+        skip |= ValidateRequiredPointer(loc.lazy_dot(Field::pfnInternalFree),
+                                        reinterpret_cast<const void *>(callback.pfnInternalAllocation),
+                                        "VUID-VkAllocationCallbacks-pfnInternalAllocation-00635");
     }
     return skip;
 }
@@ -390,6 +390,42 @@ bool Context::ValidateFlagsImplementation(const Location &loc, vvl::FlagBitmask
     return skip;
 }
 
+bool Context::IsValidFlags(vvl::FlagBitmask flag_bitmask, VkFlags all_flags, VkFlags value, const FlagType flag_type,
+                           bool instance_function) const {
+    if (value == 0) {
+        return flag_type == kOptionalFlags || flag_type == kOptionalSingleBit;
+    }
+    const bool is_bits_type = flag_type == kRequiredSingleBit || flag_type == kOptionalSingleBit;
+    if (is_bits_type && (value & (value - 1)) != 0) {
+        return false;
+    }
+    if (ignore_unknown_enums) {
+        return true;
+    }
+    if ((value & ~all_flags) != 0) {
+        return false;
+    }
+    return IsValidFlagValue(flag_bitmask, value, instance_function).empty();
+}
+
+bool Context::IsValidFlags(vvl::FlagBitmask flag_bitmask, VkFlags64 all_flags, VkFlags64 value, const FlagType flag_type,
+                           bool instance_function) const {
+    if (value == 0) {
+        return flag_type == kOptionalFlags || flag_type == kOptionalSingleBit;
+    }
+    const bool is_bits_type = flag_type == kRequiredSingleBit || flag_type == kOptionalSingleBit;
+    if (is_bits_type && (value & (value - 1)) != 0) {
+        return false;
+    }
+    if (ignore_unknown_enums) {
+        return true;
+    }
+    if ((value & ~all_flags) != 0) {
+        return false;
+    }
+    return IsValidFlag64Value(flag_bitmask, value, instance_function).empty();
+}
+
 bool Context::ValidateFlags(const Location &loc, vvl::FlagBitmask flag_bitmask, VkFlags all_flags, VkFlags value,
                             const FlagType flag_type, const char *vuid, const char *flags_zero_vuid, bool instance_function) const {
     bool skip = false;
@@ -113,7 +113,7 @@ bool Device::ValidateSwapchainCreateInfo(const Context &context, const VkSwapcha
     }
 
     skip |= context.ValidateNotZero(create_info.imageArrayLayers == 0, "VUID-VkSwapchainCreateInfoKHR-imageArrayLayers-01275",
-                                    loc.dot(Field::imageArrayLayers));
+                                    loc.lazy_dot(Field::imageArrayLayers));
 
     // Validate VK_KHR_image_format_list VkImageFormatListCreateInfo
     const auto format_list_info = vku::FindStructInPNextChain<VkImageFormatListCreateInfo>(create_info.pNext);
@@ -298,7 +298,7 @@ bool Instance::manual_PreCallValidateCreateDisplayModeKHR(VkPhysicalDevice physi
         context.ValidateNotZero(display_mode_parameters.visibleRegion.height == 0, "VUID-VkDisplayModeParametersKHR-height-01991",
                                 param_loc.dot(Field::visibleRegion).dot(Field::width));
     skip |= context.ValidateNotZero(display_mode_parameters.refreshRate == 0, "VUID-VkDisplayModeParametersKHR-refreshRate-01992",
-                                    param_loc.dot(Field::refreshRate));
+                                    param_loc.lazy_dot(Field::refreshRate));
 
     return skip;
 }
@@ -46,24 +46,32 @@ class Context {
         : log(log_), error_obj(err_), extensions(exts_), ignore_unknown_enums(ignore_unknown_enums_) {}
 
     bool ValidateNotZero(bool is_zero, const char *vuid, const Location &loc) const;
+    bool ValidateNotZero(bool is_zero, const char *vuid, const LazyLocation &loc) const {
+        return is_zero && ValidateNotZero(is_zero, vuid, loc.Get());
+    }
 
     bool ValidateRequiredPointer(const Location &loc, const void *value, const char *vuid) const;
+    bool ValidateRequiredPointer(const LazyLocation &loc, const void *value, const char *vuid) const {
+        return value == nullptr && ValidateRequiredPointer(loc.Get(), value, vuid);
+    }
 
     bool ValidateAllocationCallbacks(const VkAllocationCallbacks &callback, const Location &loc) const;
 
-    template <typename T1, typename T2>
-    bool ValidateArray(const Location &count_loc, const Location &array_loc, T1 count, const T2 *array, bool count_required,
-                       bool array_required, const char *count_required_vuid, const char *array_required_vuid) const {
+    // The templated helpers take either a Location or a LazyLocation, and only call Get() on the error path
+    template <typename CountLocation, typename ArrayLocation, typename T1, typename T2>
+    bool ValidateArray(const CountLocation &count_loc, const ArrayLocation &array_loc, T1 count, const T2 *array,
+                       bool count_required, bool array_required, const char *count_required_vuid,
+                       const char *array_required_vuid) const {
         bool skip = false;
 
         // Count parameters not tagged as optional cannot be 0
         if (count_required && (count == 0)) {
-            skip |= log.LogError(count_required_vuid, error_obj.handle, count_loc, "must be greater than 0.");
+            skip |= log.LogError(count_required_vuid, error_obj.handle, count_loc.Get(), "must be greater than 0.");
         }
 
         // Array parameters not tagged as optional cannot be NULL, unless the count is 0
         if (array_required && (count != 0) && (*array == nullptr)) {
-            skip |= log.LogError(array_required_vuid, error_obj.handle, array_loc, "is NULL.");
+            skip |= log.LogError(array_required_vuid, error_obj.handle, array_loc.Get(), "is NULL.");
         }
 
         return skip;
@@ -88,24 +96,25 @@ class Context {
         return skip;
     }
 
-    template <typename T>
-    bool ValidateStructType(const Location &loc, const T *value, VkStructureType sType, bool required, const char *struct_vuid,
-                            const char *stype_vuid) const {
+    template <typename LocationType, typename T>
+    bool ValidateStructType(const LocationType &loc, const T *value, VkStructureType sType, bool required,
+                            const char *struct_vuid, const char *stype_vuid) const {
         bool skip = false;
 
         if (value == nullptr) {
             if (required) {
-                skip |= log.LogError(struct_vuid, error_obj.handle, loc, "is NULL.");
+                skip |= log.LogError(struct_vuid, error_obj.handle, loc.Get(), "is NULL.");
             }
         } else if (value->sType != sType) {
-            skip |= log.LogError(stype_vuid, error_obj.handle, loc.dot(Field::sType), "must be %s.", string_VkStructureType(sType));
+            skip |= log.LogError(stype_vuid, error_obj.handle, loc.Get().dot(Field::sType), "must be %s.",
+                                 string_VkStructureType(sType));
         }
 
         return skip;
     }
 
-    template <typename T>
-    bool ValidateStructTypeArray(const Location &count_loc, const Location &array_loc, uint32_t count, const T *array,
+    template <typename CountLocation, typename ArrayLocation, typename T>
+    bool ValidateStructTypeArray(const CountLocation &count_loc, const ArrayLocation &array_loc, uint32_t count, const T *array,
                                  VkStructureType sType, bool count_required, bool array_required, const char *stype_vuid,
                                  const char *param_vuid, const char *count_required_vuid) const {
         bool skip = false;
@@ -117,7 +126,7 @@ class Context {
             // Verify that all structs in the array have the correct type
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i].sType != sType) {
-                    skip |= log.LogError(stype_vuid, error_obj.handle, array_loc.dot(i).dot(Field::sType), "must be %s",
+                    skip |= log.LogError(stype_vuid, error_obj.handle, array_loc.Get().dot(i).dot(Field::sType), "must be %s",
                                          string_VkStructureType(sType));
                 }
             }
@@ -126,10 +135,10 @@ class Context {
         return skip;
     }
 
-    template <typename T>
-    bool ValidateStructPointerTypeArray(const Location &count_loc, const Location &array_loc, uint32_t count, const T *array,
-                                        VkStructureType sType, bool count_required, bool array_required, const char *stype_vuid,
-                                        const char *param_vuid, const char *count_required_vuid) const {
+    template <typename CountLocation, typename ArrayLocation, typename T>
+    bool ValidateStructPointerTypeArray(const CountLocation &count_loc, const ArrayLocation &array_loc, uint32_t count,
+                                        const T *array, VkStructureType sType, bool count_required, bool array_required,
+                                        const char *stype_vuid, const char *param_vuid, const char *count_required_vuid) const {
         bool skip = false;
 
         if ((array == nullptr) || (count == 0)) {
@@ -139,7 +148,7 @@ class Context {
             // Verify that all structs in the array have the correct type
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i]->sType != sType) {
-                    skip |= log.LogError(stype_vuid, error_obj.handle, array_loc.dot(i).dot(Field::sType), "must be %s",
+                    skip |= log.LogError(stype_vuid, error_obj.handle, array_loc.Get().dot(i).dot(Field::sType), "must be %s",
                                          string_VkStructureType(sType));
                 }
             }
@@ -148,8 +157,8 @@ class Context {
         return skip;
     }
 
-    template <typename T>
-    bool ValidateStructTypeArray(const Location &count_loc, const Location &array_loc, uint32_t *count, const T *array,
+    template <typename CountLocation, typename ArrayLocation, typename T>
+    bool ValidateStructTypeArray(const CountLocation &count_loc, const ArrayLocation &array_loc, uint32_t *count, const T *array,
                                  VkStructureType sType, bool count_ptr_required, bool count_value_required, bool array_required,
                                  const char *stype_vuid, const char *param_vuid, const char *count_ptr_required_vuid,
                                  const char *count_required_vuid) const {
@@ -157,7 +166,7 @@ class Context {
 
         if (count == nullptr) {
             if (count_ptr_required) {
-                skip |= log.LogError(count_ptr_required_vuid, error_obj.handle, count_loc, "is NULL.");
+                skip |= log.LogError(count_ptr_required_vuid, error_obj.handle, count_loc.Get(), "is NULL.");
             }
         } else {
             skip |=
@@ -168,17 +177,18 @@ class Context {
         return skip;
     }
 
-    template <typename T>
-    bool ValidateRequiredHandle(const Location &loc, T value) const {
+    template <typename LocationType, typename T>
+    bool ValidateRequiredHandle(const LocationType &loc, T value) const {
         bool skip = false;
         if (value == VK_NULL_HANDLE) {
-            skip |= log.LogError("UNASSIGNED-GeneralParameterError-RequiredHandle", error_obj.handle, loc, "is VK_NULL_HANDLE.");
+            skip |= log.LogError("UNASSIGNED-GeneralParameterError-RequiredHandle", error_obj.handle, loc.Get(),
+                                 "is VK_NULL_HANDLE.");
         }
         return skip;
     }
 
-    template <typename T>
-    bool ValidateHandleArray(const Location &count_loc, const Location &array_loc, uint32_t count, const T *array,
+    template <typename CountLocation, typename ArrayLocation, typename T>
+    bool ValidateHandleArray(const CountLocation &count_loc, const ArrayLocation &array_loc, uint32_t count, const T *array,
                              bool count_required, bool array_required, const char *count_required_vuid) const {
         bool skip = false;
 
@@ -189,8 +199,8 @@ class Context {
             // Verify that no handles in the array are VK_NULL_HANDLE
             for (uint32_t i = 0; i < count; ++i) {
                 if (array[i] == VK_NULL_HANDLE) {
-                    skip |= log.LogError("UNASSIGNED-GeneralParameterError-RequiredHandleArray", error_obj.handle, array_loc.dot(i),
-                                         "is VK_NULL_HANDLE.");
+                    skip |= log.LogError("UNASSIGNED-GeneralParameterError-RequiredHandleArray", error_obj.handle,
+                                         array_loc.Get().dot(i), "is VK_NULL_HANDLE.");
                 }
             }
         }
@@ -215,13 +225,16 @@ class Context {
                              const bool is_const_param = true) const;
 
     bool ValidateBool32(const Location &loc, VkBool32 value) const;
+    bool ValidateBool32(const LazyLocation &loc, VkBool32 value) const {
+        return value != VK_TRUE && value != VK_FALSE && ValidateBool32(loc.Get(), value);
+    }
 
     bool ValidateBool32Array(const Location &count_loc, const Location &array_loc, uint32_t count, const VkBool32 *array,
                              bool count_required, bool array_required, const char *count_required_vuid,
                              const char *array_required_vuid) const;
 
-    template <typename T>
-    bool ValidateRangedEnum(const Location &loc, vvl::Enum name, T value, const char *vuid) const {
+    template <typename LocationType, typename T>
+    bool ValidateRangedEnum(const LocationType &loc, vvl::Enum name, T value, const char *vuid) const {
         bool skip = false;
         if (ignore_unknown_enums) {
             return skip;
@@ -229,7 +242,7 @@ class Context {
         ValidValue result = IsValidEnumValue(value);
 
         if (result == ValidValue::NotFound) {
-            skip |= log.LogError(vuid, error_obj.handle, loc,
+            skip |= log.LogError(vuid, error_obj.handle, loc.Get(),
                                  "(%" PRIu32
                                  ") does not fall within the begin..end range of the %s enumeration tokens and is "
                                  "not an extension added token.",
@@ -237,7 +250,7 @@ class Context {
         } else if (result == ValidValue::NoExtension) {
             // If called from an instance function, there is no device to base extension support off of
             auto extensions = GetEnumExtensions(value);
-            skip |= log.LogError(vuid, error_obj.handle, loc, "(%s) requires the extensions %s.", DescribeEnum(value),
+            skip |= log.LogError(vuid, error_obj.handle, loc.Get(), "(%s) requires the extensions %s.", DescribeEnum(value),
                                  String(extensions).c_str());
         }
 
@@ -275,21 +288,50 @@ class Context {
     }
 
     bool ValidateReservedFlags(const Location &loc, VkFlags value, const char *vuid) const;
+    bool ValidateReservedFlags(const LazyLocation &loc, VkFlags value, const char *vuid) const {
+        return value != 0 && ValidateReservedFlags(loc.Get(), value, vuid);
+    }
 
     bool ValidateReservedFlags(const Location &loc, VkFlags64 value, const char *vuid) const;
+    bool ValidateReservedFlags(const LazyLocation &loc, VkFlags64 value, const char *vuid) const {
+        return value != 0 && ValidateReservedFlags(loc.Get(), value, vuid);
+    }
 
     // helper to implement validation of both 32 bit and 64 bit flags.
     template <typename FlagTypedef>
     bool ValidateFlagsImplementation(const Location &loc, vvl::FlagBitmask flag_bitmask, FlagTypedef all_flags, FlagTypedef value,
                                      const FlagType flag_type, const char *vuid, const char *flags_zero_vuid = nullptr) const;
 
+    // Returns true if ValidateFlags() would not log anything, so the LazyLocation overloads only build the Location on errors
+    bool IsValidFlags(vvl::FlagBitmask flag_bitmask, VkFlags all_flags, VkFlags value, const FlagType flag_type,
+                      bool instance_function) const;
+    bool IsValidFlags(vvl::FlagBitmask flag_bitmask, VkFlags64 all_flags, VkFlags64 value, const FlagType flag_type,
+                      bool instance_function) const;
+
     bool ValidateFlags(const Location &loc, vvl::FlagBitmask flag_bitmask, VkFlags all_flags, VkFlags value,
                        const FlagType flag_type, const char *vuid, const char *flags_zero_vuid = nullptr,
                        bool instance_function = false) const;
+    // Zero is always valid for optional flags, which is most of the flags passed to the API
+    bool ValidateFlags(const LazyLocation &loc, vvl::FlagBitmask flag_bitmask, VkFlags all_flags, VkFlags value,
+                       const FlagType flag_type, const char *vuid, const char *flags_zero_vuid = nullptr,
+                       bool instance_function = false) const {
+        if (IsValidFlags(flag_bitmask, all_flags, value, flag_type, instance_function)) {
+            return false;
+        }
+        return ValidateFlags(loc.Get(), flag_bitmask, all_flags, value, flag_type, vuid, flags_zero_vuid, instance_function);
+    }
 
     bool ValidateFlags(const Location &loc, vvl::FlagBitmask flag_bitmask, VkFlags64 all_flags, VkFlags64 value,
                        const FlagType flag_type, const char *vuid, const char *flags_zero_vuid = nullptr,
                        bool instance_function = false) const;
+    bool ValidateFlags(const LazyLocation &loc, vvl::FlagBitmask flag_bitmask, VkFlags64 all_flags, VkFlags64 value,
+                       const FlagType flag_type, const char *vuid, const char *flags_zero_vuid = nullptr,
+                       bool instance_function = false) const {
+        if (IsValidFlags(flag_bitmask, all_flags, value, flag_type, instance_function)) {
+            return false;
+        }
+        return ValidateFlags(loc.Get(), flag_bitmask, all_flags, value, flag_type, vuid, flags_zero_vuid, instance_function);
+    }
 
     bool ValidateFlagsArray(const Location &count_loc, const Location &array_loc, vvl::FlagBitmask flag_bitmask, VkFlags all_flags,
                             uint32_t count, const VkFlags *array, bool count_required, const char *count_required_vuid,
@@ -576,7 +576,7 @@ void AccessContext::UpdateMemoryAccessStateFunctor::operator()(const AccessMap::
 // This is called with the *recorded* command buffers access context, with the *active* access context pass in, againsts which
 // hazards will be detected
 HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                                 const AccessContext &access_context) const {
+                                                 const AccessContext &access_context, DetectOptions options) const {
     // If the context is finalized we have a fast path to find first accesses within a range
     if (finalized_) {
         for (const auto &single_tag : sorted_first_accesses_.IterateSingleTagFirstAccesses(tag_range)) {
@@ -587,7 +587,7 @@ HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const Resourc
             assert(access.FirstAccessInTagRange(tag_range));
 
             HazardDetectFirstUse detector(access, queue_id, tag_range);
-            HazardResult hazard = access_context.DetectHazardRange(detector, access_range, DetectOptions::kDetectAll);
+            HazardResult hazard = access_context.DetectHazardRange(detector, access_range, options);
             if (hazard.IsHazard()) {
                 return hazard;
             }
@@ -603,7 +603,7 @@ HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const Resourc
             }
 
             HazardDetectFirstUse detector(access, queue_id, tag_range);
-            HazardResult hazard = access_context.DetectHazardRange(detector, access_range, DetectOptions::kDetectAll);
+            HazardResult hazard = access_context.DetectHazardRange(detector, access_range, options);
             if (hazard.IsHazard()) {
                 return hazard;
             }
@@ -617,7 +617,7 @@ HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const Resourc
                 continue;
             }
             HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
-            HazardResult hazard = access_context.DetectHazardRange(detector, recorded_access.first, DetectOptions::kDetectAll);
+            HazardResult hazard = access_context.DetectHazardRange(detector, recorded_access.first, options);
             if (hazard.IsHazard()) {
                 return hazard;
             }
@@ -301,8 +301,8 @@ class AccessContext {
     HazardResult DetectSubpassTransitionHazard(const SubpassBarrierTrackback &track_back,
                                                const AttachmentViewGen &attach_view) const;
 
-    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                      const AccessContext &access_context) const;
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      DetectOptions options = DetectOptions::kDetectAll) const;
     HazardResult DetectMarkerHazard(const vvl::Buffer &buffer, const AccessRange &range) const;
 
     const SubpassBarrierTrackback &GetDstExternalTrackBack() const { return dst_external_; }
@@ -62,10 +62,10 @@ HazardResult AccessState::DetectHazard(const SyncAccessInfo &usage_info) const {
         //
         // Look for casus belli for WAR
         if (HasReads()) {
-            for (const auto &read_access : GetReads()) {
-                if (IsReadHazard(usage_stage, read_access)) {
-                    return HazardResult::HazardVsPriorRead(this, usage_info, WRITE_AFTER_READ, read_access);
-                }
+            const uint64_t hazard_reads = ReadsMissingBarriersMask(last_reads, usage_stage);
+            if (hazard_reads) {
+                const ReadState read_access = last_reads.Get(GetFirstReadIndex(hazard_reads));
+                return HazardResult::HazardVsPriorRead(this, usage_info, WRITE_AFTER_READ, read_access);
             }
         } else if (last_write.has_value() && last_write->IsWriteHazard(usage_info)) {
             // Write-After-Write check -- if we have a previous write to test against
@@ -150,11 +150,12 @@ HazardResult AccessState::DetectHazard(const SyncAccessInfo &usage_info, const O
         }
         // If we're tracking any reads that aren't ordered against the current write, got to check 'em all.
         if ((ordered_stages & last_read_stages) != last_read_stages) {
-            for (const auto &read_access : GetReads()) {
-                if (read_access.stage & ordered_stages) continue;  // but we can skip the ordered ones
-                if (IsReadHazard(usage_stage, read_access)) {
-                    return HazardResult::HazardVsPriorRead(this, usage_info, WRITE_AFTER_READ, read_access);
-                }
+            // but we can skip the ordered ones
+            const uint64_t unordered_reads = ~ReadsIntersectingStagesMask(last_reads, ordered_stages, false);
+            const uint64_t hazard_reads = unordered_reads & ReadsMissingBarriersMask(last_reads, usage_stage);
+            if (hazard_reads) {
+                const ReadState read_access = last_reads.Get(GetFirstReadIndex(hazard_reads));
+                return HazardResult::HazardVsPriorRead(this, usage_info, WRITE_AFTER_READ, read_access);
             }
         }
         return {};
@@ -270,9 +271,11 @@ HazardResult AccessState::DetectAsyncHazard(const SyncAccessInfo &usage_info, co
             return HazardResult::HazardVsPriorWrite(this, usage_info, WRITE_RACING_WRITE, *last_write);
         } else if (HasReads()) {
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
-            for (const auto &read_access : GetReads()) {
-                if (read_access.queue == queue_id && read_access.tag >= start_tag) {
-                    return HazardResult::HazardVsPriorRead(this, usage_info, WRITE_RACING_READ, read_access);
+            const QueueId *read_queues = last_reads.Queues();
+            const ResourceUsageTag *read_tags = last_reads.Tags();
+            for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+                if (read_queues[read_index] == queue_id && read_tags[read_index] >= start_tag) {
+                    return HazardResult::HazardVsPriorRead(this, usage_info, WRITE_RACING_READ, last_reads.Get(read_index));
                 }
             }
         }
@@ -305,10 +308,10 @@ HazardResult AccessState::DetectBarrierHazard(const SyncAccessInfo &usage_info,
     // See DetectHazard(SyncStagetAccessIndex) above for more details.
     if (HasReads()) {
         // Look at the reads if any
-        for (const auto &read_access : GetReads()) {
-            if (read_access.IsReadBarrierHazard(queue_id, src_exec_scope, src_access_scope)) {
-                return HazardResult::HazardVsPriorRead(this, usage_info, WRITE_AFTER_READ, read_access);
-            }
+        const uint64_t hazard_reads = GetReadBarrierHazards(queue_id, src_exec_scope, src_access_scope);
+        if (hazard_reads) {
+            const ReadState read_access = last_reads.Get(GetFirstReadIndex(hazard_reads));
+            return HazardResult::HazardVsPriorRead(this, usage_info, WRITE_AFTER_READ, read_access);
         }
     } else if (last_write.has_value() && IsWriteBarrierHazard(queue_id, src_exec_scope, src_access_scope)) {
         return HazardResult::HazardVsPriorWrite(this, usage_info, WRITE_AFTER_WRITE, *last_write);
@@ -331,14 +334,14 @@ HazardResult AccessState::DetectBarrierHazard(const SyncAccessInfo &usage_info,
         if (HasReads()) {
             // Look at the reads if any... if reads exist, they are either the reason the access is in the event
             // first scope, or they are a hazard.
-            const uint32_t scope_read_count = scope_state.last_read_count;
+            const uint32_t scope_read_count = scope_state.last_reads.size();
             // Since the hasn't been a write:
             //  * The current read state is a superset of the scoped one
             //  * The stage order is the same.
-            assert(last_read_count >= scope_read_count);
+            assert(last_reads.size() >= scope_read_count);
             for (uint32_t read_idx = 0; read_idx < scope_read_count; ++read_idx) {
-                const ReadState &scope_read = scope_state.last_reads[read_idx];
-                const ReadState &current_read = last_reads[read_idx];
+                const ReadState scope_read = scope_state.last_reads.Get(read_idx);
+                const ReadState current_read = last_reads.Get(read_idx);
                 assert(scope_read.stage == current_read.stage);
                 if (current_read.tag > event_tag) {
                     // The read is more recent than the set event scope, thus no barrier from the wait/ILT.
@@ -353,8 +356,8 @@ HazardResult AccessState::DetectBarrierHazard(const SyncAccessInfo &usage_info,
                     }
                 }
             }
-            if (last_read_count > scope_read_count) {
-                const ReadState &current_read = last_reads[scope_read_count];
+            if (last_reads.size() > scope_read_count) {
+                const ReadState current_read = last_reads.Get(scope_read_count);
                 return HazardResult::HazardVsPriorRead(this, usage_info, WRITE_AFTER_READ, current_read);
             }
         } else if (last_write.has_value()) {
@@ -369,36 +372,21 @@ HazardResult AccessState::DetectBarrierHazard(const SyncAccessInfo &usage_info,
     return {};
 }
 
-void AccessState::AddRead(const ReadState &read) {
-    if (last_read_count == 0) {
-        single_last_read = read;
-        last_reads = &single_last_read;
-        last_read_count = 1;
-    } else {  // last_read_count > 0
-        auto new_reads = new ReadState[last_read_count + 1];
-        std::memcpy(new_reads, last_reads, last_read_count * sizeof(ReadState));
-        if (last_read_count > 1) {
-            delete[] last_reads;
-        }
-        new_reads[last_read_count] = read;
-        last_reads = new_reads;
-        last_read_count++;
-    }
-}
+void AccessState::AddRead(const ReadState &read) { last_reads.Add(read); }
 
 void AccessState::MergeReads(const AccessState &other) {
     // Merge the read states
-    const uint32_t pre_merge_count = last_read_count;
+    const uint32_t pre_merge_count = last_reads.size();
     const auto pre_merge_stages = last_read_stages;
-    for (uint32_t other_read_index = 0; other_read_index < other.last_read_count; other_read_index++) {
-        auto &other_read = other.last_reads[other_read_index];
+    for (uint32_t other_read_index = 0; other_read_index < other.last_reads.size(); other_read_index++) {
+        const ReadState other_read = other.last_reads.Get(other_read_index);
         if (pre_merge_stages & other_read.stage) {
             // Merge in the barriers for read stages that exist in *both* this and other
             // TODO: This is N^2 with stages... perhaps the ReadStates should be sorted by stage index.
             //       but we should wait on profiling data for that.
             for (uint32_t my_read_index = 0; my_read_index < pre_merge_count; my_read_index++) {
-                auto &my_read = last_reads[my_read_index];
-                if (other_read.stage == my_read.stage) {
+                if (other_read.stage == last_reads.Stages()[my_read_index]) {
+                    ReadState my_read = last_reads.Get(my_read_index);
                     if (my_read.tag < other_read.tag) {
                         // Other is more recent, copy in the state
                         my_read.access_index = other_read.access_index;
@@ -419,7 +407,7 @@ void AccessState::MergeReads(const AccessState &other) {
                         my_read.barriers |= other_read.barriers;
                         my_read.sync_stages |= other_read.sync_stages;
                     }
-
+                    last_reads.Set(my_read_index, my_read);
                     break;
                 }
             }
@@ -515,23 +503,30 @@ void AccessState::Update(const SyncAccessInfo &usage_info, SyncOrdering ordering
         // However, for purposes of barrier tracking, only one read per pipeline stage matters
         if (usage_stage & last_read_stages) {
             const auto not_usage_stage = ~usage_stage;
-            for (auto &read_access : GetReads()) {
-                if (read_access.stage == usage_stage) {
+            const VkPipelineStageFlags2 *read_stages = last_reads.Stages();
+            const VkPipelineStageFlags2 *read_barriers = last_reads.Barriers();
+            VkPipelineStageFlags2 *read_sync_stages = last_reads.SyncStages();
+            for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+                if (read_stages[read_index] == usage_stage) {
+                    ReadState read_access;
                     read_access.Set(usage_stage, usage_info.access_index, tag_ex);
-                } else if (read_access.barriers & usage_stage) {
+                    last_reads.Set(read_index, read_access);
+                } else if (read_barriers[read_index] & usage_stage) {
                     // If the current access is barriered to this stage, mark it as "known to happen after"
-                    read_access.sync_stages |= usage_stage;
+                    read_sync_stages[read_index] |= usage_stage;
                 } else {
                     // If the current access is *NOT* barriered to this stage it needs to be cleared.
                     // Note: this is possible because semaphores can *clear* effective barriers, so the assumption
                     //       that sync_stages is a subset of barriers may not apply.
-                    read_access.sync_stages &= not_usage_stage;
+                    read_sync_stages[read_index] &= not_usage_stage;
                 }
             }
         } else {
-            for (auto &read_access : GetReads()) {
-                if (read_access.barriers & usage_stage) {
-                    read_access.sync_stages |= usage_stage;
+            const VkPipelineStageFlags2 *read_barriers = last_reads.Barriers();
+            VkPipelineStageFlags2 *read_sync_stages = last_reads.SyncStages();
+            for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+                if (read_barriers[read_index] & usage_stage) {
+                    read_sync_stages[read_index] |= usage_stage;
                 }
             }
             ReadState new_read_state;
@@ -591,13 +586,7 @@ void AccessState::SetWrite(SyncAccessIndex access_index, ResourceUsageTagEx tag_
 
 void AccessState::ClearWrite() { last_write.reset(); }
 
-void AccessState::ClearReadStates() {
-    if (last_read_count > 1) {
-        delete[] last_reads;
-    }
-    last_reads = nullptr;
-    last_read_count = 0;
-}
+void AccessState::ClearReadStates() { last_reads.Clear(); }
 
 void AccessState::ClearRead() {
     ClearReadStates();
@@ -637,24 +626,22 @@ void AccessState::ApplyBarrier(const BarrierScope &barrier_scope, const SyncBarr
         last_write->dependency_chain |= barrier.dst_exec_scope.exec_scope;
     }
     // Apply barriers over read accesses
-    VkPipelineStageFlags2 stages_in_scope = VK_PIPELINE_STAGE_2_NONE;
-    for (ReadState &read_access : GetReads()) {
-        // The | implements the "dependency chain" logic for this access,
-        // as the barriers field stores the second sync scope
-        if (read_access.InBarrierSourceScope(barrier_scope)) {
-            // We will apply the barrier in the next loop to have this in one place
-            stages_in_scope |= read_access.stage;
-        }
+    // The stages of the reads in scope are collected first to apply the barrier in one place
+    const VkPipelineStageFlags2 stages_in_scope = GetReadStages(last_reads, GetReadsInBarrierScope(barrier_scope));
+    if (stages_in_scope == VK_PIPELINE_STAGE_2_NONE) {
+        return;
     }
-    for (ReadState &read_access : GetReads()) {
-        if ((read_access.stage | read_access.sync_stages) & stages_in_scope) {
-            // If this stage, or any stage known to be synchronized after it are in scope, apply the barrier to this read.
-            // NOTE: Forwarding barriers to known prior stages changes the sync_stages from shallow to deep, because the
-            // barriers used to determine sync_stages have been propagated to all known earlier stages
-            read_access.barriers |= barrier.dst_exec_scope.exec_scope;
-            read_execution_barriers |= barrier.dst_exec_scope.exec_scope;
-        }
+    // If this stage, or any stage known to be synchronized after it are in scope, apply the barrier to this read.
+    // NOTE: Forwarding barriers to known prior stages changes the sync_stages from shallow to deep, because the
+    // barriers used to determine sync_stages have been propagated to all known earlier stages
+    const uint64_t barrier_reads = ReadsIntersectingStagesMask(last_reads, stages_in_scope, true);
+    VkPipelineStageFlags2 *read_barriers = last_reads.Barriers();
+    for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+        const VkPipelineStageFlags2 select = VkPipelineStageFlags2(0) - ((barrier_reads >> read_index) & 1);
+        read_barriers[read_index] |= barrier.dst_exec_scope.exec_scope & select;
     }
+    // barrier_reads is never empty here, the reads that define stages_in_scope intersect it
+    read_execution_barriers |= barrier.dst_exec_scope.exec_scope;
 }
 
 void AccessState::CollectPendingBarriers(const BarrierScope &barrier_scope, const SyncBarrier &barrier, bool layout_transition,
@@ -675,22 +662,18 @@ void AccessState::CollectPendingBarriers(const BarrierScope &barrier_scope, cons
     }
 
     // Collect barriers over read accesses
-    VkPipelineStageFlags2 stages_in_scope = VK_PIPELINE_STAGE_2_NONE;
-    for (ReadState &read_access : GetReads()) {
-        // The | implements the "dependency chain" logic for this access,
-        // as the barriers field stores the second sync scope
-        if (read_access.InBarrierSourceScope(barrier_scope)) {
-            // We will apply the barrier in the next loop to have this in one place
-            stages_in_scope |= read_access.stage;
-        }
+    const VkPipelineStageFlags2 stages_in_scope = GetReadStages(last_reads, GetReadsInBarrierScope(barrier_scope));
+    if (stages_in_scope == VK_PIPELINE_STAGE_2_NONE) {
+        return;
     }
-    for (ReadState &read_access : GetReads()) {
-        if ((read_access.stage | read_access.sync_stages) & stages_in_scope) {
-            // If this stage, or any stage known to be synchronized after it are in scope, apply the barrier to this read.
-            // NOTE: Forwarding barriers to known prior stages changes the sync_stages from shallow to deep, because the
-            // barriers used to determine sync_stages have been propagated to all known earlier stages
-            pending_barriers.AddReadBarrier(this, (uint32_t)(&read_access - last_reads), barrier);
-        }
+    // If this stage, or any stage known to be synchronized after it are in scope, apply the barrier to this read.
+    // NOTE: Forwarding barriers to known prior stages changes the sync_stages from shallow to deep, because the
+    // barriers used to determine sync_stages have been propagated to all known earlier stages
+    uint64_t barrier_reads = ReadsIntersectingStagesMask(last_reads, stages_in_scope, true);
+    while (barrier_reads) {
+        const uint32_t read_index = GetFirstReadIndex(barrier_reads);
+        barrier_reads &= barrier_reads - 1;
+        pending_barriers.AddReadBarrier(this, read_index, barrier);
     }
 }
 
@@ -819,8 +802,8 @@ void AccessState::ApplyPendingReadBarrier(const PendingReadBarrier &read_barrier
         return;
     }
 
-    ReadState &read_state = last_reads[read_barrier.last_reads_index];
-    read_state.barriers |= read_barrier.barriers;
+    assert(read_barrier.last_reads_index < last_reads.size());
+    last_reads.Barriers()[read_barrier.last_reads_index] |= read_barrier.barriers;
     read_execution_barriers |= read_barrier.barriers;
 }
 
@@ -844,14 +827,17 @@ void AccessState::ApplySemaphore(const SemaphoreScope &signal, const SemaphoreSc
     // Semaphores only guarantee the first scope of the signal is before the second scope of the wait.
     // If any access isn't in the first scope, there are no guarantees, thus those barriers are cleared
     assert(signal.queue != wait.queue);
-    for (auto &read_access : GetReads()) {
-        if (read_access.ReadOrDependencyChainInSourceScope(signal.queue, signal.exec_scope)) {
-            // Deflects WAR on wait queue
-            read_access.barriers = wait.exec_scope;
-        } else {
-            // Leave sync stages alone. Update method will clear unsynchronized stages on subsequent reads as needed.
-            read_access.barriers = VK_PIPELINE_STAGE_2_NONE;
-        }
+    ReadScopeQuery signal_scope;
+    signal_scope.queue = signal.queue;
+    signal_scope.exec_scope = signal.exec_scope;
+    signal_scope.as_copy_chain_stages = VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR;
+    const uint64_t reads_in_scope = ReadsInSourceScopeMask(last_reads, signal_scope);
+    VkPipelineStageFlags2 *read_barriers = last_reads.Barriers();
+    for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+        // In scope reads deflect WAR on wait queue.
+        // Otherwise leave sync stages alone. Update method will clear unsynchronized stages on subsequent reads as needed.
+        const VkPipelineStageFlags2 select = VkPipelineStageFlags2(0) - ((reads_in_scope >> read_index) & 1);
+        read_barriers[read_index] = wait.exec_scope & select;
     }
     if (last_write.has_value() &&
         last_write->WriteOrDependencyChainInSourceScope(signal.queue, signal.exec_scope, signal.valid_accesses)) {
@@ -916,8 +902,9 @@ void AccessState::OffsetTag(ResourceUsageTag offset) {
     if (last_write.has_value()) {
         last_write->tag += offset;
     }
-    for (auto &read_access : GetReads()) {
-        read_access.tag += offset;
+    ResourceUsageTag *read_tags = last_reads.Tags();
+    for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+        read_tags[read_index] += offset;
     }
     for (auto &first : first_accesses_) {
         first.tag += offset;
@@ -943,10 +930,7 @@ AccessState::AccessState(const AccessState &other) { *this = other; }
 
 AccessState &AccessState::operator=(const AccessState &other) {
     CopySimpleMembers(other);
-    ClearReadStates();
-    for (const ReadState &read : other.GetReads()) {
-        AddRead(read);
-    }
+    last_reads = other.last_reads;
     return *this;
 }
 
@@ -954,37 +938,27 @@ AccessState::AccessState(AccessState &&other) { *this = std::move(other); }
 
 AccessState &AccessState::operator=(AccessState &&other) {
     CopySimpleMembers(other);
-
-    last_read_count = other.last_read_count;
-    single_last_read = other.single_last_read;
-
-    if (other.last_read_count == 1) {
-        last_reads = &single_last_read;
-    } else {
-        last_reads = other.last_reads;
-    }
-    other.last_reads = nullptr;
-    other.last_read_count = 0;
+    last_reads = std::move(other.last_reads);
     return *this;
 }
 
-AccessState ::~AccessState() {
-    ClearReadStates();  // free allocated memory for multi-read access state
-}
+AccessState ::~AccessState() {}
 
 VkPipelineStageFlags2 AccessState::GetReadBarriers(SyncAccessIndex access_index) const {
-    for (const auto &read_access : GetReads()) {
-        if (read_access.access_index == access_index) {
-            return read_access.barriers;
+    const SyncAccessIndex *read_access_indices = last_reads.AccessIndices();
+    for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+        if (read_access_indices[read_index] == access_index) {
+            return last_reads.Barriers()[read_index];
         }
     }
     return VK_PIPELINE_STAGE_2_NONE;
 }
 
 void AccessState::SetQueueId(QueueId id) {
-    for (auto &read_access : GetReads()) {
-        if (read_access.queue == kQueueIdInvalid) {
-            read_access.queue = id;
+    QueueId *read_queues = last_reads.Queues();
+    for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+        if (read_queues[read_index] == kQueueIdInvalid) {
+            read_queues[read_index] = id;
         }
     }
     if (last_write.has_value()) {
@@ -997,11 +971,8 @@ bool AccessState::IsWriteBarrierHazard(QueueId queue_id, VkPipelineStageFlags2 s
     return last_write.has_value() && last_write->IsWriteBarrierHazard(queue_id, src_exec_scope, src_access_scope);
 }
 
-// As ReadStates must be unique by stage, this is as good a sort as needed
-bool operator<(const ReadState &lhs, const ReadState &rhs) { return lhs.stage < rhs.stage; }
-
 void AccessState::Normalize() {
-    std::sort(last_reads, last_reads + last_read_count);
+    last_reads.SortByStage();
     ClearFirstUse();
 }
 
@@ -1010,8 +981,9 @@ void AccessState::GatherReferencedTags(ResourceUsageTagSet &used) const {
         used.CachedInsert(last_write->tag);
     }
 
-    for (const auto &read_access : GetReads()) {
-        used.CachedInsert(read_access.tag);
+    const ResourceUsageTag *read_tags = last_reads.Tags();
+    for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+        used.CachedInsert(read_tags[read_index]);
     }
 }
 
@@ -1022,6 +994,7 @@ const WriteState &AccessState::LastWrite() const {
 
 void AccessState::UpdateStats(AccessContextStats &stats) const {
 #if VVL_ENABLE_SYNCVAL_STATS != 0
+    const uint32_t last_read_count = last_reads.size();
     stats.read_states += last_read_count;
     stats.write_states += last_write.has_value();
     stats.first_accesses += first_accesses_.size();
@@ -1060,9 +1033,11 @@ VkPipelineStageFlags2 AccessState::GetOrderedStages(QueueId queue_id, const Orde
     // At apply queue submission order limits on the effect of ordering
     VkPipelineStageFlags2 non_qso_stages = VK_PIPELINE_STAGE_2_NONE;
     if (queue_id != kQueueIdInvalid) {
-        for (const auto &read_access : GetReads()) {
-            if (read_access.queue != queue_id) {
-                non_qso_stages |= read_access.stage;
+        const QueueId *read_queues = last_reads.Queues();
+        const VkPipelineStageFlags2 *read_stages = last_reads.Stages();
+        for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+            if (read_queues[read_index] != queue_id) {
+                non_qso_stages |= read_stages[read_index];
             }
         }
     }
@@ -1120,6 +1095,25 @@ void ReadState::Set(VkPipelineStageFlagBits2 stage, SyncAccessIndex access_index
     queue = kQueueIdInvalid;
 }
 
+uint64_t AccessState::GetReadBarrierHazards(QueueId queue_id, VkPipelineStageFlags2 src_exec_scope,
+                                            const SyncAccessFlags &src_access_scope) const {
+    // Same test as ReadState::IsReadBarrierHazard, evaluated for all reads at once
+    ReadScopeQuery query;
+    query.queue = queue_id;
+    query.exec_scope = ReadState::GetBarrierHazardExecScope(src_exec_scope, src_access_scope);
+    return ~ReadsInSourceScopeMask(last_reads, query) & GetAllReadsMask();
+}
+
+uint64_t AccessState::GetReadsInBarrierScope(const BarrierScope &barrier_scope) const {
+    // Same test as ReadState::InBarrierSourceScope, evaluated for all reads at once
+    ReadScopeQuery query;
+    query.queue = barrier_scope.scope_queue;
+    query.exec_scope = barrier_scope.src_exec_scope;
+    query.max_tag = barrier_scope.scope_tag;
+    query.as_copy_chain_stages = VK_PIPELINE_STAGE_2_ACCELERATION_STRUCTURE_BUILD_BIT_KHR;
+    return ReadsInSourceScopeMask(last_reads, query);
+}
+
 // Scope test including "queue submission order" effects.  Specifically, accesses from a different queue are not
 // considered to be in "queue submission order" with barriers, events, or semaphore signalling, but any barriers
 // that have bee applied (via semaphore) to those accesses can be chained off of.
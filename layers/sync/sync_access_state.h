@@ -18,6 +18,7 @@
 #pragma once
 #include "sync/sync_common.h"
 #include "sync/sync_barrier.h"
+#include "sync/sync_read_scope.h"
 #include "containers/span.h"
 #include <cstring>  // memcpy
 
@@ -196,6 +197,16 @@ struct ReadState {
 
     bool IsReadBarrierHazard(QueueId barrier_queue, VkPipelineStageFlags2 src_exec_scope,
                              const SyncAccessFlags &src_access_scope) const {
+        src_exec_scope = GetBarrierHazardExecScope(src_exec_scope, src_access_scope);
+
+        // If the read stage is not in the src sync scope
+        // *AND* not execution chained with an existing sync barrier (that's the or)
+        // then the barrier access is unsafe (R/W after R)
+        VkPipelineStageFlags2 queue_ordered_stage = (queue == barrier_queue) ? stage : VK_PIPELINE_STAGE_2_NONE;
+        return (src_exec_scope & (queue_ordered_stage | barriers)) == 0;
+    }
+    static VkPipelineStageFlags2 GetBarrierHazardExecScope(VkPipelineStageFlags2 src_exec_scope,
+                                                           const SyncAccessFlags &src_access_scope) {
         // Current implementation relies on TOP_OF_PIPE constant due to the fact that it's non-zero value
         // and AND-ing with it can create execution dependency when it's necessary. When NONE constant is
         // used, which equals to zero, then AND-ing with it always results in 0 which means "no barrier",
@@ -206,14 +217,9 @@ struct ReadState {
         // invert the condition below and exchange TOP_OF_PIPE and NONE roles, so deprecated stages would
         // not propagate into implementation internals.
         if (src_exec_scope == VK_PIPELINE_STAGE_2_NONE && src_access_scope.none()) {
-            src_exec_scope = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT;
+            return VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT;
         }
-
-        // If the read stage is not in the src sync scope
-        // *AND* not execution chained with an existing sync barrier (that's the or)
-        // then the barrier access is unsafe (R/W after R)
-        VkPipelineStageFlags2 queue_ordered_stage = (queue == barrier_queue) ? stage : VK_PIPELINE_STAGE_2_NONE;
-        return (src_exec_scope & (queue_ordered_stage | barriers)) == 0;
+        return src_exec_scope;
     }
     bool ReadOrDependencyChainInSourceScope(QueueId queue, VkPipelineStageFlags2 src_exec_scope) const;
     bool InBarrierSourceScope(const BarrierScope &barrier_scope) const;
@@ -404,12 +410,7 @@ class AccessState {
         const bool write_same = (read_execution_barriers == rhs.read_execution_barriers) &&
                                 (input_attachment_read == rhs.input_attachment_read) && (last_write == rhs.last_write);
 
-        bool read_same = (last_read_stages == rhs.last_read_stages) && (last_read_count == rhs.last_read_count);
-        if (read_same) {
-            for (uint32_t i = 0; i < last_read_count; i++) {
-                read_same = read_same && (last_reads[i] == rhs.last_reads[i]);
-            }
-        }
+        const bool read_same = (last_read_stages == rhs.last_read_stages) && (last_reads == rhs.last_reads);
 
         const bool read_write_same = write_same && read_same;
 
@@ -435,17 +436,19 @@ class AccessState {
     void CopySimpleMembers(const AccessState &other);
     bool IsRAWHazard(const SyncAccessInfo &usage_info) const;
 
-    bool IsReadHazard(VkPipelineStageFlags2 stage_mask, const ReadState &read_access) const {
-        return stage_mask != (stage_mask & read_access.barriers);
-    }
     VkPipelineStageFlags2 GetOrderedStages(QueueId queue_id, const OrderingBarrier &ordering, SyncFlags flags) const;
 
     void UpdateFirst(ResourceUsageTagEx tag_ex, const SyncAccessInfo &usage_info, SyncOrdering ordering_rule, SyncFlags flags = 0);
     void TouchupFirstForLayoutTransition(ResourceUsageTag tag, const OrderingBarrier &layout_ordering);
 
-    bool HasReads() const { return last_read_count != 0; }
-    vvl::span<ReadState> GetReads() { return vvl::make_span(last_reads, last_read_count); }
-    vvl::span<ReadState> GetReads() const { return vvl::make_span(last_reads, last_read_count); }
+    bool HasReads() const { return !last_reads.empty(); }
+    // Mask with a bit set for each read state, see sync_read_scope.h
+    uint64_t GetAllReadsMask() const {
+        return (last_reads.size() < 64) ? ((uint64_t(1) << last_reads.size()) - 1) : ~uint64_t(0);
+    }
+    uint64_t GetReadBarrierHazards(QueueId queue_id, VkPipelineStageFlags2 src_exec_scope,
+                                   const SyncAccessFlags &src_access_scope) const;
+    uint64_t GetReadsInBarrierScope(const BarrierScope &barrier_scope) const;
     void AddRead(const ReadState &read);
     void MergeReads(const AccessState &other);
     void ClearReadStates();
@@ -456,14 +459,8 @@ class AccessState {
     // unsafe would already be included.
     std::optional<WriteState> last_write;
 
-    uint32_t last_read_count = 0;
-
-    // Points to the last_read_count read states
-    ReadState *last_reads = nullptr;
-
-    // The common case is a single read. In that case, last_reads points to this object
-    // and last_read_count is 1.
-    ReadState single_last_read;
+    // The common case is a single read, it is stored without allocation
+    ReadStates last_reads;
 
     VkPipelineStageFlags2 last_read_stages = VK_PIPELINE_STAGE_2_NONE;
     VkPipelineStageFlags2 read_execution_barriers = VK_PIPELINE_STAGE_2_NONE;
@@ -491,7 +488,8 @@ bool AccessState::ClearPredicatedAccesses(Predicate &predicate) {
 
     // Use the predicate to build a mask of the read stages we are synchronizing
     // Use the sync_stages to also detect reads known to be before any synchronized reads (first pass)
-    for (const auto &read_access : GetReads()) {
+    for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+        const ReadState read_access = last_reads.Get(read_index);
         if (predicate(read_access)) {
             // If we know this stage is before any stage we syncing, or if the predicate tells us that we are waited for..
             sync_reads |= read_access.stage;
@@ -501,10 +499,12 @@ bool AccessState::ClearPredicatedAccesses(Predicate &predicate) {
     // Now that we know the reads directly in scopejust need to go over the list again to pick up the "known earlier" stages.
     // NOTE: sync_stages is "deep" catching all stages synchronized after it because we forward barriers
     uint32_t unsync_count = 0;
-    for (const auto &read_access : GetReads()) {
-        if (0 != ((read_access.stage | read_access.sync_stages) & sync_reads)) {
+    const VkPipelineStageFlags2 *read_stages = last_reads.Stages();
+    const VkPipelineStageFlags2 *read_sync_stages = last_reads.SyncStages();
+    for (uint32_t read_index = 0; read_index < last_reads.size(); read_index++) {
+        if (0 != ((read_stages[read_index] | read_sync_stages[read_index]) & sync_reads)) {
             // This is redundant in the "stage" case, but avoids a second branch to get an accurate count
-            sync_reads |= read_access.stage;
+            sync_reads |= read_stages[read_index];
         } else {
             ++unsync_count;
         }
@@ -512,21 +512,10 @@ bool AccessState::ClearPredicatedAccesses(Predicate &predicate) {
 
     if (unsync_count) {
         if (sync_reads) {
-            // When have some remaining unsynchronized reads, we have to rewrite the last_reads array.
-            small_vector<ReadState, 4> unsync_reads;
-            unsync_reads.reserve(unsync_count);
-            VkPipelineStageFlags2 unsync_read_stages = VK_PIPELINE_STAGE_2_NONE;
-            for (auto &read_access : GetReads()) {
-                if ((read_access.stage & sync_reads) == 0) {
-                    unsync_reads.emplace_back(read_access);
-                    unsync_read_stages |= read_access.stage;
-                }
-            }
-            last_read_stages = unsync_read_stages;
-            ClearReadStates();
-            for (const ReadState &read : unsync_reads) {
-                AddRead(read);
-            }
+            // When have some remaining unsynchronized reads, we have to compact the last_reads columns.
+            const uint64_t unsync_reads = ~ReadsIntersectingStagesMask(last_reads, sync_reads, false) & GetAllReadsMask();
+            last_read_stages = GetReadStages(last_reads, unsync_reads);
+            last_reads.Retain(unsync_reads);
         }
     } else {
         // Nothing remains (or it was empty to begin with)
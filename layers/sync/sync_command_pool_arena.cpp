@@ -0,0 +1,124 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync/sync_command_pool_arena.h"
+#include "sync/sync_stats.h"
+
+namespace syncval {
+
+template <typename Vector>
+static uint64_t CachedSize(const Vector &v) {
+    return uint64_t(v.capacity()) * sizeof(typename Vector::value_type);
+}
+
+CommandPoolArena::~CommandPoolArena() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TrimLocked();
+}
+
+std::shared_ptr<CommandPoolArena::AccessLog> CommandPoolArena::AcquireAccessLog() {
+    std::unique_ptr<AccessLog> access_log;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_access_logs_.empty()) {
+            access_log = std::move(free_access_logs_.back());
+            free_access_logs_.pop_back();
+            const uint64_t size = CachedSize(*access_log);
+            cached_bytes_ -= size;
+            stats_.RemoveArenaBytes(size);
+        }
+    }
+    if (!access_log) {
+        access_log = std::make_unique<AccessLog>();
+    }
+    // The deleter keeps the arena alive, so it is safe to return the object after the pool is destroyed
+    return std::shared_ptr<AccessLog>(access_log.release(), [arena = shared_from_this()](AccessLog *p) { arena->Recycle(p); });
+}
+
+std::shared_ptr<CommandPoolArena::CommandBufferSet> CommandPoolArena::AcquireCommandBufferSet() {
+    std::unique_ptr<CommandBufferSet> cb_set;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_cb_sets_.empty()) {
+            cb_set = std::move(free_cb_sets_.back());
+            free_cb_sets_.pop_back();
+            const uint64_t size = CachedSize(*cb_set);
+            cached_bytes_ -= size;
+            stats_.RemoveArenaBytes(size);
+        }
+    }
+    if (!cb_set) {
+        cb_set = std::make_unique<CommandBufferSet>();
+    }
+    return std::shared_ptr<CommandBufferSet>(cb_set.release(), [arena = shared_from_this()](CommandBufferSet *p) { arena->Recycle(p); });
+}
+
+void CommandPoolArena::Recycle(AccessLog *access_log) {
+    std::unique_ptr<AccessLog> owned(access_log);
+    owned->clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (CanCache(free_access_logs_.size())) {
+        const uint64_t size = CachedSize(*owned);
+        cached_bytes_ += size;
+        stats_.AddArenaBytes(size);
+        free_access_logs_.emplace_back(std::move(owned));
+    }
+}
+
+void CommandPoolArena::Recycle(CommandBufferSet *cb_set) {
+    std::unique_ptr<CommandBufferSet> owned(cb_set);
+    // Release the command buffer references outside of the lock, this can destroy command buffer state objects
+    owned->clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (CanCache(free_cb_sets_.size())) {
+        const uint64_t size = CachedSize(*owned);
+        cached_bytes_ += size;
+        stats_.AddArenaBytes(size);
+        free_cb_sets_.emplace_back(std::move(owned));
+    }
+}
+
+void CommandPoolArena::AddCommandBuffer() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    command_buffer_count_++;
+}
+
+void CommandPoolArena::RemoveCommandBuffer() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    assert(command_buffer_count_ > 0);
+    command_buffer_count_--;
+}
+
+void CommandPoolArena::Trim() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TrimLocked();
+}
+
+void CommandPoolArena::Release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    released_ = true;
+    TrimLocked();
+}
+
+void CommandPoolArena::TrimLocked() {
+    free_access_logs_.clear();
+    free_cb_sets_.clear();
+    stats_.RemoveArenaBytes(cached_bytes_);
+    cached_bytes_ = 0;
+}
+
+}  // namespace syncval
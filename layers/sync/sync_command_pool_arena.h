@@ -0,0 +1,79 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "sync/sync_commandbuffer.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace syncval {
+
+struct Stats;
+
+// Recycles recording storage between the command buffers of a single command pool.
+//
+// Every command buffer reset replaces the access log and the referenced command buffer set with new objects,
+// because the old ones can still be referenced by submitted batches. When the last reference to such an object
+// is dropped, the arena clears it (keeping the capacity) and caches it for the next reset of a command buffer
+// from the same pool. When the same command buffers are re-recorded each frame, the access logs reach their
+// working size once and then stop reallocating.
+//
+// Objects can be returned from any thread (batches are retired during queue operations), so the cache is
+// protected by a mutex. Acquire is called only while recording, which is externally synchronized per pool.
+class CommandPoolArena : public std::enable_shared_from_this<CommandPoolArena> {
+  public:
+    using AccessLog = CommandExecutionContext::AccessLog;
+    using CommandBufferSet = CommandExecutionContext::CommandBufferSet;
+
+    explicit CommandPoolArena(Stats &stats) : stats_(stats) {}
+    ~CommandPoolArena();
+
+    CommandPoolArena(const CommandPoolArena &) = delete;
+    CommandPoolArena &operator=(const CommandPoolArena &) = delete;
+
+    std::shared_ptr<AccessLog> AcquireAccessLog();
+    std::shared_ptr<CommandBufferSet> AcquireCommandBufferSet();
+
+    // The number of cached objects is limited by the number of command buffers allocated from the pool
+    void AddCommandBuffer();
+    void RemoveCommandBuffer();
+
+    // Frees all cached storage (vkTrimCommandPool)
+    void Trim();
+    // Frees all cached storage and stops caching (vkDestroyCommandPool).
+    // Objects that are still referenced by batches are freed when they are returned.
+    void Release();
+
+  private:
+    void Recycle(AccessLog *access_log);
+    void Recycle(CommandBufferSet *cb_set);
+    // Each command buffer needs at most one cached object of each kind for its next reset
+    bool CanCache(size_t cached_count) const { return !released_ && cached_count < command_buffer_count_; }
+    void TrimLocked();
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<AccessLog>> free_access_logs_;
+    std::vector<std::unique_ptr<CommandBufferSet>> free_cb_sets_;
+    uint32_t command_buffer_count_ = 0;
+    uint64_t cached_bytes_ = 0;
+    bool released_ = false;
+    Stats &stats_;
+};
+
+}  // namespace syncval
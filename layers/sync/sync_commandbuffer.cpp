@@ -17,6 +17,7 @@
 
 #include <vulkan/utility/vk_format_utils.h>
 #include "sync/sync_commandbuffer.h"
+#include "sync/sync_command_pool_arena.h"
 #include "error_message/error_location.h"
 #include "sync/sync_op.h"
 #include "sync/sync_reporting.h"
@@ -226,6 +227,14 @@ CommandBufferAccessContext::CommandBufferAccessContext(const SyncValidator &sync
 CommandBufferAccessContext::CommandBufferAccessContext(SyncValidator &sync_validator, vvl::CommandBuffer *cb_state)
     : CommandBufferAccessContext(sync_validator, cb_state->GetQueueFlags()) {
     cb_state_ = cb_state;
+    if (cb_state->command_pool) {
+        arena_ = sync_validator.GetCommandPoolArena(cb_state->command_pool->VkHandle());
+    }
+    if (arena_) {
+        arena_->AddCommandBuffer();
+        access_log_ = arena_->AcquireAccessLog();
+        cbs_referenced_ = arena_->AcquireCommandBufferSet();
+    }
     sync_state_.stats.AddCommandBufferContext();
 }
 
@@ -256,13 +265,27 @@ CommandBufferAccessContext::CommandBufferAccessContext(const CommandBufferAccess
 }
 
 CommandBufferAccessContext::~CommandBufferAccessContext() {
+    if (arena_) {
+        arena_->RemoveCommandBuffer();
+    }
     sync_state_.stats.RemoveCommandBufferContext();
     sync_state_.stats.RemoveHandleRecord((uint32_t)handles_.size());
 }
 
+std::shared_ptr<CommandBufferAccessContext::AccessLog> CommandBufferAccessContext::NewAccessLog() const {
+    return arena_ ? arena_->AcquireAccessLog() : std::make_shared<AccessLog>();
+}
+
+std::shared_ptr<CommandBufferAccessContext::CommandBufferSet> CommandBufferAccessContext::NewCommandBufferSet() const {
+    return arena_ ? arena_->AcquireCommandBufferSet() : std::make_shared<CommandBufferSet>();
+}
+
 void CommandBufferAccessContext::Reset() {
-    access_log_ = std::make_shared<AccessLog>();
-    cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    // Release the previous storage first, so the arena can hand it back if no batch references it
+    access_log_.reset();
+    cbs_referenced_.reset();
+    access_log_ = NewAccessLog();
+    cbs_referenced_ = NewCommandBufferSet();
     if (cb_state_) {
         cbs_referenced_->push_back(cb_state_->shared_from_this());
     }
@@ -459,6 +482,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
         return skip;
     }
     const auto &last_bound_state = cb_state_->lastBound[ConvertToVvlBindPoint(pipelineBindPoint)];
+    const vvl::DeviceState &dev_data = cb_state_->dev_data;
     const vvl::Pipeline *pipe = last_bound_state.pipeline_state;
     const std::vector<LastBound::DescriptorSetSlot> &ds_slots = last_bound_state.ds_slots;
     if (!pipe) {
@@ -503,13 +527,13 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                 switch (descriptor->GetClass()) {
                     case DescriptorClass::ImageSampler:
                     case DescriptorClass::Image: {
-                        if (descriptor->Invalid()) {
+                        if (descriptor->Invalid(dev_data)) {
                             continue;
                         }
 
                         // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
                         const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        const auto *img_view_state = image_descriptor->GetImageViewState();
+                        const auto *img_view_state = image_descriptor->GetImageViewState(dev_data);
                         VkImageLayout image_layout = image_descriptor->GetImageLayout();
 
                         if (img_view_state->is_depth_sliced) {
@@ -543,10 +567,10 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                     }
                     case DescriptorClass::TexelBuffer: {
                         const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
+                        if (texel_descriptor->Invalid(dev_data)) {
                             continue;
                         }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                        const auto *buf_view_state = texel_descriptor->GetBufferViewState(dev_data);
                         const auto *buf_state = buf_view_state->buffer_state.get();
                         const AccessRange range = MakeRange(*buf_view_state);
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
@@ -562,7 +586,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                     }
                     case DescriptorClass::GeneralBuffer: {
                         const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
+                        if (buffer_descriptor->Invalid(dev_data)) {
                             continue;
                         }
                         VkDeviceSize offset = buffer_descriptor->GetOffset();
@@ -574,7 +598,7 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                             }
                             offset += ds_slot.dynamic_offsets[dynamic_offset_index];
                         }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
+                        const auto *buf_state = buffer_descriptor->GetBufferState(dev_data);
                         const AccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
                         if (hazard.IsHazard() && !sync_state_.SuppressedBoundDescriptorWAW(hazard)) {
@@ -588,10 +612,10 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                     }
                     case DescriptorClass::AccelerationStructure: {
                         const auto *accel_descriptor = static_cast<const vvl::AccelerationStructureDescriptor *>(descriptor);
-                        if (accel_descriptor->Invalid()) {
+                        if (accel_descriptor->Invalid(dev_data)) {
                             continue;
                         }
-                        const vvl::AccelerationStructureKHR *accel = accel_descriptor->GetAccelerationStructureStateKHR();
+                        const vvl::AccelerationStructureKHR *accel = accel_descriptor->GetAccelerationStructureStateKHR(dev_data);
                         if (!accel || !accel->buffer_state) {
                             continue;
                         }
@@ -627,6 +651,7 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
     }
 
     const auto &last_bound_state = cb_state_->lastBound[ConvertToVvlBindPoint(pipelineBindPoint)];
+    const vvl::DeviceState &dev_data = cb_state_->dev_data;
     const vvl::Pipeline *pipe = last_bound_state.pipeline_state;
     const std::vector<LastBound::DescriptorSetSlot> &ds_slots = last_bound_state.ds_slots;
     if (!pipe) {
@@ -668,10 +693,10 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
                     case DescriptorClass::Image: {
                         // NOTE: ImageSamplerDescriptor inherits from ImageDescriptor, so this cast works for both types.
                         const auto *image_descriptor = static_cast<const ImageDescriptor *>(descriptor);
-                        if (image_descriptor->Invalid()) {
+                        if (image_descriptor->Invalid(dev_data)) {
                             continue;
                         }
-                        const auto *img_view_state = image_descriptor->GetImageViewState();
+                        const auto *img_view_state = image_descriptor->GetImageViewState(dev_data);
                         if (img_view_state->is_depth_sliced) {
                             // NOTE: 2D ImageViews of VK_IMAGE_CREATE_2D_ARRAY_COMPATIBLE_BIT Images are not allowed in
                             // Descriptors, unless VK_EXT_image_2d_view_of_3d is supported, which it isn't at the moment.
@@ -691,10 +716,10 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
                     }
                     case DescriptorClass::TexelBuffer: {
                         const auto *texel_descriptor = static_cast<const TexelDescriptor *>(descriptor);
-                        if (texel_descriptor->Invalid()) {
+                        if (texel_descriptor->Invalid(dev_data)) {
                             continue;
                         }
-                        const auto *buf_view_state = texel_descriptor->GetBufferViewState();
+                        const auto *buf_view_state = texel_descriptor->GetBufferViewState(dev_data);
                         const auto *buf_state = buf_view_state->buffer_state.get();
                         const AccessRange range = MakeRange(*buf_view_state);
                         const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_view_state->Handle());
@@ -703,7 +728,7 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
                     }
                     case DescriptorClass::GeneralBuffer: {
                         const auto *buffer_descriptor = static_cast<const BufferDescriptor *>(descriptor);
-                        if (buffer_descriptor->Invalid()) {
+                        if (buffer_descriptor->Invalid(dev_data)) {
                             continue;
                         }
                         VkDeviceSize offset = buffer_descriptor->GetOffset();
@@ -715,7 +740,7 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
                             }
                             offset += ds_slot.dynamic_offsets[dynamic_offset_index];
                         }
-                        const auto *buf_state = buffer_descriptor->GetBufferState();
+                        const auto *buf_state = buffer_descriptor->GetBufferState(dev_data);
                         const AccessRange range = MakeRange(*buf_state, offset, buffer_descriptor->GetRange());
                         const ResourceUsageTagEx tag_ex = AddCommandHandle(tag, buf_state->Handle());
                         current_context_->UpdateAccessState(*buf_state, sync_index, SyncOrdering::kNonAttachment, range, tag_ex);
@@ -723,10 +748,10 @@ void CommandBufferAccessContext::RecordDispatchDrawDescriptorSet(VkPipelineBindP
                     }
                     case DescriptorClass::AccelerationStructure: {
                         const auto *accel_descriptor = static_cast<const vvl::AccelerationStructureDescriptor *>(descriptor);
-                        if (accel_descriptor->Invalid()) {
+                        if (accel_descriptor->Invalid(dev_data)) {
                             continue;
                         }
-                        const vvl::AccelerationStructureKHR *accel = accel_descriptor->GetAccelerationStructureStateKHR();
+                        const vvl::AccelerationStructureKHR *accel = accel_descriptor->GetAccelerationStructureStateKHR(dev_data);
                         if (!accel || !accel->buffer_state) {
                             continue;
                         }
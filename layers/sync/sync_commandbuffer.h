@@ -25,6 +25,7 @@ struct RecordObject;
 namespace syncval {
 
 class SyncValidator;
+class CommandPoolArena;
 class ErrorMessages;
 struct AccessStats;
 
@@ -293,6 +294,10 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
 
     uint32_t AddHandle(const VulkanTypedHandle &typed_handle, uint32_t index);
 
+    // Use storage recycled by the command pool arena when available
+    std::shared_ptr<AccessLog> NewAccessLog() const;
+    std::shared_ptr<CommandBufferSet> NewCommandBufferSet() const;
+
     // As this is passing around a shared pointer to record, move to avoid needless atomics.
     void RecordSyncOp(SyncOpPointer &&sync_op);
 
@@ -311,6 +316,9 @@ class CommandBufferAccessContext : public CommandExecutionContext, DebugNameProv
     // a reference count is not needed here.
     vvl::CommandBuffer *cb_state_;
 
+    // Null for proxy contexts
+    std::shared_ptr<CommandPoolArena> arena_;
+
     std::shared_ptr<AccessLog> access_log_;
     std::shared_ptr<CommandBufferSet> cbs_referenced_;
     uint32_t command_number_;
@@ -0,0 +1,412 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync/sync_read_scope.h"
+#include "sync/sync_access_state.h"
+
+#include <cstring>
+
+// SSE2 and NEON are part of the x86-64 and aarch64 baselines, so the kernels can use them without a runtime check.
+// Wider vectors (AVX2) would need runtime dispatch, and the reads of an access state rarely fill more than two lanes.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VVL_SYNCVAL_READ_SCOPE_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VVL_SYNCVAL_READ_SCOPE_NEON
+#endif
+
+namespace syncval {
+
+static_assert(sizeof(VkPipelineStageFlags2) == 8);
+static_assert(sizeof(SyncAccessIndex) == sizeof(uint32_t));
+
+ReadStates::ReadStates(const ReadStates &other) { *this = other; }
+
+ReadStates &ReadStates::operator=(const ReadStates &other) {
+    if (this == &other) {
+        return *this;
+    }
+    Clear();
+    if (other.size_ > kInlineCapacity) {
+        Reallocate(other.size_);
+    }
+    size_ = other.size_;
+    CopyColumns(other.Data(), other.capacity_, Data(), capacity_, size_);
+    return *this;
+}
+
+ReadStates::ReadStates(ReadStates &&other) noexcept { *this = std::move(other); }
+
+ReadStates &ReadStates::operator=(ReadStates &&other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+    Clear();
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    if (capacity_ == kInlineCapacity) {
+        std::memcpy(inline_data_, other.inline_data_, sizeof(inline_data_));
+    } else {
+        heap_data_ = other.heap_data_;
+    }
+    other.size_ = 0;
+    other.capacity_ = kInlineCapacity;
+    return *this;
+}
+
+ReadState ReadStates::Get(uint32_t index) const {
+    assert(index < size_);
+    ReadState read;
+    read.stage = Stages()[index];
+    read.access_index = AccessIndices()[index];
+    read.barriers = Barriers()[index];
+    read.sync_stages = SyncStages()[index];
+    read.tag = Tags()[index];
+    read.handle_index = HandleIndices()[index];
+    read.queue = Queues()[index];
+    return read;
+}
+
+void ReadStates::Set(uint32_t index, const ReadState &read) {
+    assert(index < size_);
+    // Resolve the columns before the stores, the stores through byte storage could otherwise alias capacity_
+    VkPipelineStageFlags2 *stages = Stages();
+    VkPipelineStageFlags2 *barriers = Barriers();
+    VkPipelineStageFlags2 *sync_stages = SyncStages();
+    ResourceUsageTag *tags = Tags();
+    QueueId *queues = Queues();
+    uint32_t *handle_indices = HandleIndices();
+    SyncAccessIndex *access_indices = AccessIndices();
+    stages[index] = read.stage;
+    barriers[index] = read.barriers;
+    sync_stages[index] = read.sync_stages;
+    tags[index] = read.tag;
+    queues[index] = read.queue;
+    handle_indices[index] = read.handle_index;
+    access_indices[index] = read.access_index;
+}
+
+void ReadStates::Add(const ReadState &read) {
+    assert(size_ < kMaxReadsPerAccess);
+    if (size_ == capacity_) {
+        // Most access states have a single read, the ones with more usually have two
+        Reallocate(capacity_ * 2);
+    }
+    size_++;
+    Set(size_ - 1, read);
+}
+
+void ReadStates::Clear() {
+    if (capacity_ != kInlineCapacity) {
+        delete[] heap_data_;
+        capacity_ = kInlineCapacity;
+    }
+    size_ = 0;
+}
+
+template <typename T>
+static void CopyColumn(const unsigned char *src, uint32_t src_capacity, unsigned char *dst, uint32_t dst_capacity, size_t offset,
+                       uint32_t count) {
+    // Columns hold a few elements, a loop is faster than calling memcpy
+    const T *src_column = reinterpret_cast<const T *>(src + offset * src_capacity);
+    T *dst_column = reinterpret_cast<T *>(dst + offset * dst_capacity);
+    for (uint32_t i = 0; i < count; i++) {
+        dst_column[i] = src_column[i];
+    }
+}
+
+void ReadStates::CopyColumns(const unsigned char *src, uint32_t src_capacity, unsigned char *dst, uint32_t dst_capacity,
+                             uint32_t count) {
+    CopyColumn<VkPipelineStageFlags2>(src, src_capacity, dst, dst_capacity, kStagesOffset, count);
+    CopyColumn<VkPipelineStageFlags2>(src, src_capacity, dst, dst_capacity, kBarriersOffset, count);
+    CopyColumn<VkPipelineStageFlags2>(src, src_capacity, dst, dst_capacity, kSyncStagesOffset, count);
+    CopyColumn<ResourceUsageTag>(src, src_capacity, dst, dst_capacity, kTagsOffset, count);
+    CopyColumn<QueueId>(src, src_capacity, dst, dst_capacity, kQueuesOffset, count);
+    CopyColumn<uint32_t>(src, src_capacity, dst, dst_capacity, kHandleIndicesOffset, count);
+    CopyColumn<SyncAccessIndex>(src, src_capacity, dst, dst_capacity, kAccessIndicesOffset, count);
+}
+
+void ReadStates::Reallocate(uint32_t new_capacity) {
+    assert(new_capacity >= size_);
+    assert(new_capacity != capacity_);
+    unsigned char *new_data = (new_capacity == kInlineCapacity) ? nullptr : new unsigned char[kReadSize * new_capacity];
+    if (capacity_ == kInlineCapacity) {
+        // Growing from the inline storage, which the heap pointer overlaps
+        CopyColumns(inline_data_, capacity_, new_data, new_capacity, size_);
+        heap_data_ = new_data;
+    } else {
+        unsigned char *old_data = heap_data_;
+        if (new_data) {
+            CopyColumns(old_data, capacity_, new_data, new_capacity, size_);
+            heap_data_ = new_data;
+        } else {
+            CopyColumns(old_data, capacity_, inline_data_, new_capacity, size_);
+        }
+        delete[] old_data;
+    }
+    capacity_ = new_capacity;
+}
+
+void ReadStates::Move(uint32_t from, uint32_t to) { Set(to, Get(from)); }
+
+void ReadStates::Swap(uint32_t a, uint32_t b) {
+    const ReadState read_a = Get(a);
+    Move(b, a);
+    Set(b, read_a);
+}
+
+void ReadStates::Retain(uint64_t keep_mask) {
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < size_; i++) {
+        if ((keep_mask >> i) & 1) {
+            if (kept != i) {
+                Move(i, kept);
+            }
+            kept++;
+        }
+    }
+    size_ = kept;
+    if (size_ <= kInlineCapacity && capacity_ != kInlineCapacity) {
+        Reallocate(kInlineCapacity);
+    }
+}
+
+void ReadStates::SortByStage() {
+    // ReadStates are unique by stage and there are few of them
+    const VkPipelineStageFlags2 *stages = Stages();
+    for (uint32_t i = 1; i < size_; i++) {
+        for (uint32_t j = i; j > 0 && stages[j] < stages[j - 1]; j--) {
+            Swap(j, j - 1);
+        }
+    }
+}
+
+bool ReadStates::operator==(const ReadStates &rhs) const {
+    if (size_ != rhs.size_) {
+        return false;
+    }
+    for (uint32_t i = 0; i < size_; i++) {
+        if (!(Get(i) == rhs.Get(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace {
+
+// Scalar kernels. These handle the odd read left by the vector loops, or all reads without vector support.
+// Each returns 0 or 1 and is written so the compiler emits conditional moves instead of branches.
+
+uint64_t InSourceScopeBit(const ReadStates &reads, uint32_t i, const ReadScopeQuery &query) {
+    const VkPipelineStageFlags2 queue_ordered_stage =
+        (reads.Queues()[i] == query.queue) ? reads.Stages()[i] : VK_PIPELINE_STAGE_2_NONE;
+    const VkPipelineStageFlags2 as_copy_stages =
+        (reads.AccessIndices()[i] == SYNC_ACCELERATION_STRUCTURE_COPY_ACCELERATION_STRUCTURE_READ) ? query.as_copy_chain_stages
+                                                                                                   : VK_PIPELINE_STAGE_2_NONE;
+    return (query.exec_scope & (queue_ordered_stage | reads.Barriers()[i] | as_copy_stages)) != 0;
+}
+
+uint64_t MissingBarriersBit(const ReadStates &reads, uint32_t i, VkPipelineStageFlags2 stage_mask) {
+    return (stage_mask & ~reads.Barriers()[i]) != 0;
+}
+
+uint64_t IntersectingStagesBit(const ReadStates &reads, uint32_t i, VkPipelineStageFlags2 stages,
+                               VkPipelineStageFlags2 sync_stages_mask) {
+    return ((reads.Stages()[i] | (reads.SyncStages()[i] & sync_stages_mask)) & stages) != 0;
+}
+
+// Only the event scope logic limits the tags, so this is not part of the per-read kernels
+uint64_t ReadsInTagScopeMask(const ReadStates &reads, ResourceUsageTag max_tag) {
+    const ResourceUsageTag *tags = reads.Tags();
+    uint64_t mask = 0;
+    for (uint32_t i = 0; i < reads.size(); i++) {
+        mask |= uint64_t(tags[i] <= max_tag) << i;
+    }
+    return mask;
+}
+
+#if defined(VVL_SYNCVAL_READ_SCOPE_SSE2)
+
+__m128i Load2(const uint64_t *column) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(column)); }
+
+// Widens the comparison of two 32-bit values with value into two 64-bit lanes of all ones or all zeros
+__m128i Equal2(const uint32_t *column, uint32_t value) {
+    const __m128i equal = _mm_cmpeq_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(column)), _mm_set1_epi32(int(value)));
+    return _mm_unpacklo_epi32(equal, equal);
+}
+
+// 2-bit mask, bit set for each non-zero lane. SSE2 has no 64-bit compare, a lane is zero if both its halves are.
+uint64_t NonZeroLanes(__m128i value) {
+    const __m128i zero_halves = _mm_cmpeq_epi32(value, _mm_setzero_si128());
+    const __m128i zero_lanes = _mm_and_si128(zero_halves, _mm_shuffle_epi32(zero_halves, _MM_SHUFFLE(2, 3, 0, 1)));
+    return uint64_t(~_mm_movemask_pd(_mm_castsi128_pd(zero_lanes)) & 0x3);
+}
+
+#elif defined(VVL_SYNCVAL_READ_SCOPE_NEON)
+
+uint64x2_t Load2(const uint64_t *column) { return vld1q_u64(column); }
+
+uint64x2_t Equal2(const uint32_t *column, uint32_t value) {
+    const uint32x2_t equal = vceq_u32(vld1_u32(column), vdup_n_u32(value));
+    // Sign extension turns each all-ones 32-bit lane into an all-ones 64-bit lane
+    return vreinterpretq_u64_s64(vmovl_s32(vreinterpret_s32_u32(equal)));
+}
+
+uint64_t NonZeroLanes(uint64x2_t value) {
+    const uint64x2_t non_zero = vtstq_u64(value, value);
+    return (vgetq_lane_u64(non_zero, 0) & 1) | ((vgetq_lane_u64(non_zero, 1) & 1) << 1);
+}
+
+#endif
+
+#if defined(VVL_SYNCVAL_READ_SCOPE_SSE2) || defined(VVL_SYNCVAL_READ_SCOPE_NEON)
+#define VVL_SYNCVAL_READ_SCOPE_VECTOR
+
+#if defined(VVL_SYNCVAL_READ_SCOPE_SSE2)
+using Vector2 = __m128i;
+Vector2 Splat2(uint64_t value) { return _mm_set1_epi64x(int64_t(value)); }
+Vector2 And2(Vector2 a, Vector2 b) { return _mm_and_si128(a, b); }
+Vector2 Or2(Vector2 a, Vector2 b) { return _mm_or_si128(a, b); }
+Vector2 AndNot2(Vector2 value, Vector2 mask) { return _mm_andnot_si128(mask, value); }  // value & ~mask
+#else
+using Vector2 = uint64x2_t;
+Vector2 Splat2(uint64_t value) { return vdupq_n_u64(value); }
+Vector2 And2(Vector2 a, Vector2 b) { return vandq_u64(a, b); }
+Vector2 Or2(Vector2 a, Vector2 b) { return vorrq_u64(a, b); }
+Vector2 AndNot2(Vector2 value, Vector2 mask) { return vbicq_u64(value, mask); }  // value & ~mask
+#endif
+
+#endif
+
+}  // namespace
+
+#if defined(VVL_SYNCVAL_READ_SCOPE_VECTOR)
+
+// The vector kernels. After the pairs of reads at most one read is left for the scalar kernel.
+
+uint64_t ReadsInSourceScopeMask(const ReadStates &reads, const ReadScopeQuery &query) {
+    const uint32_t count = reads.size();
+    uint64_t mask = 0;
+    uint32_t i = 0;
+    if (count >= 2) {
+        const VkPipelineStageFlags2 *stages = reads.Stages();
+        const VkPipelineStageFlags2 *barriers = reads.Barriers();
+        const QueueId *queues = reads.Queues();
+        const uint32_t *access_indices = reinterpret_cast<const uint32_t *>(reads.AccessIndices());
+        const Vector2 exec_scope = Splat2(query.exec_scope);
+        const Vector2 as_copy_stages = Splat2(query.as_copy_chain_stages);
+        for (; i + 2 <= count; i += 2) {
+            const Vector2 same_queue = Equal2(&queues[i], query.queue);
+            const Vector2 is_as_copy = Equal2(&access_indices[i], SYNC_ACCELERATION_STRUCTURE_COPY_ACCELERATION_STRUCTURE_READ);
+            Vector2 effective_stages = Or2(Load2(&barriers[i]), And2(Load2(&stages[i]), same_queue));
+            effective_stages = Or2(effective_stages, And2(as_copy_stages, is_as_copy));
+            mask |= NonZeroLanes(And2(exec_scope, effective_stages)) << i;
+        }
+    }
+    if (i < count) {
+        mask |= InSourceScopeBit(reads, i, query) << i;
+    }
+    if (query.max_tag != kInvalidTag) {
+        mask &= ReadsInTagScopeMask(reads, query.max_tag);
+    }
+    return mask;
+}
+
+uint64_t ReadsMissingBarriersMask(const ReadStates &reads, VkPipelineStageFlags2 stage_mask) {
+    const uint32_t count = reads.size();
+    uint64_t mask = 0;
+    uint32_t i = 0;
+    if (count >= 2) {
+        const VkPipelineStageFlags2 *barriers = reads.Barriers();
+        const Vector2 stages = Splat2(stage_mask);
+        for (; i + 2 <= count; i += 2) {
+            mask |= NonZeroLanes(AndNot2(stages, Load2(&barriers[i]))) << i;
+        }
+    }
+    if (i < count) {
+        mask |= MissingBarriersBit(reads, i, stage_mask) << i;
+    }
+    return mask;
+}
+
+uint64_t ReadsIntersectingStagesMask(const ReadStates &reads, VkPipelineStageFlags2 stages, bool include_sync_stages) {
+    const uint32_t count = reads.size();
+    const VkPipelineStageFlags2 sync_stages_mask = include_sync_stages ? ~VkPipelineStageFlags2(0) : VK_PIPELINE_STAGE_2_NONE;
+    uint64_t mask = 0;
+    uint32_t i = 0;
+    if (count >= 2) {
+        const VkPipelineStageFlags2 *read_stages = reads.Stages();
+        const VkPipelineStageFlags2 *read_sync_stages = reads.SyncStages();
+        const Vector2 test_stages = Splat2(stages);
+        const Vector2 sync_mask = Splat2(sync_stages_mask);
+        for (; i + 2 <= count; i += 2) {
+            const Vector2 effective_stages = Or2(Load2(&read_stages[i]), And2(Load2(&read_sync_stages[i]), sync_mask));
+            mask |= NonZeroLanes(And2(effective_stages, test_stages)) << i;
+        }
+    }
+    if (i < count) {
+        mask |= IntersectingStagesBit(reads, i, stages, sync_stages_mask) << i;
+    }
+    return mask;
+}
+
+#else
+
+uint64_t ReadsInSourceScopeMask(const ReadStates &reads, const ReadScopeQuery &query) {
+    uint64_t mask = 0;
+    for (uint32_t i = 0; i < reads.size(); i++) {
+        mask |= InSourceScopeBit(reads, i, query) << i;
+    }
+    if (query.max_tag != kInvalidTag) {
+        mask &= ReadsInTagScopeMask(reads, query.max_tag);
+    }
+    return mask;
+}
+
+uint64_t ReadsMissingBarriersMask(const ReadStates &reads, VkPipelineStageFlags2 stage_mask) {
+    uint64_t mask = 0;
+    for (uint32_t i = 0; i < reads.size(); i++) {
+        mask |= MissingBarriersBit(reads, i, stage_mask) << i;
+    }
+    return mask;
+}
+
+uint64_t ReadsIntersectingStagesMask(const ReadStates &reads, VkPipelineStageFlags2 stages, bool include_sync_stages) {
+    const VkPipelineStageFlags2 sync_stages_mask = include_sync_stages ? ~VkPipelineStageFlags2(0) : VK_PIPELINE_STAGE_2_NONE;
+    uint64_t mask = 0;
+    for (uint32_t i = 0; i < reads.size(); i++) {
+        mask |= IntersectingStagesBit(reads, i, stages, sync_stages_mask) << i;
+    }
+    return mask;
+}
+
+#endif
+
+VkPipelineStageFlags2 GetReadStages(const ReadStates &reads, uint64_t read_mask) {
+    const VkPipelineStageFlags2 *read_stages = reads.Stages();
+    VkPipelineStageFlags2 stages = VK_PIPELINE_STAGE_2_NONE;
+    for (uint32_t i = 0; i < reads.size(); i++) {
+        // Select the stage with an all-ones/all-zeros mask instead of a branch
+        const VkPipelineStageFlags2 select = VkPipelineStageFlags2(0) - ((read_mask >> i) & 1);
+        stages |= read_stages[i] & select;
+    }
+    return stages;
+}
+
+}  // namespace syncval
@@ -0,0 +1,143 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "sync/sync_common.h"
+#include "utils/math_utils.h"
+
+namespace syncval {
+
+struct ReadState;
+
+// Read states of an AccessState, stored as a structure of arrays.
+//
+// Each field of the reads is a column, so the scope tests below load a field of consecutive reads with one vector load
+// instead of gathering it from an array of ReadState. The columns share one allocation. The common case of a single
+// read is stored inline, without allocation.
+class ReadStates {
+  public:
+    ReadStates() = default;
+    ReadStates(const ReadStates &other);
+    ReadStates &operator=(const ReadStates &other);
+    ReadStates(ReadStates &&other) noexcept;
+    ReadStates &operator=(ReadStates &&other) noexcept;
+    ~ReadStates() { Clear(); }
+
+    uint32_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    ReadState Get(uint32_t index) const;
+    void Set(uint32_t index, const ReadState &read);
+    void Add(const ReadState &read);
+    // Releases the allocation
+    void Clear();
+    // Keeps the reads selected by keep_mask, in order
+    void Retain(uint64_t keep_mask);
+    void SortByStage();
+
+    // Same as comparing the reads with ReadState::operator==
+    bool operator==(const ReadStates &rhs) const;
+
+    VkPipelineStageFlags2 *Stages() { return Column<VkPipelineStageFlags2>(kStagesOffset); }
+    const VkPipelineStageFlags2 *Stages() const { return Column<VkPipelineStageFlags2>(kStagesOffset); }
+    VkPipelineStageFlags2 *Barriers() { return Column<VkPipelineStageFlags2>(kBarriersOffset); }
+    const VkPipelineStageFlags2 *Barriers() const { return Column<VkPipelineStageFlags2>(kBarriersOffset); }
+    VkPipelineStageFlags2 *SyncStages() { return Column<VkPipelineStageFlags2>(kSyncStagesOffset); }
+    const VkPipelineStageFlags2 *SyncStages() const { return Column<VkPipelineStageFlags2>(kSyncStagesOffset); }
+    ResourceUsageTag *Tags() { return Column<ResourceUsageTag>(kTagsOffset); }
+    const ResourceUsageTag *Tags() const { return Column<ResourceUsageTag>(kTagsOffset); }
+    QueueId *Queues() { return Column<QueueId>(kQueuesOffset); }
+    const QueueId *Queues() const { return Column<QueueId>(kQueuesOffset); }
+    uint32_t *HandleIndices() { return Column<uint32_t>(kHandleIndicesOffset); }
+    const uint32_t *HandleIndices() const { return Column<uint32_t>(kHandleIndicesOffset); }
+    SyncAccessIndex *AccessIndices() { return Column<SyncAccessIndex>(kAccessIndicesOffset); }
+    const SyncAccessIndex *AccessIndices() const { return Column<SyncAccessIndex>(kAccessIndicesOffset); }
+
+  private:
+    static constexpr uint32_t kInlineCapacity = 1;
+
+    // Column offsets for a capacity of one read, the offsets scale with the capacity. Columns are ordered by alignment.
+    static constexpr size_t kStagesOffset = 0;
+    static constexpr size_t kBarriersOffset = kStagesOffset + sizeof(VkPipelineStageFlags2);
+    static constexpr size_t kSyncStagesOffset = kBarriersOffset + sizeof(VkPipelineStageFlags2);
+    static constexpr size_t kTagsOffset = kSyncStagesOffset + sizeof(VkPipelineStageFlags2);
+    static constexpr size_t kQueuesOffset = kTagsOffset + sizeof(ResourceUsageTag);
+    static constexpr size_t kHandleIndicesOffset = kQueuesOffset + sizeof(QueueId);
+    static constexpr size_t kAccessIndicesOffset = kHandleIndicesOffset + sizeof(uint32_t);
+    static constexpr size_t kReadSize = kAccessIndicesOffset + sizeof(SyncAccessIndex);
+
+    unsigned char *Data() { return (capacity_ == kInlineCapacity) ? inline_data_ : heap_data_; }
+    const unsigned char *Data() const { return (capacity_ == kInlineCapacity) ? inline_data_ : heap_data_; }
+    template <typename T>
+    T *Column(size_t offset) {
+        return reinterpret_cast<T *>(Data() + offset * capacity_);
+    }
+    template <typename T>
+    const T *Column(size_t offset) const {
+        return reinterpret_cast<const T *>(Data() + offset * capacity_);
+    }
+    static void CopyColumns(const unsigned char *src, uint32_t src_capacity, unsigned char *dst, uint32_t dst_capacity,
+                            uint32_t count);
+    void Reallocate(uint32_t new_capacity);
+    void Move(uint32_t from, uint32_t to);
+    void Swap(uint32_t a, uint32_t b);
+
+    uint32_t size_ = 0;
+    uint32_t capacity_ = kInlineCapacity;
+    union {
+        alignas(8) unsigned char inline_data_[kReadSize * kInlineCapacity];
+        unsigned char *heap_data_;
+    };
+};
+
+// Batched scope tests over the read states of an AccessState.
+//
+// There is at most one read state per pipeline stage, so a 64-bit mask can describe any subset of the reads
+// (bit i corresponds to read i). The kernels evaluate a predicate over all reads without branching on
+// individual results, which lets the barrier and hazard loops reduce to mask arithmetic. They process two reads
+// per step with SSE2 or NEON, which are part of the x86-64 and aarch64 baselines, with a branch-free scalar fallback.
+constexpr uint32_t kMaxReadsPerAccess = 64;
+
+// Parameters of the "read or its dependency chain is in the source scope" test
+struct ReadScopeQuery {
+    QueueId queue = kQueueIdInvalid;
+    VkPipelineStageFlags2 exec_scope = VK_PIPELINE_STAGE_2_NONE;
+    // Reads with tags greater than this are not in scope (used by the event scope logic)
+    ResourceUsageTag max_tag = kInvalidTag;
+    // Additional stages that chain with acceleration structure copy reads.
+    // See the comment in ReadState::ReadOrDependencyChainInSourceScope.
+    VkPipelineStageFlags2 as_copy_chain_stages = VK_PIPELINE_STAGE_2_NONE;
+};
+
+// Bit i is set if read i (or a barrier chained to it) is in the source scope
+uint64_t ReadsInSourceScopeMask(const ReadStates &reads, const ReadScopeQuery &query);
+
+// Bit i is set if stage_mask is not fully covered by the barriers of read i
+uint64_t ReadsMissingBarriersMask(const ReadStates &reads, VkPipelineStageFlags2 stage_mask);
+
+// Bit i is set if the stage of read i (optionally together with its sync_stages) intersects the given stages
+uint64_t ReadsIntersectingStagesMask(const ReadStates &reads, VkPipelineStageFlags2 stages, bool include_sync_stages);
+
+// Union of the stages of the reads selected by read_mask
+VkPipelineStageFlags2 GetReadStages(const ReadStates &reads, uint64_t read_mask);
+
+inline uint32_t GetFirstReadIndex(uint64_t read_mask) {
+    assert(read_mask != 0);
+    return static_cast<uint32_t>(LeastSignificantBit64(read_mask));
+}
+
+}  // namespace syncval
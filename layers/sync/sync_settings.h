@@ -20,5 +20,6 @@
 struct SyncValSettings {
     bool submit_time_validation = true;
     bool shader_accesses_heuristic = false;
+    bool parallel_submit_replay = false;
     bool message_extra_properties = false;
 };
@@ -41,15 +41,15 @@ namespace syncval {
 
 // NOTE: fetch_add/fetch_sub return value before increment/decrement.
 // Our Add/Sub functions return new counter values, so they need to
-// adjust result of the atomic function by adding/subtracting one.
+// adjust result of the atomic function by adding/subtracting n.
 
 void Value32::Update(uint32_t new_value) { u32.store(new_value); }
-uint32_t Value32::Add(uint32_t n) { return u32.fetch_add(n) + 1; }
-uint32_t Value32::Sub(uint32_t n) { return u32.fetch_sub(n) - 1; }
+uint32_t Value32::Add(uint32_t n) { return u32.fetch_add(n) + n; }
+uint32_t Value32::Sub(uint32_t n) { return u32.fetch_sub(n) - n; }
 
 void Value64::Update(uint64_t new_value) { u64.store(new_value); }
-uint64_t Value64::Add(uint64_t n) { return u64.fetch_add(n) + 1; }
-uint64_t Value64::Sub(uint64_t n) { return u64.fetch_sub(n) - 1; }
+uint64_t Value64::Add(uint64_t n) { return u64.fetch_add(n) + n; }
+uint64_t Value64::Sub(uint64_t n) { return u64.fetch_sub(n) - n; }
 
 void ValueMax32::Update(uint32_t new_value) {
     value.Update(new_value);
@@ -93,6 +93,9 @@ void Stats::RemoveUnresolvedBatch() { unresolved_batches.Sub(1); }
 void Stats::AddHandleRecord(uint32_t count) { handle_records.Add(count); }
 void Stats::RemoveHandleRecord(uint32_t count) { handle_records.Sub(count); }
 
+void Stats::AddArenaBytes(uint64_t bytes) { arena_bytes.Add(bytes); }
+void Stats::RemoveArenaBytes(uint64_t bytes) { arena_bytes.Sub(bytes); }
+
 void AccessContextStats::UpdateMax(const AccessContextStats& cur_stats) {
 #define UPDATE_MAX(field) field = std::max(field, cur_stats.field)
     UPDATE_MAX(access_contexts);
@@ -198,6 +201,7 @@ std::string Stats::CreateReport() {
     uint64_t handle_record_memory = handle_records.value.u32 * sizeof(HandleRecord);
     uint64_t handle_record_max_memory = handle_records.max_value.u32 * sizeof(HandleRecord);
     print_common_stats64("HandleRecord bytes", handle_record_memory, handle_record_max_memory);
+    print_common_stats64("Command pool arena bytes", arena_bytes.value.u64, arena_bytes.max_value.u64);
 
     const char* access_stats_header =
         "context      accesses   size (MB)  | reads     writes    firsts   | many_reads  many_firsts  have_allocs  allocated (B)\n";
@@ -141,6 +141,11 @@ struct Stats {
     void AddHandleRecord(uint32_t count = 1);
     void RemoveHandleRecord(uint32_t count = 1);
 
+    // Recording storage cached by command pool arenas. The max value is the arena high-water mark.
+    ValueMax64 arena_bytes;
+    void AddArenaBytes(uint64_t bytes);
+    void RemoveArenaBytes(uint64_t bytes);
+
     AccessStats access_stats;
     void UpdateAccessStats(SyncValidator& validator);
 
@@ -153,6 +158,8 @@ struct Stats {
 struct Stats {
     void AddHandleRecord(uint32_t count = 1) {}
     void RemoveHandleRecord(uint32_t count = 1) {}
+    void AddArenaBytes(uint64_t bytes) {}
+    void RemoveArenaBytes(uint64_t bytes) {}
     void AddCommandBufferContext() {}
     void RemoveCommandBufferContext() {}
     void AddQueueBatchContext() {}
@@ -673,18 +673,26 @@ std::vector<BatchContextConstPtr> QueueBatchContext::ResolveSubmitWaits(vvl::spa
     return resolved_batches;
 }
 
+void QueueBatchContext::SetupSubmitTags(const std::vector<CommandBufferConstPtr>& command_buffers) {
+    uint32_t tag_count = 0;
+    for (const auto& cb : command_buffers) {
+        if (!cb) continue;
+        tag_count += static_cast<uint32_t>(SubState(*cb).access_context.GetTagCount());
+    }
+    SetupBatchTags(tag_count);
+    submit_tags_reserved_ = true;
+}
+
 bool QueueBatchContext::ValidateSubmit(const std::vector<CommandBufferConstPtr>& command_buffers, uint64_t submit_index,
                                        uint32_t batch_index, std::vector<std::string>& current_label_stack,
                                        const ErrorObject& error_obj) {
     bool skip = false;
 
     BatchAccessLog::BatchRecord batch{queue_state_, submit_index, batch_index};
-    uint32_t tag_count = 0;
-    for (const auto& cb : command_buffers) {
-        if (!cb) continue;
-        tag_count += static_cast<uint32_t>(SubState(*cb).access_context.GetTagCount());
+    if (!submit_tags_reserved_) {
+        SetupSubmitTags(command_buffers);
     }
-    batch.base_tag = SetupBatchTags(tag_count);
+    batch.base_tag = tag_range_.begin;
 
     for (size_t index = 0; index < command_buffers.size(); index++) {
         const auto& cb = SubState(*command_buffers[index]);
@@ -704,6 +712,42 @@ bool QueueBatchContext::ValidateSubmit(const std::vector<CommandBufferConstPtr>&
     return skip;
 }
 
+bool QueueBatchContext::ValidateConcurrentBatch(const std::vector<CommandBufferConstPtr>& command_buffers,
+                                                const QueueBatchContext& concurrent_batch, ResourceUsageTag concurrent_start_tag,
+                                                const ErrorObject& error_obj) {
+    bool skip = false;
+
+    // Same as RegisterAsyncContexts, the log is needed to report accesses from the concurrent batch
+    batch_log_.Import(concurrent_batch.batch_log_);
+
+    const QueueId concurrent_queue = concurrent_batch.GetQueueId();
+    ResourceUsageTag sync_tag = concurrent_start_tag;
+    if (concurrent_queue < queue_sync_tag_.size()) {
+        sync_tag = std::max(sync_tag, queue_sync_tag_[concurrent_queue]);
+    }
+
+    // The context has no accesses of its own, so only async hazards against the concurrent batch can be detected.
+    // Barriers do not affect async hazards, so the whole tag range of the command buffer is validated at once.
+    AccessContext async_context;
+    async_context.AddAsyncContext(&concurrent_batch.GetAccessContext(), sync_tag, concurrent_queue);
+
+    const ResourceUsageRange all_tags(0, ResourceUsageRecord::kMaxIndex);
+    for (size_t index = 0; index < command_buffers.size(); index++) {
+        if (!command_buffers[index]) continue;
+        const CommandBufferAccessContext& access_context = SubState(*command_buffers[index]).access_context;
+        if (access_context.GetTagCount() == 0) continue;
+
+        const HazardResult hazard = access_context.GetCurrentAccessContext()->DetectFirstUseHazard(
+            GetQueueId(), all_tags, async_context, AccessContext::DetectOptions::kDetectAsync);
+        if (hazard.IsHazard()) {
+            LogObjectList objlist(Handle(), access_context.Handle());
+            const std::string error = sync_state_.error_messages_.FirstUseError(hazard, *this, access_context, uint32_t(index));
+            skip |= sync_state_.SyncError(hazard.Hazard(), objlist, error_obj.location, error);
+        }
+    }
+    return skip;
+}
+
 QueueBatchContext::PresentResourceRecord::Base_::Record QueueBatchContext::PresentResourceRecord::MakeRecord() const {
     return std::make_unique<PresentResourceRecord>(presented_);
 }
@@ -329,9 +329,16 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
                                                          std::vector<VkSemaphoreSubmitInfo> &unresolved_waits,
                                                          SignalsUpdate &signals_update);
 
+    // Reserves the tags of the submitted command buffers. ValidateSubmit does it when it was not done beforehand.
+    void SetupSubmitTags(const std::vector<CommandBufferConstPtr> &command_buffers);
     bool ValidateSubmit(const std::vector<CommandBufferConstPtr> &command_buffers, uint64_t submit_index, uint32_t batch_index,
                         std::vector<std::string> &current_label_stack, const ErrorObject &error_obj);
     void ResolveSubmittedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset);
+    // Checks for async hazards against a batch from another queue that was validated concurrently with this one.
+    // Only accesses of the concurrent batch starting from concurrent_start_tag are considered.
+    bool ValidateConcurrentBatch(const std::vector<CommandBufferConstPtr> &command_buffers,
+                                 const QueueBatchContext &concurrent_batch, ResourceUsageTag concurrent_start_tag,
+                                 const ErrorObject &error_obj);
 
     // For Present
     std::vector<ConstPtr> ResolvePresentWaits(vvl::span<const VkSemaphore> wait_semaphores, const PresentedImages &presented_images,
@@ -374,6 +381,7 @@ class QueueBatchContext : public CommandExecutionContext, public std::enable_sha
   private:
     const QueueSyncState *queue_state_ = nullptr;
     ResourceUsageRange tag_range_ = ResourceUsageRange(0, 0);  // Range of tags referenced by cbs_referenced
+    bool submit_tags_reserved_ = false;
 
     AccessContext access_context_;
     AccessContext *current_access_context_;
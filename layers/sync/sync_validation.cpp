@@ -22,6 +22,7 @@
 
 #include "sync/sync_error_messages.h"
 #include "sync/sync_validation.h"
+#include "sync/sync_command_pool_arena.h"
 #include "sync/sync_image.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/ray_tracing_state.h"
@@ -40,7 +41,11 @@ static bool GetShowStatsEnvVar() {
 }
 
 SyncValidator::SyncValidator(vvl::dispatch::Device *dev, syncval::Instance *instance_vo)
-    : BaseClass(dev, instance_vo, LayerObjectTypeSyncValidation), error_messages_(*this), report_stats_(GetShowStatsEnvVar()) {}
+    : BaseClass(dev, instance_vo, LayerObjectTypeSyncValidation), error_messages_(*this), report_stats_(GetShowStatsEnvVar()) {
+    if (syncval_settings.submit_time_validation && syncval_settings.parallel_submit_replay) {
+        replay_thread_pool_ = std::make_unique<vvl::ThreadPool>();
+    }
+}
 
 SyncValidator::~SyncValidator() {
     // Instance level SyncValidator does not have much to say
@@ -51,6 +56,22 @@ SyncValidator::~SyncValidator() {
     }
 }
 
+ReadLockGuard SyncValidator::CommandBufferReadLock() const {
+    if (global_settings.fine_grained_locking) {
+        return ReadLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return ReadLock();
+    }
+}
+
+WriteLockGuard SyncValidator::CommandBufferWriteLock() {
+    if (global_settings.fine_grained_locking) {
+        return WriteLockGuard(validation_object_mutex, std::defer_lock);
+    } else {
+        return WriteLock();
+    }
+}
+
 // Location to add per-queue submit debug info if built with -D DEBUG_CAPTURE_KEYBOARD=ON.
 void SyncValidator::DebugCapture() {
     if (report_stats_) {
@@ -326,6 +347,44 @@ void SyncValidator::Created(vvl::Image &image_state) {
     image_state.SetSubState(container_type, std::make_unique<ImageSubState>(image_state));
 }
 
+std::shared_ptr<CommandPoolArena> SyncValidator::GetCommandPoolArena(VkCommandPool command_pool) const {
+    const auto found_it = command_pool_arenas_.find(command_pool);
+    if (found_it == command_pool_arenas_.end()) {
+        return nullptr;
+    }
+    return found_it->second;
+}
+
+void SyncValidator::PostCallRecordCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo,
+                                                    const VkAllocationCallbacks *pAllocator, VkCommandPool *pCommandPool,
+                                                    const RecordObject &record_obj) {
+    if (record_obj.result != VK_SUCCESS) {
+        return;
+    }
+    command_pool_arenas_.insert_or_assign(*pCommandPool, std::make_shared<CommandPoolArena>(stats));
+}
+
+void SyncValidator::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool,
+                                                    const VkAllocationCallbacks *pAllocator, const RecordObject &record_obj) {
+    auto pop_result = command_pool_arenas_.pop(commandPool);
+    if (pop_result->first) {
+        // Command buffers and submitted batches can still hold references to the arena
+        pop_result->second->Release();
+    }
+}
+
+void SyncValidator::PostCallRecordTrimCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags,
+                                                  const RecordObject &record_obj) {
+    if (auto arena = GetCommandPoolArena(commandPool)) {
+        arena->Trim();
+    }
+}
+
+void SyncValidator::PostCallRecordTrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags,
+                                                     const RecordObject &record_obj) {
+    PostCallRecordTrimCommandPool(device, commandPool, flags, record_obj);
+}
+
 void SyncValidator::PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator,
                                                const RecordObject &record_obj) {
     if (const auto buffer_state = Get<vvl::Buffer>(buffer)) {
@@ -2572,6 +2631,11 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
     // Since this early return is above the TlsGuard, the Record phase must also be.
     if (!syncval_settings.submit_time_validation) return skip;
 
+    // The batches of a submit are replayed on this thread. Each batch imports the context of the previous batch of the queue
+    // and its command buffers are replayed in order, so there is no independent work within one submit. Submits to other
+    // queues are serialized by the lock because the replay reads their last batches as async contexts, and it resolves
+    // waits against their signals. Batches of several queues only become ready together when timeline signals resolve
+    // wait-before-signal submits, which is what syncval_parallel_submit_replay runs on worker threads.
     std::lock_guard lock_guard(queue_submit_mutex_);
 
     ClearPending();
@@ -2688,8 +2752,14 @@ bool SyncValidator::PropagateTimelineSignals(SignalsUpdate &signals_update, cons
     // Each iteration uses registered timeline signals to resolve existing unresolved batches.
     // Each resolved batch can generate new timeline signals which can resolve more unresolved batches on the next iteration.
     // This finishes when all unresolved batches are resolved or when iteration does not generate new timeline signals.
-    while (PropagateTimelineSignalsIteration(queues, signals_update, skip, error_obj)) {
-        ;
+    if (replay_thread_pool_) {
+        while (PropagateTimelineSignalsParallelIteration(queues, signals_update, skip, error_obj)) {
+            ;
+        }
+    } else {
+        while (PropagateTimelineSignalsIteration(queues, signals_update, skip, error_obj)) {
+            ;
+        }
     }
 
     // Schedule unresolved state update
@@ -2733,8 +2803,7 @@ bool SyncValidator::PropagateTimelineSignalsIteration(std::vector<UnresolvedQueu
     return has_new_timeline_signals;
 }
 
-bool SyncValidator::ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, SignalsUpdate &signals_update,
-                                           BatchContextPtr &last_batch, bool &skip, const ErrorObject &error_obj) const {
+bool SyncValidator::ResolveUnresolvedBatchWaits(UnresolvedBatch &unresolved_batch, SignalsUpdate &signals_update) const {
     // Resolve waits that have matching signal
     auto it = unresolved_batch.unresolved_waits.begin();
     while (it != unresolved_batch.unresolved_waits.end()) {
@@ -2751,14 +2820,11 @@ bool SyncValidator::ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, Si
         }
         it = unresolved_batch.unresolved_waits.erase(it);
     }
+    return unresolved_batch.unresolved_waits.empty();
+}
 
-    // This batch still has unresolved waits
-    if (!unresolved_batch.unresolved_waits.empty()) {
-        return false;  // no new timeline signals were registered
-    }
-
-    // Process fully resolved batch
-    UnresolvedBatch &ready_batch = unresolved_batch;
+bool SyncValidator::ValidateResolvedBatch(UnresolvedBatch &ready_batch, BatchContextPtr &last_batch,
+                                          const ErrorObject &error_obj) const {
     if (last_batch && !vvl::Contains(ready_batch.resolved_dependencies, last_batch)) {
         ready_batch.batch->ResolveLastBatch(last_batch);
         ready_batch.resolved_dependencies.emplace_back(std::move(last_batch));
@@ -2767,13 +2833,118 @@ bool SyncValidator::ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, Si
 
     const auto async_batches = ready_batch.batch->RegisterAsyncContexts(ready_batch.resolved_dependencies);
 
-    skip |= ready_batch.batch->ValidateSubmit(ready_batch.command_buffers, ready_batch.submit_index, ready_batch.batch_index,
-                                              ready_batch.label_stack, error_obj);
+    return ready_batch.batch->ValidateSubmit(ready_batch.command_buffers, ready_batch.submit_index, ready_batch.batch_index,
+                                             ready_batch.label_stack, error_obj);
+}
+
+bool SyncValidator::ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, SignalsUpdate &signals_update,
+                                           BatchContextPtr &last_batch, bool &skip, const ErrorObject &error_obj) const {
+    // This batch still has unresolved waits
+    if (!ResolveUnresolvedBatchWaits(unresolved_batch, signals_update)) {
+        return false;  // no new timeline signals were registered
+    }
+
+    // Process fully resolved batch
+    UnresolvedBatch &ready_batch = unresolved_batch;
+    skip |= ValidateResolvedBatch(ready_batch, last_batch, error_obj);
 
     const auto submit_signals = vvl::make_span(ready_batch.signals.data(), ready_batch.signals.size());
     return signals_update.RegisterSignals(ready_batch.batch, submit_signals);
 }
 
+bool SyncValidator::PropagateTimelineSignalsParallelIteration(std::vector<UnresolvedQueue> &queues, SignalsUpdate &signals_update,
+                                                              bool &skip, const ErrorObject &error_obj) const {
+    // Batches that became ready on a single queue. They depend on each other through submission order,
+    // but there are no semaphore dependencies between the chains of different queues.
+    struct ReadyChain {
+        UnresolvedQueue *queue = nullptr;
+        BatchContextPtr last_batch;
+        std::vector<UnresolvedBatch> batches;
+        ResourceUsageTag start_tag = 0;
+        MessageCapture messages;
+        bool skip = false;
+    };
+    std::vector<ReadyChain> chains;
+
+    // Resolve waits using only the signals registered before this iteration. The signals of the batches
+    // that are validated by this iteration are registered after the join, so a batch that waits on one
+    // of them stays unresolved and is picked up by the next iteration.
+    for (auto &queue : queues) {
+        ReadyChain chain;
+        chain.queue = &queue;
+        chain.last_batch =
+            queue.queue_state->PendingLastBatch() ? queue.queue_state->PendingLastBatch() : queue.queue_state->LastBatch();
+
+        while (!queue.unresolved_batches.empty()) {
+            auto &unresolved_batch = queue.unresolved_batches.front();
+            if (!ResolveUnresolvedBatchWaits(unresolved_batch, signals_update)) {
+                break;  // later batches on this queue must wait for this one (submission order)
+            }
+            chain.batches.emplace_back(std::move(unresolved_batch));
+            queue.unresolved_batches.erase(queue.unresolved_batches.begin());
+            queue.update_unresolved = true;
+            stats.RemoveUnresolvedBatch();
+        }
+        if (!chain.batches.empty()) {
+            chains.emplace_back(std::move(chain));
+        }
+    }
+    if (chains.empty()) {
+        return false;
+    }
+
+    // Reserve the tags in queue and submission order, the same as the sequential replay, so the tags do not depend
+    // on which task runs first
+    for (ReadyChain &chain : chains) {
+        for (UnresolvedBatch &ready_batch : chain.batches) {
+            ready_batch.batch->SetupSubmitTags(ready_batch.command_buffers);
+        }
+    }
+
+    // Pending last batches are not updated until the join, so all chains see the same set of async batches.
+    // Errors are captured per chain and reported after the join in queue order.
+    {
+        vvl::TaskGroup task_group(replay_thread_pool_.get());
+        for (ReadyChain &chain : chains) {
+            task_group.Run([this, &chain, &error_obj]() {
+                MessageCapture::Scope capture_scope(chain.messages);
+                for (UnresolvedBatch &ready_batch : chain.batches) {
+                    chain.skip |= ValidateResolvedBatch(ready_batch, chain.last_batch, error_obj);
+                }
+            });
+        }
+        task_group.Wait();
+    }
+
+    // Sequential validation would have registered the last batch of each earlier queue as async context
+    // for the batches of the later queues. Do this check now that all chains are replayed.
+    for (ReadyChain &chain : chains) {
+        chain.start_tag = chain.batches.front().batch->GetTagRange().begin;
+    }
+    for (size_t i = 0; i < chains.size(); i++) {
+        ReadyChain &chain = chains[i];
+        skip |= chain.messages.Replay();
+        skip |= chain.skip;
+        for (size_t j = 0; j < i; j++) {
+            const ReadyChain &concurrent_chain = chains[j];
+            for (UnresolvedBatch &ready_batch : chain.batches) {
+                skip |= ready_batch.batch->ValidateConcurrentBatch(ready_batch.command_buffers, *concurrent_chain.last_batch,
+                                                                   concurrent_chain.start_tag, error_obj);
+            }
+        }
+    }
+
+    bool has_new_timeline_signals = false;
+    for (ReadyChain &chain : chains) {
+        for (UnresolvedBatch &ready_batch : chain.batches) {
+            const auto submit_signals = vvl::make_span(ready_batch.signals.data(), ready_batch.signals.size());
+            has_new_timeline_signals |= signals_update.RegisterSignals(ready_batch.batch, submit_signals);
+        }
+        chain.queue->queue_state->SetPendingLastBatch(std::move(chain.last_batch));
+    }
+    return has_new_timeline_signals;
+}
+
 void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, QueueSubmitCmdState *cmd_state) {
     stats.UpdateMemoryStats();
 
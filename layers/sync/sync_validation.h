@@ -28,6 +28,7 @@
 #include "sync/sync_stats.h"
 #include "sync/sync_submit.h"
 #include "containers/limits.h"
+#include "utils/thread_pool.h"
 
 namespace syncval {
 // sync validation has no instance-level functionality
@@ -47,6 +48,11 @@ class SyncValidator : public vvl::DeviceProxy {
     SyncValidator(vvl::dispatch::Device *dev, syncval::Instance *instance_vo);
     ~SyncValidator();
 
+    // Command buffer access contexts are only touched under the command buffer lock, vkCmd* calls
+    // do not need the device-wide lock when fine grained locking is enabled
+    ReadLockGuard CommandBufferReadLock() const override;
+    WriteLockGuard CommandBufferWriteLock() override;
+
     ErrorMessages error_messages_;
 
     // Stats object must be the first member of this class:
@@ -65,6 +71,13 @@ class SyncValidator : public vvl::DeviceProxy {
 
     mutable std::mutex queue_submit_mutex_;
 
+    // Worker threads for syncval_parallel_submit_replay. Null when the setting is disabled.
+    std::unique_ptr<vvl::ThreadPool> replay_thread_pool_;
+
+    // Recording storage recycled between the command buffers of each command pool
+    vvl::concurrent_unordered_map<VkCommandPool, std::shared_ptr<CommandPoolArena>> command_pool_arenas_;
+    std::shared_ptr<CommandPoolArena> GetCommandPoolArena(VkCommandPool command_pool) const;
+
     // Semaphore signal registry
     vvl::unordered_map<VkSemaphore, SignalInfo> binary_signals_;
     vvl::unordered_map<VkSemaphore, std::vector<SignalInfo>> timeline_signals_;
@@ -102,6 +115,16 @@ class SyncValidator : public vvl::DeviceProxy {
     bool ProcessUnresolvedBatch(UnresolvedBatch &unresolved_batch, SignalsUpdate &signals_update, BatchContextPtr &last_batch,
                                 bool &skip, const ErrorObject &error_obj) const;
 
+    // Version of PropagateTimelineSignalsIteration used by syncval_parallel_submit_replay.
+    // Ready batches from different queues are replayed concurrently on the replay thread pool.
+    bool PropagateTimelineSignalsParallelIteration(std::vector<UnresolvedQueue> &queues, SignalsUpdate &signals_update,
+                                                   bool &skip, const ErrorObject &error_obj) const;
+
+    // Return true if all waits of the batch are resolved
+    bool ResolveUnresolvedBatchWaits(UnresolvedBatch &unresolved_batch, SignalsUpdate &signals_update) const;
+    // Replay batch with resolved waits on top of the last batch. Updates last_batch to point to the replayed batch.
+    bool ValidateResolvedBatch(UnresolvedBatch &ready_batch, BatchContextPtr &last_batch, const ErrorObject &error_obj) const;
+
     void ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag, const LastSynchronizedPresent &last_synchronized_present);
     void ApplyAcquireWait(const AcquiredImage &acquired);
 
@@ -130,6 +153,16 @@ class SyncValidator : public vvl::DeviceProxy {
 
     void DebugCapture() final;
 
+    void PostCallRecordCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo,
+                                         const VkAllocationCallbacks *pAllocator, VkCommandPool *pCommandPool,
+                                         const RecordObject &record_obj) override;
+    void PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks *pAllocator,
+                                         const RecordObject &record_obj) override;
+    void PostCallRecordTrimCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags,
+                                       const RecordObject &record_obj) override;
+    void PostCallRecordTrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags,
+                                          const RecordObject &record_obj) override;
+
     void PreCallRecordDestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator,
                                     const RecordObject &record_obj) override;
     void PreCallRecordDestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator,
@@ -18,8 +18,76 @@
 #include "generated/dispatch_functions.h"
 #include "thread_tracker/thread_safety_validation.h"
 
+#include <algorithm>
+#include <condition_variable>
+
 namespace threadsafety {
 
+// Parking is only reached when the app hits a threading error and the callback asks to skip the call, so all objects share one
+// lock and condition variable.
+struct ObjectParkingLot {
+    std::mutex lock;
+    std::condition_variable cv;
+};
+
+static ObjectParkingLot &GetObjectParkingLot() {
+    static ObjectParkingLot parking_lot;
+    return parking_lot;
+}
+
+void ObjectUseData::ParkUntilIdle(bool is_writer) {
+    ObjectParkingLot &parking_lot = GetObjectParkingLot();
+    // Must be visible before checking the counts, so a Remove that the check misses is guaranteed to see the waiter
+    parked_waiters.fetch_add(1);
+    {
+        std::unique_lock<std::mutex> lock(parking_lot.lock);
+        parking_lot.cv.wait(lock, [&]() { return IsIdle(is_writer); });
+    }
+    parked_waiters.fetch_sub(1);
+}
+
+void ObjectUseData::WakeParkedWaiters() {
+    ObjectParkingLot &parking_lot = GetObjectParkingLot();
+    // Taking the lock orders the wake up with the check done by the waiter before it sleeps
+    std::lock_guard<std::mutex> lock(parking_lot.lock);
+    parking_lot.cv.notify_all();
+}
+
+ObjectUseData *ObjectUseDataPool::Allocate() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (free_list_.empty()) {
+        // Entries of objects destroyed while in use can be reused once the other threads are done with them
+        auto is_busy = [](const ObjectUseData *use_data) {
+            const ObjectUseData::WriteReadCount count = use_data->GetCount();
+            return count.GetReadCount() != 0 || count.GetWriteCount() != 0;
+        };
+        auto busy_end = std::partition(busy_free_list_.begin(), busy_free_list_.end(), is_busy);
+        free_list_.insert(free_list_.end(), busy_end, busy_free_list_.end());
+        busy_free_list_.erase(busy_end, busy_free_list_.end());
+    }
+    if (free_list_.empty()) {
+        blocks_.emplace_back(std::make_unique<ObjectUseData[]>(kBlockSize));
+        ObjectUseData *block = blocks_.back().get();
+        for (size_t i = kBlockSize; i > 0; --i) {
+            free_list_.push_back(&block[i - 1]);
+        }
+    }
+    ObjectUseData *use_data = free_list_.back();
+    free_list_.pop_back();
+    use_data->thread = std::thread::id();
+    return use_data;
+}
+
+void ObjectUseDataPool::Free(ObjectUseData *use_data) {
+    const ObjectUseData::WriteReadCount count = use_data->GetCount();
+    std::lock_guard<std::mutex> guard(lock_);
+    if (count.GetReadCount() != 0 || count.GetWriteCount() != 0) {
+        busy_free_list_.push_back(use_data);
+    } else {
+        free_list_.push_back(use_data);
+    }
+}
+
 ReadLockGuard Device::ReadLock() const { return ReadLockGuard(validation_object_mutex, std::defer_lock); }
 
 WriteLockGuard Device::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
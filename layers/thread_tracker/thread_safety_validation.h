@@ -19,10 +19,12 @@
 #pragma once
 
 #include <atomic>
-#include <chrono>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <vector>
 #include "chassis/validation_object.h"
 
 namespace threadsafety {
@@ -71,30 +73,75 @@ class alignas(kObjectUserDataAlignment) ObjectUseData {
         int64_t prev = writer_reader_count.fetch_add(1ULL);
         return WriteReadCount(prev);
     }
-    WriteReadCount RemoveWriter() {
-        int64_t prev = writer_reader_count.fetch_add(-(1LL << 32));
-        assert(prev > 0);
-        return WriteReadCount(prev);
-    }
-    WriteReadCount RemoveReader() {
-        int64_t prev = writer_reader_count.fetch_add(-1LL);
-        assert(prev > 0);
-        return WriteReadCount(prev);
+    // A Finish without a matching Start (the handle was destroyed and created again in between) would make the count negative,
+    // it is dropped instead. The returned count is then 0 for that use, so the caller can report it.
+    WriteReadCount RemoveWriter() { return Remove(1LL << 32); }
+    WriteReadCount RemoveReader() { return Remove(1LL); }
+    WriteReadCount GetCount() const { return WriteReadCount(writer_reader_count); }
+
+    // True once the only use left is the one of the calling thread
+    bool IsIdle(bool is_writer) const {
+        const WriteReadCount count = GetCount();
+        return count.GetReadCount() <= (int)(!is_writer) && count.GetWriteCount() <= (int)is_writer;
     }
-    WriteReadCount GetCount() { return WriteReadCount(writer_reader_count); }
 
     void WaitForObjectIdle(bool is_writer) {
         // Wait for thread-safe access to object instead of skipping call.
-        while (GetCount().GetReadCount() > (int)(!is_writer) || GetCount().GetWriteCount() > (int)is_writer) {
-            std::this_thread::sleep_for(std::chrono::microseconds(1));
+        // Most collisions are a single short call on the other thread, so spin a little before parking.
+        for (uint32_t i = 0; i < kIdleSpinCount; ++i) {
+            if (IsIdle(is_writer)) {
+                return;
+            }
+            std::this_thread::yield();
         }
+        ParkUntilIdle(is_writer);
     }
 
     std::atomic<std::thread::id> thread{};
 
   private:
+    static constexpr uint32_t kIdleSpinCount = 64;
+
+    WriteReadCount Remove(int64_t use) {
+        int64_t prev = writer_reader_count.load();
+        do {
+            const WriteReadCount prev_count(prev);
+            if ((use == 1 ? prev_count.GetReadCount() : prev_count.GetWriteCount()) == 0) {
+                return prev_count;
+            }
+        } while (!writer_reader_count.compare_exchange_weak(prev, prev - use));
+        if (parked_waiters.load() != 0) {
+            WakeParkedWaiters();
+        }
+        return WriteReadCount(prev);
+    }
+
+    void ParkUntilIdle(bool is_writer);
+    void WakeParkedWaiters();
+
     // Need to update write and read counts atomically. Writer in high 32 bits, reader in low 32 bits.
     std::atomic<int64_t> writer_reader_count{};
+    // Threads sleeping in ParkUntilIdle(), so the Remove functions only take the parking lock when someone waits
+    std::atomic<uint32_t> parked_waiters{};
+};
+
+// Keeps the ObjectUseData of a Counter, so the object table only stores a pointer and looking up an object does not have to copy
+// (and atomically reference count) a shared_ptr.
+// Destroyed entries are recycled instead of freed, but only once nothing uses them. If the app destroys an object while another
+// thread still uses it, which is reported as a threading error, the other thread keeps using the entry of the destroyed object
+// and never the entry of a new object.
+class ObjectUseDataPool {
+  public:
+    ObjectUseData *Allocate();
+    void Free(ObjectUseData *use_data);
+
+  private:
+    static constexpr size_t kBlockSize = 64;
+
+    std::mutex lock_;
+    std::vector<std::unique_ptr<ObjectUseData[]>> blocks_;
+    std::vector<ObjectUseData *> free_list_;
+    std::vector<ObjectUseData *> busy_free_list_;  // freed while still in use
 };
 
 template <typename T>
@@ -103,22 +150,31 @@ class Counter {
     VulkanObjectType object_type{};
     Logger *logger{};
 
-    vvl::concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    ObjectUseDataPool use_data_pool;
+    vvl::concurrent_unordered_map<T, ObjectUseData *, 6> object_table;
 
     void Init(VulkanObjectType type, Logger *val_obj) {
         object_type = type;
         logger = val_obj;
     }
 
-    void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
+    void CreateObject(T object) {
+        ObjectUseData *use_data = use_data_pool.Allocate();
+        if (!object_table.insert(object, use_data)) {
+            use_data_pool.Free(use_data);
+        }
+    }
 
     void DestroyObject(T object) {
         if (object) {
-            object_table.erase(object);
+            auto iter = object_table.pop(object);
+            if (iter != object_table.end()) {
+                use_data_pool.Free(iter->second);
+            }
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object, const Location& loc) {
+    ObjectUseData *FindObject(T object, const Location& loc) {
         assert(object_table.contains(object));
         auto iter = object_table.find(object);
         if (iter != object_table.end()) {
@@ -178,7 +234,9 @@ class Counter {
         if (!use_data) {
             return;
         }
-        use_data->RemoveWriter();
+        if (use_data->RemoveWriter().GetWriteCount() == 0) {
+            HandleFinishWithoutStart(object, loc);
+        }
     }
 
     void StartRead(T object, const Location& loc) {
@@ -213,7 +271,9 @@ class Counter {
         if (!use_data) {
             return;
         }
-        use_data->RemoveReader();
+        if (use_data->RemoveReader().GetReadCount() == 0) {
+            HandleFinishWithoutStart(object, loc);
+        }
     }
 
   private:
@@ -224,7 +284,7 @@ class Counter {
         return err_str.str();
     }
 
-    void HandleErrorOnWrite(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleErrorOnWrite(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         const std::string error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
         const bool skip = logger->LogError("UNASSIGNED-Threading-MultipleThreads-Write", object, loc, "%s", error_message.c_str());
@@ -239,7 +299,15 @@ class Counter {
         }
     }
 
-    void HandleErrorOnRead(const std::shared_ptr<ObjectUseData> &use_data, T object, const Location& loc) {
+    void HandleFinishWithoutStart(T object, const Location& loc) {
+        logger->LogError("UNASSIGNED-Threading-Info", object, loc,
+                         "THREADING ERROR : %s 0x%" PRIxLEAST64
+                         " was not in use when this call finished using it. It was likely destroyed, and the handle created again, "
+                         "while this call was running.",
+                         string_VulkanObjectType(object_type), (uint64_t)(object));
+    }
+
+    void HandleErrorOnRead(ObjectUseData *use_data, T object, const Location& loc) {
         const std::thread::id tid = std::this_thread::get_id();
         // There is a writer of the object.
         const auto error_message = GetErrorMessage(tid, use_data->thread.load(std::memory_order_relaxed));
@@ -19,7 +19,20 @@
 
 #include <sys/stat.h>
 #include <vulkan/vk_enum_string_helper.h>
+#include <cstdio>
+#include <fstream>
 
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "hash_util.h"
 #include "vk_layer_config.h"
 
 std::string GetTempFilePath() {
@@ -39,3 +52,268 @@ std::string GetTempFilePath() {
     if (!tmp_path.size()) tmp_path = "/tmp";
     return tmp_path;
 }
+
+bool WriteFileAtomically(const std::string &path, const void *data, size_t size) {
+#if defined(_WIN32)
+    const std::string temp_path = path + "." + std::to_string(GetCurrentProcessId()) + ".tmp";
+#else
+    const std::string temp_path = path + "." + std::to_string(getpid()) + ".tmp";
+#endif
+    {
+        std::ofstream temp_file(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!temp_file) {
+            return false;
+        }
+        temp_file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
+        temp_file.close();
+        if (!temp_file) {
+            std::remove(temp_path.c_str());
+            return false;
+        }
+    }
+#if defined(_WIN32)
+    const bool renamed = MoveFileExA(temp_path.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    const bool renamed = std::rename(temp_path.c_str(), path.c_str()) == 0;
+#endif
+    if (!renamed) {
+        std::remove(temp_path.c_str());
+    }
+    return renamed;
+}
+
+uint64_t GetLayerBuildId() {
+    std::string binary_path;
+#if defined(_WIN32)
+    HMODULE module = nullptr;
+    char module_path[MAX_PATH] = {};
+    if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                           reinterpret_cast<LPCSTR>(&GetLayerBuildId), &module) &&
+        GetModuleFileNameA(module, module_path, MAX_PATH) != 0) {
+        binary_path = module_path;
+    }
+#else
+    Dl_info info = {};
+    if (dladdr(reinterpret_cast<const void *>(&GetLayerBuildId), &info) != 0 && info.dli_fname) {
+        binary_path = info.dli_fname;
+    }
+#endif
+    struct stat file_info;
+    if (binary_path.empty() || stat(binary_path.c_str(), &file_info) != 0) {
+        return 0;
+    }
+    const uint64_t values[2] = {static_cast<uint64_t>(file_info.st_size), static_cast<uint64_t>(file_info.st_mtime)};
+    binary_path.append(reinterpret_cast<const char *>(values), sizeof(values));
+    return hash_util::Hash64(binary_path.data(), binary_path.size());
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::Map(const std::string &path) {
+    Unmap();
+    // FILE_SHARE_DELETE lets the file be renamed over while it is open
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    bool mapped = GetFileSizeEx(file, &file_size) != 0;
+    if (mapped && file_size.QuadPart != 0) {
+        // The view keeps its own reference, both handles can be closed right away
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        view_ = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (mapping) {
+            CloseHandle(mapping);
+        }
+        mapped = view_ != nullptr;
+        view_size_ = mapped ? static_cast<size_t>(file_size.QuadPart) : 0;
+    }
+    CloseHandle(file);
+    return mapped;
+}
+
+void MappedFile::Unmap() {
+    if (view_) {
+        UnmapViewOfFile(view_);
+        view_ = nullptr;
+        view_size_ = 0;
+    }
+}
+
+bool AppendOnlyFile::Open(const std::string &path) {
+    Close();
+    // FILE_APPEND_DATA without FILE_WRITE_DATA makes every write go to the current end of the file in one step (like O_APPEND),
+    // so the records of several processes sharing the file do not overwrite each other
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    file_ = file;
+    path_ = path;
+    return true;
+}
+
+void AppendOnlyFile::Close() {
+    Unmap();
+    if (file_) {
+        CloseHandle(file_);
+        file_ = nullptr;
+    }
+}
+
+bool AppendOnlyFile::IsOpen() const { return file_ != nullptr; }
+
+bool AppendOnlyFile::Map(const uint8_t *&out_data, size_t &out_size) {
+    Unmap();
+    out_data = nullptr;
+    out_size = 0;
+    LARGE_INTEGER file_size;
+    if (!file_ || !GetFileSizeEx(file_, &file_size)) {
+        return false;
+    }
+    if (file_size.QuadPart == 0) {
+        return true;  // can't map an empty file
+    }
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_) {
+        return false;
+    }
+    view_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+    if (!view_) {
+        Unmap();
+        return false;
+    }
+    view_size_ = static_cast<size_t>(file_size.QuadPart);
+    out_data = static_cast<const uint8_t *>(view_);
+    out_size = view_size_;
+    return true;
+}
+
+void AppendOnlyFile::Unmap() {
+    if (view_) {
+        UnmapViewOfFile(view_);
+        view_ = nullptr;
+        view_size_ = 0;
+    }
+    if (mapping_) {
+        CloseHandle(mapping_);
+        mapping_ = nullptr;
+    }
+}
+
+bool AppendOnlyFile::Truncate(size_t size) {
+    if (!file_) {
+        return false;
+    }
+    // The append handle can't move the end of the file, use a short lived write handle
+    HANDLE file = CreateFileA(path_.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(size);
+    const bool truncated = SetFilePointerEx(file, position, nullptr, FILE_BEGIN) && SetEndOfFile(file);
+    CloseHandle(file);
+    return truncated;
+}
+
+bool AppendOnlyFile::Append(const void *data, size_t size) {
+    DWORD written = 0;
+    return file_ && WriteFile(file_, data, static_cast<DWORD>(size), &written, nullptr) && written == size;
+}
+
+#else
+
+bool MappedFile::Map(const std::string &path) {
+    Unmap();
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    bool mapped = fstat(fd, &info) == 0;
+    if (mapped && info.st_size != 0) {
+        // The mapping keeps its own reference, the descriptor can be closed right away
+        void *view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        mapped = view != MAP_FAILED;
+        if (mapped) {
+            view_ = view;
+            view_size_ = static_cast<size_t>(info.st_size);
+        }
+    }
+    close(fd);
+    return mapped;
+}
+
+void MappedFile::Unmap() {
+    if (view_) {
+        munmap(view_, view_size_);
+        view_ = nullptr;
+        view_size_ = 0;
+    }
+}
+
+bool AppendOnlyFile::Open(const std::string &path) {
+    Close();
+    // O_APPEND keeps the records of several processes sharing the file from overwriting each other
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    return fd_ >= 0;
+}
+
+void AppendOnlyFile::Close() {
+    Unmap();
+    if (fd_ >= 0) {
+        close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool AppendOnlyFile::IsOpen() const { return fd_ >= 0; }
+
+bool AppendOnlyFile::Map(const uint8_t *&out_data, size_t &out_size) {
+    Unmap();
+    out_data = nullptr;
+    out_size = 0;
+    struct stat info;
+    if (fd_ < 0 || fstat(fd_, &info) != 0) {
+        return false;
+    }
+    if (info.st_size == 0) {
+        return true;  // can't map an empty file
+    }
+    void *view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    view_ = view;
+    view_size_ = static_cast<size_t>(info.st_size);
+    out_data = static_cast<const uint8_t *>(view_);
+    out_size = view_size_;
+    return true;
+}
+
+void AppendOnlyFile::Unmap() {
+    if (view_) {
+        munmap(view_, view_size_);
+        view_ = nullptr;
+        view_size_ = 0;
+    }
+}
+
+bool AppendOnlyFile::Truncate(size_t size) { return fd_ >= 0 && ftruncate(fd_, static_cast<off_t>(size)) == 0; }
+
+bool AppendOnlyFile::Append(const void *data, size_t size) {
+    if (fd_ < 0) {
+        return false;
+    }
+    ssize_t written;
+    do {
+        written = write(fd_, data, size);
+    } while (written < 0 && errno == EINTR);
+    return written == static_cast<ssize_t>(size);
+}
+
+#endif
@@ -18,6 +18,70 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
-std::string GetTempFilePath();
\ No newline at end of file
+std::string GetTempFilePath();
+
+// Writes the data to a temporary file next to path, then renames it over path. Readers (including other processes) see either
+// the old or the new content, never a partially written file.
+bool WriteFileAtomically(const std::string &path, const void *data, size_t size);
+
+// Identifies the layer binary from its path, size and modification time, so anything kept across runs can be dropped when the
+// layer is rebuilt or updated. Returns 0 if the binary cannot be found.
+uint64_t GetLayerBuildId();
+
+// Read-only memory mapping of a whole file. The file itself is not kept open, so it can be replaced (see WriteFileAtomically())
+// while the old content stays mapped.
+class MappedFile {
+  public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    ~MappedFile() { Unmap(); }
+
+    // Returns false if the file does not exist or can't be mapped. An empty file maps to nullptr with a size of 0
+    bool Map(const std::string &path);
+    void Unmap();
+
+    const uint8_t *Data() const { return static_cast<const uint8_t *>(view_); }
+    size_t Size() const { return view_size_; }
+
+  private:
+    void *view_ = nullptr;
+    size_t view_size_ = 0;
+};
+
+// File that is read once through a read-only memory mapping, then only written by appending to it.
+// Each Append() is a single write, so if the process dies the file ends with at most one partial record.
+class AppendOnlyFile {
+  public:
+    AppendOnlyFile() = default;
+    AppendOnlyFile(const AppendOnlyFile &) = delete;
+    AppendOnlyFile &operator=(const AppendOnlyFile &) = delete;
+    ~AppendOnlyFile() { Close(); }
+
+    // Creates the file if it does not exist
+    bool Open(const std::string &path);
+    void Close();
+    bool IsOpen() const;
+
+    // Maps the whole file, the mapping is valid until Unmap(). An empty file maps to nullptr with a size of 0
+    bool Map(const uint8_t *&out_data, size_t &out_size);
+    void Unmap();
+
+    bool Truncate(size_t size);
+    bool Append(const void *data, size_t size);
+
+  private:
+#if defined(_WIN32)
+    void *file_ = nullptr;
+    void *mapping_ = nullptr;
+    std::string path_;  // for Truncate(), the file is opened for appending only
+#else
+    int fd_ = -1;
+#endif
+    void *view_ = nullptr;
+    size_t view_size_ = 0;
+};
\ No newline at end of file
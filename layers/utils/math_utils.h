@@ -98,6 +98,29 @@ constexpr T Align(T x, T p2) {
 // Returns the 0-based index of the LSB. An input mask of 0 yields -1
 static inline int LeastSignificantBit(uint32_t mask) { return u_ffs(static_cast<int>(mask)) - 1; }
 
+// Same as LeastSignificantBit for 64-bit masks, a single bit scan instruction like C++20 std::countr_zero
+static inline int LeastSignificantBit64(uint64_t mask) {
+#if defined __GNUC__
+    return mask ? __builtin_ctzll(mask) : -1;
+#elif defined _MSC_VER && defined _WIN64
+    unsigned long bit_pos;
+    return _BitScanForward64(&bit_pos, mask) ? int(bit_pos) : -1;
+#elif defined _MSC_VER
+    unsigned long bit_pos;
+    if (_BitScanForward(&bit_pos, static_cast<unsigned long>(mask))) {
+        return int(bit_pos);
+    }
+    return _BitScanForward(&bit_pos, static_cast<unsigned long>(mask >> 32)) ? int(bit_pos) + 32 : -1;
+#else
+    for (int k = 0; k < 64; ++k) {
+        if (((mask >> k) & 1) != 0) {
+            return k;
+        }
+    }
+    return -1;
+#endif
+}
+
 template <typename FlagBits, typename Flags>
 FlagBits LeastSignificantFlag(Flags flags) {
     const int bit_shift = LeastSignificantBit(flags);
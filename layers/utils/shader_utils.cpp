@@ -53,28 +53,82 @@ void ValidationCache::GetUUID(uint8_t *uuid) {
     std::memcpy(uuid + (VK_UUID_SIZE - sizeof(uint32_t)), &spirv_val_option_hash_, sizeof(uint32_t));
 }
 
+static constexpr size_t kValidationCacheHeaderSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
+
 void ValidationCache::Load(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
-    const auto headerSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
-    auto size = headerSize;
-    if (!pCreateInfo->pInitialData || pCreateInfo->initialDataSize < size) return;
+    if (!pCreateInfo->pInitialData) return;
+    auto guard = WriteLock();
+    LoadData(pCreateInfo->pInitialData, pCreateInfo->initialDataSize);
+}
 
-    uint32_t const *data = (uint32_t const *)pCreateInfo->pInitialData;
-    if (data[0] != size) return;
-    if (data[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return;
+bool ValidationCache::LoadData(const void *data, size_t data_size) {
+    if (data_size < kValidationCacheHeaderSize) return false;
+
+    uint32_t header[2];
+    std::memcpy(header, data, sizeof(header));
+    if (header[0] != kValidationCacheHeaderSize) return false;
+    if (header[1] != VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT) return false;
     uint8_t expected_uuid[VK_UUID_SIZE];
     GetUUID(expected_uuid);
-    if (memcmp(&data[2], expected_uuid, VK_UUID_SIZE) != 0) return;  // different version
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    if (memcmp(bytes + sizeof(header), expected_uuid, VK_UUID_SIZE) != 0) return false;  // different version
 
-    data = (uint32_t const *)(reinterpret_cast<uint8_t const *>(data) + headerSize);
+    const size_t hash_count = (data_size - kValidationCacheHeaderSize) / sizeof(uint32_t);
+    bytes += kValidationCacheHeaderSize;
 
+    good_shader_hashes_.reserve(good_shader_hashes_.size() + hash_count);
+    for (size_t i = 0; i < hash_count; ++i, bytes += sizeof(uint32_t)) {
+        uint32_t hash;
+        std::memcpy(&hash, bytes, sizeof(hash));
+        good_shader_hashes_.insert(hash);
+    }
+    return true;
+}
+
+bool ValidationCache::AttachFile(const std::string &path) {
     auto guard = WriteLock();
-    for (; size < pCreateInfo->initialDataSize; data++, size += sizeof(uint32_t)) {
-        good_shader_hashes_.insert(*data);
+    if (!file_.Open(path)) {
+        return false;
+    }
+
+    const uint8_t *data = nullptr;
+    size_t data_size = 0;
+    if (!file_.Map(data, data_size)) {
+        file_.Close();
+        return false;
+    }
+    const bool loaded = LoadData(data, data_size);
+    file_.Unmap();
+
+    if (!loaded) {
+        // Missing, corrupt or from another spirv-val version/configuration, start over with only our header
+        uint32_t header[2 + VK_UUID_SIZE / sizeof(uint32_t)];
+        header[0] = static_cast<uint32_t>(kValidationCacheHeaderSize);
+        header[1] = VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT;
+        GetUUID(reinterpret_cast<uint8_t *>(&header[2]));
+        if (!file_.Truncate(0) || !file_.Append(header, sizeof(header))) {
+            file_.Close();
+            return false;
+        }
+    } else if (data_size % sizeof(uint32_t) != 0) {
+        // Partial hash from a process that died while appending
+        if (!file_.Truncate(data_size - data_size % sizeof(uint32_t))) {
+            file_.Close();
+            return false;
+        }
+    }
+    return true;
+}
+
+void ValidationCache::InsertLocked(uint32_t hash) {
+    if (good_shader_hashes_.insert(hash).second && file_.IsOpen()) {
+        // Losing a hash only costs validating that shader again next run
+        file_.Append(&hash, sizeof(hash));
     }
 }
 
 void ValidationCache::Write(size_t *pDataSize, void *pData) {
-    const auto header_size = 2 * sizeof(uint32_t) + VK_UUID_SIZE;  // 4 bytes for header size + 4 bytes for version number + UUID
+    const auto header_size = kValidationCacheHeaderSize;  // 4 bytes for header size + 4 bytes for version number + UUID
     if (!pData) {
         *pDataSize = header_size + good_shader_hashes_.size() * sizeof(uint32_t);
         return;
@@ -113,7 +167,7 @@ void ValidationCache::Merge(ValidationCache const *other) {
     auto other_guard = other->ReadLock();
     auto guard = WriteLock();
     good_shader_hashes_.reserve(good_shader_hashes_.size() + other->good_shader_hashes_.size());
-    for (auto h : other->good_shader_hashes_) good_shader_hashes_.insert(h);
+    for (auto h : other->good_shader_hashes_) InsertLocked(h);
 }
 
 spv_target_env PickSpirvEnv(const APIVersion &api_version, bool spirv_1_4) {
@@ -223,6 +277,30 @@ void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const Dev
     out_command = ss.str();
 }
 
+void GetShaderModuleCacheUUID(const APIVersion &api_version, const VkDeviceCreateInfo &create_info,
+                              const DeviceFeatures &enabled_features, const VkPhysicalDeviceProperties &phys_dev_props,
+                              uint32_t spirv_val_option_hash, uint8_t *uuid) {
+    // First half is the build, a new SPIRV-Tools or Vulkan-Headers means a new layer with possibly different checks
+    std::string build_id = SPIRV_TOOLS_COMMIT_ID;
+    build_id += std::to_string(VK_HEADER_VERSION_COMPLETE);
+    const uint64_t build_hash = hash_util::Hash64(build_id.data(), build_id.size());
+
+    // Second half is the device, the checks depend on the enabled features/extensions and the driver limits
+    std::string device_id(reinterpret_cast<const char *>(&enabled_features), sizeof(DeviceFeatures));
+    for (uint32_t i = 0; i < create_info.enabledExtensionCount; ++i) {
+        device_id += create_info.ppEnabledExtensionNames[i];
+        device_id += ',';
+    }
+    const uint32_t device_values[] = {api_version.Value(), phys_dev_props.driverVersion, phys_dev_props.vendorID,
+                                      phys_dev_props.deviceID, spirv_val_option_hash};
+    device_id.append(reinterpret_cast<const char *>(device_values), sizeof(device_values));
+    const uint64_t device_hash = hash_util::Hash64(device_id.data(), device_id.size());
+
+    static_assert(VK_UUID_SIZE == 2 * sizeof(uint64_t));
+    std::memcpy(uuid, &build_hash, sizeof(uint64_t));
+    std::memcpy(uuid + sizeof(uint64_t), &device_hash, sizeof(uint64_t));
+}
+
 // This is used to help dump SPIR-V while debugging intermediate phases of any altercations to the SPIR-V
 void DumpSpirvToFile(const std::string &file_path, const uint32_t *spirv, size_t spirv_dwords_count) {
     std::ofstream debug_file(file_path, std::ios::out | std::ios::binary);
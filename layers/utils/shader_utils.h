@@ -22,6 +22,7 @@
 
 #include <vulkan/vulkan_core.h>
 #include "containers/custom_containers.h"
+#include "utils/file_system_utils.h"
 #include "utils/lock_utils.h"
 
 #include <spirv-tools/libspirv.hpp>
@@ -81,6 +82,11 @@ class ValidationCache {
     void Write(size_t *pDataSize, void *pData);
     void Merge(ValidationCache const *other);
 
+    // Backs the cache with a file in the same layout as the VK_EXT_validation_cache data. The file is memory mapped to load it,
+    // and from then on every new hash is appended to it as it is inserted, so there is nothing left to write when the cache is
+    // destroyed and the hashes found before a crash are kept. A file with another header is started over.
+    bool AttachFile(const std::string &path);
+
     bool Contains(uint32_t hash) {
         auto guard = ReadLock();
         return good_shader_hashes_.count(hash) != 0;
@@ -88,7 +94,7 @@ class ValidationCache {
 
     void Insert(uint32_t hash) {
         auto guard = WriteLock();
-        good_shader_hashes_.insert(hash);
+        InsertLocked(hash);
     }
 
   private:
@@ -97,6 +103,9 @@ class ValidationCache {
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
     void GetUUID(uint8_t *uuid);
+    // Returns false if the header does not match, trailing bytes not making a full hash are ignored. Must hold lock_
+    bool LoadData(const void *data, size_t data_size);
+    void InsertLocked(uint32_t hash);
 
     // Can hit cases where error appear/disappear if spirv-val settings are adjusted
     // see https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/8031
@@ -107,6 +116,7 @@ class ValidationCache {
     // wrong with them; also, we expect they will get fixed, so we're less
     // likely to see them again.
     vvl::unordered_set<uint32_t> good_shader_hashes_;
+    AppendOnlyFile file_;  // guarded by lock_, only open after AttachFile()
     mutable std::shared_mutex lock_;
 };
 
@@ -116,4 +126,9 @@ void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const Dev
                             spv_target_env spirv_environment, spvtools::ValidatorOptions &out_options, uint32_t *out_hash,
                             std::string &out_command);
 
+// Identifies everything the vkCreateShaderModule time checks depend on, used to invalidate the spirv::ModuleCache file
+void GetShaderModuleCacheUUID(const APIVersion &api_version, const VkDeviceCreateInfo &create_info,
+                              const DeviceFeatures &enabled_features, const VkPhysicalDeviceProperties &phys_dev_props,
+                              uint32_t spirv_val_option_hash, uint8_t *uuid);
+
 void DumpSpirvToFile(const std::string &file_name, const uint32_t *spirv, size_t spirv_dwords_count);
@@ -0,0 +1,113 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+
+namespace vvl {
+
+ThreadPool::ThreadPool(uint32_t thread_count) {
+    if (thread_count == 0) {
+        // Leave one core to the application thread that submits the work
+        const uint32_t hw_threads = std::thread::hardware_concurrency();
+        thread_count = std::max(hw_threads, 2u) - 1;
+    }
+    threads_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; i++) {
+        threads_.emplace_back(&ThreadPool::WorkerFunc, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        exit_ = true;
+    }
+    cv_.notify_all();
+    for (std::thread &thread : threads_) {
+        thread.join();
+    }
+}
+
+void ThreadPool::Submit(std::function<void()> &&task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.emplace_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+bool ThreadPool::RunPendingTask() {
+    std::function<void()> task;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return false;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+    }
+    task();
+    return true;
+}
+
+void ThreadPool::WorkerFunc() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return exit_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;  // exit_ is set and all work is done
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+void TaskGroup::Run(std::function<void()> &&task) {
+    if (!pool_ || pool_->ThreadCount() == 0) {
+        task();
+        return;
+    }
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_->Submit([this, task = std::move(task)]() {
+        task();
+        // The decrement is done under the lock so the waiter can't return (and destroy the group)
+        // while this thread still touches the group's members.
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            cv_.notify_all();
+        }
+    });
+}
+
+void TaskGroup::Wait() {
+    if (!pool_) {
+        return;  // tasks were executed inline
+    }
+    // Help with queued work instead of blocking, the queued task might be one of ours
+    while (pending_.load(std::memory_order_acquire) != 0 && pool_->RunPendingTask()) {
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return pending_.load(std::memory_order_acquire) == 0; });
+}
+
+}  // namespace vvl
@@ -0,0 +1,82 @@
+/* Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Fixed size pool of worker threads executing tasks in FIFO order.
+// The pool does not expose futures, use TaskGroup to wait for a set of tasks.
+class ThreadPool {
+  public:
+    // thread_count == 0 selects a count based on std::thread::hardware_concurrency()
+    explicit ThreadPool(uint32_t thread_count = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    uint32_t ThreadCount() const { return static_cast<uint32_t>(threads_.size()); }
+
+    void Submit(std::function<void()> &&task);
+
+    // Pops and executes a single queued task on the calling thread.
+    // Returns false if the queue was empty.
+    bool RunPendingTask();
+
+  private:
+    void WorkerFunc();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+    bool exit_ = false;
+};
+
+// Set of tasks that can be waited on as a whole.
+// If the pool is null the tasks are executed inline by Run().
+// While waiting, the calling thread helps to drain the pool queue. This makes it safe
+// to wait on a TaskGroup from inside another pool task without deadlocking the pool.
+class TaskGroup {
+  public:
+    explicit TaskGroup(ThreadPool *pool) : pool_(pool) {}
+    ~TaskGroup() { Wait(); }
+
+    TaskGroup(const TaskGroup &) = delete;
+    TaskGroup &operator=(const TaskGroup &) = delete;
+
+    void Run(std::function<void()> &&task);
+    void Wait();
+
+  private:
+    ThreadPool *pool_;
+    std::atomic<uint32_t> pending_{0};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+}  // namespace vvl
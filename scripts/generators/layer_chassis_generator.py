@@ -226,6 +226,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include <array>
             #include <cstring>
 
+            #include "chassis/device_hook.h"
             #include "chassis/dispatch_object.h"
             #include "chassis/validation_object.h"
             #include "generated/dispatch_vector.h"
@@ -322,6 +323,15 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             out.append(f'ErrorObject error_obj(vvl::Func::{command.name}, VulkanTypedHandle({command.params[0].name}, kVulkanObjectType{command.params[0].type[2:]}));\n')
 
+            # vkCmd* calls only modify the (externally synchronized) command buffer, validation objects can choose
+            # a cheaper lock for them
+            read_lock = 'CommandBufferReadLock' if command.name.startswith('vkCmd') else 'ReadLock'
+            write_lock = 'CommandBufferWriteLock' if command.name.startswith('vkCmd') else 'WriteLock'
+
+            # Device objects are always one of the concrete classes in chassis/device_hook.h, so their locks and hooks go
+            # through VVL_DEVICE_HOOK to skip the virtual call. Instance objects keep the virtual call.
+            hook = 'vo->{}' if command.instance else 'VVL_DEVICE_HOOK(vo, {})'
+
             # Generate pre-call validation source code
             out.append(f'{{\nVVL_ZoneScopedN("PreCallValidate_{command.name}");')
             if not command.instance:
@@ -330,7 +340,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                 if (!vo) {{
                                     continue;
                                 }}
-                                auto lock = vo->ReadLock();
+                                auto lock = {hook.format(read_lock)}();
                             ''')
             else:
                 out.append(f'''
@@ -340,7 +350,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                 }}
                             ''')
 
-            out.append(f'skip |= vo->PreCallValidate{command.name[2:]}({paramsList}, error_obj);\n')
+            validate_hook = hook.format(f'PreCallValidate{command.name[2:]}')
+            out.append(f'skip |= {validate_hook}({paramsList}, error_obj);\n')
             out.append(f'if (skip) {return_map[command.returnType]}\n')
             out.append('   }\n')
             out.append('}\n')
@@ -359,7 +370,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                 if (!vo) {{
                                     continue;
                                 }}
-                                auto lock = vo->WriteLock();
+                                auto lock = {hook.format(write_lock)}();
                             ''')
             else:
                 out.append(f'''
@@ -369,7 +380,8 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                 }}
                             ''')
 
-            out.append(f'vo->PreCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
+            pre_record_hook = hook.format(f'PreCallRecord{command.name[2:]}')
+            out.append(f'{pre_record_hook}({paramsList}, record_obj);\n')
             out.append('   }\n')
             if "QueueSubmit" in command.name:
                 out.append('''
@@ -470,11 +482,12 @@ class LayerChassisOutputGenerator(BaseGenerator):
             ]
             if not command.instance:
                 if command.name not in commands_with_blocking_operations:
-                    out.append('auto lock = vo->WriteLock();\n')
+                    out.append(f'auto lock = {hook.format(write_lock)}();\n')
                 else:
                     out.append('vvl::base::Device::BlockingOperationGuard lock(vo);\n')
 
-            out.append(f'vo->PostCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
+            post_record_hook = hook.format(f'PostCallRecord{command.name[2:]}')
+            out.append(f'{post_record_hook}({paramsList}, record_obj);\n')
             out.append('    }\n')
             if "QueueSubmit" in command.name:
                 out.append('''
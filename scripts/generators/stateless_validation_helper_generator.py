@@ -701,19 +701,19 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                             countRequiredVuid = '"VUID-VkShaderModuleCreateInfo-codeSize-01085"' # exception due to unique lenValue
 
                         # TODO - some length have unhandled symbols
-                        count_loc = f'{errorLoc}.dot(Field::{member.length})'
+                        count_loc = f'{errorLoc}.lazy_dot(Field::{member.length})'
                         if '->' in member.length:
-                            count_loc = f'{errorLoc}.dot(Field::{member.length.split("->")[0]}).dot(Field::{member.length.split("->")[1]})'
+                            count_loc = f'{errorLoc}.dot(Field::{member.length.split("->")[0]}).lazy_dot(Field::{member.length.split("->")[1]})'
                         elif ' + ' in member.length:
                             # hardcoded only instance for now
                             if 'samples' in member.length: # "(samples + 31) / 32"
-                                count_loc = f'{errorLoc}.dot(Field::samples)'
+                                count_loc = f'{errorLoc}.lazy_dot(Field::samples)'
                             elif 'rasterizationSamples' in member.length: # "(rasterizationSamples + 31) / 32"
-                                count_loc = f'{errorLoc}.dot(Field::rasterizationSamples)'
+                                count_loc = f'{errorLoc}.lazy_dot(Field::rasterizationSamples)'
                                 member.length = 'rasterizationSamples'
                         elif ' / ' in member.length:
-                            count_loc = f'{errorLoc}.dot(Field::{member.length.split(" / ")[0]})'
-                        checkExpr.append(f'skip |= {context}ValidateArray({count_loc}, {errorLoc}.dot(Field::{member.name}), {valuePrefix}{member.length}, &{valuePrefix}{member.name}, {counValueRequired}, {arrayRequired}, {countRequiredVuid}, {arrayRequiredVuid});\n')
+                            count_loc = f'{errorLoc}.lazy_dot(Field::{member.length.split(" / ")[0]})'
+                        checkExpr.append(f'skip |= {context}ValidateArray({count_loc}, {errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{member.length}, &{valuePrefix}{member.name}, {counValueRequired}, {arrayRequired}, {countRequiredVuid}, {arrayRequiredVuid});\n')
             if checkExpr and lengthMember and length_deref and member.length.count('->'):
                 # Add checks to ensure the validation call does not dereference a NULL pointer to obtain the count
                 count = member.length.count('->')
@@ -734,9 +734,9 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
             # Function pointers need a reinterpret_cast to void*
             ptrRequiredVuid = self.GetVuid(callerName, f"{member.name}-parameter")
             if member.type.startswith('PFN_'):
-                checkExpr.append(f'skip |= {context}ValidateRequiredPointer({errorLoc}.dot(Field::{member.name}), reinterpret_cast<const void*>({valuePrefix}{member.name}), {ptrRequiredVuid});\n')
+                checkExpr.append(f'skip |= {context}ValidateRequiredPointer({errorLoc}.lazy_dot(Field::{member.name}), reinterpret_cast<const void*>({valuePrefix}{member.name}), {ptrRequiredVuid});\n')
             else:
-                checkExpr.append(f'skip |= {context}ValidateRequiredPointer({errorLoc}.dot(Field::{member.name}), {valuePrefix}{member.name}, {ptrRequiredVuid});\n')
+                checkExpr.append(f'skip |= {context}ValidateRequiredPointer({errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{member.name}, {ptrRequiredVuid});\n')
         return checkExpr
 
     # Process struct member validation code, performing name substitution if required
@@ -889,7 +889,7 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                     # Log a diagnostic message when validation cannot be automatically generated and must be implemented manually
                     self.logMsg('diag', f'ParameterValidation: No validation for {callerName} {member.name}')
                 elif countRequiredVuid:
-                    usedLines.append(f'skip |= {context}ValidateArray({errorLoc}.dot(Field::{member.length}), loc, {valuePrefix}{member.length}, &{valuePrefix}{member.name}, true, false, {countRequiredVuid}, kVUIDUndefined);\n')
+                    usedLines.append(f'skip |= {context}ValidateArray({errorLoc}.lazy_dot(Field::{member.length}), loc, {valuePrefix}{member.length}, &{valuePrefix}{member.name}, true, false, {countRequiredVuid}, kVUIDUndefined);\n')
                 else:
                     if member.type in self.vk.structs and self.vk.structs[member.type].sType:
                         # If this is a pointer to a struct with an sType field, verify the type
@@ -903,18 +903,18 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                                 paramVuid = 'kVUIDUndefined'
                             # This is an array of struct pointers
                             if member.cDeclaration.count('*') == 2:
-                                usedLines.append(f'skip |= {context}ValidateStructPointerTypeArray({errorLoc}.dot(Field::{lengthMember.name}), {errorLoc}.dot(Field::{member.name}), {valuePrefix}{lengthMember.name}, {valuePrefix}{member.name}, {struct.sType}, {counValueRequired}, {arrayRequired}, {sTypeVuid}, {paramVuid}, {countRequiredVuid});\n')
+                                usedLines.append(f'skip |= {context}ValidateStructPointerTypeArray({errorLoc}.lazy_dot(Field::{lengthMember.name}), {errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{lengthMember.name}, {valuePrefix}{member.name}, {struct.sType}, {counValueRequired}, {arrayRequired}, {sTypeVuid}, {paramVuid}, {countRequiredVuid});\n')
                             # This is an array with a pointer to a count value
                             elif lengthMember.pointer:
                                 # When the length parameter is a pointer, there is an extra Boolean parameter in the function call to indicate if it is required
                                 countPtrRequiredVuid = self.GetVuid(callerName, f"{member.length}-parameter")
-                                usedLines.append(f'skip |= {context}ValidateStructTypeArray({errorLoc}.dot(Field::{member.length}), {errorLoc}.dot(Field::{member.name}), {valuePrefix}{member.length}, {valuePrefix}{member.name}, {struct.sType}, {counPtrRequired}, {counValueRequired}, {arrayRequired}, {sTypeVuid}, {paramVuid}, {countPtrRequiredVuid}, {countRequiredVuid});\n')
+                                usedLines.append(f'skip |= {context}ValidateStructTypeArray({errorLoc}.lazy_dot(Field::{member.length}), {errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{member.length}, {valuePrefix}{member.name}, {struct.sType}, {counPtrRequired}, {counValueRequired}, {arrayRequired}, {sTypeVuid}, {paramVuid}, {countPtrRequiredVuid}, {countRequiredVuid});\n')
                             # This is an array with an integer count value
                             else:
-                                usedLines.append(f'skip |= {context}ValidateStructTypeArray({errorLoc}.dot(Field::{member.length}), {errorLoc}.dot(Field::{member.name}), {valuePrefix}{member.length}, {valuePrefix}{member.name}, {struct.sType}, {counValueRequired}, {arrayRequired}, {sTypeVuid}, {paramVuid}, {countRequiredVuid});\n')
+                                usedLines.append(f'skip |= {context}ValidateStructTypeArray({errorLoc}.lazy_dot(Field::{member.length}), {errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{member.length}, {valuePrefix}{member.name}, {struct.sType}, {counValueRequired}, {arrayRequired}, {sTypeVuid}, {paramVuid}, {countRequiredVuid});\n')
                         # This is an individual struct
                         else:
-                            usedLines.append(f'skip |= {context}ValidateStructType({errorLoc}.dot(Field::{member.name}), {valuePrefix}{member.name}, {struct.sType}, {arrayRequired}, {paramVuid}, {sTypeVuid});\n')
+                            usedLines.append(f'skip |= {context}ValidateStructType({errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{member.name}, {struct.sType}, {arrayRequired}, {paramVuid}, {sTypeVuid});\n')
                     # If this is an input handle array that is not allowed to contain NULL handles, verify that none of the handles are VK_NULL_HANDLE
                     elif member.type in self.vk.handles and member.const and not self.isHandleOptional(member, lengthMember):
                         if not lengthMember:
@@ -925,7 +925,7 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                             raise Exception('Unsupported parameter validation case: Output handle array elements are not NULL checked')
                         countRequiredVuid = self.GetVuid(callerName, f"{member.length}-arraylength")
                         # This is an array with an integer count value
-                        usedLines.append(f'skip |= {context}ValidateHandleArray({errorLoc}.dot(Field::{member.length}), {errorLoc}.dot(Field::{member.name}), {valuePrefix}{member.length}, {valuePrefix}{member.name}, {counValueRequired}, {arrayRequired}, {countRequiredVuid});\n')
+                        usedLines.append(f'skip |= {context}ValidateHandleArray({errorLoc}.lazy_dot(Field::{member.length}), {errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{member.length}, {valuePrefix}{member.name}, {counValueRequired}, {arrayRequired}, {countRequiredVuid});\n')
                     elif member.type in self.vk.flags and member.const:
                         # Generate check string for an array of VkFlags values
                         if self.isFlagReserved(member.type):
@@ -1023,7 +1023,7 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                     if member.type in self.vk.structs and self.vk.structs[member.type].sType:
                         sTypeVuid = self.GetVuid(member.type, "sType-sType")
                         sType = self.vk.structs[member.type].sType
-                        usedLines.append(f'skip |= {context}ValidateStructType({errorLoc}.dot(Field::{member.name}), &({valuePrefix}{member.name}), {sType}, false, kVUIDUndefined, {sTypeVuid});\n')
+                        usedLines.append(f'skip |= {context}ValidateStructType({errorLoc}.lazy_dot(Field::{member.name}), &({valuePrefix}{member.name}), {sType}, false, kVUIDUndefined, {sTypeVuid});\n')
                     elif member.name == 'sType' and structTypeName in self.generateStructHelper:
                         # TODO - This workaround is because this is shared by other pipeline calls that don't need generateStructHelper
                         if structTypeName != 'VkPipelineShaderStageCreateInfo':
@@ -1032,10 +1032,10 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                             usedLines.append(f'skip |= {context}ValidateStructType(loc, &info, {struct.sType}, false, kVUIDUndefined, {sTypeVuid});\n')
                     elif member.type in self.vk.handles:
                         if not member.optional:
-                            usedLines.append(f'skip |= {context}ValidateRequiredHandle({errorLoc}.dot(Field::{member.name}), {valuePrefix}{member.name});\n')
+                            usedLines.append(f'skip |= {context}ValidateRequiredHandle({errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{member.name});\n')
                     elif member.type in self.vk.flags and self.isFlagReserved(member.type):
                         vuid = self.GetVuid(callerName, f"{member.name}-zerobitmask")
-                        usedLines.append(f'skip |= {context}ValidateReservedFlags({errorLoc}.dot(Field::{member.name}), {valuePrefix}{member.name}, {vuid});\n')
+                        usedLines.append(f'skip |= {context}ValidateReservedFlags({errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{member.name}, {vuid});\n')
                     elif member.type in self.vk.flags or member.type in self.vk.bitmasks:
                         if member.type in self.vk.flags:
                             flagBitsName = self.vk.flags[member.type].bitmaskName
@@ -1059,15 +1059,15 @@ class StatelessValidationHelperOutputGenerator(BaseGenerator):
                         else:
                             if self.vk.commands[funcName].instance:
                                 isInstanceFunction = 'true'
-                        usedLines.append(f'skip |= {context}ValidateFlags({errorLoc}.dot(Field::{member.name}), vvl::FlagBitmask::{flagBitsName}, {allFlagsName}, {valuePrefix}{member.name}, {flagsType}, {invalidVuid}{zeroVuidArg}, {isInstanceFunction});\n')
+                        usedLines.append(f'skip |= {context}ValidateFlags({errorLoc}.lazy_dot(Field::{member.name}), vvl::FlagBitmask::{flagBitsName}, {allFlagsName}, {valuePrefix}{member.name}, {flagsType}, {invalidVuid}{zeroVuidArg}, {isInstanceFunction});\n')
                     elif member.type == 'VkBool32':
-                        usedLines.append(f'skip |= {context}ValidateBool32({errorLoc}.dot(Field::{member.name}), {valuePrefix}{member.name});\n')
+                        usedLines.append(f'skip |= {context}ValidateBool32({errorLoc}.lazy_dot(Field::{member.name}), {valuePrefix}{member.name});\n')
                     elif member.type == 'VkDeviceAddress' and not member.optional:
                         vuid = self.GetVuid(callerName, f"{member.name}-parameter")
-                        usedLines.append(f'skip |= {context}ValidateNotZero({valuePrefix}{member.name} == 0, {vuid}, {errorLoc}.dot(Field::{member.name}));\n')
+                        usedLines.append(f'skip |= {context}ValidateNotZero({valuePrefix}{member.name} == 0, {vuid}, {errorLoc}.lazy_dot(Field::{member.name}));\n')
                     elif member.type in self.vk.enums and member.type != 'VkStructureType':
                         vuid = self.GetVuid(callerName, f"{member.name}-parameter")
-                        usedLines.append(f'skip |= {context}ValidateRangedEnum({errorLoc}.dot(Field::{member.name}), vvl::Enum::{member.type}, {valuePrefix}{member.name}, {vuid});\n')
+                        usedLines.append(f'skip |= {context}ValidateRangedEnum({errorLoc}.lazy_dot(Field::{member.name}), vvl::Enum::{member.type}, {valuePrefix}{member.name}, {vuid});\n')
                     # If this is a struct, see if it contains members that need to be checked
                     if member.type in self.validatedStructs:
                         memberNamePrefix = f'{valuePrefix}{member.name}.'
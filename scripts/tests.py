@@ -204,6 +204,11 @@ def RunVVLTests(args):
         # (https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/8931)
         common_ci.RunShellCmd(lvt_cmd + " --gtest_filter=*SyncVal.*:*Threading.*:*SyncObject.*:-*Video*", env=lvt_env)
         return
+    if args.syncval:
+        # Sync validation and its containers, for builds that only change how the sync state is stored
+        common_ci.RunShellCmd(lvt_cmd + " --gtest_filter=*SyncVal*:*SyncObject.*:CustomContainer.*:-*Video*", env=lvt_env)
+        common_ci.RunShellCmd(lvt_cmd + ' --gtest_filter=*SyncVal* --syncval-disable-core', env=lvt_env)
+        return
     if args.wsi:
         # We need to use xvfb to get github action runners to be able to create a surface context
         # Adding to other tests is a slow, unnecessary, overheader
@@ -268,6 +273,9 @@ if __name__ == '__main__':
     parser.add_argument(
         '--tsan', dest='tsan',
         action='store_true', help='Filter out tests for TSAN')
+    parser.add_argument(
+        '--syncval', dest='syncval',
+        action='store_true', help='Filter out tests for sync validation')
     parser.add_argument(
         '--wsi', dest='wsi',
         action='store_true', help='Filter out tests for WSI (which uses xvfb and will slow down other tests)')
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include "test_common.h"
+
+// Helpers of the DISABLED_*Benchmark tests.
+//
+// Benchmarks only measure, they are disabled so they do not slow down the regular runs. Run them with
+//   --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+// Each measurement is printed and also recorded as a property of the test, so it is part of the --gtest_output report.
+namespace benchmark {
+
+// Returns the wall clock time of func in milliseconds
+template <typename Func>
+double TimeMs(Func &&func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// The name is used as the property key, keep it to letters, digits, '.' and '_' (ex. "random_ops.btree_ms")
+inline void Report(const char *name, double value) {
+    char text[32];
+    snprintf(text, sizeof(text), "%.3f", value);
+    printf("[ BENCHMARK] %-48s %12s\n", name, text);
+    fflush(stdout);
+    ::testing::Test::RecordProperty(name, text);
+}
+
+}  // namespace benchmark
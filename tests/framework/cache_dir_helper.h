@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "vk_layer_config.h"
+
+// Points XDG_CACHE_HOME, where the layer puts the files it keeps across runs, at an empty private directory while alive.
+// Tests can then look at the files written by one device, change them, and see what the next device makes of them, without
+// touching the user cache directory.
+class CacheDirHelper {
+  public:
+    explicit CacheDirHelper(const char *name)
+        : previous_cache_home_(GetEnvironment("XDG_CACHE_HOME")), dir_(std::filesystem::temp_directory_path() / name) {
+        std::filesystem::remove_all(dir_);
+        std::filesystem::create_directories(dir_);
+        SetEnvironment("XDG_CACHE_HOME", dir_.string().c_str());
+    }
+    ~CacheDirHelper() {
+        SetEnvironment("XDG_CACHE_HOME", previous_cache_home_.c_str());
+        std::error_code ec;
+        std::filesystem::remove_all(dir_, ec);
+    }
+
+    // The file the layer wrote with a name starting with prefix, empty if there is none
+    std::filesystem::path Find(const char *prefix) const {
+        for (const auto &entry : std::filesystem::directory_iterator(dir_)) {
+            if (entry.path().filename().string().rfind(prefix, 0) == 0) {
+                return entry.path();
+            }
+        }
+        return {};
+    }
+
+    static std::vector<uint8_t> Read(const std::filesystem::path &path) {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        return std::vector<uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+    static void Write(const std::filesystem::path &path, const std::vector<uint8_t> &bytes) {
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    }
+
+  private:
+    const std::string previous_cache_home_;
+    const std::filesystem::path dir_;
+};
@@ -36,7 +36,7 @@ class VkSyncValTest : public VkLayerTest {
   public:
     void InitSyncValFramework(const SyncValSettings *p_sync_settings = nullptr);
     void InitSyncVal(const SyncValSettings *p_sync_settings = nullptr);
-    void InitTimelineSemaphore();
+    void InitTimelineSemaphore(const SyncValSettings *p_sync_settings = nullptr);
     void InitRayTracing();
 
     vkt::Buffer GetSerializationDeserializationBuffer(const vkt::as::AccelerationStructureKHR &as);
@@ -13,7 +13,15 @@
  */
 
 #include <vulkan/vulkan_core.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
 #include "../framework/layer_validation_tests.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/descriptor_helper.h"
+#include "../framework/thread_helper.h"
+#include "../framework/benchmark.h"
 
 class StressCore : public VkLayerTest {};
 
@@ -254,3 +262,458 @@ TEST_F(StressCore, BufferCopiesSparseBuffer2) {
     // Wait for operations to finish before destroying anything
     m_default_queue->Wait();
 }
+
+// Every worker binds and updates the same buffers, so all threads look up the same state objects
+struct ParallelRecordingWorkload {
+    static constexpr uint32_t buffer_count = 16;
+    static constexpr uint32_t commands_per_frame = 3000;
+
+    explicit ParallelRecordingWorkload(VkLayerTest &test)
+        : device(*test.DeviceObj()), index_buffer(device, 1024, VK_BUFFER_USAGE_INDEX_BUFFER_BIT), offsets(buffer_count, 0) {
+        for (uint32_t i = 0; i < buffer_count; ++i) {
+            vertex_buffers.emplace_back(device, 1024, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+            vertex_buffer_handles.push_back(vertex_buffers.back());
+        }
+    }
+
+    // Returns false if the workers did not finish in time
+    bool Run(int worker_count, int frame_count) {
+        ThreadTimeoutHelper timeout_helper(worker_count);
+        auto worker_thread = [&]() {
+            auto timeout_guard = timeout_helper.ThreadGuard();
+            vkt::CommandPool pool(device, device.graphics_queue_node_index_);
+            vkt::CommandBuffer cb(device, pool);
+            const uint32_t data = 0;
+
+            for (int frame = 0; frame < frame_count; ++frame) {
+                cb.Begin();
+                for (uint32_t i = 0; i < commands_per_frame / 3; ++i) {
+                    vk::CmdBindVertexBuffers(cb, 0, buffer_count, vertex_buffer_handles.data(), offsets.data());
+                    vk::CmdBindIndexBuffer(cb, index_buffer, 0, VK_INDEX_TYPE_UINT32);
+                    vk::CmdUpdateBuffer(cb, vertex_buffer_handles[i % buffer_count], 0, sizeof(data), &data);
+                }
+                cb.End();
+                cb.Reset();
+            }
+        };
+        std::vector<std::thread> workers;
+        for (int i = 0; i < worker_count; i++) workers.emplace_back(worker_thread);
+        constexpr int wait_time = 120;
+        const bool finished = timeout_helper.WaitForThreads(wait_time);
+        for (auto &worker : workers) worker.join();
+        return finished;
+    }
+
+    vkt::Device &device;
+    std::vector<vkt::Buffer> vertex_buffers;
+    std::vector<VkBuffer> vertex_buffer_handles;
+    vkt::Buffer index_buffer;
+    const std::vector<VkDeviceSize> offsets;
+};
+
+TEST_F(StressCore, ParallelRecordingSharedBuffers) {
+    TEST_DESCRIPTION("Many threads record commands that reference the same buffers, make sure handle lookups scale");
+
+    RETURN_IF_SKIP(Init());
+
+    ParallelRecordingWorkload workload(*this);
+    if (!workload.Run(8, 20)) {
+        ADD_FAILURE() << "The waiting time for the worker threads exceeded the maximum limit";
+    }
+}
+
+TEST_F(StressCore, DISABLED_ParallelRecordingSharedBuffersBenchmark) {
+    TEST_DESCRIPTION("Measures the recording throughput of threads that reference the same buffers");
+
+    RETURN_IF_SKIP(Init());
+
+    ParallelRecordingWorkload workload(*this);
+    constexpr int frame_count = 50;
+    for (int worker_count : {1, 8}) {
+        bool finished = false;
+        const double ms = benchmark::TimeMs([&] { finished = workload.Run(worker_count, frame_count); });
+        ASSERT_TRUE(finished);
+        const double commands = double(worker_count) * frame_count * ParallelRecordingWorkload::commands_per_frame;
+        benchmark::Report(worker_count == 1 ? "parallel_recording.1_thread_commands_per_ms"
+                                            : "parallel_recording.8_threads_commands_per_ms",
+                          commands / ms);
+    }
+}
+
+struct RecordAndSubmitWorkload {
+    static constexpr uint32_t buffer_count = 8;
+    static constexpr uint32_t commands_per_frame = 1000;
+
+    explicit RecordAndSubmitWorkload(VkLayerTest &test) : device(*test.DeviceObj()), queue(*test.DefaultQueue()) {
+        for (uint32_t i = 0; i < buffer_count; ++i) {
+            buffers.emplace_back(device, 1024, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+            buffer_handles.push_back(buffers.back());
+        }
+    }
+
+    // Returns false if the workers did not finish in time or did not complete all their frames
+    bool Run(int worker_count, int frame_count) {
+        ThreadTimeoutHelper timeout_helper(worker_count);
+        std::atomic<int> completed_frames{0};
+        auto worker_thread = [&]() {
+            auto timeout_guard = timeout_helper.ThreadGuard();
+            vkt::CommandPool pool(device, device.graphics_queue_node_index_);
+            vkt::CommandBuffer cb(device, pool);
+            vkt::Fence fence(device);
+
+            for (int frame = 0; frame < frame_count; ++frame) {
+                cb.Begin();
+                for (uint32_t i = 0; i < commands_per_frame; ++i) {
+                    // Every worker reads the same buffers, so the thread-safety layer looks them up from all threads at once
+                    const VkBufferCopy region = {0, 0, 256};
+                    vk::CmdCopyBuffer(cb, buffer_handles[i % buffer_count], buffer_handles[(i + 1) % buffer_count], 1, &region);
+                }
+                cb.End();
+                {
+                    std::lock_guard<std::mutex> lock(queue_mutex);
+                    queue.Submit(cb, fence);
+                }
+                EXPECT_EQ(VK_SUCCESS, fence.Wait(kWaitTimeout));
+                fence.Reset();
+                completed_frames++;
+            }
+        };
+        std::vector<std::thread> workers;
+        for (int i = 0; i < worker_count; i++) workers.emplace_back(worker_thread);
+        constexpr int wait_time = 120;
+        const bool finished = timeout_helper.WaitForThreads(wait_time);
+        for (auto &worker : workers) worker.join();
+        return finished && completed_frames.load() == worker_count * frame_count;
+    }
+
+    vkt::Device &device;
+    vkt::Queue &queue;
+    // The queue must be externally synchronized, so it is the one object that the workers really take turns on
+    std::mutex queue_mutex;
+    std::vector<vkt::Buffer> buffers;
+    std::vector<VkBuffer> buffer_handles;
+};
+
+TEST_F(StressCore, ThreadSafetyRecordAndSubmit) {
+    TEST_DESCRIPTION("Threads record command buffers using shared objects and take turns submitting them to one queue");
+    RETURN_IF_SKIP(Init());
+
+    RecordAndSubmitWorkload workload(*this);
+    constexpr int worker_count = 8;
+    constexpr int frame_count = 20;
+    if (!workload.Run(worker_count, frame_count)) {
+        ADD_FAILURE() << "The worker threads did not complete their frames in the maximum waiting time";
+    }
+
+#if GTEST_IS_THREADSAFE
+    // The command buffers of the workers are freed, so this one reuses the thread-safety entry of one of them, which must
+    // start idle and still report a collision
+    m_errorMonitor->SetDesiredError("THREADING ERROR");
+    m_errorMonitor->SetAllowedFailureMsg("THREADING ERROR");  // Ignore any extra threading errors found beyond the first one
+    vkt::CommandBuffer cb(*m_device, m_command_pool);
+    vkt::Event event(*m_device);
+    cb.Begin();
+    ThreadTestData data;
+    data.commandBuffer = cb;
+    data.event = event;
+    std::atomic<bool> bailout{false};
+    data.bailout = &bailout;
+    m_errorMonitor->SetBailout(data.bailout);
+    std::thread thread(AddToCommandBuffer, &data);
+    AddToCommandBuffer(&data);
+    thread.join();
+    cb.End();
+    m_errorMonitor->SetBailout(nullptr);
+    m_errorMonitor->VerifyFound();
+#endif
+}
+
+TEST_F(StressCore, DISABLED_ThreadSafetyRecordAndSubmitBenchmark) {
+    TEST_DESCRIPTION("Measures the throughput of threads recording command buffers with shared objects and submitting them");
+    RETURN_IF_SKIP(Init());
+
+    RecordAndSubmitWorkload workload(*this);
+    constexpr int frame_count = 50;
+    for (int worker_count : {1, 8}) {
+        bool finished = false;
+        const double ms = benchmark::TimeMs([&] { finished = workload.Run(worker_count, frame_count); });
+        ASSERT_TRUE(finished);
+        const double commands = double(worker_count) * frame_count * RecordAndSubmitWorkload::commands_per_frame;
+        benchmark::Report(worker_count == 1 ? "record_and_submit.1_thread_commands_per_ms"
+                                            : "record_and_submit.8_threads_commands_per_ms",
+                          commands / ms);
+    }
+}
+
+// All the descriptor updates and draws are valid, so this is the cost of validating the common case
+struct DescriptorUpdateAndDrawWorkload {
+    static constexpr uint32_t write_count = 4;
+
+    // The test must have called InitRenderTarget(), the pipeline uses its render pass
+    explicit DescriptorUpdateAndDrawWorkload(VkLayerTest &test)
+        : device(*test.DeviceObj()),
+          uniform_buffer(device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT),
+          index_buffer(device, 3 * sizeof(uint32_t), VK_BUFFER_USAGE_INDEX_BUFFER_BIT),
+          descriptor_set(&device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, write_count, VK_SHADER_STAGE_ALL, nullptr}}),
+          pipe(test) {
+        pipe.pipeline_layout_ = vkt::PipelineLayout(device, {&descriptor_set.layout_});
+        pipe.CreateGraphicsPipeline();
+
+        for (uint32_t i = 0; i < write_count; ++i) {
+            buffer_infos[i] = {uniform_buffer, 0, VK_WHOLE_SIZE};
+            writes[i] = vku::InitStructHelper();
+            writes[i].dstSet = descriptor_set.set_;
+            writes[i].dstBinding = 0;
+            writes[i].dstArrayElement = i;
+            writes[i].descriptorCount = 1;
+            writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            writes[i].pBufferInfo = &buffer_infos[i];
+        }
+    }
+
+    // Each update writes every element of the binding
+    void UpdateDescriptorSets(uint32_t update_count) {
+        for (uint32_t i = 0; i < update_count; ++i) {
+            vk::UpdateDescriptorSets(device, write_count, writes, 0, nullptr);
+        }
+    }
+
+    // Records the draws in a single render pass, all using the same pipeline and descriptor set
+    void RecordDraws(vkt::CommandBuffer &cb, const VkRenderPassBeginInfo &render_pass_begin, uint32_t draw_count, bool indexed) {
+        cb.Begin();
+        cb.BeginRenderPass(render_pass_begin);
+        vk::CmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe);
+        vk::CmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_, 0, 1, &descriptor_set.set_, 0,
+                                  nullptr);
+        if (indexed) {
+            vk::CmdBindIndexBuffer(cb, index_buffer, 0, VK_INDEX_TYPE_UINT32);
+            for (uint32_t i = 0; i < draw_count; ++i) {
+                vk::CmdDrawIndexed(cb, 3, 1, 0, 0, 0);
+            }
+        } else {
+            for (uint32_t i = 0; i < draw_count; ++i) {
+                vk::CmdDraw(cb, 3, 1, 0, 0);
+            }
+        }
+        cb.EndRenderPass();
+        cb.End();
+    }
+
+    vkt::Device &device;
+    vkt::Buffer uniform_buffer;
+    vkt::Buffer index_buffer;
+    OneOffDescriptorSet descriptor_set;
+    CreatePipelineHelper pipe;
+    VkDescriptorBufferInfo buffer_infos[write_count];
+    VkWriteDescriptorSet writes[write_count];
+};
+
+TEST_F(StressCore, UpdateDescriptorSetsAndDraws) {
+    TEST_DESCRIPTION("Many descriptor updates and draws that are all valid, then make sure errors are still caught");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    DescriptorUpdateAndDrawWorkload workload(*this);
+    constexpr uint32_t iterations = 10000;
+    workload.UpdateDescriptorSets(iterations);
+
+    // The same write, one past the end of the binding
+    VkWriteDescriptorSet out_of_bounds_write = workload.writes[DescriptorUpdateAndDrawWorkload::write_count - 1];
+    out_of_bounds_write.dstArrayElement = DescriptorUpdateAndDrawWorkload::write_count;
+    m_errorMonitor->SetDesiredError("VUID-VkWriteDescriptorSet-dstArrayElement-00321");
+    vk::UpdateDescriptorSets(device(), 1, &out_of_bounds_write, 0, nullptr);
+    m_errorMonitor->VerifyFound();
+
+    workload.RecordDraws(m_command_buffer, m_renderPassBeginInfo, iterations, false);
+    m_default_queue->Submit(m_command_buffer);
+    m_default_queue->Wait();
+
+    // The draws only validated the set once, destroying the buffer must still invalidate the command buffer
+    workload.uniform_buffer.Destroy();
+    m_errorMonitor->SetDesiredError("VUID-vkQueueSubmit-pCommandBuffers-00070");
+    m_default_queue->Submit(m_command_buffer);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(StressCore, DISABLED_UpdateDescriptorSetsAndDrawsBenchmark) {
+    TEST_DESCRIPTION("Measures the validation throughput of valid descriptor updates, draws and indexed draws");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    DescriptorUpdateAndDrawWorkload workload(*this);
+    constexpr uint32_t iterations = 100000;
+    const double update_ms = benchmark::TimeMs([&] { workload.UpdateDescriptorSets(iterations); });
+    benchmark::Report("update_descriptor_sets.writes_per_ms",
+                      double(iterations) * DescriptorUpdateAndDrawWorkload::write_count / update_ms);
+
+    for (bool indexed : {false, true}) {
+        const double draw_ms =
+            benchmark::TimeMs([&] { workload.RecordDraws(m_command_buffer, m_renderPassBeginInfo, iterations, indexed); });
+        benchmark::Report(indexed ? "cmd_draw_indexed.draws_per_ms" : "cmd_draw.draws_per_ms", iterations / draw_ms);
+        m_default_queue->Submit(m_command_buffer);
+        m_default_queue->Wait();
+    }
+}
+
+TEST_F(StressCore, AllocatePartiallyBoundSets) {
+    TEST_DESCRIPTION("Allocate huge partially bound sets and write a few descriptors, then read them back with copies");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::descriptorBindingPartiallyBound);
+    AddRequiredFeature(vkt::Feature::descriptorBindingVariableDescriptorCount);
+    AddRequiredFeature(vkt::Feature::descriptorBindingSampledImageUpdateAfterBind);
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    VkPhysicalDeviceDescriptorIndexingProperties indexing_props = vku::InitStructHelper();
+    GetPhysicalDeviceProperties2(indexing_props);
+    const uint32_t descriptor_count =
+        std::min({1u << 20, indexing_props.maxDescriptorSetUpdateAfterBindSampledImages,
+                  indexing_props.maxPerStageDescriptorUpdateAfterBindSampledImages});
+
+    vkt::Image image(*m_device, 16, 16, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT);
+    vkt::ImageView image_view = image.CreateView();
+
+    // Spread the writes over the whole array, so that they touch as many different pages as possible
+    constexpr uint32_t write_count = 256;
+    const uint32_t stride = std::max(1u, descriptor_count / write_count);
+    const VkDescriptorImageInfo image_info = {VK_NULL_HANDLE, image_view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+    VkDescriptorSetVariableDescriptorCountAllocateInfo variable_count_info = vku::InitStructHelper();
+    variable_count_info.descriptorSetCount = 1;
+    variable_count_info.pDescriptorCounts = &descriptor_count;
+    const OneOffDescriptorIndexingSet::Bindings bindings = {
+        {0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, descriptor_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr,
+         VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT |
+             VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT}};
+
+    std::vector<VkWriteDescriptorSet> writes(write_count);
+    auto write_descriptors = [&](VkDescriptorSet set) {
+        for (uint32_t w = 0; w < write_count; ++w) {
+            writes[w] = vku::InitStructHelper();
+            writes[w].dstSet = set;
+            writes[w].dstBinding = 0;
+            writes[w].dstArrayElement = std::min(w * stride, descriptor_count - 1);
+            writes[w].descriptorCount = 1;
+            writes[w].descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+            writes[w].pImageInfo = &image_info;
+        }
+        vk::UpdateDescriptorSets(device(), write_count, writes.data(), 0, nullptr);
+    };
+
+    constexpr uint32_t iterations = 100;
+    for (uint32_t i = 0; i < iterations; ++i) {
+        OneOffDescriptorIndexingSet descriptor_set(m_device, bindings, &variable_count_info);
+        ASSERT_TRUE(descriptor_set.Initialized());
+        write_descriptors(descriptor_set.set_);
+    }
+
+    OneOffDescriptorIndexingSet src_set(m_device, bindings, &variable_count_info);
+    ASSERT_TRUE(src_set.Initialized());
+    write_descriptors(src_set.set_);
+
+    // Copy the written descriptors to a set where the draw checks every descriptor was updated
+    OneOffDescriptorSet dst_set(m_device,
+                                {{0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, write_count, VK_SHADER_STAGE_FRAGMENT_BIT, nullptr}});
+    std::vector<VkCopyDescriptorSet> copies(write_count);
+    for (uint32_t w = 0; w < write_count; ++w) {
+        copies[w] = vku::InitStructHelper();
+        copies[w].srcSet = src_set.set_;
+        copies[w].srcBinding = 0;
+        copies[w].srcArrayElement = writes[w].dstArrayElement;
+        copies[w].dstSet = dst_set.set_;
+        copies[w].dstBinding = 0;
+        copies[w].dstArrayElement = w;
+        copies[w].descriptorCount = 1;
+    }
+    vk::UpdateDescriptorSets(device(), 0, nullptr, write_count, copies.data());
+
+    const char *fs_source = R"glsl(
+        #version 450
+        #extension GL_EXT_samplerless_texture_functions : require
+        layout(set = 0, binding = 0) uniform texture2D textures[256];
+        layout(location = 0) out vec4 color;
+        void main() {
+            color = texelFetch(textures[0], ivec2(0), 0) + texelFetch(textures[255], ivec2(0), 0);
+        }
+    )glsl";
+    VkShaderObj fs(this, fs_source, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper pipe(*this);
+    pipe.shader_stages_ = {pipe.vs_->GetStageCreateInfo(), fs.GetStageCreateInfo()};
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, {&dst_set.layout_});
+    pipe.CreateGraphicsPipeline();
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe);
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_, 0, 1, &dst_set.set_, 0,
+                              nullptr);
+    vk::CmdDraw(m_command_buffer, 3, 1, 0, 0);
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+
+    // A descriptor between two written ones was never written, copying it marks the destination as not updated
+    if (stride > 1) {
+        VkCopyDescriptorSet copy = copies[0];
+        copy.srcArrayElement = 1;
+        vk::UpdateDescriptorSets(device(), 0, nullptr, 1, &copy);
+
+        vkt::CommandBuffer cb(*m_device, m_command_pool);
+        cb.Begin();
+        cb.BeginRenderPass(m_renderPassBeginInfo);
+        vk::CmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe);
+        vk::CmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_, 0, 1, &dst_set.set_, 0, nullptr);
+        m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-08114");
+        vk::CmdDraw(cb, 3, 1, 0, 0);
+        m_errorMonitor->VerifyFound();
+        cb.EndRenderPass();
+        cb.End();
+    }
+}
+
+TEST_F(StressCore, ManyCommandBuffersShareBuffers) {
+    TEST_DESCRIPTION("Record the same buffers in many command buffers, then reset them and destroy a shared buffer");
+    RETURN_IF_SKIP(Init());
+
+    vkt::Buffer src_buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer other_src_buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer dst_buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::CommandPool command_pool(*m_device, m_device->graphics_queue_node_index_);
+
+    constexpr uint32_t command_buffer_count = 4096;
+    std::vector<VkCommandBuffer> command_buffers(command_buffer_count);
+    VkCommandBufferAllocateInfo alloc_info = vku::InitStructHelper();
+    alloc_info.commandPool = command_pool;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = command_buffer_count;
+    vk::AllocateCommandBuffers(device(), &alloc_info, command_buffers.data());
+
+    const VkCommandBufferBeginInfo begin_info = vku::InitStructHelper();
+    const VkBufferCopy region = {0, 0, 256};
+    for (VkCommandBuffer command_buffer : command_buffers) {
+        vk::BeginCommandBuffer(command_buffer, &begin_info);
+        vk::CmdCopyBuffer(command_buffer, src_buffer, dst_buffer, 1, &region);
+        vk::EndCommandBuffer(command_buffer);
+    }
+
+    // Every command buffer unlinks itself from both buffers, the odd ones then only use the other source buffer
+    vk::ResetCommandPool(device(), command_pool, 0);
+    for (uint32_t i = 0; i < command_buffer_count; ++i) {
+        vk::BeginCommandBuffer(command_buffers[i], &begin_info);
+        vk::CmdCopyBuffer(command_buffers[i], (i % 2) ? other_src_buffer : src_buffer, dst_buffer, 1, &region);
+        vk::EndCommandBuffer(command_buffers[i]);
+    }
+
+    // Invalidates the even command buffers through the parents of the buffer
+    src_buffer.Destroy();
+
+    m_default_queue->Submit({command_buffers[1], command_buffers[command_buffer_count / 2 + 1], command_buffers.back()});
+    m_default_queue->Wait();
+
+    for (uint32_t i : {0u, command_buffer_count / 2, command_buffer_count - 2}) {
+        m_errorMonitor->SetDesiredError("VUID-vkQueueSubmit-pCommandBuffers-00070");
+        m_default_queue->Submit(std::vector<VkCommandBuffer>{command_buffers[i]});
+        m_errorMonitor->VerifyFound();
+    }
+    m_default_queue->Wait();
+
+    vk::FreeCommandBuffers(device(), command_pool, command_buffer_count, command_buffers.data());
+}
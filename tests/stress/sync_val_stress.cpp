@@ -11,8 +11,11 @@
  *     http://www.apache.org/licenses/LICENSE-2.0
  */
 
+#include <thread>
 #include "../framework/sync_val_tests.h"
 #include "../framework/descriptor_helper.h"
+#include "../framework/thread_helper.h"
+#include "../framework/benchmark.h"
 #include "layer_validation_tests.h"
 
 class StressSyncVal : public VkLayerTest {
@@ -144,3 +147,168 @@ TEST_F(StressSyncVal, CopyPagesInSmallChunksNoQueueSync) {
     }
     m_default_queue->Wait();
 }
+
+// Reads from the copy, indirect command and compute shader stages, then barriers that have only part of the reads in the
+// source scope. This exercises the read scope tests that are evaluated for all reads of the access state at once
+// (see sync_read_scope.h).
+struct ConcurrentReadsWorkload {
+    static constexpr VkDeviceSize buffer_size = 256;
+
+    explicit ConcurrentReadsWorkload(VkLayerTest &test)
+        : buffer(*test.DeviceObj(), buffer_size,
+                 VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+                     VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT),
+          dst_buffer(*test.DeviceObj(), buffer_size, VK_BUFFER_USAGE_TRANSFER_DST_BIT),
+          descriptor_set(test.DeviceObj(), {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}}),
+          cs_pipe(test) {
+        descriptor_set.WriteDescriptorBufferInfo(0, buffer, 0, buffer_size, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+        descriptor_set.UpdateDescriptorSets();
+
+        const char *cs_source = R"glsl(
+            #version 450
+            layout(set=0, binding=0) uniform UBO { uint x; } ubo;
+            void main() {
+                if (ubo.x == 0) {
+                    return;
+                }
+            }
+        )glsl";
+        cs_pipe.cs_ = VkShaderObj(*test.DeviceObj(), cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+        cs_pipe.pipeline_layout_ = vkt::PipelineLayout(*test.DeviceObj(), {&descriptor_set.layout_});
+        cs_pipe.CreateComputePipeline();
+
+        // Makes the fill visible to all readers and orders the copy writes
+        write_barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+        write_barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+        write_barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT | VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT |
+                                     VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+        write_barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT |
+                                      VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT | VK_ACCESS_2_UNIFORM_READ_BIT;
+
+        // Only the copy read is in the source scope
+        copy_read_barrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+        copy_read_barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+
+        // Protects the remaining reads
+        compute_read_barrier.srcStageMask = VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+        compute_read_barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    }
+
+    void Bind(vkt::CommandBuffer &cb) {
+        vk::CmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, cs_pipe);
+        vk::CmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_COMPUTE, cs_pipe.pipeline_layout_, 0, 1, &descriptor_set.set_, 0,
+                                  nullptr);
+    }
+
+    void RecordReads(vkt::CommandBuffer &cb) {
+        vk::CmdFillBuffer(cb, buffer, 0, buffer_size, 0);
+        cb.Barrier(write_barrier);
+        cb.Copy(buffer, dst_buffer);
+        vk::CmdDispatchIndirect(cb, buffer, 0);
+    }
+
+    void RecordIterations(vkt::CommandBuffer &cb, uint32_t iteration_count) {
+        cb.Begin();
+        Bind(cb);
+        for (uint32_t i = 0; i < iteration_count; i++) {
+            RecordReads(cb);
+            cb.Barrier(copy_read_barrier);
+            cb.Barrier(compute_read_barrier);
+        }
+        cb.End();
+    }
+
+    vkt::Buffer buffer;
+    vkt::Buffer dst_buffer;
+    OneOffDescriptorSet descriptor_set;
+    CreateComputePipelineHelper cs_pipe;
+    VkMemoryBarrier2 write_barrier = vku::InitStructHelper();
+    VkMemoryBarrier2 copy_read_barrier = vku::InitStructHelper();
+    VkMemoryBarrier2 compute_read_barrier = vku::InitStructHelper();
+};
+
+TEST_F(StressSyncVal, BarriersOverConcurrentReads) {
+    TEST_DESCRIPTION("Performance stress testing test: apply barriers to a buffer that is read by multiple pipeline stages");
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+    AddRequiredFeature(vkt::Feature::synchronization2);
+    RETURN_IF_SKIP(InitSyncVal());
+
+    ConcurrentReadsWorkload workload(*this);
+    workload.RecordIterations(m_command_buffer, 4096);
+    m_default_queue->SubmitAndWait(m_command_buffer);
+
+    // Without the second barrier the indirect and uniform reads are not protected
+    vkt::CommandBuffer cb(*m_device, m_command_pool);
+    cb.Begin();
+    workload.Bind(cb);
+    workload.RecordReads(cb);
+    cb.Barrier(workload.copy_read_barrier);
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-AFTER-READ");
+    vk::CmdFillBuffer(cb, workload.buffer, 0, workload.buffer_size, 0);
+    m_errorMonitor->VerifyFound();
+    cb.End();
+}
+
+TEST_F(StressSyncVal, DISABLED_BarriersOverConcurrentReadsBenchmark) {
+    TEST_DESCRIPTION("Measures recording and submitting barriers over the reads of multiple pipeline stages");
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+    AddRequiredFeature(vkt::Feature::synchronization2);
+    RETURN_IF_SKIP(InitSyncVal());
+
+    ConcurrentReadsWorkload workload(*this);
+    const uint32_t iteration_count = 65536;
+    const double record_ms = benchmark::TimeMs([&] { workload.RecordIterations(m_command_buffer, iteration_count); });
+    const double submit_ms = benchmark::TimeMs([&] { m_default_queue->SubmitAndWait(m_command_buffer); });
+    benchmark::Report("concurrent_reads.record_ms", record_ms);
+    benchmark::Report("concurrent_reads.submit_ms", submit_ms);
+}
+
+TEST_F(StressSyncVal, ParallelSecondaryRecording) {
+    TEST_DESCRIPTION("Many threads record secondary command buffers at the same time, then execute them from one primary");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    constexpr uint32_t worker_count = 16;
+    constexpr uint32_t copies_per_worker = 1000;
+    constexpr VkDeviceSize copy_size = 16;
+    constexpr VkDeviceSize worker_region_size = copies_per_worker * copy_size;
+
+    const VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    vkt::Buffer src_buffer(*m_device, worker_region_size, usage);
+    vkt::Buffer dst_buffer(*m_device, worker_count * worker_region_size, usage);
+
+    // Each worker uses its own pool, as required for concurrent recording
+    std::vector<std::unique_ptr<vkt::CommandPool>> pools;
+    std::vector<std::unique_ptr<vkt::CommandBuffer>> secondaries;
+    for (uint32_t i = 0; i < worker_count; ++i) {
+        pools.emplace_back(std::make_unique<vkt::CommandPool>(*m_device, m_device->graphics_queue_node_index_));
+        secondaries.emplace_back(std::make_unique<vkt::CommandBuffer>(*m_device, *pools.back(), VK_COMMAND_BUFFER_LEVEL_SECONDARY));
+    }
+
+    ThreadTimeoutHelper timeout_helper(worker_count);
+    auto worker_thread = [&](uint32_t worker_index) {
+        auto timeout_guard = timeout_helper.ThreadGuard();
+        vkt::CommandBuffer &secondary = *secondaries[worker_index];
+        secondary.Begin();
+        for (uint32_t i = 0; i < copies_per_worker; ++i) {
+            // Workers write disjoint regions, so executing all of them together is hazard free
+            const VkBufferCopy region = {i * copy_size, worker_index * worker_region_size + i * copy_size, copy_size};
+            vk::CmdCopyBuffer(secondary, src_buffer, dst_buffer, 1, &region);
+        }
+        secondary.End();
+    };
+    std::vector<std::thread> workers;
+    for (uint32_t i = 0; i < worker_count; i++) workers.emplace_back(worker_thread, i);
+    constexpr int wait_time = 120;
+    if (!timeout_helper.WaitForThreads(wait_time))
+        ADD_FAILURE() << "The waiting time for the worker threads exceeded the maximum limit: " << wait_time << " seconds.";
+    for (auto &worker : workers) worker.join();
+
+    std::vector<VkCommandBuffer> secondary_handles;
+    for (const auto &secondary : secondaries) {
+        secondary_handles.push_back(*secondary);
+    }
+    m_command_buffer.Begin();
+    vk::CmdExecuteCommands(m_command_buffer, size32(secondary_handles), secondary_handles.data());
+    m_command_buffer.End();
+    m_default_queue->SubmitAndWait(m_command_buffer);
+}
@@ -2002,6 +2002,118 @@ TEST_F(NegativeDescriptors, DISABLED_MutableBufferUpdate) {
     m_command_buffer.End();
 }
 
+TEST_F(NegativeDescriptors, CachedDrawStateNewPipeline) {
+    TEST_DESCRIPTION("Same descriptor set is used by a second pipeline which statically uses a binding that was not updated");
+    RETURN_IF_SKIP(Init());
+
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr},
+                                                  {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    vkt::Buffer buffer(*m_device, 32, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source_0 = R"glsl(
+        #version 450
+        layout(set=0, binding=0) buffer SSBO { uint x; };
+        void main() {
+            x = 0;
+        }
+    )glsl";
+    const char *cs_source_1 = R"glsl(
+        #version 450
+        layout(set=0, binding=1) buffer SSBO { uint x; };
+        void main() {
+            x = 0;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe_0(*this);
+    pipe_0.cs_ = VkShaderObj(this, cs_source_0, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe_0.cp_ci_.layout = pipeline_layout;
+    pipe_0.CreateComputePipeline();
+
+    CreateComputePipelineHelper pipe_1(*this);
+    pipe_1.cs_ = VkShaderObj(this, cs_source_1, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe_1.cp_ci_.layout = pipeline_layout;
+    pipe_1.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0, 1, &descriptor_set.set_, 0,
+                              nullptr);
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe_0);
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    // Nothing changed, the set is not validated again
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe_1);
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-None-08114");
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    m_errorMonitor->VerifyFound();
+    m_command_buffer.End();
+}
+
+TEST_F(NegativeDescriptors, CachedDrawStateHit) {
+    TEST_DESCRIPTION("A set which is not updated is reported once while nothing changes, then again for another pipeline");
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(Init());
+
+    // The draws are only recorded, and remembered as validated, if the error does not make the layer skip the call
+    m_errorMonitor->SetAllowedFailureMsg("VUID-vkCmdDispatch-None-08114");
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.count = 0;
+    callback_data.callback = [](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData, DebugUtilsLabelCheckData *data) {
+        if (strcmp(pCallbackData->pMessageIdName, "VUID-vkCmdDispatch-None-08114") == 0) {
+            data->count++;
+        }
+    };
+    VkDebugUtilsMessengerCreateInfoEXT callback_create_info = vku::InitStructHelper();
+    callback_create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    callback_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    callback_create_info.pfnUserCallback = DebugUtilsCallback;
+    callback_create_info.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT my_messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &callback_create_info, nullptr, &my_messenger);
+
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set=0, binding=0) buffer SSBO { uint x; };
+        void main() {
+            x = 0;
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe_0(*this);
+    pipe_0.cs_ = VkShaderObj(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe_0.cp_ci_.layout = pipeline_layout;
+    pipe_0.CreateComputePipeline();
+
+    CreateComputePipelineHelper pipe_1(*this);
+    pipe_1.cs_ = VkShaderObj(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe_1.cp_ci_.layout = pipeline_layout;
+    pipe_1.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0, 1, &descriptor_set.set_, 0,
+                              nullptr);
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe_0);
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    EXPECT_EQ(callback_data.count, 1u);
+    // Nothing changed, the set is not validated again
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    EXPECT_EQ(callback_data.count, 1u);
+
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe_1);
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    EXPECT_EQ(callback_data.count, 2u);
+    m_command_buffer.End();
+
+    vk::DestroyDebugUtilsMessengerEXT(instance(), my_messenger, nullptr);
+}
+
 TEST_F(NegativeDescriptors, UpdateDescriptorSetMismatchType) {
     RETURN_IF_SKIP(Init());
 
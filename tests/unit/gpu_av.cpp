@@ -17,6 +17,7 @@
 #include "../framework/shader_object_helper.h"
 #include "../framework/descriptor_helper.h"
 #include "../framework/gpu_av_helper.h"
+#include "../framework/cache_dir_helper.h"
 
 class NegativeGpuAV : public GpuAVTest {};
 
@@ -748,3 +749,120 @@ TEST_F(NegativeGpuAV, LeakDeviceMemory) {
 
     m_errorMonitor->SetUnexpectedError("VUID-vkDestroyDevice-device-05137");
 }
+
+TEST_F(NegativeGpuAV, ParallelShaderInstrumentation) {
+    TEST_DESCRIPTION("Instrument the shaders of a batched vkCreateComputePipelines on worker threads, each must report its error");
+    std::vector<VkLayerSettingEXT> layer_settings = {
+        {OBJECT_LAYER_NAME, "gpuav_parallel_shader_instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue}};
+    RETURN_IF_SKIP(InitGpuAvFramework(layer_settings));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, kHostVisibleMemProps);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, buffer, 0, 16, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    const char *cs_source_0 = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer SSBO { uint a; uint b[]; };
+        void main() { a = b[32]; }
+    )glsl";
+    const char *cs_source_1 = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer SSBO { uint a; uint b[]; };
+        void main() { b[64] = a; }
+    )glsl";
+    VkShaderObj cs_0(this, cs_source_0, VK_SHADER_STAGE_COMPUTE_BIT);
+    VkShaderObj cs_1(this, cs_source_1, VK_SHADER_STAGE_COMPUTE_BIT);
+
+    VkComputePipelineCreateInfo pipeline_cis[2];
+    pipeline_cis[0] = vku::InitStructHelper();
+    pipeline_cis[0].stage = cs_0.GetStageCreateInfo();
+    pipeline_cis[0].layout = pipeline_layout;
+    pipeline_cis[1] = pipeline_cis[0];
+    pipeline_cis[1].stage = cs_1.GetStageCreateInfo();
+    VkPipeline pipelines[2] = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, 2, pipeline_cis, nullptr, pipelines);
+
+    m_command_buffer.Begin();
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0, 1, &descriptor_set.set_, 0,
+                              nullptr);
+    for (VkPipeline pipeline : pipelines) {
+        vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    }
+    m_command_buffer.End();
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-storageBuffers-06936", 2);
+    m_default_queue->SubmitAndWait(m_command_buffer);
+    m_errorMonitor->VerifyFound();
+
+    for (VkPipeline pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
+
+TEST_F(NegativeGpuAV, InstrumentedShaderCache) {
+    TEST_DESCRIPTION("Shaders found in the instrumented shader cache must report errors for the pipeline using them");
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitGpuAvFramework());
+    RETURN_IF_SKIP(InitState());
+    CacheDirHelper cache_dir("vvl_test_instrumented_shader_cache");
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer SSBO { uint a; uint b[]; };
+        void main() { a = b[32]; }
+    )glsl";
+    const std::vector<uint32_t> spirv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, cs_source);
+
+    // The first device fills the cache file, in which the second one finds both pipelines.
+    // Within a device, the second pipeline uses the entry added for the first one.
+    for (uint32_t device_index = 0; device_index < 2; ++device_index) {
+        vkt::Device device(gpu_, m_device_extension_names);
+        vkt::Queue *queue = device.QueuesWithComputeCapability()[0];
+        vkt::CommandPool command_pool(device, queue->family_index);
+        vkt::CommandBuffer command_buffer(device, command_pool);
+
+        vkt::Buffer buffer(device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        OneOffDescriptorSet descriptor_set(&device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+        const vkt::PipelineLayout pipeline_layout(device, {&descriptor_set.layout_});
+        descriptor_set.WriteDescriptorBufferInfo(0, buffer, 0, 16, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+        descriptor_set.UpdateDescriptorSets();
+
+        VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+        module_ci.codeSize = spirv.size() * sizeof(uint32_t);
+        module_ci.pCode = spirv.data();
+        vkt::ShaderModule module(device, module_ci);
+
+        VkComputePipelineCreateInfo pipeline_ci = vku::InitStructHelper();
+        pipeline_ci.stage = vku::InitStructHelper();
+        pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipeline_ci.stage.module = module;
+        pipeline_ci.stage.pName = "main";
+        pipeline_ci.layout = pipeline_layout;
+        vkt::Pipeline pipelines[2] = {vkt::Pipeline(device, pipeline_ci), vkt::Pipeline(device, pipeline_ci)};
+        const char *pipeline_names[2] = {"first_pipeline", "second_pipeline"};
+        pipelines[0].SetName(VK_OBJECT_TYPE_PIPELINE, pipeline_names[0]);
+        pipelines[1].SetName(VK_OBJECT_TYPE_PIPELINE, pipeline_names[1]);
+
+        // Dispatched in reverse order of creation, so an id left from another pipeline would name the wrong one
+        for (int32_t i = 1; i >= 0; --i) {
+            command_buffer.Begin();
+            vk::CmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0, 1,
+                                      &descriptor_set.set_, 0, nullptr);
+            vk::CmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelines[i]);
+            vk::CmdDispatch(command_buffer, 1, 1, 1);
+            command_buffer.End();
+
+            m_errorMonitor->SetDesiredErrorRegex("VUID-vkCmdDispatch-storageBuffers-06936",
+                                                 std::string("VkPipeline.*") + pipeline_names[i]);
+            queue->SubmitAndWait(command_buffer);
+            m_errorMonitor->VerifyFound();
+        }
+    }
+    if (cache_dir.Find("instrumented_shader_cache").empty()) {
+        GTEST_SKIP() << "The instrumented shader cache is not used with this layer build";
+    }
+}
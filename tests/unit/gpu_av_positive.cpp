@@ -24,6 +24,7 @@
 #include "../framework/descriptor_helper.h"
 #include "../framework/gpu_av_helper.h"
 #include "../framework/external_memory_sync.h"
+#include "../framework/cache_dir_helper.h"
 #include "../../layers/gpuav/shaders/gpuav_shaders_constants.h"
 
 class PositiveGpuAV : public GpuAVTest {};
@@ -2482,3 +2483,64 @@ TEST_F(PositiveGpuAV, SafeBuffers) {
         ASSERT_TRUE(buffer_ci.size == 63);
     }
 }
+
+TEST_F(PositiveGpuAV, InstrumentedShaderCacheCorruptFile) {
+    TEST_DESCRIPTION("A truncated or corrupt instrumented shader cache file is ignored, then written again");
+    RETURN_IF_SKIP(InitGpuAvFramework());
+    RETURN_IF_SKIP(InitState());
+    CacheDirHelper cache_dir("vvl_test_instrumented_shader_cache_corrupt");
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer SSBO { uint a; uint b[]; };
+        void main() { a = b[0]; }
+    )glsl";
+    const std::vector<uint32_t> spirv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, cs_source);
+    const auto create_pipeline = [this, &spirv]() {
+        vkt::Device device(gpu_, m_device_extension_names);
+        const vkt::DescriptorSetLayout descriptor_set_layout(
+            device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}});
+        const vkt::PipelineLayout pipeline_layout(device, {&descriptor_set_layout});
+
+        VkShaderModuleCreateInfo module_ci = vku::InitStructHelper();
+        module_ci.codeSize = spirv.size() * sizeof(uint32_t);
+        module_ci.pCode = spirv.data();
+        vkt::ShaderModule module(device, module_ci);
+
+        VkComputePipelineCreateInfo pipeline_ci = vku::InitStructHelper();
+        pipeline_ci.stage = vku::InitStructHelper();
+        pipeline_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        pipeline_ci.stage.module = module;
+        pipeline_ci.stage.pName = "main";
+        pipeline_ci.layout = pipeline_layout;
+        vkt::Pipeline pipeline(device, pipeline_ci);
+    };
+
+    create_pipeline();
+    const std::filesystem::path cache_path = cache_dir.Find("instrumented_shader_cache");
+    if (cache_path.empty()) {
+        GTEST_SKIP() << "The instrumented shader cache is not used with this layer build";
+    }
+    const std::vector<uint8_t> cache_bytes = CacheDirHelper::Read(cache_path);
+
+    // Cut in the middle of the SPIR-V
+    std::vector<uint8_t> bytes = cache_bytes;
+    bytes.resize(bytes.size() - sizeof(uint32_t));
+    CacheDirHelper::Write(cache_path, bytes);
+    create_pipeline();
+    ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), cache_bytes.size());
+
+    // Fails the entry checksum, the shader is instrumented again
+    bytes = cache_bytes;
+    bytes.back() ^= 0xFF;
+    CacheDirHelper::Write(cache_path, bytes);
+    create_pipeline();
+    bytes = CacheDirHelper::Read(cache_path);
+    ASSERT_EQ(bytes.size(), cache_bytes.size());
+    ASSERT_EQ(bytes.back(), cache_bytes.back());
+
+    // Not even a whole file header
+    CacheDirHelper::Write(cache_path, std::vector<uint8_t>(7, 0xFF));
+    create_pipeline();
+    ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), cache_bytes.size());
+}
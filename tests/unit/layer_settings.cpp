@@ -190,6 +190,54 @@ TEST_F(NegativeLayerSettings, DuplicateMessageLimit) {
     vk::GetPhysicalDeviceProperties2KHR(Gpu(), &properties2);
 }
 
+TEST_F(NegativeLayerSettings, AsyncMessageDelivery) {
+    TEST_DESCRIPTION("Messages are delivered from a dedicated thread and flushed by vkDeviceWaitIdle");
+    AddRequiredExtensions(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "async_message_delivery", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    VkBaseOutStructure bogus_struct{};
+    bogus_struct.sType = static_cast<VkStructureType>(0x33333333);
+    VkPhysicalDeviceProperties2KHR properties2 = vku::InitStructHelper(&bogus_struct);
+
+    m_errorMonitor->SetDesiredError("VUID-VkPhysicalDeviceProperties2-pNext-pNext", 3);
+    for (uint32_t i = 0; i < 3; i++) {
+        vk::GetPhysicalDeviceProperties2KHR(Gpu(), &properties2);
+    }
+    vk::DeviceWaitIdle(device());
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeLayerSettings, AsyncMessageDeliveryFullQueue) {
+    TEST_DESCRIPTION("Log more messages than the asynchronous delivery queue holds");
+    AddRequiredExtensions(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+
+    uint32_t limit = 0;
+    const VkLayerSettingEXT settings[2] = {
+        {OBJECT_LAYER_NAME, "async_message_delivery", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue},
+        {OBJECT_LAYER_NAME, "duplicate_message_limit", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &limit}};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 2, settings};
+
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    VkBaseOutStructure bogus_struct{};
+    bogus_struct.sType = static_cast<VkStructureType>(0x33333333);
+    VkPhysicalDeviceProperties2KHR properties2 = vku::InitStructHelper(&bogus_struct);
+
+    const uint32_t count = 4096;
+    m_errorMonitor->SetDesiredError("VUID-VkPhysicalDeviceProperties2-pNext-pNext", count);
+    for (uint32_t i = 0; i < count; i++) {
+        vk::GetPhysicalDeviceProperties2KHR(Gpu(), &properties2);
+    }
+    vk::DeviceWaitIdle(device());
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeLayerSettings, DuplicateMessageLimitZero) {
     TEST_DESCRIPTION("Use the duplicate_message_limit setting with zero explicitly");
     AddRequiredExtensions(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
@@ -1369,3 +1369,38 @@ TEST_F(NegativeObjectLifetime, DestroySemaphoreInUseErrorMessage) {
     m_errorMonitor->VerifyFound();
     m_default_queue->Wait();
 }
+
+TEST_F(NegativeObjectLifetime, FreedDescriptorSetAfterReallocation) {
+    TEST_DESCRIPTION("Use a freed descriptor set after many other sets were allocated in its place");
+    RETURN_IF_SKIP(Init());
+
+    VkDescriptorPoolSize ds_type_count = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1};
+    VkDescriptorPoolCreateInfo ds_pool_ci = vku::InitStructHelper();
+    ds_pool_ci.maxSets = 1;
+    ds_pool_ci.poolSizeCount = 1;
+    ds_pool_ci.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    ds_pool_ci.pPoolSizes = &ds_type_count;
+    vkt::DescriptorPool ds_pool(*m_device, ds_pool_ci);
+
+    const vkt::DescriptorSetLayout ds_layout(*m_device, {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr});
+
+    VkDescriptorSetAllocateInfo alloc_info = vku::InitStructHelper();
+    alloc_info.descriptorPool = ds_pool;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.pSetLayouts = &ds_layout.handle();
+
+    VkDescriptorSet freed_set = VK_NULL_HANDLE;
+    vk::AllocateDescriptorSets(device(), &alloc_info, &freed_set);
+    vk::FreeDescriptorSets(device(), ds_pool, 1, &freed_set);
+
+    // With handle wrapping the freed set's slot gets reused by one of these, the old handle must still be invalid
+    for (uint32_t i = 0; i < 1000; ++i) {
+        VkDescriptorSet set = VK_NULL_HANDLE;
+        vk::AllocateDescriptorSets(device(), &alloc_info, &set);
+        vk::FreeDescriptorSets(device(), ds_pool, 1, &set);
+    }
+
+    m_errorMonitor->SetDesiredError("VUID-vkFreeDescriptorSets-pDescriptorSets-00310");
+    vk::FreeDescriptorSets(device(), ds_pool, 1, &freed_set);
+    m_errorMonitor->VerifyFound();
+}
@@ -4136,3 +4136,44 @@ TEST_F(NegativePipeline, DepthBounds) {
     pipe.CreateGraphicsPipeline();
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativePipeline, ParallelPipelineValidation) {
+    TEST_DESCRIPTION("Validate the pipelines of a batched vkCreateComputePipelines on worker threads, each must report its error");
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "parallel_pipeline_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &kVkTrue};
+    VkLayerSettingsCreateInfoEXT layer_setting_ci = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_setting_ci));
+    RETURN_IF_SKIP(InitState());
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x=2, local_size_y=4) in;
+        void main(){
+        }
+    )glsl";
+    VkShaderObj cs(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    const vkt::PipelineLayout pipeline_layout(*m_device, {});
+
+    // Every odd pipeline is a derivative of itself
+    constexpr uint32_t pipeline_count = 16;
+    VkComputePipelineCreateInfo compute_create_infos[pipeline_count];
+    for (uint32_t i = 0; i < pipeline_count; i++) {
+        compute_create_infos[i] = vku::InitStructHelper();
+        compute_create_infos[i].stage = cs.GetStageCreateInfo();
+        compute_create_infos[i].layout = pipeline_layout;
+        compute_create_infos[i].flags = VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT;
+        compute_create_infos[i].basePipelineIndex = -1;
+        if (i % 2 == 1) {
+            compute_create_infos[i].flags |= VK_PIPELINE_CREATE_DERIVATIVE_BIT;
+            compute_create_infos[i].basePipelineIndex = static_cast<int32_t>(i);
+        }
+    }
+
+    m_errorMonitor->SetDesiredError("VUID-vkCreateComputePipelines-flags-00695", pipeline_count / 2);
+    VkPipeline pipelines[pipeline_count] = {};
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, pipeline_count, compute_create_infos, nullptr, pipelines);
+    m_errorMonitor->VerifyFound();
+    for (VkPipeline pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
@@ -1165,6 +1165,62 @@ TEST_F(NegativeShaderObject, DescriptorSetBoundRange) {
     m_command_buffer.End();
 }
 
+TEST_F(NegativeShaderObject, CachedDrawState) {
+    TEST_DESCRIPTION("A set which is not updated is reported once while nothing changes, then again for other shader objects");
+    AddRequiredExtensions(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitBasicShaderObject());
+
+    // The draws are only recorded, and remembered as validated, if the error does not make the layer skip the call
+    m_errorMonitor->SetAllowedFailureMsg("VUID-vkCmdDispatch-None-08114");
+    DebugUtilsLabelCheckData callback_data;
+    callback_data.count = 0;
+    callback_data.callback = [](const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData, DebugUtilsLabelCheckData *data) {
+        if (strcmp(pCallbackData->pMessageIdName, "VUID-vkCmdDispatch-None-08114") == 0) {
+            data->count++;
+        }
+    };
+    VkDebugUtilsMessengerCreateInfoEXT callback_create_info = vku::InitStructHelper();
+    callback_create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    callback_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    callback_create_info.pfnUserCallback = DebugUtilsCallback;
+    callback_create_info.pUserData = &callback_data;
+    VkDebugUtilsMessengerEXT my_messenger = VK_NULL_HANDLE;
+    vk::CreateDebugUtilsMessengerEXT(instance(), &callback_create_info, nullptr, &my_messenger);
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) buffer SSBO { uint x; };
+        void main() {
+            x = 0;
+        }
+    )glsl";
+    auto cs_spirv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, cs_source);
+
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    const vkt::Shader comp_shader_0(*m_device,
+                                    ShaderCreateInfo(cs_spirv, VK_SHADER_STAGE_COMPUTE_BIT, 1, &descriptor_set.layout_.handle()));
+    const vkt::Shader comp_shader_1(*m_device,
+                                    ShaderCreateInfo(cs_spirv, VK_SHADER_STAGE_COMPUTE_BIT, 1, &descriptor_set.layout_.handle()));
+
+    m_command_buffer.Begin();
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0u, 1u, &descriptor_set.set_, 0u,
+                              nullptr);
+    m_command_buffer.BindCompShader(comp_shader_0);
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    EXPECT_EQ(callback_data.count, 1u);
+    // Nothing changed, the set is not validated again
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    EXPECT_EQ(callback_data.count, 1u);
+
+    m_command_buffer.BindCompShader(comp_shader_1);
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    EXPECT_EQ(callback_data.count, 2u);
+    m_command_buffer.End();
+
+    vk::DestroyDebugUtilsMessengerEXT(instance(), my_messenger, nullptr);
+}
+
 TEST_F(NegativeShaderObject, NotSettingViewportAndScissor) {
     TEST_DESCRIPTION("Draw with shader object without setting viewport and scissor.");
 
@@ -12,8 +12,10 @@
  *     http://www.apache.org/licenses/LICENSE-2.0
  */
 
+#include <filesystem>
 #include "../framework/layer_validation_tests.h"
 #include "../framework/pipeline_helper.h"
+#include "vk_layer_config.h"
 
 struct icd_spv_header {
     uint32_t magic = 0x07230203;
@@ -2998,3 +3000,109 @@ TEST_F(NegativeShaderSpirv, ShaderFmaNon32) {
     VkShaderObj cs(this, spv_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2, SPV_SOURCE_ASM);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeShaderSpirv, ModuleCacheDeferredParse) {
+    TEST_DESCRIPTION("Module found in the shader module cache written by an earlier device, parsing is deferred to the pipeline");
+    RETURN_IF_SKIP(Init());
+
+    // The cache files go in a private directory instead of the user cache directory
+    const std::string previous_cache_home = GetEnvironment("XDG_CACHE_HOME");
+    const std::filesystem::path cache_dir = std::filesystem::temp_directory_path() / "vvl_test_shader_module_cache";
+    std::filesystem::remove_all(cache_dir);
+    std::filesystem::create_directories(cache_dir);
+    SetEnvironment("XDG_CACHE_HOME", cache_dir.string().c_str());
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x=1) in;
+        layout(set=0, binding=0) buffer block { vec4 x; };
+        void main(){
+           x = vec4(1);
+        }
+    )glsl";
+    const std::vector<uint32_t> spirv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, cs_source);
+    const VkShaderModuleCreateInfo module_ci = vkt::ShaderModule::CreateInfo(spirv.size() * sizeof(uint32_t), spirv.data(), 0);
+
+    {
+        // Parsed and checked, written out when the device is destroyed
+        vkt::Device first_device(gpu_, m_device_extension_names);
+        vkt::ShaderModule module(first_device, module_ci);
+    }
+    ASSERT_FALSE(std::filesystem::is_empty(cache_dir));
+
+    {
+        vkt::Device second_device(gpu_, m_device_extension_names);
+        vkt::ShaderModule module(second_device, module_ci);
+        vkt::PipelineLayout pipeline_layout(second_device, {});
+
+        VkComputePipelineCreateInfo compute_ci = vku::InitStructHelper();
+        compute_ci.stage = vku::InitStructHelper();
+        compute_ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+        compute_ci.stage.module = module;
+        compute_ci.stage.pName = "main";
+        compute_ci.layout = pipeline_layout;
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        m_errorMonitor->SetDesiredError("VUID-VkComputePipelineCreateInfo-layout-07988");
+        vk::CreateComputePipelines(second_device, VK_NULL_HANDLE, 1, &compute_ci, nullptr, &pipeline);
+        m_errorMonitor->VerifyFound();
+        if (pipeline != VK_NULL_HANDLE) {
+            vk::DestroyPipeline(second_device, pipeline, nullptr);
+        }
+    }
+
+    SetEnvironment("XDG_CACHE_HOME", previous_cache_home.c_str());
+    std::filesystem::remove_all(cache_dir);
+}
+
+TEST_F(NegativeShaderSpirv, ParallelSpirvValDuplicates) {
+    TEST_DESCRIPTION("Batch of pipelines sharing the same invalid inlined SPIR-V, spirv-val runs once but each pipeline reports it");
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_KHR_MAINTENANCE_5_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::maintenance5);
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "parallel_pipeline_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                       &kVkTrue};
+    VkLayerSettingsCreateInfoEXT layer_setting_ci = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_setting_ci));
+    RETURN_IF_SKIP(InitState());
+
+    // OpReturnValue in a void function
+    const char *spv_source = R"(
+               OpCapability Shader
+               OpMemoryModel Logical GLSL450
+               OpEntryPoint GLCompute %main "main"
+               OpExecutionMode %main LocalSize 1 1 1
+       %void = OpTypeVoid
+          %3 = OpTypeFunction %void
+       %uint = OpTypeInt 32 0
+     %uint_0 = OpConstant %uint 0
+       %main = OpFunction %void None %3
+          %5 = OpLabel
+               OpReturnValue %uint_0
+               OpFunctionEnd
+        )";
+    std::vector<uint32_t> shader;
+    ASSERT_TRUE(ASMtoSPV(SPV_ENV_VULKAN_1_1, 0, spv_source, shader));
+
+    VkShaderModuleCreateInfo module_create_info = vku::InitStructHelper();
+    module_create_info.pCode = shader.data();
+    module_create_info.codeSize = shader.size() * sizeof(uint32_t);
+
+    VkPipelineShaderStageCreateInfo stage_ci = vku::InitStructHelper(&module_create_info);
+    stage_ci.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    stage_ci.module = VK_NULL_HANDLE;
+    stage_ci.pName = "main";
+    const vkt::PipelineLayout pipeline_layout(*m_device, {});
+
+    constexpr uint32_t pipeline_count = 8;
+    VkComputePipelineCreateInfo compute_create_infos[pipeline_count];
+    for (uint32_t i = 0; i < pipeline_count; i++) {
+        compute_create_infos[i] = vku::InitStructHelper();
+        compute_create_infos[i].stage = stage_ci;
+        compute_create_infos[i].layout = pipeline_layout;
+    }
+
+    m_errorMonitor->SetDesiredError("VUID-VkShaderModuleCreateInfo-pCode-08737", pipeline_count);
+    VkPipeline pipelines[pipeline_count] = {};
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, pipeline_count, compute_create_infos, nullptr, pipelines);
+    m_errorMonitor->VerifyFound();
+}
@@ -15,6 +15,7 @@
 #include <spirv-tools/libspirv.h>
 #include "../framework/layer_validation_tests.h"
 #include "../framework/pipeline_helper.h"
+#include "../framework/cache_dir_helper.h"
 
 class PositiveShaderSpirv : public VkLayerTest {};
 
@@ -2466,4 +2467,84 @@ TEST_F(PositiveShaderSpirv, ShaderFma) {
     pipe.dsl_bindings_[0] = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
     pipe.cs_ = VkShaderObj(this, spv_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_1, SPV_SOURCE_ASM);
     pipe.CreateComputePipeline();
-}
\ No newline at end of file
+}
+// Header size, header version and UUID of the shader validation cache file
+static constexpr size_t kValidationCacheHeaderSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE;
+
+static VkShaderModuleCreateInfo ValidationCacheModuleCreateInfo(const std::vector<uint32_t> &spirv) {
+    return vkt::ShaderModule::CreateInfo(spirv.size() * sizeof(uint32_t), spirv.data(), 0);
+}
+
+TEST_F(PositiveShaderSpirv, ValidationCacheFileHeaderMismatch) {
+    TEST_DESCRIPTION("A shader validation cache file with another header is started over, then hashes are appended to it");
+    RETURN_IF_SKIP(Init());
+    CacheDirHelper cache_dir("vvl_test_validation_cache_header");
+
+    const std::vector<uint32_t> spirv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, kMinimalShaderGlsl);
+    { vkt::Device device(gpu_, m_device_extension_names); }
+    const std::filesystem::path cache_path = cache_dir.Find("shader_validation_cache");
+    ASSERT_FALSE(cache_path.empty());
+    ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), kValidationCacheHeaderSize);
+
+    // Not a validation cache at all
+    CacheDirHelper::Write(cache_path, std::vector<uint8_t>(kValidationCacheHeaderSize + 3 * sizeof(uint32_t), 0xFF));
+    {
+        vkt::Device device(gpu_, m_device_extension_names);
+        ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), kValidationCacheHeaderSize);
+        vkt::ShaderModule module(device, ValidationCacheModuleCreateInfo(spirv));
+        ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), kValidationCacheHeaderSize + sizeof(uint32_t));
+    }
+    {
+        // Found in the file, nothing new to append
+        vkt::Device device(gpu_, m_device_extension_names);
+        vkt::ShaderModule module(device, ValidationCacheModuleCreateInfo(spirv));
+        ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), kValidationCacheHeaderSize + sizeof(uint32_t));
+    }
+
+    // Written by another layer build or spirv-val configuration
+    std::vector<uint8_t> bytes = CacheDirHelper::Read(cache_path);
+    bytes[2 * sizeof(uint32_t)] ^= 0xFF;
+    CacheDirHelper::Write(cache_path, bytes);
+    {
+        vkt::Device device(gpu_, m_device_extension_names);
+        ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), kValidationCacheHeaderSize);
+    }
+}
+
+TEST_F(PositiveShaderSpirv, ValidationCacheFilePartialRecord) {
+    TEST_DESCRIPTION("A partial hash left by a process that died while appending is dropped when the file is opened");
+    RETURN_IF_SKIP(Init());
+    CacheDirHelper cache_dir("vvl_test_validation_cache_partial");
+
+    const std::vector<uint32_t> spirv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, kMinimalShaderGlsl);
+    const char *other_source = R"glsl(
+        #version 450
+        layout(local_size_x=2) in;
+        void main(){}
+    )glsl";
+    const std::vector<uint32_t> other_spirv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, other_source);
+    {
+        vkt::Device device(gpu_, m_device_extension_names);
+        vkt::ShaderModule module(device, ValidationCacheModuleCreateInfo(spirv));
+        // Only new hashes are appended
+        vkt::ShaderModule same_module(device, ValidationCacheModuleCreateInfo(spirv));
+    }
+    const std::filesystem::path cache_path = cache_dir.Find("shader_validation_cache");
+    ASSERT_FALSE(cache_path.empty());
+    std::vector<uint8_t> bytes = CacheDirHelper::Read(cache_path);
+    ASSERT_EQ(bytes.size(), kValidationCacheHeaderSize + sizeof(uint32_t));
+
+    bytes.push_back(0xAB);
+    bytes.push_back(0xCD);
+    CacheDirHelper::Write(cache_path, bytes);
+    {
+        vkt::Device device(gpu_, m_device_extension_names);
+        ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), kValidationCacheHeaderSize + sizeof(uint32_t));
+        // The full hash before the partial one was kept
+        vkt::ShaderModule module(device, ValidationCacheModuleCreateInfo(spirv));
+        ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), kValidationCacheHeaderSize + sizeof(uint32_t));
+        // Appended after the last full hash
+        vkt::ShaderModule other_module(device, ValidationCacheModuleCreateInfo(other_spirv));
+        ASSERT_EQ(CacheDirHelper::Read(cache_path).size(), kValidationCacheHeaderSize + 2 * sizeof(uint32_t));
+    }
+}
@@ -51,6 +51,10 @@ void VkSyncValTest::InitSyncValFramework(const SyncValSettings *p_sync_settings)
     settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_shader_accesses_heuristic",
                                             VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &shader_accesses_heuristic});
 
+    const auto parallel_submit_replay = static_cast<VkBool32>(sync_settings.parallel_submit_replay);
+    settings.emplace_back(VkLayerSettingEXT{OBJECT_LAYER_NAME, "syncval_parallel_submit_replay", VK_LAYER_SETTING_TYPE_BOOL32_EXT,
+                                            1, &parallel_submit_replay});
+
     VkLayerSettingsCreateInfoEXT settings_create_info = vku::InitStructHelper();
     settings_create_info.settingCount = size32(settings);
     settings_create_info.pSettings = settings.data();
@@ -73,11 +77,11 @@ void VkSyncValTest::InitSyncVal(const SyncValSettings *p_sync_settings) {
     RETURN_IF_SKIP(InitState());
 }
 
-void VkSyncValTest::InitTimelineSemaphore() {
+void VkSyncValTest::InitTimelineSemaphore(const SyncValSettings *p_sync_settings) {
     SetTargetApiVersion(VK_API_VERSION_1_3);
     AddRequiredFeature(vkt::Feature::synchronization2);
     AddRequiredFeature(vkt::Feature::timelineSemaphore);
-    RETURN_IF_SKIP(InitSyncVal());
+    RETURN_IF_SKIP(InitSyncVal(p_sync_settings));
 }
 
 void VkSyncValTest::InitRayTracing() {
@@ -3406,3 +3410,53 @@ TEST_F(PositiveSyncVal, ResumeLoadOpAfterStoreOp2) {
     m_command_buffer.EndRendering();
     m_command_buffer.End();
 }
+
+TEST_F(PositiveSyncVal, ReuseCommandPoolRecordingStorage) {
+    TEST_DESCRIPTION("Re-record command buffers while the previous recordings are still referenced by submitted batches");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkMemoryBarrier barrier = vku::InitStructHelper();
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+
+    auto pool = std::make_unique<vkt::CommandPool>(*m_device, m_default_queue->family_index,
+                                                   VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    vkt::CommandBuffer cb0(*m_device, *pool);
+    vkt::CommandBuffer cb1(*m_device, *pool);
+
+    for (uint32_t frame = 0; frame < 3; frame++) {
+        // Implicit reset by Begin. The access log of the previous recording is referenced by the last submitted batch.
+        cb0.Begin();
+        cb0.Copy(buffer_a, buffer_b);
+        cb0.End();
+        cb1.Begin();
+        vk::CmdPipelineBarrier(cb1, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0, nullptr, 0,
+                               nullptr);
+        cb1.Copy(buffer_b, buffer_a);
+        cb1.End();
+
+        m_default_queue->Submit(cb0);
+        m_default_queue->Submit(cb1);
+        m_default_queue->Wait();
+
+        if (frame == 1) {
+            vk::ResetCommandPool(device(), *pool, 0);
+            vk::TrimCommandPool(device(), *pool, 0);
+        }
+    }
+
+    // The batches keep the recorded accesses after the pool is gone
+    cb0.Destroy();
+    cb1.Destroy();
+    pool.reset();
+
+    m_command_buffer.Begin();
+    vk::CmdPipelineBarrier(m_command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &barrier, 0,
+                           nullptr, 0, nullptr);
+    m_command_buffer.Copy(buffer_a, buffer_b);
+    m_command_buffer.End();
+    m_default_queue->SubmitAndWait(m_command_buffer);
+}
@@ -16,6 +16,7 @@
  */
 
 #include "../framework/sync_val_tests.h"
+#include "../layers/sync/sync_settings.h"
 
 struct NegativeSyncValTimelineSemaphore : public VkSyncValTest {};
 
@@ -353,3 +354,34 @@ TEST_F(NegativeSyncValTimelineSemaphore, SignalResolvesTwoWaits4) {
     m_errorMonitor->VerifyFound();
     m_device->Wait();
 }
+
+TEST_F(NegativeSyncValTimelineSemaphore, SignalResolvesTwoWaitsParallelReplay) {
+    TEST_DESCRIPTION("One signal resolves two wait-before-signal waits. The batches are replayed concurrently");
+    SyncValSettings settings;
+    settings.submit_time_validation = true;
+    settings.parallel_submit_replay = true;
+    RETURN_IF_SKIP(InitTimelineSemaphore(&settings));
+
+    if (!m_third_queue) {
+        GTEST_SKIP() << "Three queues are needed";
+    }
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    m_command_buffer.Begin();
+    m_command_buffer.Copy(buffer_a, buffer_b);
+    m_command_buffer.End();
+    m_second_command_buffer.Begin();
+    m_second_command_buffer.Copy(buffer_a, buffer_b);
+    m_second_command_buffer.End();
+
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+    m_default_queue->Submit2(m_command_buffer, vkt::TimelineWait(semaphore, 1));
+    m_second_queue->Submit2(m_second_command_buffer, vkt::TimelineWait(semaphore, 1));
+    m_errorMonitor->SetDesiredError("SYNC-HAZARD-WRITE-RACING-WRITE");
+    m_third_queue->Submit2(vkt::no_cmd, vkt::TimelineSignal(semaphore, 1));
+    m_errorMonitor->VerifyFound();
+
+    // Unblock queue threads (the previous call did not reach Record phase)
+    m_third_queue->Submit2(vkt::no_cmd, vkt::TimelineSignal(semaphore, 1));
+    m_device->Wait();
+}
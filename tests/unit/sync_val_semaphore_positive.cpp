@@ -17,6 +17,7 @@
 
 #include <thread>
 #include "../framework/sync_val_tests.h"
+#include "../layers/sync/sync_settings.h"
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include "../framework/external_memory_sync.h"
 #endif  // VK_USE_PLATFORM_WIN32_KHR
@@ -377,6 +378,32 @@ TEST_F(PositiveSyncValTimelineSemaphore, SignalResolvesTwoWaits2) {
     m_device->Wait();
 }
 
+TEST_F(PositiveSyncValTimelineSemaphore, ParallelReplayChainedWaits) {
+    TEST_DESCRIPTION("Host signal resolves a wait on one queue, which in turn resolves a wait on another queue");
+    SyncValSettings settings;
+    settings.submit_time_validation = true;
+    settings.parallel_submit_replay = true;
+    RETURN_IF_SKIP(InitTimelineSemaphore(&settings));
+
+    if (!m_second_queue) {
+        GTEST_SKIP() << "Two queues are needed";
+    }
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    m_command_buffer.Begin();
+    m_command_buffer.Copy(buffer_a, buffer_b);
+    m_command_buffer.End();
+    m_second_command_buffer.Begin();
+    m_second_command_buffer.Copy(buffer_a, buffer_b);
+    m_second_command_buffer.End();
+
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+    m_default_queue->Submit2(m_command_buffer, vkt::TimelineWait(semaphore, 1), vkt::TimelineSignal(semaphore, 2));
+    m_second_queue->Submit2(m_second_command_buffer, vkt::TimelineWait(semaphore, 2));
+    semaphore.Signal(1);
+    m_device->Wait();
+}
+
 TEST_F(PositiveSyncValTimelineSemaphore, SyncSubmitsWithSingleSemaphore) {
     // TODO: existing implementation releases QBC objects and removes signals properly but vvl::Semaphore state
     // objects accumulate timepoints. Investigate if it's possible to safely release timepoint in vvl::Semaphore
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "utils/file_system_utils.h"
+
+TEST(FileSystemUtils, AppendOnlyFile) {
+    const std::string path = GetTempFilePath() + "/vvl_append_only_file_test.bin";
+    std::remove(path.c_str());
+
+    {
+        AppendOnlyFile file;
+        ASSERT_TRUE(file.Open(path));
+        const uint8_t *data = nullptr;
+        size_t size = 1;
+        ASSERT_TRUE(file.Map(data, size));
+        ASSERT_EQ(size, 0u);
+        ASSERT_EQ(data, nullptr);
+
+        for (uint32_t i = 0; i < 1000; ++i) {
+            ASSERT_TRUE(file.Append(&i, sizeof(i)));
+        }
+        // Partial record, as left by a process dying in the middle of an append
+        const uint8_t partial[2] = {0xAB, 0xCD};
+        ASSERT_TRUE(file.Append(partial, sizeof(partial)));
+    }
+
+    {
+        AppendOnlyFile file;
+        ASSERT_TRUE(file.Open(path));
+        const uint8_t *data = nullptr;
+        size_t size = 0;
+        ASSERT_TRUE(file.Map(data, size));
+        ASSERT_EQ(size, 1000 * sizeof(uint32_t) + 2);
+        for (uint32_t i = 0; i < 1000; ++i) {
+            uint32_t value;
+            std::memcpy(&value, data + i * sizeof(uint32_t), sizeof(value));
+            ASSERT_EQ(value, i);
+        }
+        file.Unmap();
+
+        // Drop the partial record and keep appending after the last full one
+        ASSERT_TRUE(file.Truncate(1000 * sizeof(uint32_t)));
+        const uint32_t last = 1000;
+        ASSERT_TRUE(file.Append(&last, sizeof(last)));
+        ASSERT_TRUE(file.Map(data, size));
+        ASSERT_EQ(size, 1001 * sizeof(uint32_t));
+        uint32_t value;
+        std::memcpy(&value, data + 1000 * sizeof(uint32_t), sizeof(value));
+        ASSERT_EQ(value, last);
+    }
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "error_message/logging.h"
+
+// Counts hash until Count() rejects it, returns how many times it was accepted
+static uint32_t CountUntilRejected(MessageCounter &counter, uint32_t vuid_hash, uint32_t limit) {
+    uint32_t accepted = 0;
+    bool at_limit = false;
+    while (counter.Count(vuid_hash, limit, at_limit)) {
+        ++accepted;
+        if (at_limit != (accepted == limit)) {
+            ADD_FAILURE() << "at_limit set on count " << accepted << " of " << limit;
+        }
+    }
+    return accepted;
+}
+
+TEST(MessageCounter, Limit) {
+    auto counter = std::make_unique<MessageCounter>();
+    ASSERT_EQ(CountUntilRejected(*counter, 0x1234, 10), 10u);
+    bool at_limit = true;
+    ASSERT_FALSE(counter->Count(0x1234, 10, at_limit));
+    ASSERT_FALSE(at_limit);
+    // Other messages are not affected
+    ASSERT_EQ(CountUntilRejected(*counter, 0x5678, 10), 10u);
+}
+
+TEST(MessageCounter, OverflowManyMessages) {
+    auto counter = std::make_unique<MessageCounter>();
+    // More messages than slots in the table
+    const uint32_t message_count = 4096;
+    for (uint32_t i = 0; i < message_count; ++i) {
+        ASSERT_EQ(CountUntilRejected(*counter, i * 2654435761u, 3), 3u);
+    }
+    for (uint32_t i = 0; i < message_count; ++i) {
+        bool at_limit = false;
+        ASSERT_FALSE(counter->Count(i * 2654435761u, 3, at_limit));
+    }
+}
+
+TEST(MessageCounter, OverflowLongProbe) {
+    auto counter = std::make_unique<MessageCounter>();
+    // All in the same home slot, so the later ones do not find a slot within the probe distance
+    const uint32_t message_count = 64;
+    for (uint32_t i = 0; i < message_count; ++i) {
+        ASSERT_EQ(CountUntilRejected(*counter, 7 + (i << 16), 5), 5u);
+    }
+    for (uint32_t i = 0; i < message_count; ++i) {
+        bool at_limit = false;
+        ASSERT_FALSE(counter->Count(7 + (i << 16), 5, at_limit));
+    }
+}
+
+TEST(MessageCounter, ConcurrentCount) {
+    auto counter = std::make_unique<MessageCounter>();
+    const uint32_t thread_count = 8;
+    const uint32_t attempts = 2000;
+    const uint32_t limit = 5000;
+    // One message in the table, one in the overflow map (it shares the home slot of 16 others logged first)
+    const uint32_t table_hash = 0x10001;
+    const uint32_t overflow_hash = 3 + (100 << 16);
+    for (uint32_t i = 0; i < 16; ++i) {
+        bool at_limit = false;
+        ASSERT_TRUE(counter->Count(3 + (i << 16), limit, at_limit));
+    }
+
+    std::atomic<uint32_t> accepted[2] = {};
+    std::atomic<uint32_t> at_limit_count[2] = {};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&]() {
+            const uint32_t hashes[2] = {table_hash, overflow_hash};
+            for (uint32_t i = 0; i < attempts; ++i) {
+                for (uint32_t h = 0; h < 2; ++h) {
+                    bool at_limit = false;
+                    if (counter->Count(hashes[h], limit, at_limit)) {
+                        accepted[h]++;
+                    }
+                    if (at_limit) {
+                        at_limit_count[h]++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (uint32_t h = 0; h < 2; ++h) {
+        ASSERT_EQ(accepted[h].load(), limit);
+        ASSERT_EQ(at_limit_count[h].load(), 1u);
+    }
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+
+#include "containers/paged_array.h"
+
+TEST(CustomContainer, PagedArray) {
+    vvl::paged_array<uint32_t> values;
+    ASSERT_EQ(values.get(0), 0u);
+    ASSERT_EQ(values.get(1000000), 0u);
+
+    values.set(1, 7);
+    ASSERT_EQ(values.get(1), 7u);
+    ASSERT_EQ(values.get(0), 0u);
+    ASSERT_EQ(values.get(2), 0u);
+
+    // Values in other pages
+    for (uint32_t i = 63; i < 20000; i += 97) {
+        values.set(i, i * 2);
+    }
+    for (uint32_t i = 63; i < 20000; i += 97) {
+        ASSERT_EQ(values.get(i), i * 2);
+        ASSERT_EQ(values.get(i + 1), 0u);
+    }
+    values.set(0xFFFFFFFF, 3);
+    ASSERT_EQ(values.get(0xFFFFFFFF), 3u);
+    ASSERT_EQ(values.get(0xFFFFFFFE), 0u);
+
+    values.set(1, 0);
+    ASSERT_EQ(values.get(1), 0u);
+}
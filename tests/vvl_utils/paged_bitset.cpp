@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <cstdint>
+
+#include "containers/paged_bitset.h"
+
+TEST(CustomContainer, PagedBitset) {
+    vvl::paged_bitset<> bits;
+    ASSERT_FALSE(bits.test(0));
+    ASSERT_FALSE(bits.test(1000000));
+    ASSERT_FALSE(bits.reset(1000000));
+
+    ASSERT_TRUE(bits.set(1));
+    ASSERT_FALSE(bits.set(1));
+    ASSERT_TRUE(bits.test(1));
+    ASSERT_FALSE(bits.test(0));
+    ASSERT_FALSE(bits.test(2));
+
+    // Bits in other words and pages
+    for (uint32_t i = 63; i < 20000; i += 97) {
+        ASSERT_TRUE(bits.set(i));
+    }
+    for (uint32_t i = 63; i < 20000; i += 97) {
+        ASSERT_TRUE(bits.test(i));
+        ASSERT_FALSE(bits.test(i + 1));
+    }
+    ASSERT_TRUE(bits.set(0xFFFFFFFF));
+    ASSERT_TRUE(bits.test(0xFFFFFFFF));
+    ASSERT_FALSE(bits.test(0xFFFFFFFE));
+
+    for (uint32_t i = 63; i < 20000; i += 97) {
+        ASSERT_TRUE(bits.reset(i));
+        ASSERT_FALSE(bits.reset(i));
+        ASSERT_FALSE(bits.test(i));
+    }
+    ASSERT_TRUE(bits.test(1));
+    ASSERT_TRUE(bits.test(0xFFFFFFFF));
+}
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "../framework/benchmark.h"
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "containers/btree_map.h"
+#include "containers/range_map.h"
+
+using Range = vvl::range<uint64_t>;
+using StdRangeMap = sparse_container::range_map<uint64_t, uint64_t, std::map<Range, uint64_t>>;
+using BTreeRangeMap = sparse_container::range_map<uint64_t, uint64_t, vvl::btree_map<Range, uint64_t>>;
+
+template <typename MapA, typename MapB>
+static bool HaveSameEntries(const MapA& a, const MapB& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    auto it_b = b.begin();
+    for (const auto& entry : a) {
+        if (entry.first != it_b->first || entry.second != it_b->second) {
+            return false;
+        }
+        ++it_b;
+    }
+    return it_b == b.end();
+}
+
+// Applies the same random sequence of overwrites, erases and splits to both maps
+template <typename Map>
+static void RandomRangeOps(Map& map, uint32_t seed, uint32_t op_count, uint64_t address_space) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint64_t> address(0, address_space - 1);
+    std::uniform_int_distribution<uint64_t> length(1, 64);
+    std::uniform_int_distribution<uint32_t> op(0, 3);
+    for (uint32_t i = 0; i < op_count; ++i) {
+        const uint64_t begin = address(gen);
+        const Range range(begin, begin + length(gen));
+        switch (op(gen)) {
+            case 0:
+                map.erase_range(range);
+                break;
+            case 1: {
+                auto it = map.find(range.begin);
+                if (it != map.end()) {
+                    map.split(it, range.begin);
+                }
+                break;
+            }
+            default:
+                map.overwrite_range(std::make_pair(range, uint64_t(i)));
+                break;
+        }
+    }
+}
+
+TEST(CustomContainer, BTreeMapMatchesStdMap) {
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> key(0, 4000);
+    vvl::btree_map<int, int> btree;
+    std::map<int, int> reference;
+    for (int i = 0; i < 40000; ++i) {
+        const int k = key(gen);
+        if (i % 3 == 0) {
+            auto it = btree.find(k);
+            ASSERT_EQ(it == btree.end(), reference.find(k) == reference.end());
+            if (it != btree.end()) {
+                auto next = btree.erase(it);
+                auto ref_next = reference.erase(reference.find(k));
+                ASSERT_EQ(next == btree.end(), ref_next == reference.end());
+                if (next != btree.end()) {
+                    ASSERT_EQ(next->first, ref_next->first);
+                }
+            }
+        } else {
+            auto hint = btree.lower_bound(k);
+            btree.emplace_hint(hint, std::make_pair(k, i));
+            reference.emplace(k, i);
+        }
+    }
+    ASSERT_TRUE(HaveSameEntries(btree, reference));
+
+    // Reverse iteration
+    auto it = btree.end();
+    for (auto ref_it = reference.rbegin(); ref_it != reference.rend(); ++ref_it) {
+        --it;
+        ASSERT_EQ(it->first, ref_it->first);
+    }
+    ASSERT_TRUE(it == btree.begin());
+
+    auto copy = btree;
+    ASSERT_TRUE(HaveSameEntries(copy, reference));
+    btree.clear();
+    ASSERT_TRUE(btree.empty());
+    ASSERT_TRUE(HaveSameEntries(copy, reference));
+}
+
+TEST(CustomContainer, BTreeMapIteratorsSurviveModification) {
+    vvl::btree_map<int, int> btree;
+    for (int i = 0; i < 1000; i += 2) {
+        btree.emplace_hint(btree.end(), std::make_pair(i, i));
+    }
+    auto it = btree.find(500);
+    const auto end = btree.end();
+    // Splits the leaf holding 500 and moves the element
+    for (int i = 1; i < 1000; i += 2) {
+        btree.emplace_hint(btree.end(), std::make_pair(i, i));
+    }
+    ASSERT_EQ(it->first, 500);
+    ++it;
+    ASSERT_EQ(it->first, 501);
+    for (int i = 0; i < 500; ++i) {
+        btree.erase(btree.begin());
+    }
+    ASSERT_EQ(it->first, 501);
+    --it;
+    ASSERT_TRUE(it == btree.begin());
+    ASSERT_TRUE(end == btree.end());
+}
+
+TEST(CustomContainer, BTreeMapReferencesSurviveModification) {
+    // The sync barrier code keeps pointers to mapped values while it inserts into the same map
+    vvl::btree_map<int, int> btree;
+    for (int i = 0; i < 1000; i += 2) {
+        btree.emplace_hint(btree.end(), std::make_pair(i, i));
+    }
+    std::vector<std::pair<const int, int>*> values;
+    for (auto& entry : btree) {
+        values.emplace_back(&entry);
+    }
+    // Splits every leaf
+    for (int i = 1; i < 1000; i += 2) {
+        btree.insert(std::make_pair(i, i));
+    }
+    // Merges leaves
+    for (int i = 1; i < 1000; i += 2) {
+        btree.erase(btree.find(i));
+    }
+    ASSERT_EQ(values.size(), btree.size());
+    auto it = btree.begin();
+    for (auto* value : values) {
+        ASSERT_EQ(value, &*it);
+        ASSERT_EQ(value->first, value->second);
+        ++it;
+    }
+}
+
+TEST(CustomContainer, RangeMapBTreeMatchesStdMap) {
+    for (uint32_t seed = 0; seed < 8; ++seed) {
+        StdRangeMap std_map;
+        BTreeRangeMap btree_map;
+        RandomRangeOps(std_map, seed, 4000, 1 << 14);
+        RandomRangeOps(btree_map, seed, 4000, 1 << 14);
+        ASSERT_TRUE(HaveSameEntries(std_map, btree_map));
+
+        sparse_container::consolidate(std_map);
+        sparse_container::consolidate(btree_map);
+        ASSERT_TRUE(HaveSameEntries(std_map, btree_map));
+    }
+}
+
+TEST(CustomContainer, RangeMapInfillUpdate) {
+    struct Ops {
+        void infill(BTreeRangeMap& map, const BTreeRangeMap::iterator& pos, const Range& range) const {
+            map.insert(pos, std::make_pair(range, uint64_t(1)));
+        }
+        void update(const BTreeRangeMap::iterator& pos) const { pos->second++; }
+    };
+    BTreeRangeMap map;
+    for (uint64_t i = 0; i < 1024; i += 4) {
+        map.insert(std::make_pair(Range(i, i + 2), uint64_t(0)));
+    }
+    sparse_container::infill_update_range(map, Range(1, 1023), Ops());
+    ASSERT_EQ(map.begin()->first, Range(0, 1));
+    for (auto it = ++map.begin(); it != map.end(); ++it) {
+        // Existing ranges were updated from 0, gaps were filled with 1
+        ASSERT_EQ(it->second, 1u);
+    }
+}
+
+template <typename Map>
+static void CheckOverwriteSortedRun(uint32_t seed) {
+    Map bulk;
+    Map reference;
+    RandomRangeOps(bulk, seed, 2000, 1 << 12);
+    RandomRangeOps(reference, seed, 2000, 1 << 12);
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint64_t> gap(0, 16);
+    std::uniform_int_distribution<uint64_t> length(1, 32);
+    std::vector<typename Map::value_type> run;
+    uint64_t address = gap(gen);
+    while (address < (1 << 12)) {
+        const Range range(address, address + length(gen));
+        run.emplace_back(range, range.begin * 7);
+        address = range.end + gap(gen);
+    }
+
+    bulk.overwrite_sorted_run(run.begin(), run.end());
+    for (const auto& value : run) {
+        reference.overwrite_range(value);
+    }
+    ASSERT_TRUE(HaveSameEntries(bulk, reference));
+}
+
+TEST(CustomContainer, RangeMapOverwriteSortedRun) {
+    for (uint32_t seed = 0; seed < 8; ++seed) {
+        CheckOverwriteSortedRun<StdRangeMap>(seed);
+        CheckOverwriteSortedRun<BTreeRangeMap>(seed);
+    }
+}
+
+// Compares the std::map and B-tree backends on access patterns typical for the image layout and syncval maps
+template <typename Map>
+static double TimeRangeMap(void (*workload)(Map&)) {
+    Map map;
+    return benchmark::TimeMs([&]() { workload(map); });
+}
+
+template <typename Map>
+static void SplitWorkload(Map& map) {
+    // Whole resource, then fine grained per subresource updates
+    map.insert(std::make_pair(Range(0, 1 << 20), uint64_t(0)));
+    for (uint64_t i = 0; i < (1 << 20); i += 64) {
+        map.overwrite_range(std::make_pair(Range(i + 16, i + 48), i));
+    }
+}
+
+template <typename Map>
+static std::vector<typename Map::value_type> MakeSortedRun() {
+    std::vector<typename Map::value_type> run;
+    for (uint64_t i = 0; i < (1 << 20); i += 32) {
+        run.emplace_back(Range(i, i + 24), i);
+    }
+    return run;
+}
+
+template <typename Map>
+static void SortedRunWorkload(Map& map) {
+    const auto run = MakeSortedRun<Map>();
+    for (int pass = 0; pass < 8; ++pass) {
+        for (const auto& value : run) {
+            map.overwrite_range(value);
+        }
+    }
+}
+
+// Same updates as SortedRunWorkload, with one overwrite_sorted_run per pass
+template <typename Map>
+static void SortedRunSpliceWorkload(Map& map) {
+    const auto run = MakeSortedRun<Map>();
+    for (int pass = 0; pass < 8; ++pass) {
+        map.overwrite_sorted_run(run.begin(), run.end());
+    }
+}
+
+template <typename Map>
+static void RandomWorkload(Map& map) {
+    RandomRangeOps(map, 0, 200000, 1 << 20);
+}
+
+template <typename Map>
+static void LookupWorkload(Map& map) {
+    for (uint64_t i = 0; i < (1 << 20); i += 16) {
+        map.insert(std::make_pair(Range(i, i + 8), i));
+    }
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<uint64_t> address(0, (1 << 20) - 1);
+    uint64_t sum = 0;
+    for (int i = 0; i < 1000000; ++i) {
+        auto it = map.find(address(gen));
+        sum += (it != map.end()) ? it->second : 0;
+    }
+    for (const auto& entry : map) {
+        sum += entry.second;
+    }
+    ASSERT_NE(sum, 0u);
+}
+
+TEST(CustomContainer, DISABLED_RangeMapBenchmark) {
+    struct Workload {
+        const char* name;
+        void (*std_workload)(StdRangeMap&);
+        void (*btree_workload)(BTreeRangeMap&);
+    };
+    const Workload workloads[] = {
+        {"split", SplitWorkload<StdRangeMap>, SplitWorkload<BTreeRangeMap>},
+        {"sorted_run", SortedRunWorkload<StdRangeMap>, SortedRunWorkload<BTreeRangeMap>},
+        {"sorted_run_splice", SortedRunSpliceWorkload<StdRangeMap>, SortedRunSpliceWorkload<BTreeRangeMap>},
+        {"random_ops", RandomWorkload<StdRangeMap>, RandomWorkload<BTreeRangeMap>},
+        {"lookup", LookupWorkload<StdRangeMap>, LookupWorkload<BTreeRangeMap>},
+    };
+    for (const Workload& workload : workloads) {
+        benchmark::Report((std::string(workload.name) + ".std_map_ms").c_str(), TimeRangeMap(workload.std_workload));
+        benchmark::Report((std::string(workload.name) + ".btree_ms").c_str(), TimeRangeMap(workload.btree_workload));
+    }
+}
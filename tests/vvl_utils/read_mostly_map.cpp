@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "containers/read_mostly_map.h"
+
+TEST(CustomContainer, ReadMostlyMapBasic) {
+    vvl::read_mostly_map<uint64_t, int> map;
+    std::vector<int> values(1000);
+    ASSERT_EQ(map.find(1), nullptr);
+
+    for (uint64_t i = 1; i <= values.size(); ++i) {
+        map.insert_or_assign(i, &values[i - 1]);
+    }
+    for (uint64_t i = 1; i <= values.size(); ++i) {
+        ASSERT_EQ(map.find(i), &values[i - 1]);
+    }
+    ASSERT_EQ(map.find(values.size() + 1), nullptr);
+
+    // Erase every other entry, then re-insert with a different value (handle reuse)
+    for (uint64_t i = 1; i <= values.size(); i += 2) {
+        map.erase(i);
+    }
+    for (uint64_t i = 1; i <= values.size(); ++i) {
+        ASSERT_EQ(map.find(i), (i % 2) ? nullptr : &values[i - 1]);
+    }
+    for (uint64_t i = 1; i <= values.size(); i += 2) {
+        map.insert_or_assign(i, &values[0]);
+    }
+    for (uint64_t i = 1; i <= values.size(); i += 2) {
+        ASSERT_EQ(map.find(i), &values[0]);
+    }
+
+    map.clear();
+    ASSERT_EQ(map.find(2), nullptr);
+    map.insert_or_assign(2, &values[1]);
+    ASSERT_EQ(map.find(2), &values[1]);
+}
+
+TEST(CustomContainer, ReadMostlyMapConcurrentReaders) {
+    vvl::read_mostly_map<uint64_t, int> map;
+    constexpr uint64_t kStableCount = 256;
+    std::vector<int> values(kStableCount);
+    for (uint64_t i = 0; i < kStableCount; ++i) {
+        map.insert_or_assign(i + 1, &values[i]);
+    }
+
+    // Readers must always find the stable keys while the writer churns other keys, which rebuilds the table
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> errors{0};
+    std::vector<std::thread> readers;
+    for (uint32_t t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            while (!done.load(std::memory_order_relaxed)) {
+                for (uint64_t i = 0; i < kStableCount; ++i) {
+                    if (map.find(i + 1) != &values[i]) {
+                        errors.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+
+    int churn_value = 0;
+    for (uint64_t round = 0; round < 200; ++round) {
+        const uint64_t base = 1000 + round * 64;
+        for (uint64_t i = 0; i < 64; ++i) {
+            map.insert_or_assign(base + i, &churn_value);
+        }
+        for (uint64_t i = 0; i < 64; ++i) {
+            map.erase(base + i);
+        }
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(errors.load(), 0u);
+}
+
+TEST(CustomContainer, ReadMostlyMapReclaimUnderSteadyReaders) {
+    vvl::read_mostly_map<uint64_t, int> map;
+    int value = 0;
+    uint64_t key = 1;
+    map.insert_or_assign(key++, &value);
+
+    // There is always a read in progress, but each read ends, as with threads that keep looking up handles
+    vvl::ReaderCounters &readers = vvl::ReaderCounters::Get();
+    uint32_t parity = readers.Enter();
+    while (map.retired_table_count() == 0) {
+        map.insert_or_assign(key++, &value);
+    }
+    for (uint32_t i = 0; i < 8 && map.retired_table_count() != 0; ++i) {
+        const uint32_t next_parity = readers.Enter();
+        readers.Exit(parity);
+        parity = next_parity;
+        map.erase(1);
+    }
+    readers.Exit(parity);
+    ASSERT_EQ(map.retired_table_count(), 0u);
+}
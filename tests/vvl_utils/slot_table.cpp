@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include "../framework/benchmark.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "containers/custom_containers.h"
+#include "containers/slot_table.h"
+
+// Same layout as wrapped handles, [generation:16][index:24]
+static uint64_t SlotKey(uint32_t index, uint32_t generation) { return (uint64_t(generation) << 24) | index; }
+
+TEST(CustomContainer, SlotTableBasic) {
+    vvl::slot_table<uint64_t, 24> table;
+    uint64_t value = 0;
+    ASSERT_FALSE(table.find(0, SlotKey(0, 1), value));
+
+    for (uint32_t i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(table.insert(i, SlotKey(i, 1), i * 3));
+    }
+    for (uint32_t i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(table.find(i, SlotKey(i, 1), value));
+        ASSERT_EQ(value, i * 3);
+    }
+    // Entry is taken
+    ASSERT_FALSE(table.insert(5, SlotKey(5, 2), 0));
+
+    // Reuse an index with the next generation, the old key must not match anymore
+    ASSERT_TRUE(table.erase(5, SlotKey(5, 1), value));
+    ASSERT_EQ(value, 15u);
+    ASSERT_FALSE(table.erase(5, SlotKey(5, 1), value));
+    ASSERT_TRUE(table.insert(5, SlotKey(5, 2), 42));
+    ASSERT_FALSE(table.find(5, SlotKey(5, 1), value));
+    ASSERT_TRUE(table.find(5, SlotKey(5, 2), value));
+    ASSERT_EQ(value, 42u);
+
+    // Index far away from the others, in a page that does not exist yet
+    ASSERT_FALSE(table.find(vvl::slot_table<uint64_t, 24>::kMaxIndex, SlotKey(0xFFFFFF, 1), value));
+    ASSERT_TRUE(table.insert(vvl::slot_table<uint64_t, 24>::kMaxIndex, SlotKey(0xFFFFFF, 1), 7));
+    ASSERT_TRUE(table.find(vvl::slot_table<uint64_t, 24>::kMaxIndex, SlotKey(0xFFFFFF, 1), value));
+    ASSERT_EQ(value, 7u);
+}
+
+TEST(CustomContainer, SlotTableConcurrentReaders) {
+    vvl::slot_table<uint64_t, 24> table;
+    constexpr uint32_t kStableCount = 256;
+    for (uint32_t i = 0; i < kStableCount; ++i) {
+        table.insert(i, SlotKey(i, 1), i + 1);
+    }
+
+    // Readers must always find the stable keys, and never find a churned key with another key's value
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> errors{0};
+    std::vector<std::thread> readers;
+    for (uint32_t t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            uint64_t value = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                for (uint32_t i = 0; i < kStableCount; ++i) {
+                    if (!table.find(i, SlotKey(i, 1), value) || value != i + 1) {
+                        errors.fetch_add(1);
+                    }
+                }
+                for (uint32_t i = kStableCount; i < kStableCount + 64; ++i) {
+                    for (uint32_t generation = 1; generation < 4; ++generation) {
+                        if (table.find(i, SlotKey(i, generation), value) && value != SlotKey(i, generation)) {
+                            errors.fetch_add(1);
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    for (uint32_t round = 0; round < 2000; ++round) {
+        const uint32_t generation = 1 + round % 3;
+        for (uint32_t i = kStableCount; i < kStableCount + 64; ++i) {
+            table.insert(i, SlotKey(i, generation), SlotKey(i, generation));
+        }
+        uint64_t value = 0;
+        for (uint32_t i = kStableCount; i < kStableCount + 64; ++i) {
+            table.erase(i, SlotKey(i, generation), value);
+        }
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(errors.load(), 0u);
+}
+
+// Compares unwrapping handles through the slot table with the concurrent hash map it replaced
+TEST(CustomContainer, DISABLED_SlotTableBenchmark) {
+    constexpr uint32_t kHandleCount = 100000;
+    constexpr uint32_t kLookupRounds = 50;
+    constexpr uint32_t kThreadCount = 4;
+
+    vvl::slot_table<uint64_t, 24> table;
+    vvl::concurrent_unordered_map<uint64_t, uint64_t, 4> map;
+    std::vector<uint64_t> keys;
+    for (uint32_t i = 0; i < kHandleCount; ++i) {
+        keys.push_back(SlotKey(i, 1));
+        table.insert(i, keys.back(), i);
+        map.insert(keys.back(), i);
+    }
+
+    auto time_lookups = [&](auto &&lookup) {
+        std::atomic<uint64_t> sum{0};
+        const double ms = benchmark::TimeMs([&]() {
+            std::vector<std::thread> threads;
+            for (uint32_t t = 0; t < kThreadCount; ++t) {
+                threads.emplace_back([&]() {
+                    uint64_t local_sum = 0;
+                    for (uint32_t round = 0; round < kLookupRounds; ++round) {
+                        for (const uint64_t key : keys) {
+                            local_sum += lookup(key);
+                        }
+                    }
+                    sum += local_sum;
+                });
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+        });
+        EXPECT_NE(sum.load(), 0u);
+        return ms;
+    };
+
+    // kThreadCount threads each doing kHandleCount * kLookupRounds lookups
+    benchmark::Report("concurrent_unordered_map_ms", time_lookups([&](uint64_t key) {
+                          auto iter = map.find(key);
+                          return iter != map.end() ? iter->second : 0;
+                      }));
+    benchmark::Report("slot_table_ms", time_lookups([&](uint64_t key) {
+                          uint64_t value = 0;
+                          table.find(static_cast<uint32_t>(key) & 0xFFFFFF, key, value);
+                          return value;
+                      }));
+}